@@ -6,80 +6,39 @@
 #pragma comment (lib, "Release/zlib/zlib.lib")
 #endif
 
-// صڴmalloc, ʹʱҪfreeͷ
+// ѹ Czlib::compress ɵ, صڴmalloc, ʹʱҪfreeͷ
+// ͷ¼ԭʼȺѹ󳤶, ԭʼһλ, һνѹ
 LPBYTE EKrnln_uncompress(LPCVOID data, int size, int& pRetSize)
 {
-    if (!data)
+    pRetSize = 0;
+    const int offset = 10;  // 2ֽڱ־ + 4ֽԭʼ + 4ֽѹ󳤶
+    if (!data || size < offset)
         return 0;   // ѹΪ
 
-    pRetSize = 0;
-    LPINT pInt = (LPINT)data;
-    uLongf destLen = pInt[0];   // ǰ4ֽѹǰĳߴ
-    if (destLen < 0 || destLen > 10 * 1024 * 1024)
-        return 0;   // 10MĶΪ
+    LPBYTE pData = (LPBYTE)data;
+    const int srcLen = *(int*)(pData + 2);
+    const int dwLen = *(int*)(pData + 6);
+    if (*(short*)pData != 31082 || srcLen <= 0 || dwLen <= 0 || dwLen > size - offset)
+        return 0;   //  Czlib ѹ, ݲ
 
-    LPBYTE pStart = (LPBYTE)&pInt[1];   // ĲǱѹ
-    size -= 4;
-    LPBYTE ptr = (LPBYTE)malloc(destLen);
+    LPBYTE ptr = (LPBYTE)malloc(srcLen);
     if (!ptr)
         return 0;
 
-    int err = ::uncompress(ptr, &destLen, pStart, size);
-
-    // , Ǿӻߴ糢Խѹ
-    while (err == Z_BUF_ERROR)
-    {
-        destLen *= 2;
-        free(ptr);
-        ptr = (LPBYTE)malloc(destLen);
-        if (!ptr)
-            return 0;
-        err = ::uncompress(ptr, &destLen, pStart, size);
-    }
-    if (err != Z_OK)
+    uLongf destLen = (uLongf)srcLen;
+    int err = ::uncompress(ptr, &destLen, pData + offset, (uLong)dwLen);
+    if (err != Z_OK || destLen != (uLongf)srcLen)
     {
-        // ѹ, , ֱӷʧ
+        // ѹ߳Ⱥͼ¼Ĳһ, 
         free(ptr);
         return 0;
     }
-    pRetSize = destLen;
+    pRetSize = srcLen;
     return ptr;
 }
 
-void test11()
-{
-    BYTE data[] =
-    {
-        0x6A, 0x79, 0x3B, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00, 0x78, 0x9C, 0x01, 0x3B, 0x00, 0xC4, 0xFF, 0xB5, 0xDA, 0xCB, 0xC4, 0xB8, 0xF6, 0xB3, 0xC9, 0xD4, 0xB1, 0xBE, 0xCD, 0xCA,
-        0xC7, 0xD2, 0xAA, 0xD7, 0xAA, 0xBB, 0xBB, 0xB3, 0xC9, 0xB1, 0xE4, 0xC1, 0xBF, 0xB5, 0xC4, 0x64, 0x6C, 0x6C, 0xCD, 0xEA, 0xD5, 0xFB, 0xC2, 0xB7, 0xBE, 0xB6, 0x2C, 0x20, 0xCE,
-    };
-    int nBufferSize = sizeof(data);
-    uLongf sourceLen = nBufferSize;
-    uLongf destLen = (uLongf)(((double)(sourceLen + 12)) * 1.1);    // , Ҫԭʼݳһ
-    LPBYTE pBuffer = new BYTE[destLen + 4];
-    Bytef* ptr = (Bytef*)pBuffer;
-
-    memcpy(ptr, &nBufferSize, 4);
-    memset(ptr + 4, 0, destLen);
-
-    int err = ::compress(ptr + 4, &destLen, data, sourceLen);
-    if (err != Z_OK) 
-        return;
-    destLen += 4;
-
-    int unSize = 0;
-    //LPBYTE ppp = EKrnln_uncompress(ptr, destLen, unSize);
-
-    LPBYTE ppp = EKrnln_uncompress(data, nBufferSize, unSize);
-
-
-
-    return;
-}
-
 unsigned char* GetELibStlFneDllData(int* size)
 {
-    test11();
 #if defined(__COMPILE_FNR) || defined(__E_STATIC_LIB)
     // fnrlibĻ, ⲿִǲᱻ, , Ǿó
     MessageBoxA(0, "debug", "ô?", 0);
@@ -2835,13 +2794,8 @@ unsigned char* GetELibStlFneDllData(int* size)
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
     };
 
-    // ԼŪһzlib, Լװѹͽѹ
-    Czlib zlib;
-    uLongf len = sizeof(dll) / sizeof(dll[0]);
-
     // ѹ󷵻صһָ, ʹþָ̬, й©
-    ptr = zlib.uncompress(dll, &len);
-    retSize = (int)len; // ¼ѹĳߴ
+    ptr = EKrnln_uncompress(dll, (int)sizeof(dll), retSize);
     if ( size )
         *size = retSize;
     return ptr;
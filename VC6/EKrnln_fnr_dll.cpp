@@ -2758,13 +2758,8 @@ unsigned char* GetELibStlFnrDllData(int* size)
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
     };
 
-    // ԼŪһzlib, Լװѹͽѹ
-    Czlib zlib;
-    uLongf len = sizeof(dll) / sizeof(dll[0]);
-
     // ѹ󷵻صһָ, ʹþָ̬, й©
-    ptr = zlib.uncompress(dll, &len);
-    retSize = (int)len; // ¼ѹĳߴ
+    ptr = EKrnln_uncompress(dll, (int)sizeof(dll), retSize);
     if ( size )
         *size = retSize;
     return ptr;
@@ -11,12 +11,16 @@
 
 
 static IEKrnln g_call;
+static DWORD s_notifySys;   // dllǰյϵͳ֪ͨ, غתdll
 
 
+// dllڵһҪʱŽѹ, ֻ¼֪ͨϢ
 inline void init_call_dll()
 {
     if ( g_call ) return;
     g_call = IextEntry();
+    if ( g_call && s_notifySys )
+        g_call->NotifyLib(NL_SYS_NOTIFY_FUNCTION, s_notifySys, 0);
 }
 #ifndef __E_STATIC_LIB
 #define IEXT_DEF_STR(_index, _name, _remarks) (INT) ______E_FNENAME(IEXT_NAME(_index, _name)),
@@ -37,7 +41,9 @@ EXTERN_C INT WINAPI iext_ProcessNotifyLib_iext(INT nMsg, DWORD dwParam1, DWORD d
     // ʵֺĵĺ(char*[]), ֧־̬Ķ̬봦
     case NL_GET_CMD_FUNC_NAMES:
     {
-        g_call->NotifyLib(nMsg, (DWORD)"QQ121007124__Group_20752843", (DWORD)s_names);
+        init_call_dll();
+        if ( g_call )
+            g_call->NotifyLib(nMsg, (DWORD)"QQ121007124__Group_20752843", (DWORD)s_names);
         return (INT)s_names;
     }
     // شϵͳ֪ͨĺ(PFN_NOTIFY_LIB), ֧־̬Ķ̬봦
@@ -59,12 +65,17 @@ EXTERN_C INT WINAPI iext_ProcessNotifyLib_iext(INT nMsg, DWORD dwParam1, DWORD d
     // dwParam1: (PFN_NOTIFY_SYS)
     case NL_SYS_NOTIFY_FUNCTION:
     {
-        init_call_dll();
+        s_notifySys = dwParam1;
+        if ( !g_call )
+            return 0;
         break;
     }
     default:
         break;
     }
+    init_call_dll();
+    if ( !g_call )
+        return 0;
     return g_call->NotifyLib(nMsg, dwParam1, dwParam2);
     return 0;
 }
@@ -44,6 +44,27 @@ IEXT_SPACENAME_END
 #endif
 
 
+// ʱ __LOAD_TIME_BENCH__ ( /D__LOAD_TIME_BENCH__) ͳƽѹͼdllĺʱ, OutputDebugString
+#ifdef __LOAD_TIME_BENCH__
+static LONGLONG s_uncompressTicks;  // ѹdllݵĺʱ
+inline LONGLONG bench_now()
+{
+    LARGE_INTEGER now;
+    QueryPerformanceCounter(&now);
+    return now.QuadPart;
+}
+inline void bench_report(LONGLONG loadTicks)
+{
+    LARGE_INTEGER freq;
+    QueryPerformanceFrequency(&freq);
+    wchar_t text[260];
+    swprintf_s(text, L"չһ: ѹdll %.3f , ع %.3f \r\n",
+               (double)s_uncompressTicks * 1000 / freq.QuadPart, (double)loadTicks * 1000 / freq.QuadPart);
+    OutputDebugStringW(text);
+}
+#endif
+
+// һεʱŽѹ, صԼdllļʱߵ, õĽѹ
 static inline LPCVOID GetELibStlDllData(int* size)
 {
 
@@ -56,10 +77,16 @@ static inline LPCVOID GetELibStlDllData(int* size)
         return dll;
     }
 
+#ifdef __LOAD_TIME_BENCH__
+    const LONGLONG start = bench_now();
+#endif
 #if defined(__COMPILE_FNR) || defined(__E_STATIC_LIB)
     dll = GetELibStlFnrDllData(&retSize);
 #else
     dll = GetELibStlFneDllData(&retSize);
+#endif
+#ifdef __LOAD_TIME_BENCH__
+    s_uncompressTicks = bench_now() - start;
 #endif
     if ( size )*size = retSize;
     return dll;
@@ -148,7 +175,9 @@ IEKrnln IextEntry()
     PFN_CreateEKrnlnInterface pfn = 0;
     HMODULE hModule = 0;
     LPCVOID dll = 0;
-    GetELibStlDllData(0);
+#ifdef __LOAD_TIME_BENCH__
+    const LONGLONG loadStart = bench_now();
+#endif
 
 
 #if defined(_DBG_LOCAL)
@@ -220,7 +249,9 @@ IEKrnln IextEntry()
     if ( !pfn )
         return 0;
 
-    
+#ifdef __LOAD_TIME_BENCH__
+    bench_report(bench_now() - loadStart);
+#endif
 
     HMODULE hBase = 0;
     MEMORY_BASIC_INFORMATION mem = { 0 };
@@ -29,6 +29,9 @@ IEKrnln IextEntry();
 unsigned char* GetELibStlFneDllData(int* size);
 unsigned char* GetELibStlFnrDllData(int* size);
 
+// ѹ Czlib::compress ɵ, mallocڴ, ʧܷ0
+unsigned char* EKrnln_uncompress(const void* data, int size, int& pRetSize);
+
 
 
 
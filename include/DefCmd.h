@@ -366,6 +366,151 @@
 /*363*/ ,Fn_IsFileExistW/*ļǷW*/\
 /*364*/ ,Fn_GetHttpFile/*HTTPļW*/\
 /*365*/	,Fn_DowndLoadFile/*HTTPW*/\
+/*366*/ ,Fn_eStl_GetMd5ArrayW/*ȡժҪW*/\
+/*367*/ ,Fn_md5_structure/*MD5*/\
+/*368*/ ,Fn_md5_copy/*MD5*/\
+/*369*/ ,Fn_md5_destruct/*MD5*/\
+/*370*/ ,Fn_md5_update/**/\
+/*371*/ ,Fn_md5_final_str/*ȡժҪı*/\
+/*372*/ ,Fn_md5_final/*ȡժҪ*/\
+/*373*/ ,Fn_md5_reset/**/\
+/*374*/ ,Fn_eStl_GetHashW/*ȡݹϣW*/\
+/*375*/ ,Fn_eStl_GetHashArrayW/*ȡݹϣW*/\
+/*376*/ ,Fn_hasher_structure/*ϣ*/\
+/*377*/ ,Fn_hasher_copy/*ϣ*/\
+/*378*/ ,Fn_hasher_destruct/*ϣ*/\
+/*379*/ ,Fn_hasher_init/*ʼ*/\
+/*380*/ ,Fn_hasher_update/**/\
+/*381*/ ,Fn_hasher_final/*ȡժҪ*/\
+/*382*/ ,Fn_hasher_final_str/*ȡժҪı*/\
+/*383*/ ,Fn_hasher_reset/**/\
+/*384*/ ,hash_dir_W/*ȡĿ¼ļϣW*/\
+/*385*/ ,hash_files_W/*ȡļϣW*/\
+/*386*/ ,compress_file_W/*ѹļW*/\
+/*387*/ ,uncompress_file_W/*ѹļW*/\
+/*388*/ ,Fn_deflate_structure/*ѹ*/\
+/*389*/ ,Fn_deflate_copy/*ѹ*/\
+/*390*/ ,Fn_deflate_destruct/*ѹ*/\
+/*391*/ ,Fn_deflate_init/*ʼ*/\
+/*392*/ ,Fn_deflate_push/**/\
+/*393*/ ,Fn_deflate_flush/*ˢ*/\
+/*394*/ ,Fn_deflate_reset/**/\
+/*395*/ ,Fn_inflate_structure/*ѹ*/\
+/*396*/ ,Fn_inflate_copy/*ѹ*/\
+/*397*/ ,Fn_inflate_destruct/*ѹ*/\
+/*398*/ ,Fn_inflate_init/*ʼ*/\
+/*399*/ ,Fn_inflate_push/**/\
+/*400*/ ,Fn_inflate_finished/*Ƿ*/\
+/*401*/ ,Fn_inflate_error/*ȡ*/\
+/*402*/ ,Fn_inflate_reset/**/\
+/*403*/ ,parallel_compress/*ѹ*/\
+/*404*/ ,lz_compress/*ѹ*/\
+/*405*/ ,lz_uncompress/*ٽѹ*/\
+/*406*/ ,lz_compress_block/*ѹ*/\
+/*407*/ ,lz_uncompress_block/*ٽѹ*/\
+/*408*/ ,Fn_zip_structure/*ѹ*/\
+/*409*/ ,Fn_zip_copy/*ѹ*/\
+/*410*/ ,Fn_zip_destruct/*ѹ*/\
+/*411*/ ,Fn_zip_open/**/\
+/*412*/ ,Fn_zip_create/**/\
+/*413*/ ,Fn_zip_close/*ر*/\
+/*414*/ ,Fn_zip_count/*ȡļ*/\
+/*415*/ ,Fn_zip_list/*ȡļб*/\
+/*416*/ ,Fn_zip_find/*ļ*/\
+/*417*/ ,Fn_zip_name/*ȡļ*/\
+/*418*/ ,Fn_zip_size/*ȡļߴ*/\
+/*419*/ ,Fn_zip_time/*ȡ޸ʱ*/\
+/*420*/ ,Fn_zip_is_dir/*ǷΪĿ¼*/\
+/*421*/ ,Fn_zip_extract_bin/*ѹֽڼ*/\
+/*422*/ ,Fn_zip_extract_file/*ѹļ*/\
+/*423*/ ,Fn_zip_extract_all/*ȫѹ*/\
+/*424*/ ,Fn_zip_add_file/*ļ*/\
+/*425*/ ,Fn_zip_add_data/**/\
+/*426*/ ,Fn_zip_add_dir/*Ŀ¼*/\
+/*427*/ ,Fn_memfile_set_memory_limit/*ڴļ.ڴ*/\
+/*428*/ ,Fn_CFile_ReadLines/*ļд.W*/\
+/*429*/ ,Fn_mmap_structure/*ڴӳļ.*/\
+/*430*/ ,Fn_mmap_copy/*ڴӳļ.*/\
+/*431*/ ,Fn_mmap_destruct/*ڴӳļ.*/\
+/*432*/ ,Fn_mmap_open/*ڴӳļ.*/\
+/*433*/ ,Fn_mmap_close/*ڴӳļ.ر*/\
+/*434*/ ,Fn_mmap_size/*ڴӳļ.ȡߴ*/\
+/*435*/ ,Fn_mmap_set_window/*ڴӳļ.ôڳߴ*/\
+/*436*/ ,Fn_mmap_pointer/*ڴӳļ.ȡָ*/\
+/*437*/ ,Fn_mmap_read_bin/*ڴӳļ.ֽڼ*/\
+/*438*/ ,Fn_mmap_read_int/*ڴӳļ.*/\
+/*439*/ ,Fn_mmap_read_int64/*ڴӳļ.*/\
+/*440*/ ,Fn_mmap_read_double/*ڴӳļ.˫С*/\
+/*441*/ ,Fn_mmap_write/*ڴӳļ.дֽڼ*/\
+/*442*/ ,Fn_mmap_prefetch/*ڴӳļ.Ԥ*/\
+/*443*/ ,Fn_mmap_flush/*ڴӳļ.ˢ*/\
+/*444*/ ,Fn_aio_structure/*첽ļ.*/\
+/*445*/ ,Fn_aio_copy/*첽ļ.*/\
+/*446*/ ,Fn_aio_destruct/*첽ļ.*/\
+/*447*/ ,Fn_aio_open/*첽ļ.*/\
+/*448*/ ,Fn_aio_close/*첽ļ.ر*/\
+/*449*/ ,Fn_aio_submit_read/*첽ļ.ύ*/\
+/*450*/ ,Fn_aio_submit_write/*첽ļ.ύд*/\
+/*451*/ ,Fn_aio_submit_sync/*첽ļ.ύͬ*/\
+/*452*/ ,Fn_aio_wait/*첽ļ.ȴ*/\
+/*453*/ ,Fn_aio_outstanding/*첽ļ.ȡδ*/\
+/*454*/ ,Fn_lidx_structure/*.*/\
+/*455*/ ,Fn_lidx_copy/*.*/\
+/*456*/ ,Fn_lidx_destruct/*.*/\
+/*457*/ ,Fn_lidx_open/*.*/\
+/*458*/ ,Fn_lidx_close/*.ر*/\
+/*459*/ ,Fn_lidx_refresh/*.ˢ*/\
+/*460*/ ,Fn_lidx_count/*.ȡ*/\
+/*461*/ ,Fn_lidx_line/*.ȡ*/\
+/*462*/ ,Fn_lidx_lines/*.ȡ*/\
+/*463*/ ,Fn_lidx_offset/*.ȡλ*/\
+/*464*/ ,Fn_lidx_save/*.*/\
+/*465*/ ,Fn_DetectEncoding/**/\
+/*466*/ ,Fn_DetectFileEncoding/*ļ*/\
+/*467*/ ,Fn_ConvertEncoding/*ת*/\
+/*468*/ ,Fn_EncodingName/*ȡ*/\
+/*469*/ ,Fn_charconv_structure/*ת.*/\
+/*470*/ ,Fn_charconv_copy/*ת.*/\
+/*471*/ ,Fn_charconv_destruct/*ת.*/\
+/*472*/ ,Fn_charconv_init/*ת.ʼ*/\
+/*473*/ ,Fn_charconv_feed/*ת.ת*/\
+/*474*/ ,Fn_charconv_finish/*ת.*/\
+/*475*/ ,Fn_charconv_errors/*ת.ȡ*/\
+/*476*/ ,Fn_charconv_source/*ת.ȡԴ*/\
+/*477*/ ,Fn_remove_tree_W/*ɾW*/\
+/*478*/ ,Fn_copy_tree_W/*W*/\
+/*479*/ ,Fn_dirwalk_structure/*Ŀ¼.*/\
+/*480*/ ,Fn_dirwalk_copy/*Ŀ¼.*/\
+/*481*/ ,Fn_dirwalk_destruct/*Ŀ¼.*/\
+/*482*/ ,Fn_dirwalk_start/*Ŀ¼.ʼ*/\
+/*483*/ ,Fn_dirwalk_next/*Ŀ¼.ȡһ*/\
+/*484*/ ,Fn_dirwalk_done/*Ŀ¼.Ƿ*/\
+/*485*/ ,Fn_dirwalk_stop/*Ŀ¼.ֹͣ*/\
+/*486*/ ,Fn_dirwalk_found/*Ŀ¼.ȡҵ*/\
+/*487*/ ,Fn_dirwalk_errors/*Ŀ¼.ȡ*/\
+/*488*/ ,Fn_folder_monitor_structure/*Ŀ¼.*/\
+/*489*/ ,Fn_folder_monitor_copy/*Ŀ¼.*/\
+/*490*/ ,Fn_folder_monitor_destruct/*Ŀ¼.*/\
+/*491*/ ,Fn_folder_monitor_start/*Ŀ¼.ʼ*/\
+/*492*/ ,Fn_folder_monitor_poll/*Ŀ¼.ȡ¼*/\
+/*493*/ ,Fn_folder_monitor_wait/*Ŀ¼.ȴ*/\
+/*494*/ ,Fn_folder_monitor_stop/*Ŀ¼.ֹͣ*/\
+/*495*/ ,Fn_folder_monitor_running/*Ŀ¼.Ƿڼ*/\
+/*496*/ ,Fn_folder_monitor_overflows/*Ŀ¼.ȡ*/\
+/*497*/ ,Fn_fast_copy_W/*ٸļW*/\
+/*498*/ ,Fn_number_array_to_text/*ֵ鵽ıW*/\
+/*499*/ ,Fn_text_to_number_array/*ıֵW*/\
+/*500*/ ,Fn_format_date/*ʽW*/\
+/*501*/ ,Fn_parse_date/*W*/\
+/*502*/ ,Fn_iso_week/*ȡISOW*/\
+/*503*/ ,Fn_format_date_array/*鵽ıW*/\
+/*504*/ ,Fn_parse_date_array/*ı鵽W*/\
+/*505*/ ,Server_SendBatch/**/\
+/*506*/ ,Clinet_SendBatch/**/\
+/*507*/ ,Server_SetSendLimits/*÷ˮλ*/\
+/*508*/ ,Server_GetSendQueue/*ȡͶ*/\
+/*509*/ ,Clinet_SetSendLimits/*÷ˮλ*/\
+/*510*/ ,Clinet_GetSendQueue/*ȡͶ*/\
 
 #pragma endregion
 
@@ -401,7 +546,18 @@ CtCommandLink/*
 ,HexView_control/*ƿ*/\
 ,Obj_MemoryModule/*ڴģ*/\
 ,CtScintilla/*𻨱༭*/\
-,Obj_SkinSharp/*Ƥģ*/
+,Obj_SkinSharp/*Ƥģ*/\
+,Obj_Md5/*MD5*/\
+,Obj_Hasher/*ϣ*/\
+,Obj_Deflate/*ѹ*/\
+,Obj_Inflate/*ѹ*/\
+,Obj_Zip/*ѹ*/\
+,Obj_MappedFile/*ڴӳļ*/\
+,Obj_AsyncFile/*첽ļ*/\
+,Obj_LineIndex/**/\
+,Obj_CharsetConverter/*ת*/\
+,Obj_DirWalker/*Ŀ¼*/\
+,Obj_FolderMonitor/*Ŀ¼*/
 #pragma endregion
 
 
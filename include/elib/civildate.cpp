@@ -0,0 +1,537 @@
+#include "civildate.h"
+#include<cmath>
+
+namespace elibstl {
+	namespace datetime {
+		namespace {
+			/*18991230յ197011յ*/
+			constexpr std::int64_t kOleEpoch = -25569;
+			constexpr std::int64_t kMsPerDay = 86400000;
+
+			const wchar_t* const kWeekdayNames[] = { L"Sunday", L"Monday", L"Tuesday", L"Wednesday", L"Thursday", L"Friday", L"Saturday" };
+			const wchar_t* const kMonthNames[] = { L"January", L"February", L"March", L"April", L"May", L"June",
+				L"July", L"August", L"September", L"October", L"November", L"December" };
+
+			inline std::int64_t floor_div(std::int64_t a, std::int64_t b)
+			{
+				return a / b - ((a % b != 0) && ((a < 0) != (b < 0)));
+			}
+
+			inline int weekday_from_days(std::int64_t z)
+			{
+				return static_cast<int>(z >= -4 ? (z + 4) % 7 : (z + 5) % 7 + 6);
+			}
+
+			/*dateÿticks_per_day,õ1970͵ķ*/
+			bool split_ticks(double date, std::int64_t ticks_per_day, std::int64_t& z, std::int64_t& ticks)
+			{
+				if (!std::isfinite(date))
+					return false;
+				const double linear = to_linear(date);
+				if (linear < kMinLinear || linear >= kEndLinear)
+					return false;
+				const std::int64_t total = std::llround(linear * static_cast<double>(ticks_per_day));
+				const std::int64_t days = floor_div(total, ticks_per_day);
+				/*23:59:59.9996ʱܽ10000*/
+				if (days >= static_cast<std::int64_t>(kEndLinear))
+					return false;
+				ticks = total - days * ticks_per_day;
+				z = days + kOleEpoch;
+				return true;
+			}
+
+			bool from_days(std::int64_t z, double time, double& date)
+			{
+				const double linear = static_cast<double>(z - kOleEpoch) + time;
+				if (linear < kMinLinear || linear >= kEndLinear)
+					return false;
+				date = from_linear(linear);
+				return true;
+			}
+
+			void put_number(std::wstring& out, std::int64_t value, int width)
+			{
+				wchar_t buf[24];
+				int n = 0;
+				const bool negative = value < 0;
+				std::uint64_t v = negative ? 0 - static_cast<std::uint64_t>(value) : static_cast<std::uint64_t>(value);
+				do
+				{
+					buf[23 - n++] = static_cast<wchar_t>(L'0' + v % 10);
+					v /= 10;
+				} while (v != 0);
+				while (n < width)
+					buf[23 - n++] = L'0';
+				if (negative)
+					out.push_back(L'-');
+				out.append(buf + 24 - n, n);
+			}
+
+			inline wchar_t to_lower(wchar_t c)
+			{
+				return (c >= L'A' && c <= L'Z') ? static_cast<wchar_t>(c - L'A' + L'a') : c;
+			}
+			inline bool is_space(wchar_t c)
+			{
+				return c == L' ' || (c >= L'\t' && c <= L'\r') || c == 0x3000 || c == 0xA0;
+			}
+
+			/*ִСдƥwordǰ3ַ,ɹʱǰtext*/
+			bool match_name(std::wstring_view& text, std::wstring_view word)
+			{
+				auto matches = [&](size_t len) {
+					if (text.size() < len)
+						return false;
+					for (size_t i = 0; i < len; ++i)
+					{
+						if (to_lower(text[i]) != to_lower(word[i]))
+							return false;
+					}
+					return true;
+				};
+				if (matches(word.size()))
+				{
+					text.remove_prefix(word.size());
+					return true;
+				}
+				if (matches(3))
+				{
+					text.remove_prefix(3);
+					return true;
+				}
+				return false;
+			}
+
+			/*ȡmin_digitsmax_digitsλ,digitsΪʵʶλ*/
+			bool read_number(std::wstring_view& text, int min_digits, int max_digits, int& value, int* digits = nullptr)
+			{
+				int n = 0;
+				value = 0;
+				while (n < max_digits && static_cast<size_t>(n) < text.size() && text[n] >= L'0' && text[n] <= L'9')
+				{
+					value = value * 10 + (text[n] - L'0');
+					++n;
+				}
+				if (n < min_digits)
+					return false;
+				text.remove_prefix(n);
+				if (digits)
+					*digits = n;
+				return true;
+			}
+		}
+
+		std::int64_t days_from_civil(std::int64_t y, unsigned m, unsigned d)
+		{
+			y -= m <= 2;
+			const std::int64_t era = (y >= 0 ? y : y - 399) / 400;
+			const unsigned yoe = static_cast<unsigned>(y - era * 400);
+			const unsigned doy = (153 * (m > 2 ? m - 3 : m + 9) + 2) / 5 + d - 1;
+			const unsigned doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+			return era * 146097 + static_cast<std::int64_t>(doe) - 719468;
+		}
+
+		void civil_from_days(std::int64_t z, std::int64_t& y, unsigned& m, unsigned& d)
+		{
+			z += 719468;
+			const std::int64_t era = (z >= 0 ? z : z - 146096) / 146097;
+			const unsigned doe = static_cast<unsigned>(z - era * 146097);
+			const unsigned yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+			const unsigned doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+			const unsigned mp = (5 * doy + 2) / 153;
+			d = doy - (153 * mp + 2) / 5 + 1;
+			m = mp < 10 ? mp + 3 : mp - 9;
+			y = static_cast<std::int64_t>(yoe) + era * 400 + (m <= 2);
+		}
+
+		bool is_leap_year(std::int64_t y)
+		{
+			return y % 4 == 0 && (y % 100 != 0 || y % 400 == 0);
+		}
+
+		unsigned days_in_month(std::int64_t y, unsigned m)
+		{
+			static const unsigned char kDays[] = { 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+			return m == 2 && is_leap_year(y) ? 29u : kDays[(m - 1) % 12];
+		}
+
+		double to_linear(double date)
+		{
+			if (date >= 0)
+				return date;
+			const double day = std::ceil(date);
+			return day + (day - date);
+		}
+
+		double from_linear(double linear)
+		{
+			const double day = std::floor(linear);
+			if (day >= 0)
+				return linear;
+			return day - (linear - day);
+		}
+
+		bool split(double date, fields& out)
+		{
+			std::int64_t z, ms;
+			if (!split_ticks(date, kMsPerDay, z, ms))
+				return false;
+			std::int64_t y;
+			unsigned m, d;
+			civil_from_days(z, y, m, d);
+			out.year = static_cast<int>(y);
+			out.month = static_cast<int>(m);
+			out.day = static_cast<int>(d);
+			out.hour = static_cast<int>(ms / 3600000);
+			out.minute = static_cast<int>(ms / 60000 % 60);
+			out.second = static_cast<int>(ms / 1000 % 60);
+			out.millisecond = static_cast<int>(ms % 1000);
+			out.weekday = weekday_from_days(z);
+			out.yday = static_cast<int>(z - days_from_civil(y, 1, 1));
+			return true;
+		}
+
+		bool join(const fields& f, double& date)
+		{
+			const std::int64_t months = static_cast<std::int64_t>(f.year) * 12 + (f.month - 1);
+			const std::int64_t y = floor_div(months, 12);
+			const unsigned m = static_cast<unsigned>(months - y * 12 + 1);
+			std::int64_t z = days_from_civil(y, m, 1) + (f.day - 1);
+			std::int64_t ms = ((static_cast<std::int64_t>(f.hour) * 60 + f.minute) * 60 + f.second) * 1000 + f.millisecond;
+			const std::int64_t carry = floor_div(ms, kMsPerDay);
+			z += carry;
+			ms -= carry * kMsPerDay;
+			return from_days(z, static_cast<double>(ms) / kMsPerDay, date);
+		}
+
+		bool add_months(double date, int months, double& result)
+		{
+			if (!std::isfinite(date))
+				return false;
+			const double linear = to_linear(date);
+			if (linear < kMinLinear || linear >= kEndLinear)
+				return false;
+			const double day = std::floor(linear);
+			std::int64_t y;
+			unsigned m, d;
+			civil_from_days(static_cast<std::int64_t>(day) + kOleEpoch, y, m, d);
+			const std::int64_t total = y * 12 + (m - 1) + months;
+			y = floor_div(total, 12);
+			m = static_cast<unsigned>(total - y * 12 + 1);
+			const unsigned last = days_in_month(y, m);
+			if (d > last)
+				d = last;
+			return from_days(days_from_civil(y, m, d), linear - day, result);
+		}
+
+		bool add_days(double date, double days, double& result)
+		{
+			if (!std::isfinite(date) || !std::isfinite(days))
+				return false;
+			const double linear = to_linear(date) + days;
+			if (linear < kMinLinear || linear >= kEndLinear)
+				return false;
+			result = from_linear(linear);
+			return true;
+		}
+
+		int weekday(double date)
+		{
+			std::int64_t z, ms;
+			if (!split_ticks(date, kMsPerDay, z, ms))
+				return -1;
+			return weekday_from_days(z);
+		}
+
+		int iso_week(double date, int* iso_year)
+		{
+			std::int64_t z, ms;
+			if (!split_ticks(date, kMsPerDay, z, ms))
+				return 0;
+			/*ISOһʼ,һڵ*/
+			const int wd = weekday_from_days(z);
+			const std::int64_t thursday = z - (wd == 0 ? 6 : wd - 1) + 3;
+			std::int64_t y;
+			unsigned m, d;
+			civil_from_days(thursday, y, m, d);
+			if (iso_year)
+				*iso_year = static_cast<int>(y);
+			return static_cast<int>((thursday - days_from_civil(y, 1, 1)) / 7 + 1);
+		}
+
+		bool format(double date, std::wstring_view fmt, std::wstring& out)
+		{
+			fields f;
+			if (!split(date, f))
+				return false;
+			out.reserve(out.size() + fmt.size() + 16);
+			for (size_t i = 0; i < fmt.size(); ++i)
+			{
+				const wchar_t c = fmt[i];
+				if (c != L'%' || i + 1 == fmt.size())
+				{
+					out.push_back(c);
+					continue;
+				}
+				switch (fmt[++i])
+				{
+				case L'Y': put_number(out, f.year, 4); break;
+				case L'y': put_number(out, f.year % 100, 2); break;
+				case L'm': put_number(out, f.month, 2); break;
+				case L'd': put_number(out, f.day, 2); break;
+				case L'e': put_number(out, f.day, 1); break;
+				case L'H': put_number(out, f.hour, 2); break;
+				case L'I': put_number(out, f.hour % 12 == 0 ? 12 : f.hour % 12, 2); break;
+				case L'M': put_number(out, f.minute, 2); break;
+				case L'S': put_number(out, f.second, 2); break;
+				case L'L': put_number(out, f.millisecond, 3); break;
+				case L'p': out.append(f.hour < 12 ? L"AM" : L"PM"); break;
+				case L'j': put_number(out, f.yday + 1, 3); break;
+				case L'a': out.append(kWeekdayNames[f.weekday], 3); break;
+				case L'A': out.append(kWeekdayNames[f.weekday]); break;
+				case L'b': out.append(kMonthNames[f.month - 1], 3); break;
+				case L'B': out.append(kMonthNames[f.month - 1]); break;
+				case L'u': put_number(out, f.weekday == 0 ? 7 : f.weekday, 1); break;
+				case L'w': put_number(out, f.weekday, 1); break;
+				case L'V': put_number(out, iso_week(date), 2); break;
+				case L'G':
+				{
+					int y = 0;
+					iso_week(date, &y);
+					put_number(out, y, 4);
+					break;
+				}
+				case L'F':
+					put_number(out, f.year, 4);
+					out.push_back(L'-');
+					put_number(out, f.month, 2);
+					out.push_back(L'-');
+					put_number(out, f.day, 2);
+					break;
+				case L'T':
+					put_number(out, f.hour, 2);
+					out.push_back(L':');
+					put_number(out, f.minute, 2);
+					out.push_back(L':');
+					put_number(out, f.second, 2);
+					break;
+				case L'%': out.push_back(L'%'); break;
+				default:
+					out.push_back(L'%');
+					out.push_back(fmt[i]);
+					break;
+				}
+			}
+			return true;
+		}
+
+		std::wstring to_wstring(double date)
+		{
+			/*ԭȾVariantTimeToSystemTimeʱһ뵽*/
+			std::int64_t z, s;
+			if (!split_ticks(date, 86400, z, s))
+				return {};
+			std::int64_t y;
+			unsigned m, d;
+			civil_from_days(z, y, m, d);
+			const int hour = static_cast<int>(s / 3600), minute = static_cast<int>(s / 60 % 60), second = static_cast<int>(s % 60);
+
+			std::wstring out;
+			out.reserve(24);
+			put_number(out, y, 1);
+			out.push_back(L'');
+			put_number(out, m, 1);
+			out.push_back(L'');
+			put_number(out, d, 1);
+			out.push_back(L'');
+			if (second || minute || hour)
+			{
+				put_number(out, hour, 1);
+				out.push_back(L'ʱ');
+				if (second || minute)
+				{
+					put_number(out, minute, 1);
+					out.push_back(L'');
+					if (second)
+					{
+						put_number(out, second, 1);
+						out.push_back(L'');
+					}
+				}
+			}
+			return out;
+		}
+
+		bool parse(std::wstring_view text, std::wstring_view fmt, double& date)
+		{
+			fields f;
+			f.month = 1;
+			f.day = 1;
+			bool has_year = false, has_date = false, has_yday = false, hour12 = false;
+			int pm = -1;
+			int yday = 0;
+			for (size_t i = 0; i < fmt.size(); ++i)
+			{
+				const wchar_t c = fmt[i];
+				if (is_space(c))
+				{
+					while (!text.empty() && is_space(text.front()))
+						text.remove_prefix(1);
+					continue;
+				}
+				if (c != L'%' || i + 1 == fmt.size() || fmt[i + 1] == L'%')
+				{
+					if (c == L'%' && i + 1 != fmt.size())
+						++i;
+					if (text.empty() || text.front() != c)
+						return false;
+					text.remove_prefix(1);
+					continue;
+				}
+				int value = 0, digits = 0;
+				switch (fmt[++i])
+				{
+				case L'Y':
+					if (!read_number(text, 1, 4, f.year))
+						return false;
+					has_year = has_date = true;
+					break;
+				case L'y':
+					if (!read_number(text, 2, 2, value))
+						return false;
+					/*POSIXͬ,69Ϊ19xx*/
+					f.year = value < 69 ? 2000 + value : 1900 + value;
+					has_year = has_date = true;
+					break;
+				case L'm':
+					if (!read_number(text, 1, 2, f.month) || f.month < 1 || f.month > 12)
+						return false;
+					has_date = true;
+					break;
+				case L'b':
+				case L'B':
+				{
+					int k = 0;
+					while (k < 12 && !match_name(text, kMonthNames[k]))
+						++k;
+					if (k == 12)
+						return false;
+					f.month = k + 1;
+					has_date = true;
+					break;
+				}
+				case L'a':
+				case L'A':
+				{
+					int k = 0;
+					while (k < 7 && !match_name(text, kWeekdayNames[k]))
+						++k;
+					if (k == 7)
+						return false;
+					break;
+				}
+				case L'd':
+				case L'e':
+					if (!read_number(text, 1, 2, f.day) || f.day < 1)
+						return false;
+					has_date = true;
+					break;
+				case L'j':
+					if (!read_number(text, 1, 3, yday) || yday < 1 || yday > 366)
+						return false;
+					has_yday = has_date = true;
+					break;
+				case L'H':
+					if (!read_number(text, 1, 2, f.hour) || f.hour > 23)
+						return false;
+					break;
+				case L'I':
+					if (!read_number(text, 1, 2, f.hour) || f.hour < 1 || f.hour > 12)
+						return false;
+					hour12 = true;
+					break;
+				case L'M':
+					if (!read_number(text, 1, 2, f.minute) || f.minute > 59)
+						return false;
+					break;
+				case L'S':
+					if (!read_number(text, 1, 2, f.second) || f.second > 59)
+						return false;
+					break;
+				case L'L':
+					if (!read_number(text, 1, 3, f.millisecond, &digits))
+						return false;
+					for (; digits < 3; ++digits)
+						f.millisecond *= 10;
+					break;
+				case L'p':
+					if (text.size() >= 2 && (to_lower(text[0]) == L'a' || to_lower(text[0]) == L'p') && to_lower(text[1]) == L'm')
+						pm = to_lower(text[0]) == L'p';
+					else if (text.size() >= 2 && text[1] == L'' && (text[0] == L'' || text[0] == L''))
+						pm = text[0] == L'';
+					else
+						return false;
+					text.remove_prefix(2);
+					break;
+				case L'F':
+					if (!read_number(text, 1, 4, f.year) || text.empty() || text.front() != L'-')
+						return false;
+					text.remove_prefix(1);
+					if (!read_number(text, 1, 2, f.month) || f.month < 1 || f.month > 12 || text.empty() || text.front() != L'-')
+						return false;
+					text.remove_prefix(1);
+					if (!read_number(text, 1, 2, f.day) || f.day < 1)
+						return false;
+					has_year = has_date = true;
+					break;
+				case L'T':
+					if (!read_number(text, 1, 2, f.hour) || f.hour > 23 || text.empty() || text.front() != L':')
+						return false;
+					text.remove_prefix(1);
+					if (!read_number(text, 1, 2, f.minute) || f.minute > 59 || text.empty() || text.front() != L':')
+						return false;
+					text.remove_prefix(1);
+					if (!read_number(text, 1, 2, f.second) || f.second > 59)
+						return false;
+					break;
+				default:
+					return false;
+				}
+			}
+			while (!text.empty() && is_space(text.front()))
+				text.remove_prefix(1);
+			if (!text.empty())
+				return false;
+
+			if (pm >= 0)
+			{
+				if (hour12 || f.hour <= 12)
+					f.hour = f.hour % 12 + (pm ? 12 : 0);
+			}
+			if (!has_date)
+			{
+				/*ֻʱ,ڲΪ0*/
+				f.year = 1899;
+				f.month = 12;
+				f.day = 30;
+			}
+			else
+			{
+				if (!has_year)
+					return false;
+				if (has_yday)
+				{
+					if (yday > (is_leap_year(f.year) ? 366 : 365))
+						return false;
+					f.month = 1;
+					f.day = yday;
+				}
+				else if (static_cast<unsigned>(f.day) > days_in_month(f.year, static_cast<unsigned>(f.month)))
+				{
+					return false;
+				}
+			}
+			return join(f, date);
+		}
+	}
+}
@@ -0,0 +1,78 @@
+#pragma once
+#include<cstddef>
+#include<cstdint>
+#include<string>
+#include<string_view>
+
+/*
+* ʱ(OLE DATE)Ļ,SYSTEMTIME,ϵͳAPI.
+* OLE DATEΪ18991230,СΪһеʱ;Ϊʱǰ,СԱʾʱ,
+* -1.25189912296ʱ2818ʱ.ȰԵټ.
+* ĻʹHoward Hinnantcivil_from_days/days_from_civil㷨,ûвѭ.
+*/
+namespace elibstl {
+	namespace datetime {
+		struct fields
+		{
+			int year = 1899;
+			int month = 12;       /*1-12*/
+			int day = 30;         /*1-31*/
+			int hour = 0;
+			int minute = 0;
+			int second = 0;
+			int millisecond = 0;
+			int weekday = 6;      /*0Ϊ*/
+			int yday = 364;       /*һеĵڼ,0Ϊ11*/
+		};
+
+		/*ʱ͵ȡֵΧΪ10011յ99991231,ΪӦ*/
+		constexpr double kMinLinear = -657434.0;  /*10011*/
+		constexpr double kEndLinear = 2958466.0;  /*1000011,*/
+
+		/*197011*/
+		std::int64_t days_from_civil(std::int64_t y, unsigned m, unsigned d);
+		void civil_from_days(std::int64_t z, std::int64_t& y, unsigned& m, unsigned& d);
+		unsigned days_in_month(std::int64_t y, unsigned m);
+		bool is_leap_year(std::int64_t y);
+
+		/*OLE DATE(189912300ʱΪ0,ʱ̲֮)Ļ*/
+		double to_linear(double date);
+		double from_linear(double linear);
+
+		/*ֵ,;ڷΧʱؼ*/
+		bool split(double date, fields& out);
+		/*
+		* ɸֶ,weekdayyday.Χֶλλλ,13Ϊһ1,0Ϊһ,
+		* 25ʱΪһ1ʱ.ڷΧʱؼ.
+		*/
+		bool join(const fields& f, double& date);
+
+		/*,ԭڳĿ·ݵʱȡһ,ʱ̲*/
+		bool add_months(double date, int months, double& result);
+		/*,ԴС*/
+		bool add_days(double date, double days, double& result);
+		/*0Ϊ*/
+		int weekday(double date);
+		/*ISO 8601(1-53),iso_yearΪ,Ϊnullptr*/
+		int iso_week(double date, int* iso_year = nullptr);
+
+		/*
+		* ʽ׷ı,ʽCstrftimeͬҲӰ:
+		* %Y %yλ %m %d %e(0) %Hʱ %IʮСʱ %M %S %L(3λ) %p AM/PM
+		* %jһеĵڼ %a/%AڵӢд/ȫ %b/%B·ݵӢд/ȫ %u(1Ϊһ) %w(0Ϊ)
+		* %V ISO %G ISO %F%Y-%m-%d %T%H:%M:%S %%Ϊ%,ַԭ.
+		* dateЧʱؼҲ޸out.
+		*/
+		bool format(double date, std::wstring_view fmt, std::wstring& out);
+		/*"ı"ͬд:2024123ʱ45,ʱΪ0ĲְԭĹʡ*/
+		std::wstring to_wstring(double date);
+
+		/*
+		* formatĸʽȡ,֧%Y %y %m %d %e %H %I %M %S %L %p %j %b %B %a %A %F %T %%.
+		* ֿԲ0;ʽеĿհƥհ;%p""/"".
+		* ʽֻʱʱڲΪ0(18991230);ʱ,ûи¡ȡ1,ʱȡ0.
+		* ı(ĩβհ)ҪƥЧŷ.
+		*/
+		bool parse(std::wstring_view text, std::wstring_view fmt, double& date);
+	}
+}
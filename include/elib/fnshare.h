@@ -1,5 +1,7 @@
 #include "lib2.h"
 #include"PublicIDEFunctions.h"
+#include"numtext.h"
+#include"civildate.h"
 typedef INT(cdecl* PFN_ON_SYS_NOTIFY) (INT nMsg, DWORD dwParam1, DWORD dwParam2);
 #ifndef _private
 #define _private  //ʶΪֻ˽
@@ -528,6 +530,21 @@ namespace elibstl
 		memcpy(p + 2, ewstr.data(), sizeof(LPBYTE) * ewstr.size());
 		return p;
 	}
+	/*ͷŲοԭеı鲢ÿ,֮ɰcreate_text_arrayĽд*/
+	inline void free_text_array_var(void** ppAryData)
+	{
+		if (!*ppAryData)
+			return;
+		size_t count = 0;
+		auto pText = elibstl::get_array_element_inf<void**>(*ppAryData, &count);
+		for (size_t i = 0; i < count; i++)
+		{
+			if (pText[i])
+				elibstl::efree(pText[i]);
+		}
+		elibstl::efree(*ppAryData);
+		*ppAryData = NULL;
+	}
 
 	inline std::wstring utf82utf16(const char* utf8str) {
 		int len = MultiByteToWideChar(CP_UTF8, 0, utf8str, -1, nullptr, 0);
@@ -604,13 +621,13 @@ namespace elibstl
 			*pArgInf->m_pInt = _wtoi(str.c_str());
 			break;
 		case SDT_INT64:
-			*pArgInf->m_pInt64 = _wtoi64(str.c_str());
+			*pArgInf->m_pInt64 = numtext::to_int64(str.c_str());
 			break;
 		case SDT_FLOAT:
-			*pArgInf->m_pFloat = (FLOAT)_wtof(str.c_str());
+			*pArgInf->m_pFloat = numtext::to_float(str.c_str());
 			break;
 		case SDT_DOUBLE:
-			*pArgInf->m_pDouble = _wtof(str.c_str());
+			*pArgInf->m_pDouble = numtext::to_double(str.c_str());
 			break;
 		default:
 			return false;
@@ -711,17 +728,10 @@ namespace elibstl
 				return  std::to_wstring(pArgInf.m_int64);
 			}
 			else if (pArgInf.m_dtDataType == SDT_FLOAT) {
-				str = std::to_wstring(pArgInf.m_float);
-				str = str.substr(0, str.find_last_not_of(L'0') + 1);
-				if (str.back() == L'.')
-					str.pop_back();
+				return numtext::to_wstring(pArgInf.m_float);
 			}
 			else if (pArgInf.m_dtDataType == SDT_DOUBLE) {
-				str = std::to_wstring(pArgInf.m_double);
-				str = str.substr(0, str.find_last_not_of(L'0') + 1);
-				if (str.back() == L'.')
-					str.pop_back();
-
+				return numtext::to_wstring(pArgInf.m_double);
 			}
 			else if (pArgInf.m_dtDataType == SDT_BOOL) {
 				if (pArgInf.m_bool)
@@ -737,26 +747,7 @@ namespace elibstl
 				}
 			}
 			else if (pArgInf.m_dtDataType == SDT_DATE_TIME) {
-
-				wchar_t temp[MAX_PATH]{ 0 };
-				SYSTEMTIME st = { 0 };
-				VariantTimeToSystemTime(pArgInf.m_double, &st);
-				wchar_t strFormat[128]{ 0 };
-				wcscpy_s(strFormat, L"%d%d%d");
-				//ʽʱ䲿
-				wchar_t strFormatTime[128]{ 0 };
-				if (st.wSecond)
-					wcscpy_s(strFormatTime, L"%dʱ%d%d");
-				else if (st.wMinute && st.wSecond == 0)
-					wcscpy_s(strFormatTime, L"%dʱ%d");
-				else if (st.wHour && st.wMinute == 0 && st.wSecond == 0)
-					wcscpy_s(strFormatTime, L"%dʱ");
-				else
-					strFormatTime[0] = L'\0';
-				wcscat_s(strFormat, strFormatTime);
-				wsprintfW(temp, strFormat, st.wYear, st.wMonth, st.wDay, st.wHour, st.wMinute, st.wSecond);
-				return temp;
-
+				return datetime::to_wstring(pArgInf.m_double);
 			}
 			return str;
 		}
@@ -855,17 +846,10 @@ namespace elibstl
 				return  std::to_wstring(pArgInf.m_int64);
 			}
 			else if (pArgInf.m_dtDataType == SDT_FLOAT) {
-				str = std::to_wstring(pArgInf.m_float);
-				str = str.substr(0, str.find_last_not_of(L'0') + 1);
-				if (str.back() == L'.')
-					str.pop_back();
+				return numtext::to_wstring(pArgInf.m_float);
 			}
 			else if (pArgInf.m_dtDataType == SDT_DOUBLE) {
-				str = std::to_wstring(pArgInf.m_double);
-				str = str.substr(0, str.find_last_not_of(L'0') + 1);
-				if (str.back() == L'.')
-					str.pop_back();
-
+				return numtext::to_wstring(pArgInf.m_double);
 			}
 			else if (pArgInf.m_dtDataType == SDT_BOOL) {
 				if (pArgInf.m_bool)
@@ -894,26 +878,7 @@ namespace elibstl
 				return ret;*/
 			}
 			else if (pArgInf.m_dtDataType == SDT_DATE_TIME) {
-
-				wchar_t temp[MAX_PATH]{ 0 };
-				SYSTEMTIME st = { 0 };
-				VariantTimeToSystemTime(pArgInf.m_double, &st);
-				wchar_t strFormat[128]{ 0 };
-				wcscpy_s(strFormat, L"%d%d%d");
-				//ʽʱ䲿
-				wchar_t strFormatTime[128]{ 0 };
-				if (st.wSecond)
-					wcscpy_s(strFormatTime, L"%dʱ%d%d");
-				else if (st.wMinute && st.wSecond == 0)
-					wcscpy_s(strFormatTime, L"%dʱ%d");
-				else if (st.wHour && st.wMinute == 0 && st.wSecond == 0)
-					wcscpy_s(strFormatTime, L"%dʱ");
-				else
-					strFormatTime[0] = L'\0';
-				wcscat_s(strFormat, strFormatTime);
-				wsprintfW(temp, strFormat, st.wYear, st.wMonth, st.wDay, st.wHour, st.wMinute, st.wSecond);
-				return temp;
-
+				return datetime::to_wstring(pArgInf.m_double);
 			}
 			return str;
 		}
@@ -0,0 +1,921 @@
+#include "numtext.h"
+#include<cfloat>
+#include<clocale>
+#include<cmath>
+#include<cstdlib>
+#include<cstring>
+#include<cwchar>
+#include<limits>
+#if defined(_MSC_VER)
+#include<intrin.h>
+#endif
+
+/*
+* ְUlf AdamsRyu(PLDI 2018)ʵ,ȡְClinger·Daniel LemireEisel-Lemire㷨ʵ,
+* õ5ݱnumtext_tables.cppṩ.
+*/
+namespace elibstl {
+	namespace numtext {
+		using namespace detail;
+
+		namespace {
+			constexpr int kDoubleMantissaBits = 52;
+			constexpr int kDoubleBias = 1023;
+			constexpr int kDoublePow5InvBitCount = 125;
+			constexpr int kDoublePow5BitCount = 125;
+			constexpr int kFloatMantissaBits = 23;
+			constexpr int kFloatBias = 127;
+			constexpr int kFloatPow5InvBitCount = 59;
+			constexpr int kFloatPow5BitCount = 61;
+
+			inline std::uint64_t double_to_bits(double d)
+			{
+				std::uint64_t bits;
+				std::memcpy(&bits, &d, sizeof(bits));
+				return bits;
+			}
+			inline double bits_to_double(std::uint64_t bits)
+			{
+				double d;
+				std::memcpy(&d, &bits, sizeof(d));
+				return d;
+			}
+			inline std::uint32_t float_to_bits(float f)
+			{
+				std::uint32_t bits;
+				std::memcpy(&bits, &f, sizeof(bits));
+				return bits;
+			}
+
+			/*a*bĵ64λ,64λдhi*/
+			inline std::uint64_t umul128(std::uint64_t a, std::uint64_t b, std::uint64_t* hi)
+			{
+#if defined(__SIZEOF_INT128__)
+				const unsigned __int128 p = static_cast<unsigned __int128>(a) * b;
+				*hi = static_cast<std::uint64_t>(p >> 64);
+				return static_cast<std::uint64_t>(p);
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_ARM64))
+#if defined(_M_X64)
+				return _umul128(a, b, hi);
+#else
+				* hi = __umulh(a, b);
+				return a * b;
+#endif
+#else
+				/*32λĿϲĸ32λ˷*/
+				const std::uint64_t a_lo = static_cast<std::uint32_t>(a), a_hi = a >> 32;
+				const std::uint64_t b_lo = static_cast<std::uint32_t>(b), b_hi = b >> 32;
+				const std::uint64_t b00 = a_lo * b_lo, b01 = a_lo * b_hi;
+				const std::uint64_t b10 = a_hi * b_lo, b11 = a_hi * b_hi;
+				const std::uint64_t mid1 = b10 + (b00 >> 32);
+				const std::uint64_t mid2 = b01 + static_cast<std::uint32_t>(mid1);
+				*hi = b11 + (mid1 >> 32) + (mid2 >> 32);
+				return (mid2 << 32) | static_cast<std::uint32_t>(b00);
+#endif
+			}
+
+			/*0 < dist < 64*/
+			inline std::uint64_t shiftright128(std::uint64_t lo, std::uint64_t hi, int dist)
+			{
+				return (hi << (64 - dist)) | (lo >> dist);
+			}
+
+			inline int count_leading_zeros(std::uint64_t v)
+			{
+				int n = 0;
+				if ((v >> 32) == 0) { n += 32; v <<= 32; }
+				if ((v >> 48) == 0) { n += 16; v <<= 16; }
+				if ((v >> 56) == 0) { n += 8; v <<= 8; }
+				if ((v >> 60) == 0) { n += 4; v <<= 4; }
+				if ((v >> 62) == 0) { n += 2; v <<= 2; }
+				if ((v >> 63) == 0) { n += 1; }
+				return n;
+			}
+
+			/*ceil(log2(5^e)),eΪ0ʱΪ1*/
+			inline int pow5bits(int e)
+			{
+				return static_cast<int>((static_cast<std::uint32_t>(e) * 1217359) >> 19) + 1;
+			}
+			/*floor(log10(2^e))*/
+			inline std::uint32_t log10_pow2(int e)
+			{
+				return (static_cast<std::uint32_t>(e) * 78913) >> 18;
+			}
+			/*floor(log10(5^e))*/
+			inline std::uint32_t log10_pow5(int e)
+			{
+				return (static_cast<std::uint32_t>(e) * 732923) >> 20;
+			}
+
+			template<typename T>
+			inline bool multiple_of_pow5(T value, std::uint32_t p)
+			{
+				std::uint32_t count = 0;
+				while (value != 0 && value % 5 == 0)
+				{
+					value /= 5;
+					if (++count >= p)
+						return true;
+				}
+				return count >= p;
+			}
+			template<typename T>
+			inline bool multiple_of_pow2(T value, std::uint32_t p)
+			{
+				return (value & ((T(1) << p) - 1)) == 0;
+			}
+
+			inline std::uint64_t mul_shift64(std::uint64_t m, const std::uint64_t* mul, int j)
+			{
+				std::uint64_t high1;
+				const std::uint64_t low1 = umul128(m, mul[1], &high1);
+				std::uint64_t high0;
+				umul128(m, mul[0], &high0);
+				const std::uint64_t sum = high0 + low1;
+				if (sum < high0)
+					++high1;
+				return shiftright128(sum, high1, j - 64);
+			}
+
+			inline std::uint32_t mul_shift32(std::uint32_t m, std::uint64_t factor, int shift)
+			{
+				const std::uint64_t bits0 = static_cast<std::uint64_t>(m) * static_cast<std::uint32_t>(factor);
+				const std::uint64_t bits1 = static_cast<std::uint64_t>(m) * (factor >> 32);
+				return static_cast<std::uint32_t>(((bits0 >> 32) + bits1) >> (shift - 32));
+			}
+
+			/*value = mantissa * 10^exponent*/
+			struct decimal
+			{
+				std::uint64_t mantissa;
+				int exponent;
+			};
+
+			decimal shortest(std::uint64_t ieee_mantissa, std::uint32_t ieee_exponent)
+			{
+				int e2;
+				std::uint64_t m2;
+				if (ieee_exponent == 0)
+				{
+					e2 = 1 - kDoubleBias - kDoubleMantissaBits - 2;
+					m2 = ieee_mantissa;
+				}
+				else
+				{
+					e2 = static_cast<int>(ieee_exponent) - kDoubleBias - kDoubleMantissaBits - 2;
+					m2 = (1ull << kDoubleMantissaBits) | ieee_mantissa;
+				}
+				const bool accept_bounds = (m2 & 1) == 0;
+
+				/*ЧΪ[mv-1-mm_shift, mv+2]һ,Ƿȡaccept_bounds*/
+				const std::uint64_t mv = 4 * m2;
+				const std::uint32_t mm_shift = ieee_mantissa != 0 || ieee_exponent <= 1;
+
+				std::uint64_t vr, vp, vm;
+				int e10;
+				bool vm_trailing_zeros = false;
+				bool vr_trailing_zeros = false;
+				if (e2 >= 0)
+				{
+					const std::uint32_t q = log10_pow2(e2) - (e2 > 3);
+					e10 = static_cast<int>(q);
+					const int k = kDoublePow5InvBitCount + pow5bits(static_cast<int>(q)) - 1;
+					const int i = -e2 + static_cast<int>(q) + k;
+					const std::uint64_t* mul = kDoublePow5InvSplit[q];
+					vr = mul_shift64(4 * m2, mul, i);
+					vp = mul_shift64(4 * m2 + 2, mul, i);
+					vm = mul_shift64(4 * m2 - 1 - mm_shift, mul, i);
+					if (q <= 21)
+					{
+						/*mpmvmmһ5ı*/
+						if (mv % 5 == 0)
+							vr_trailing_zeros = multiple_of_pow5(mv, q);
+						else if (accept_bounds)
+							vm_trailing_zeros = multiple_of_pow5(mv - 1 - mm_shift, q);
+						else
+							vp -= multiple_of_pow5(mv + 2, q);
+					}
+				}
+				else
+				{
+					const std::uint32_t q = log10_pow5(-e2) - (-e2 > 1);
+					e10 = static_cast<int>(q) + e2;
+					const int i = -e2 - static_cast<int>(q);
+					const int k = pow5bits(i) - kDoublePow5BitCount;
+					const int j = static_cast<int>(q) - k;
+					const std::uint64_t* mul = kDoublePow5Split[i];
+					vr = mul_shift64(4 * m2, mul, j);
+					vp = mul_shift64(4 * m2 + 2, mul, j);
+					vm = mul_shift64(4 * m2 - 1 - mm_shift, mul, j);
+					if (q <= 1)
+					{
+						/*mv=4*m2Ϊ0ĵλ*/
+						vr_trailing_zeros = true;
+						if (accept_bounds)
+							vm_trailing_zeros = mm_shift == 1;
+						else
+							--vp;
+					}
+					else if (q < 63)
+					{
+						vr_trailing_zeros = multiple_of_pow2(mv, q);
+					}
+				}
+
+				/*ȥڶĵλ*/
+				int removed = 0;
+				std::uint8_t last_removed_digit = 0;
+				std::uint64_t output;
+				if (vm_trailing_zeros || vr_trailing_zeros)
+				{
+					for (;;)
+					{
+						const std::uint64_t vp_div10 = vp / 10;
+						const std::uint64_t vm_div10 = vm / 10;
+						if (vp_div10 <= vm_div10)
+							break;
+						const std::uint64_t vr_div10 = vr / 10;
+						vm_trailing_zeros &= vm - vm_div10 * 10 == 0;
+						vr_trailing_zeros &= last_removed_digit == 0;
+						last_removed_digit = static_cast<std::uint8_t>(vr - vr_div10 * 10);
+						vr = vr_div10;
+						vp = vp_div10;
+						vm = vm_div10;
+						++removed;
+					}
+					if (vm_trailing_zeros)
+					{
+						for (;;)
+						{
+							const std::uint64_t vm_div10 = vm / 10;
+							if (vm - vm_div10 * 10 != 0)
+								break;
+							const std::uint64_t vr_div10 = vr / 10;
+							vr_trailing_zeros &= last_removed_digit == 0;
+							last_removed_digit = static_cast<std::uint8_t>(vr - vr_div10 * 10);
+							vr = vr_div10;
+							vp = vp / 10;
+							vm = vm_div10;
+							++removed;
+						}
+					}
+					/*ǡмʱż*/
+					if (vr_trailing_zeros && last_removed_digit == 5 && vr % 2 == 0)
+						last_removed_digit = 4;
+					output = vr + ((vr == vm && (!accept_bounds || !vm_trailing_zeros)) || last_removed_digit >= 5);
+				}
+				else
+				{
+					bool round_up = false;
+					const std::uint64_t vp_div100 = vp / 100;
+					const std::uint64_t vm_div100 = vm / 100;
+					if (vp_div100 > vm_div100)
+					{
+						const std::uint64_t vr_div100 = vr / 100;
+						round_up = vr - vr_div100 * 100 >= 50;
+						vr = vr_div100;
+						vp = vp_div100;
+						vm = vm_div100;
+						removed += 2;
+					}
+					for (;;)
+					{
+						const std::uint64_t vp_div10 = vp / 10;
+						const std::uint64_t vm_div10 = vm / 10;
+						if (vp_div10 <= vm_div10)
+							break;
+						const std::uint64_t vr_div10 = vr / 10;
+						round_up = vr - vr_div10 * 10 >= 5;
+						vr = vr_div10;
+						vp = vp_div10;
+						vm = vm_div10;
+						++removed;
+					}
+					output = vr + (vr == vm || round_up);
+				}
+				return { output, e10 + removed };
+			}
+
+			decimal shortest(std::uint32_t ieee_mantissa, std::uint32_t ieee_exponent)
+			{
+				int e2;
+				std::uint32_t m2;
+				if (ieee_exponent == 0)
+				{
+					e2 = 1 - kFloatBias - kFloatMantissaBits - 2;
+					m2 = ieee_mantissa;
+				}
+				else
+				{
+					e2 = static_cast<int>(ieee_exponent) - kFloatBias - kFloatMantissaBits - 2;
+					m2 = (1u << kFloatMantissaBits) | ieee_mantissa;
+				}
+				const bool accept_bounds = (m2 & 1) == 0;
+
+				const std::uint32_t mv = 4 * m2;
+				const std::uint32_t mp = 4 * m2 + 2;
+				const std::uint32_t mm_shift = ieee_mantissa != 0 || ieee_exponent <= 1;
+				const std::uint32_t mm = 4 * m2 - 1 - mm_shift;
+
+				std::uint32_t vr, vp, vm;
+				int e10;
+				bool vm_trailing_zeros = false;
+				bool vr_trailing_zeros = false;
+				std::uint8_t last_removed_digit = 0;
+				if (e2 >= 0)
+				{
+					const std::uint32_t q = log10_pow2(e2);
+					e10 = static_cast<int>(q);
+					const int k = kFloatPow5InvBitCount + pow5bits(static_cast<int>(q)) - 1;
+					const int i = -e2 + static_cast<int>(q) + k;
+					vr = mul_shift32(mv, kFloatPow5InvSplit[q], i);
+					vp = mul_shift32(mp, kFloatPow5InvSplit[q], i);
+					vm = mul_shift32(mm, kFloatPow5InvSplit[q], i);
+					if (q != 0 && (vp - 1) / 10 <= vm / 10)
+					{
+						/*ѭִʱҲҪ֪ȥһλ*/
+						const int l = kFloatPow5InvBitCount + pow5bits(static_cast<int>(q - 1)) - 1;
+						last_removed_digit = static_cast<std::uint8_t>(mul_shift32(mv, kFloatPow5InvSplit[q - 1], -e2 + static_cast<int>(q) - 1 + l) % 10);
+					}
+					if (q <= 9)
+					{
+						if (mv % 5 == 0)
+							vr_trailing_zeros = multiple_of_pow5(mv, q);
+						else if (accept_bounds)
+							vm_trailing_zeros = multiple_of_pow5(mm, q);
+						else
+							vp -= multiple_of_pow5(mp, q);
+					}
+				}
+				else
+				{
+					const std::uint32_t q = log10_pow5(-e2);
+					e10 = static_cast<int>(q) + e2;
+					const int i = -e2 - static_cast<int>(q);
+					const int k = pow5bits(i) - kFloatPow5BitCount;
+					int j = static_cast<int>(q) - k;
+					vr = mul_shift32(mv, kFloatPow5Split[i], j);
+					vp = mul_shift32(mp, kFloatPow5Split[i], j);
+					vm = mul_shift32(mm, kFloatPow5Split[i], j);
+					if (q != 0 && (vp - 1) / 10 <= vm / 10)
+					{
+						j = static_cast<int>(q) - 1 - (pow5bits(i + 1) - kFloatPow5BitCount);
+						last_removed_digit = static_cast<std::uint8_t>(mul_shift32(mv, kFloatPow5Split[i + 1], j) % 10);
+					}
+					if (q <= 1)
+					{
+						vr_trailing_zeros = true;
+						if (accept_bounds)
+							vm_trailing_zeros = mm_shift == 1;
+						else
+							--vp;
+					}
+					else if (q < 31)
+					{
+						vr_trailing_zeros = multiple_of_pow2(mv, q - 1);
+					}
+				}
+
+				int removed = 0;
+				std::uint32_t output;
+				if (vm_trailing_zeros || vr_trailing_zeros)
+				{
+					while (vp / 10 > vm / 10)
+					{
+						vm_trailing_zeros &= vm % 10 == 0;
+						vr_trailing_zeros &= last_removed_digit == 0;
+						last_removed_digit = static_cast<std::uint8_t>(vr % 10);
+						vr /= 10;
+						vp /= 10;
+						vm /= 10;
+						++removed;
+					}
+					if (vm_trailing_zeros)
+					{
+						while (vm % 10 == 0)
+						{
+							vr_trailing_zeros &= last_removed_digit == 0;
+							last_removed_digit = static_cast<std::uint8_t>(vr % 10);
+							vr /= 10;
+							vp /= 10;
+							vm /= 10;
+							++removed;
+						}
+					}
+					if (vr_trailing_zeros && last_removed_digit == 5 && vr % 2 == 0)
+						last_removed_digit = 4;
+					output = vr + ((vr == vm && (!accept_bounds || !vm_trailing_zeros)) || last_removed_digit >= 5);
+				}
+				else
+				{
+					while (vp / 10 > vm / 10)
+					{
+						last_removed_digit = static_cast<std::uint8_t>(vr % 10);
+						vr /= 10;
+						vp /= 10;
+						vm /= 10;
+						++removed;
+					}
+					output = vr + (vr == vm || last_removed_digit >= 5);
+				}
+				return { output, e10 + removed };
+			}
+
+			size_t write_special(bool negative, bool nan, wchar_t* buf)
+			{
+				if (nan)
+				{
+					std::memcpy(buf, L"nan", 3 * sizeof(wchar_t));
+					return 3;
+				}
+				size_t n = 0;
+				if (negative)
+					buf[n++] = L'-';
+				std::memcpy(buf + n, L"inf", 3 * sizeof(wchar_t));
+				return n + 3;
+			}
+
+			size_t write_decimal(bool negative, decimal d, wchar_t* buf)
+			{
+				wchar_t digits[20];
+				int count = 0;
+				do
+				{
+					digits[19 - count++] = static_cast<wchar_t>(L'0' + d.mantissa % 10);
+					d.mantissa /= 10;
+				} while (d.mantissa != 0);
+				const wchar_t* first = digits + 20 - count;
+				/*Сڵpointλ֮*/
+				const int point = count + d.exponent;
+
+				size_t n = 0;
+				if (negative)
+					buf[n++] = L'-';
+				if (point > 0 && point <= 21)
+				{
+					if (count <= point)
+					{
+						for (int i = 0; i < count; ++i)
+							buf[n++] = first[i];
+						for (int i = count; i < point; ++i)
+							buf[n++] = L'0';
+					}
+					else
+					{
+						for (int i = 0; i < point; ++i)
+							buf[n++] = first[i];
+						buf[n++] = L'.';
+						for (int i = point; i < count; ++i)
+							buf[n++] = first[i];
+					}
+				}
+				else if (point <= 0 && point > -6)
+				{
+					buf[n++] = L'0';
+					buf[n++] = L'.';
+					for (int i = point; i < 0; ++i)
+						buf[n++] = L'0';
+					for (int i = 0; i < count; ++i)
+						buf[n++] = first[i];
+				}
+				else
+				{
+					buf[n++] = first[0];
+					if (count > 1)
+					{
+						buf[n++] = L'.';
+						for (int i = 1; i < count; ++i)
+							buf[n++] = first[i];
+					}
+					int exp = point - 1;
+					buf[n++] = L'e';
+					buf[n++] = exp < 0 ? L'-' : L'+';
+					if (exp < 0)
+						exp = -exp;
+					if (exp >= 100)
+						buf[n++] = static_cast<wchar_t>(L'0' + exp / 100);
+					if (exp >= 10)
+						buf[n++] = static_cast<wchar_t>(L'0' + exp / 10 % 10);
+					buf[n++] = static_cast<wchar_t>(L'0' + exp % 10);
+				}
+				return n;
+			}
+
+			inline bool is_digit(wchar_t c)
+			{
+				return c >= L'0' && c <= L'9';
+			}
+			inline wchar_t to_lower(wchar_t c)
+			{
+				return (c >= L'A' && c <= L'Z') ? static_cast<wchar_t>(c - L'A' + L'a') : c;
+			}
+			inline bool is_space(wchar_t c)
+			{
+				return c == L' ' || (c >= L'\t' && c <= L'\r') || c == 0x3000 || c == 0xA0;
+			}
+
+			/*ƥ䲻ִСдASCIIСд,ɹʱص֮λ*/
+			const wchar_t* match_word(const wchar_t* first, const wchar_t* last, const char* word)
+			{
+				for (; *word; ++word, ++first)
+				{
+					if (first == last || to_lower(*first) != *word)
+						return nullptr;
+				}
+				return first;
+			}
+
+			struct scanned
+			{
+				bool negative = false;
+				std::uint64_t mantissa = 0;   /*ǰ19λЧ*/
+				std::int64_t exponent = 0;
+				bool truncated = false;       /*19λ֮з0*/
+				const wchar_t* begin = nullptr;  /*֮һַ*/
+			};
+
+			/*parseĸʽɨʮ,inf/nan,ʧʱfirst*/
+			const wchar_t* scan_decimal(const wchar_t* first, const wchar_t* last, scanned& out)
+			{
+				const wchar_t* p = first;
+				if (p != last && (*p == L'+' || *p == L'-'))
+				{
+					out.negative = *p == L'-';
+					++p;
+				}
+				out.begin = p;
+				int significant = 0;
+				bool any_digit = false;
+				for (; p != last && is_digit(*p); ++p)
+				{
+					any_digit = true;
+					if (significant < 19)
+					{
+						if (significant != 0 || *p != L'0')
+						{
+							out.mantissa = out.mantissa * 10 + static_cast<unsigned>(*p - L'0');
+							++significant;
+						}
+					}
+					else
+					{
+						++out.exponent;
+						out.truncated |= *p != L'0';
+					}
+				}
+				if (p != last && *p == L'.')
+				{
+					const wchar_t* frac = p + 1;
+					for (; frac != last && is_digit(*frac); ++frac)
+					{
+						any_digit = true;
+						if (significant < 19)
+						{
+							if (significant != 0 || *frac != L'0')
+							{
+								out.mantissa = out.mantissa * 10 + static_cast<unsigned>(*frac - L'0');
+								++significant;
+							}
+							--out.exponent;
+						}
+						else
+						{
+							out.truncated |= *frac != L'0';
+						}
+					}
+					if (any_digit)
+						p = frac;
+				}
+				if (!any_digit)
+					return first;
+
+				if (p != last && (*p == L'e' || *p == L'E'))
+				{
+					const wchar_t* e = p + 1;
+					bool exp_negative = false;
+					if (e != last && (*e == L'+' || *e == L'-'))
+					{
+						exp_negative = *e == L'-';
+						++e;
+					}
+					if (e != last && is_digit(*e))
+					{
+						std::int64_t exp = 0;
+						for (; e != last && is_digit(*e); ++e)
+						{
+							if (exp < 100000000)
+								exp = exp * 10 + (*e - L'0');
+						}
+						out.exponent += exp_negative ? -exp : exp;
+						p = e;
+					}
+				}
+				return p;
+			}
+
+			const double kExactPow10[] = {
+				1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+				1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22,
+			};
+
+			/*w*10^q,޷ȷȷĽʱؼ*/
+			bool eisel_lemire(std::uint64_t w, std::int64_t q, std::uint64_t& bits)
+			{
+				if (q < kPow5_128Min)
+				{
+					bits = 0;
+					return true;
+				}
+				if (q > kPow5_128Max)
+				{
+					bits = 0x7FFull << 52;
+					return true;
+				}
+				int lz = count_leading_zeros(w);
+				w <<= lz;
+				const std::uint64_t* pow5 = kPow5_128[q - kPow5_128Min];
+				std::uint64_t upper;
+				std::uint64_t lower = umul128(w, pow5[0], &upper);
+				if ((upper & 0x1FF) == 0x1FF)
+				{
+					/*ضӰ,ٳϵ64λ*/
+					std::uint64_t second_upper;
+					const std::uint64_t second_lower = umul128(w, pow5[1], &second_upper);
+					lower += second_upper;
+					if (lower < second_upper)
+						++upper;
+					if (second_lower + 1 == 0 && lower + 1 == 0 && (upper & 0x1FF) == 0x1FF)
+						return false;
+				}
+				const std::uint64_t upper_bit = upper >> 63;
+				std::uint64_t mantissa = upper >> (upper_bit + 9);
+				lz += static_cast<int>(1 ^ upper_bit);
+				/*ǡм*/
+				if (lower == 0 && (upper & 0x1FF) == 0 && (mantissa & 3) == 1)
+					return false;
+				mantissa += mantissa & 1;
+				mantissa >>= 1;
+				if (mantissa >= (1ull << 53))
+				{
+					mantissa = 1ull << 52;
+					--lz;
+				}
+				mantissa &= ~(1ull << 52);
+				const std::int64_t real_exponent = (((152170 + 65536) * q) >> 16) + 1024 + 63 - lz;
+				/*ǹCп*/
+				if (real_exponent < 1 || real_exponent > 2046)
+					return false;
+				bits = mantissa | (static_cast<std::uint64_t>(real_exponent) << 52);
+				return true;
+			}
+
+			/*[first,last)תɵǰµխַı,Cп*/
+			template<typename T, typename F>
+			T parse_slow(const wchar_t* first, const wchar_t* last, F convert)
+			{
+				const char point = *std::localeconv()->decimal_point;
+				std::string text;
+				text.reserve(static_cast<size_t>(last - first));
+				for (; first != last; ++first)
+					text.push_back(*first == L'.' ? point : static_cast<char>(*first));
+				return convert(text.c_str(), nullptr);
+			}
+
+			const wchar_t* parse_special(const wchar_t* first, const wchar_t* last, double& value)
+			{
+				const wchar_t* p = first;
+				bool negative = false;
+				if (p != last && (*p == L'+' || *p == L'-'))
+				{
+					negative = *p == L'-';
+					++p;
+				}
+				if (const wchar_t* end = match_word(p, last, "inf"))
+				{
+					if (const wchar_t* longer = match_word(end, last, "inity"))
+						end = longer;
+					value = negative ? -std::numeric_limits<double>::infinity() : std::numeric_limits<double>::infinity();
+					return end;
+				}
+				if (const wchar_t* end = match_word(p, last, "nan"))
+				{
+					value = negative ? -std::numeric_limits<double>::quiet_NaN() : std::numeric_limits<double>::quiet_NaN();
+					return end;
+				}
+				return first;
+			}
+		}
+
+		size_t format(double value, wchar_t* buf)
+		{
+			const std::uint64_t bits = double_to_bits(value);
+			const bool negative = (bits >> 63) != 0;
+			const std::uint64_t ieee_mantissa = bits & ((1ull << kDoubleMantissaBits) - 1);
+			const std::uint32_t ieee_exponent = static_cast<std::uint32_t>((bits >> kDoubleMantissaBits) & 0x7FF);
+			if (ieee_exponent == 0x7FF)
+				return write_special(negative, ieee_mantissa != 0, buf);
+			if (ieee_exponent == 0 && ieee_mantissa == 0)
+			{
+				size_t n = 0;
+				if (negative)
+					buf[n++] = L'-';
+				buf[n++] = L'0';
+				return n;
+			}
+			/*2^53ֱ,ȥĩβ0write_decimalд*/
+			const int e2 = static_cast<int>(ieee_exponent) - kDoubleBias - kDoubleMantissaBits;
+			if (e2 <= 0 && e2 >= -kDoubleMantissaBits)
+			{
+				const std::uint64_t m2 = (1ull << kDoubleMantissaBits) | ieee_mantissa;
+				if ((m2 & ((1ull << -e2) - 1)) == 0)
+				{
+					decimal d{ m2 >> -e2, 0 };
+					while (d.mantissa % 10 == 0)
+					{
+						d.mantissa /= 10;
+						++d.exponent;
+					}
+					return write_decimal(negative, d, buf);
+				}
+			}
+			return write_decimal(negative, shortest(ieee_mantissa, ieee_exponent), buf);
+		}
+
+		size_t format(float value, wchar_t* buf)
+		{
+			const std::uint32_t bits = float_to_bits(value);
+			const bool negative = (bits >> 31) != 0;
+			const std::uint32_t ieee_mantissa = bits & ((1u << kFloatMantissaBits) - 1);
+			const std::uint32_t ieee_exponent = (bits >> kFloatMantissaBits) & 0xFF;
+			if (ieee_exponent == 0xFF)
+				return write_special(negative, ieee_mantissa != 0, buf);
+			if (ieee_exponent == 0 && ieee_mantissa == 0)
+			{
+				size_t n = 0;
+				if (negative)
+					buf[n++] = L'-';
+				buf[n++] = L'0';
+				return n;
+			}
+			return write_decimal(negative, shortest(ieee_mantissa, ieee_exponent), buf);
+		}
+
+		size_t format(std::int64_t value, wchar_t* buf)
+		{
+			wchar_t digits[20];
+			int count = 0;
+			std::uint64_t v = value < 0 ? 0 - static_cast<std::uint64_t>(value) : static_cast<std::uint64_t>(value);
+			do
+			{
+				digits[19 - count++] = static_cast<wchar_t>(L'0' + v % 10);
+				v /= 10;
+			} while (v != 0);
+			size_t n = 0;
+			if (value < 0)
+				buf[n++] = L'-';
+			std::memcpy(buf + n, digits + 20 - count, count * sizeof(wchar_t));
+			return n + count;
+		}
+
+		std::wstring to_wstring(double value)
+		{
+			wchar_t buf[kMaxChars];
+			return std::wstring(buf, format(value, buf));
+		}
+
+		std::wstring to_wstring(float value)
+		{
+			wchar_t buf[kMaxChars];
+			return std::wstring(buf, format(value, buf));
+		}
+
+		const wchar_t* parse(const wchar_t* first, const wchar_t* last, double& value)
+		{
+			scanned s;
+			const wchar_t* end = scan_decimal(first, last, s);
+			if (end == first)
+				return parse_special(first, last, value);
+
+			double result;
+			if (s.mantissa == 0)
+			{
+				result = 0;
+			}
+			else if (!s.truncated && s.mantissa <= (1ull << 53) && s.exponent >= -22 && s.exponent <= 22)
+			{
+				/*β10ݶܾȷʾ,һγ˳ֻһ*/
+				result = static_cast<double>(s.mantissa);
+				if (s.exponent < 0)
+					result /= kExactPow10[-s.exponent];
+				else
+					result *= kExactPow10[s.exponent];
+			}
+			else
+			{
+				std::uint64_t bits;
+				bool ok = eisel_lemire(s.mantissa, s.exponent, bits);
+				if (ok && s.truncated)
+				{
+					/*ʵֵmantissamantissa+1֮,˽ͬȷ*/
+					std::uint64_t upper_bits;
+					ok = eisel_lemire(s.mantissa + 1, s.exponent, upper_bits) && upper_bits == bits;
+				}
+				if (ok)
+					result = bits_to_double(bits);
+				else
+					result = std::fabs(parse_slow<double>(s.begin, end, [](const char* str, char** e) { return std::strtod(str, e); }));
+			}
+			value = s.negative ? -result : result;
+			return end;
+		}
+
+		const wchar_t* parse(const wchar_t* first, const wchar_t* last, float& value)
+		{
+			double d;
+			const wchar_t* end = parse(first, last, d);
+			if (end == first)
+				return first;
+			/*
+			* ȵõȷdoubleתΪfloat,ֻdoubleǡfloatмʱſγ,
+			* ʱCпֱת.
+			*/
+			float f = static_cast<float>(d);
+			if (std::isfinite(d) && static_cast<double>(f) != d)
+			{
+				bool ambiguous = !std::isfinite(f);
+				if (!ambiguous)
+				{
+					const float g = std::nextafter(f, d > f ? std::numeric_limits<float>::infinity() : -std::numeric_limits<float>::infinity());
+					ambiguous = std::isfinite(g) && (static_cast<double>(f) + static_cast<double>(g)) * 0.5 == d;
+				}
+				if (ambiguous)
+				{
+					const wchar_t* begin = first;
+					if (*begin == L'+' || *begin == L'-')
+						++begin;
+					f = std::fabs(parse_slow<float>(begin, end, [](const char* str, char** e) { return std::strtof(str, e); }));
+					if (d < 0)
+						f = -f;
+				}
+			}
+			value = f;
+			return end;
+		}
+
+		const wchar_t* parse(const wchar_t* first, const wchar_t* last, std::int64_t& value)
+		{
+			const wchar_t* p = first;
+			bool negative = false;
+			if (p != last && (*p == L'+' || *p == L'-'))
+			{
+				negative = *p == L'-';
+				++p;
+			}
+			if (p == last || !is_digit(*p))
+				return first;
+			const std::uint64_t limit = negative ? (1ull << 63) : (1ull << 63) - 1;
+			std::uint64_t v = 0;
+			bool overflow = false;
+			for (; p != last && is_digit(*p); ++p)
+			{
+				const unsigned digit = static_cast<unsigned>(*p - L'0');
+				if (overflow || v > (limit - digit) / 10)
+					overflow = true;
+				else
+					v = v * 10 + digit;
+			}
+			if (overflow)
+				v = limit;
+			value = negative ? static_cast<std::int64_t>(0 - v) : static_cast<std::int64_t>(v);
+			return p;
+		}
+
+		double to_double(const wchar_t* str)
+		{
+			while (is_space(*str))
+				++str;
+			double value = 0;
+			parse(str, str + std::wcslen(str), value);
+			return value;
+		}
+
+		float to_float(const wchar_t* str)
+		{
+			while (is_space(*str))
+				++str;
+			float value = 0;
+			parse(str, str + std::wcslen(str), value);
+			return value;
+		}
+
+		std::int64_t to_int64(const wchar_t* str)
+		{
+			while (is_space(*str))
+				++str;
+			std::int64_t value = 0;
+			parse(str, str + std::wcslen(str), value);
+			return value;
+		}
+	}
+}
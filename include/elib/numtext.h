@@ -0,0 +1,57 @@
+#pragma once
+#include<cstddef>
+#include<cstdint>
+#include<string>
+
+/*
+* ֵıĻת,Ӱ.
+* Ryu㷨ԭصı,ȡʱClinger·,Eisel-Lemire㷨,
+* ߶޷ȷȷʱ(19λЧ֡ӽе㡢ǹټ)ŽCп.
+*/
+namespace elibstl {
+	namespace numtext {
+		/*"-2.2250738585072014e-308"Ϊ24ַ*/
+		constexpr size_t kMaxChars = 32;
+
+		/*
+		* д̵ԭصı,ַ,дβ0.
+		* Сλ-521֮ʱͨд(0.000001123456789012345680000),ÿѧ(1e-71.5e+300).
+		* ͷֱΪinf-infnan.
+		*/
+		size_t format(double value, wchar_t* buf);
+		size_t format(float value, wchar_t* buf);
+		size_t format(std::int64_t value, wchar_t* buf);
+		std::wstring to_wstring(double value);
+		std::wstring to_wstring(float value);
+
+		/*
+		* firstʼȡһֵ,ʽΪ[+-][.][e[+-]],Ҳinfinfinitynan(ִСд).
+		* ǰհ.ضȡλ,ûжֵʱfirstҲ޸value.
+		* ΧʱΪŵ0;ΧʱȡINT64_MAXINT64_MIN.
+		*/
+		const wchar_t* parse(const wchar_t* first, const wchar_t* last, double& value);
+		const wchar_t* parse(const wchar_t* first, const wchar_t* last, float& value);
+		const wchar_t* parse(const wchar_t* first, const wchar_t* last, std::int64_t& value);
+
+		/*_wtof/_wtoi64:ǰհ,ֵ֮,ûֵʱΪ0*/
+		double to_double(const wchar_t* str);
+		float to_float(const wchar_t* str);
+		std::int64_t to_int64(const wchar_t* str);
+
+		namespace detail {
+			constexpr int kDoublePow5InvTableSize = 342;
+			constexpr int kDoublePow5TableSize = 326;
+			constexpr int kFloatPow5InvTableSize = 31;
+			constexpr int kFloatPow5TableSize = 48;
+			constexpr int kPow5_128Min = -342;
+			constexpr int kPow5_128Max = 308;
+			constexpr int kPow5_128Size = kPow5_128Max - kPow5_128Min + 1;
+
+			extern const std::uint64_t kDoublePow5InvSplit[kDoublePow5InvTableSize][2];
+			extern const std::uint64_t kDoublePow5Split[kDoublePow5TableSize][2];
+			extern const std::uint64_t kFloatPow5InvSplit[kFloatPow5InvTableSize];
+			extern const std::uint64_t kFloatPow5Split[kFloatPow5TableSize];
+			extern const std::uint64_t kPow5_128[kPow5_128Size][2];
+		}
+	}
+}
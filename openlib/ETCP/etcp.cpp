@@ -1,4 +1,5 @@
 //ԴETCP
+//ļΪƽ̨޹صĲ:ӿڡͻ˵ӹ̺׽ָ,շetcp_iocp.cppetcp_epoll.cpp
 #pragma warning(disable:4996)
 #pragma warning(disable:6001)
 #pragma warning(disable:6386)
@@ -6,19 +7,22 @@
 #pragma warning(disable:6387)
 #pragma warning(disable:6279)
 #pragma warning(disable:28183)
-#include "etcp.h"
+#include "etcp_backend.h"
+#include "etcp_frame.h"
 #include"vector"
 #include"iostream"
+#include <chrono>
+#include <cstring>
+#ifndef _WIN32
+#include <poll.h>
+#include <sys/uio.h>
+#endif
 #pragma comment(lib, "WS2_32.lib")
 using namespace std;
 typedef unsigned char byte;
-static HANDLE g_iocp = NULL;
-static HANDLE g_iocp_client = NULL;
-static int g_cpu = 0;
-static int buf_len = 65535;
-static tcp_fun g_fun = NULL;
-static tcp_fun_client g_fun_client = NULL;
-#include"Tace.hpp"
+int buf_len = 65535;
+tcp_fun g_fun = NULL;
+tcp_fun_client g_fun_client = NULL;
 int closesockets(SOCKET so)
 {
 	if (INVALID_SOCKET == so)
@@ -29,1391 +33,606 @@ int closesockets(SOCKET so)
 	lingerStruct.l_onoff = 1;
 	lingerStruct.l_linger = 0;
 	setsockopt(so, SOL_SOCKET, SO_LINGER, (char*)&lingerStruct, sizeof(lingerStruct));
+#ifdef _WIN32
 	shutdown(so, SD_BOTH);
 	return closesocket(so);
+#else
+	shutdown(so, SHUT_RDWR);
+	return close(so);
+#endif
 }
 
-
-
-
-
-
-char CETCPBase64::b64B2C(BYTE b)
-{
-	if ((00 <= b) && (b <= 25)) { return char(b + 'A' - 00); }
-	else if ((26 <= b) && (b <= 51)) { return char(b + 'a' - 26); }
-	else if ((52 <= b) && (b <= 61)) { return char(b + '0' - 52); }
-	else if (62 == b) { return '+'; }
-	else if (63 == b) { return '/'; }
-	else
-	{
-		return '=';
-	}
-
-}
-int CETCPBase64::b64Encode(LPBYTE srcbuf, int cbsrc, LPBYTE dstbuf, int cbdst)
-{
-	int i, cnt = cbsrc / 3;
-
-	for (i = 0; i < cnt + 1; i++)
-	{
-		dstbuf[i * 4 + 0] = b64B2C(((srcbuf[i * 3 + 0] >> 2)));
-		dstbuf[i * 4 + 1] = b64B2C(((srcbuf[i * 3 + 0] & 0x03) << 4) + (srcbuf[i * 3 + 1] >> 4));
-		dstbuf[i * 4 + 2] = b64B2C(((srcbuf[i * 3 + 1] & 0x0F) << 2) + (srcbuf[i * 3 + 2] >> 6));
-		dstbuf[i * 4 + 3] = b64B2C(((srcbuf[i * 3 + 2] & 0x3F)));
-	}
-
-	if (cbsrc % 3 == 1)
-	{
-		dstbuf[cnt * 4 + 2] = '=';
-		dstbuf[cnt * 4 + 3] = '=';
-
-		cnt++;
-	}
-	else if (cbsrc % 3 == 2)
-	{
-		dstbuf[cnt * 4 + 3] = '=';
-
-		cnt++;
-	}
-
-	dstbuf[cnt * 4] = 0;
-
-	return cnt * 4;
-}
-
-
-tcp::tcp()
-{
-	m_Is = FALSE;
-	m_Close = FALSE;
-	InitializeCriticalSection(&m_cs);
-	m_cnum = 0;
-	m_so = INVALID_SOCKET;
-}
-tcp::~tcp()
-{
-	m_cnum = 0;
-	m_so = INVALID_SOCKET;
-}
-int tcp::Init(const char* host, unsigned short nPort, int nIs)
-{
-	m_Is = nIs;
-	m_so = WSASocket(AF_INET, SOCK_STREAM, IPPROTO_TCP, 0, 0, WSA_FLAG_OVERLAPPED);
-	if (INVALID_SOCKET == m_so)
-	{
-		return WSAGetLastError();
-	}
-	HANDLE t = CreateIoCompletionPort((HANDLE)m_so, g_iocp, NULL, 0);
-	if (NULL == t)
-	{
-		Close();
-		return GetLastError();
-	}
-
-	sockaddr_in in;
-	in.sin_family = AF_INET;
-	in.sin_addr.S_un.S_addr = inet_addr(host);
-	in.sin_port = htons(nPort);
-	if (SOCKET_ERROR == bind(m_so, (SOCKADDR*)&in, sizeof(in)))
-	{
-		Close();
-		return WSAGetLastError();
-	}
-
-	if (SOCKET_ERROR == listen(m_so, g_cpu))
-	{
-		Close();
-		return WSAGetLastError();
-	}
-
-	return AcceptServer();
-}
-int tcp::AcceptServer()
-{
-	tcpstruct* op = new tcpstruct;
-	memset(op, 0, sizeof(tcpstruct));
-
-	op->buf = new char[buf_len];
-	op->so = this;
-	op->bufSize = buf_len;
-	op->bufOffset = 0;
-	op->state = tcp_connt;
-	op->c_so = INVALID_SOCKET;
-	op->c_so = WSASocket(AF_INET, SOCK_STREAM, IPPROTO_TCP, 0, 0, WSA_FLAG_OVERLAPPED);
-	if (INVALID_SOCKET == op->c_so)
-	{
-		delete[]op->buf;
-		op->buf = NULL;
-
-		delete[]op;
-		op = NULL;
-		Close();
-		return WSAGetLastError();
-	}
-
-	//
-	setsockopt(op->c_so, SOL_SOCKET, SO_RCVBUF, (const char*)&buf_len, sizeof(int));
-	int nSendBuf = 0;
-	setsockopt(op->c_so, SOL_SOCKET, SO_SNDBUF, (const char*)&nSendBuf, sizeof(int));
-	BOOL bReuseaddr = TRUE;
-	setsockopt(op->c_so, SOL_SOCKET, SO_REUSEADDR, (const char*)&bReuseaddr, sizeof(BOOL));
-
-	HANDLE t = NULL;
-	t = CreateIoCompletionPort((HANDLE)op->c_so, g_iocp, NULL, 0);
-	if (NULL == t)
-	{
-		closesockets(op->c_so);
-		op->c_so = INVALID_SOCKET;
-
-		delete[]op->buf;
-		op->buf = NULL;
-
-		delete[]op;
-		op = NULL;
-		Close();
-		return GetLastError();
-	}
-
-	LPFN_ACCEPTEX	lpfnAcceptEx = NULL;
-	GUID lGUID = WSAID_ACCEPTEX;
-	DWORD cb = 0;
-	if (WSAIoctl(m_so, SIO_GET_EXTENSION_FUNCTION_POINTER, &lGUID, sizeof(GUID), &lpfnAcceptEx, sizeof(lpfnAcceptEx), &cb, NULL, NULL))
-	{
-		closesockets(op->c_so);
-		op->c_so = INVALID_SOCKET;
-
-		delete[]op->buf;
-		op->buf = NULL;
-
-		delete[]op;
-		op = NULL;
-		Close();
-		return 2;
-	}
-
-	DWORD Cb = 0;
-
-	if (lpfnAcceptEx(m_so, op->c_so, op->buf, 0, sizeof(sockaddr) + 16, sizeof(sockaddr) + 16, &Cb, (LPOVERLAPPED)op))
+namespace etcp {
+	int last_error()
 	{
-		closesockets(op->c_so);
-		op->c_so = INVALID_SOCKET;
-
-		delete[]op->buf;
-		op->buf = NULL;
-		delete[]op;
-		op = NULL;
-		Close();
-		return 3;
-	}
-	return 0;
-}
-int tcp::Close()
-{
-	m_Close = TRUE;
-	m_cnum = 0;
-	closesockets(m_so);
-
-	m_so = INVALID_SOCKET;
-	return 0;
-}
-int tcp::Accept()
-{
-	tcpstruct* op = new tcpstruct;
-	memset(op, 0, sizeof(tcpstruct));
-
-	op->buf = new char[buf_len];
-	op->so = this;
-	op->bufSize = buf_len;
-	op->bufOffset = 0;
-
-	op->state = tcp_connt;
-	op->c_so = INVALID_SOCKET;
-	op->c_so = WSASocket(AF_INET, SOCK_STREAM, IPPROTO_TCP, 0, 0, WSA_FLAG_OVERLAPPED);
-	if (INVALID_SOCKET == op->c_so)
-	{
-		delete[]op->buf;
-		op->buf = NULL;
-
-		delete[]op;
-		op = NULL;
+#ifdef _WIN32
 		return WSAGetLastError();
+#else
+		return errno;
+#endif
 	}
 
-	//
-	setsockopt(op->c_so, SOL_SOCKET, SO_RCVBUF, (const char*)&buf_len, sizeof(int));
-	int nSendBuf = 0;
-	setsockopt(op->c_so, SOL_SOCKET, SO_SNDBUF, (const char*)&nSendBuf, sizeof(int));
-	BOOL bReuseaddr = TRUE;
-	setsockopt(op->c_so, SOL_SOCKET, SO_REUSEADDR, (const char*)&bReuseaddr, sizeof(BOOL));
-
-	HANDLE t = NULL;
-	t = CreateIoCompletionPort((HANDLE)op->c_so, g_iocp, NULL, 0);
-	if (NULL == t)
+	int set_nonblocking(SOCKET so, bool on)
 	{
-		closesockets(op->c_so);
-		op->c_so = INVALID_SOCKET;
-		PostQueuedCompletionStatus(g_iocp, 0, NULL, (LPOVERLAPPED)op);
-
-		delete[]op->buf;
-		op->buf = NULL;
-
-		delete[]op;
-		op = NULL;
-		return GetLastError();
-	}
-
-	LPFN_ACCEPTEX	lpfnAcceptEx = NULL;
-	GUID lGUID = WSAID_ACCEPTEX;
-	DWORD cb = 0;
-	if (WSAIoctl(m_so, SIO_GET_EXTENSION_FUNCTION_POINTER, &lGUID, sizeof(GUID), &lpfnAcceptEx, sizeof(lpfnAcceptEx), &cb, NULL, NULL))
-	{
-		closesockets(op->c_so);
-		op->c_so = INVALID_SOCKET;
-		PostQueuedCompletionStatus(g_iocp, 0, NULL, (LPOVERLAPPED)op);
-
-		delete[]op->buf;
-		op->buf = NULL;
-
-		delete[]op;
-		op = NULL;
-		return 2;
-	}
-
-	DWORD Cb = 0;
-	if (lpfnAcceptEx(m_so, op->c_so, op->buf, 0, sizeof(sockaddr) + 16, sizeof(sockaddr) + 16, &Cb, (LPOVERLAPPED)op))
-	{
-		closesockets(op->c_so);
-		op->c_so = INVALID_SOCKET;
-		PostQueuedCompletionStatus(g_iocp, 0, NULL, (LPOVERLAPPED)op);
-
-		delete[]op->buf;
-		op->buf = NULL;
-
-		delete[]op;
-		op = NULL;
-		return 3;
-	}
-	return 0;
-}
-
-void tcp::ClientAccept(bool error, P_tcpstruct nop)
-{
-	while (0 != Accept())
-	{
-		Sleep(1);
-	}
-
-	setsockopt(nop->c_so, SOL_SOCKET, SO_UPDATE_ACCEPT_CONTEXT, (char*)&m_so, sizeof(SOCKET));
-
-	DWORD Cb = 0;
-	tcp_keepalive ka;
-	ka.onoff = 1;
-	ka.keepalivetime = 1000 * 30;
-	ka.keepaliveinterval = 1000 * 5;
-	WSAIoctl(nop->c_so, SIO_KEEPALIVE_VALS, &ka, sizeof(ka), NULL, 0, &Cb, NULL, NULL);
-
-	EnterCriticalSection(&m_cs);
-	m_cnum++;
-	LeaveCriticalSection(&m_cs);
-
-	g_fun(this, nop->c_so, tcp_connt, NULL, NULL, m_cnum);
-
-	//ÿͻ˽ͶϿ
-	if (error)
-	{
-		EnterCriticalSection(&m_cs);
-		m_cnum--;
-		LeaveCriticalSection(&m_cs);
-
-		g_fun(this, nop->c_so, tcp_close, NULL, NULL, m_cnum);
-		closesockets(nop->c_so);
-		nop->c_so = INVALID_SOCKET;
-
-		delete[]nop->buf;
-		nop->buf = NULL;
-
-		delete nop;
-		nop = NULL;
-		return;
-	}
-
-	nop->state = tcp_recv;
-
-	//ȡAPI
-	WSABUF wsabuf;
-	if (m_Is)
-	{
-		delete[]nop->buf;
-		nop->bufOffset = 0;
-		nop->buf = new char[sizeof(DWORD)];
-		nop->bufSize = sizeof(DWORD);
-		wsabuf.buf = nop->buf + nop->bufOffset;
-		wsabuf.len = nop->bufSize - nop->bufOffset;
-	}
-	else
-	{
-		wsabuf.buf = nop->buf;
-		wsabuf.len = buf_len;
+#ifdef _WIN32
+		unsigned long ul = on ? 1 : 0;
+		return ioctlsocket(so, FIONBIO, &ul);
+#else
+		int flags = fcntl(so, F_GETFL, 0);
+		if (flags < 0)
+		{
+			return -1;
+		}
+		flags = on ? (flags | O_NONBLOCK) : (flags & ~O_NONBLOCK);
+		return fcntl(so, F_SETFL, flags);
+#endif
 	}
 
-	DWORD Flg = 0;
-	Cb = 0;
-	if (WSARecv(nop->c_so, &wsabuf, 1, &Cb, &Flg, (LPWSAOVERLAPPED)nop, NULL))
+	bool resolve_ipv4(const char* host, in_addr& out)
 	{
-		int ercode = WSAGetLastError();
-		if (ercode == WSAEFAULT)
+		addrinfo hints = {};
+		hints.ai_family = AF_INET;
+		hints.ai_socktype = SOCK_STREAM;
+		addrinfo* result = NULL;
+		if (!host || getaddrinfo(host, NULL, &hints, &result) != 0 || !result)
 		{
-			return;
-		}
-		else if (ercode != WSA_IO_PENDING)
-		{
-			EnterCriticalSection(&m_cs);
-			m_cnum--;
-			LeaveCriticalSection(&m_cs);
-
-
-			g_fun(this, nop->c_so, tcp_close, NULL, NULL, m_cnum);
-
-			closesockets(nop->c_so);
-			nop->c_so = INVALID_SOCKET;
-
-
-			delete[]nop->buf;
-			nop->buf = NULL;
-
-			delete nop;
-			nop = NULL;
-			return;
+			return false;
 		}
+		out = ((sockaddr_in*)result->ai_addr)->sin_addr;
+		freeaddrinfo(result);
+		return true;
 	}
-}
 
-void tcp::RecvData(bool error, P_tcpstruct nop)
-{
-
-	if (error)
+	int connect_timeout(SOCKET so, const char* host, unsigned short port, int time)
 	{
-		EnterCriticalSection(&m_cs);
-		m_cnum--;
-		LeaveCriticalSection(&m_cs);
-
-		g_fun(this, nop->c_so, tcp_close, NULL, NULL, m_cnum);
-
-		//closesockets(nop->c_so);
-		//nop->c_so = INVALID_SOCKET;
-
-		delete[]nop->buf;
-		nop->buf = NULL;
-
-		delete nop;
-		nop = NULL;
-		return;
-	}
+		sockaddr_in in = {};
+		in.sin_family = AF_INET;
+		in.sin_port = htons(port);
+		if (!resolve_ipv4(host, in.sin_addr))
+		{
+			return 1;
+		}
 
-	if (m_Is)
-	{
-		nop->bufOffset += nop->cb;
-		if (nop->bufOffset < nop->bufSize)
+		set_nonblocking(so, true);
+		if (SOCKET_ERROR == connect(so, (sockaddr*)&in, sizeof(in)))
 		{
-			nop->state = tcp_recv;
-			WSABUF wsabuf;
-			if (m_Is)
+#ifdef _WIN32
+			if (WSAGetLastError() != WSAEWOULDBLOCK)
 			{
-				wsabuf.buf = nop->buf + nop->bufOffset;
-				wsabuf.len = nop->bufSize - nop->bufOffset;
+				return 1;
 			}
-			else
+			fd_set w, e;
+			FD_ZERO(&w);
+			FD_ZERO(&e);
+			FD_SET(so, &w);
+			FD_SET(so, &e);
+			struct timeval timeout;
+			timeout.tv_sec = time;
+			timeout.tv_usec = 0;
+			if (select(0, 0, &w, &e, &timeout) <= 0 || !FD_ISSET(so, &w))
 			{
-				wsabuf.buf = nop->buf;
-				wsabuf.len = buf_len;
+				return 1;
 			}
-			DWORD Cb = 0;
-			DWORD Flg = 0;
-			if (WSARecv(nop->c_so, &wsabuf, 1, &Cb, &Flg, (LPWSAOVERLAPPED)nop, NULL))
+#else
+			if (errno != EINPROGRESS)
 			{
-				int ercode = WSAGetLastError();
-				if (ercode == WSAEFAULT)
-				{
-					return;
-				}
-				else if (ercode != WSA_IO_PENDING)
-				{
-					EnterCriticalSection(&m_cs);
-					m_cnum--;
-					LeaveCriticalSection(&m_cs);
-
-					g_fun(this, nop->c_so, tcp_close, NULL, NULL, m_cnum);
-
-					delete[]nop->buf;
-					nop->buf = NULL;
-
-					delete nop;
-					nop = NULL;
-					return;
-				}
+				return 1;
 			}
-			return;
-		}
-		DWORD size = *((DWORD*)(nop->buf));
-		if (size > 65536000)
-		{
-			EnterCriticalSection(&m_cs);
-			m_cnum--;
-			LeaveCriticalSection(&m_cs);
-
-			g_fun(this, nop->c_so, tcp_close, NULL, NULL, m_cnum);
-			//closesockets(nop->c_so);
-			//nop->c_so = INVALID_SOCKET;
-
-			delete[]nop->buf;
-			nop->buf = NULL;
-
-			delete nop;
-			nop = NULL;
-			return;
-		}
-
-
-		if (nop->bufOffset < DWORD(sizeof(DWORD)) + size)  //Լ
-		{
-			delete[] nop->buf;
-
-			nop->buf = new char[sizeof(DWORD) + size];
-			nop->bufSize = sizeof(DWORD) + size;
-			nop->bufOffset = sizeof(DWORD);
-			memcpy(nop->buf, &size, sizeof(DWORD));
-
-			nop->state = tcp_recv;
-			WSABUF wsabuf;
-			if (m_Is)
+			pollfd pfd = { so, POLLOUT, 0 };
+			int ret;
+			while ((ret = poll(&pfd, 1, time > 0 ? time * 1000 : 0)) < 0 && errno == EINTR)
 			{
-				wsabuf.buf = nop->buf + nop->bufOffset;
-				wsabuf.len = nop->bufSize - nop->bufOffset;
 			}
-			else
+			if (ret <= 0)
 			{
-				wsabuf.buf = nop->buf;
-				wsabuf.len = buf_len;
+				return 1;
 			}
-			DWORD Cb = 0;
-			DWORD Flg = 0;
-			if (WSARecv(nop->c_so, &wsabuf, 1, &Cb, &Flg, (LPWSAOVERLAPPED)nop, NULL))
+#endif
+			int err = 0;
+			socklen len = sizeof(err);
+			if (getsockopt(so, SOL_SOCKET, SO_ERROR, (char*)&err, &len) != 0 || err != 0)
 			{
-				int ercode = WSAGetLastError();
-				if (ercode == WSAEFAULT)
-				{
-					return;
-				}
-				else if (ercode != WSA_IO_PENDING)
-				{
-					EnterCriticalSection(&m_cs);
-					m_cnum--;
-					LeaveCriticalSection(&m_cs);
-
-					g_fun(this, nop->c_so, tcp_close, NULL, NULL, m_cnum);
-
-					delete[]nop->buf;
-					nop->buf = NULL;
-
-					delete nop;
-					nop = NULL;
-					return;
-				}
+				return 1;
 			}
-			return;
-		}
-		if (nop->bufSize - sizeof(DWORD) > 0)
-		{
-			g_fun(this, nop->c_so, tcp_recv, nop->buf + sizeof(DWORD), nop->bufSize - sizeof(DWORD), m_cnum);
-		}
-		delete[]nop->buf;
-		nop->buf = new char[sizeof(DWORD)];
-		nop->bufSize = sizeof(DWORD);
-	}
-	else
-	{
-		g_fun(this, nop->c_so, tcp_recv, nop->buf, nop->cb, m_cnum);
-	}
-
-	nop->bufOffset = 0;
-	nop->state = tcp_recv;
-	WSABUF wsabuf;
-	if (m_Is)
-	{
-		wsabuf.buf = nop->buf + nop->bufOffset;
-		wsabuf.len = nop->bufSize - nop->bufOffset;
-	}
-	else
-	{
-		wsabuf.buf = nop->buf;
-		wsabuf.len = buf_len;
-	}
-	DWORD Cb = 0;
-	DWORD Flg = 0;
-	if (WSARecv(nop->c_so, &wsabuf, 1, &Cb, &Flg, (LPWSAOVERLAPPED)nop, NULL))
-	{
-		int ercode = WSAGetLastError();
-		if (ercode == WSAEFAULT)
-		{
-			return;
-		}
-		else if (ercode != WSA_IO_PENDING)
-		{
-			EnterCriticalSection(&m_cs);
-			m_cnum--;
-			LeaveCriticalSection(&m_cs);
-
-			g_fun(this, nop->c_so, tcp_close, NULL, NULL, m_cnum);
-
-			//closesocket(nop->c_so);
-			//nop->c_so = INVALID_SOCKET;
-
-
-			//PostQueuedCompletionStatus(g_iocp, 0, NULL, (LPOVERLAPPED)nop);
-
-			delete[]nop->buf;
-			nop->buf = NULL;
-
-			delete nop;
-			nop = NULL;
 		}
-	}
-}
-int tcp::SoSend(SOCKET so, char* buf, DWORD cb)
-{
-	if (cb > 65536000)
-	{
+		set_nonblocking(so, false);
 		return 0;
 	}
-	tcpstruct* op = new tcpstruct;
-	memset(op, 0, sizeof(tcpstruct));
-	op->so = this;
-	op->state = tcp_send;
-
-	WSABUF wsabuf;
 
-	if (m_Is)
-	{
-		op->buf = new char[sizeof(DWORD) + cb];
-		op->bufSize = sizeof(DWORD) + cb;
-		wsabuf.buf = op->buf;
-		wsabuf.len = op->bufSize;
-		memcpy(wsabuf.buf, &cb, sizeof(DWORD));
-		memcpy(wsabuf.buf + sizeof(DWORD), buf, cb);
-	}
-	else
+	void set_io_timeout(SOCKET so, int ms)
 	{
-		wsabuf.buf = buf;
-		wsabuf.len = cb;
+#ifdef _WIN32
+		DWORD to = ms;
+#else
+		timeval to = { ms / 1000, (ms % 1000) * 1000 };
+#endif
+		setsockopt(so, SOL_SOCKET, SO_SNDTIMEO, (char*)&to, sizeof(to));
+		setsockopt(so, SOL_SOCKET, SO_RCVTIMEO, (char*)&to, sizeof(to));
 	}
-	op->bufOffset = 0;
 
-
-
-	if (WSASend(so, &wsabuf, 1, &op->cb, 0, (LPWSAOVERLAPPED)op, NULL))
-	{
-		int ercode = WSAGetLastError();
-		if (ercode != WSA_IO_PENDING)
-		{
-			delete[]op->buf;
-			op->buf = NULL;
-
-			delete op;
-			op = NULL;
-			return 1;
-		}
-
-	}
-	return 0;
-}
-int tcp::SoSends(SOCKET so, char* buf, DWORD cb)
-{
-	if (cb > 65536000)
+	void set_keepalive(SOCKET so, int idle_ms, int interval_ms)
 	{
-		return 0;
-	}
-
-	if (m_Is)
-	{
-		memcpy(buf, &cb, sizeof(DWORD));
-		memcpy(buf + sizeof(DWORD), buf, cb);
-		if (send(so, buf, cb + sizeof(DWORD), 0))
-		{
-			return 0;
-		}
-	}
-	else
-	{
-		if (send(so, buf, cb, 0))
-		{
-			return 0;
-		}
-	}
-	return 1;
-
-}
-void tcp::OnSend(bool ercode, P_tcpstruct nop)
-{
-	SOCKET n_so = nop->c_so;
-	delete[]nop->buf;
-	nop->buf = NULL;
-
-	delete nop;
-	nop = NULL;
-
-	if (ercode)
-	{
-		closesockets(n_so);
-		g_fun(this, n_so, tcp_server_close, NULL, NULL, m_cnum);
-		n_so = INVALID_SOCKET;
-	}
-
-}
-
-
-tcp_client::tcp_client()
-{
-
-	m_Is = 0;
-	m_isok = 0;
-	m_buf = 0;
-	m_so = INVALID_SOCKET;
-}
-tcp_client::~tcp_client()
-{
-	m_so = INVALID_SOCKET;
-}
-int tcp_client::Init(char* host, unsigned short nPort, BOOL nIs, EProxyType proxyType, PCHAR proxyhost, WORD proxyport, PCHAR username, PCHAR userpass, int time)
-{
-
-	m_so = WSASocket(AF_INET, SOCK_STREAM, IPPROTO_TCP, 0, 0, WSA_FLAG_OVERLAPPED);
-	if (INVALID_SOCKET == m_so)
-	{
-		return WSAGetLastError();
-	}
-
-	HANDLE t = CreateIoCompletionPort((HANDLE)m_so, g_iocp_client, NULL, 0);
-	if (NULL == t)
-	{
-		Close();
-		return GetLastError();
-	}
-
-	sockaddr_in in;
-	in.sin_family = AF_INET;
-	in.sin_addr.S_un.S_addr = 0;
-	in.sin_port = 0;
-	if (SOCKET_ERROR == bind(m_so, (SOCKADDR*)&in, sizeof(in)))
-	{
-		Close();
-		return WSAGetLastError();
-	}
-
-	m_Is = nIs;
-
-	if (PROXY_TYPE_NONE == proxyType)
-	{
-		in.sin_family = AF_INET;
-		struct hostent* pHost;
-		pHost = gethostbyname(host);
-		memcpy(&in.sin_addr.S_un.S_addr, pHost->h_addr_list[0], pHost->h_length);
-		in.sin_addr.S_un.S_addr = inet_addr(inet_ntoa(in.sin_addr));
-		in.sin_port = htons(nPort);
-
-		unsigned long ul = 1;
-		ioctlsocket(m_so, FIONBIO, (unsigned long*)&ul);
-
-		connect(m_so, (sockaddr*)&in, sizeof(sockaddr));
-
-		struct timeval timeout;
-		fd_set r;
-
-		FD_ZERO(&r);
-		FD_SET(m_so, &r);
-		timeout.tv_sec = time;
-		timeout.tv_usec = 0;
-		int ret = select(m_so, 0, &r, 0, &timeout);
-		if (ret <= 0)
-		{
-			Close();
-			return 1;
-		}
-
-		tcpstruct_client* op = new tcpstruct_client;
-		memset(op, 0, sizeof(tcpstruct_client));
-
-		op->so = this;
-		op->state = tcp_connt_client;
-
-		op->buf = NULL;
-		op->bufSize = 0;
-		op->bufOffset = 0;
-
-		PostQueuedCompletionStatus(g_iocp_client, 0, NULL, (LPOVERLAPPED)op);
-	}
-	else
-	{
-		in.sin_family = AF_INET;
-		struct hostent* pHost;
-		pHost = gethostbyname(proxyhost);
-		memcpy(&in.sin_addr.S_un.S_addr, pHost->h_addr_list[0], pHost->h_length);
-		in.sin_addr.S_un.S_addr = inet_addr(inet_ntoa(in.sin_addr));
-
-		in.sin_port = htons(proxyport);
-
-		unsigned long ul = 1;
-		ioctlsocket(m_so, FIONBIO, (unsigned long*)&ul);
-
-		connect(m_so, (sockaddr*)&in, sizeof(sockaddr));
-
-		struct timeval timeout;
-		fd_set r;
-
-		FD_ZERO(&r);
-		FD_SET(m_so, &r);
-		timeout.tv_sec = time;
-		timeout.tv_usec = 0;
-		int ret = select(m_so, 0, &r, 0, &timeout);
-		if (ret <= 0)
-		{
-			Close();
-			return 1;
-		}
-
-		DWORD to = 30000;
-
-		setsockopt(m_so, SOL_SOCKET, SO_SNDTIMEO, (char*)&to, sizeof(to));
-		setsockopt(m_so, SOL_SOCKET, SO_RCVTIMEO, (char*)&to, sizeof(to));
-
-
+#ifdef _WIN32
 		tcp_keepalive ka;
 		ka.onoff = 1;
-		ka.keepalivetime = 5000;
-		ka.keepaliveinterval = 5000;
-
+		ka.keepalivetime = idle_ms;
+		ka.keepaliveinterval = interval_ms;
 		DWORD cb = 0;
-
-		WSAIoctl(m_so, SIO_KEEPALIVE_VALS, &ka, sizeof(ka), NULL, 0, &cb, NULL, NULL);
-
-		int ercode = 0;
-
-		switch (proxyType)
-		{
-		case PROXY_TYPE_SOCKS4:	ercode = SoProxySocks4(host, nPort, username, userpass); break;
-		case PROXY_TYPE_SOCKS5:	ercode = SoProxySocks5(host, nPort, username, userpass); break;
-		case PROXY_TYPE_HTTP:	ercode = SoProxyHttp(host, nPort, username, userpass); break;
-		default:
-			Close();
-			return -1;//ERROR_INVALID_PARAMETER;
-		}
-
-		if (ercode)
-		{
-			Close();
-			return ercode;
+		WSAIoctl(so, SIO_KEEPALIVE_VALS, &ka, sizeof(ka), NULL, 0, &cb, NULL, NULL);
+#else
+		int on = 1, idle = idle_ms / 1000, interval = interval_ms / 1000;
+		setsockopt(so, SOL_SOCKET, SO_KEEPALIVE, &on, sizeof(on));
+		setsockopt(so, IPPROTO_TCP, TCP_KEEPIDLE, &idle, sizeof(idle));
+		setsockopt(so, IPPROTO_TCP, TCP_KEEPINTVL, &interval, sizeof(interval));
+#endif
+	}
+
+	int send_all(SOCKET so, const char* buf, std::size_t len)
+	{
+#ifdef MSG_NOSIGNAL
+		const int flags = MSG_NOSIGNAL;
+#else
+		const int flags = 0;
+#endif
+		while (len)
+		{
+			const int n = send(so, buf, int(len < 0x40000000 ? len : 0x40000000), flags);
+			if (n <= 0)
+			{
+#ifndef _WIN32
+				if (n < 0 && errno == EINTR)
+					continue;
+#endif
+				return -1;
+			}
+			buf += n;
+			len -= n;
 		}
-
-		tcpstruct_client* op = new tcpstruct_client;
-		memset(op, 0, sizeof(tcpstruct_client));
-
-		op->so = this;
-		op->state = tcp_connt_client;
-		op->bufOffset = 0;
-		op->buf = NULL;
-		op->bufSize = 0;
-
-		PostQueuedCompletionStatus(g_iocp_client, 0, NULL, (LPOVERLAPPED)op);
-	}
-	return 0;
-}
-
-void tcp_client::OnConnect(bool ercode, P_tcpstruct_client op)
-{
-
-	setsockopt(m_so, SOL_SOCKET, 0x7010, NULL, 0);
-	debug_put((void*)g_fun_client);
-
-	g_fun_client(this, m_so, 1, NULL, 0);
-
-	if (ercode)
-	{
-		OnClose(ercode, op);
-		return;
-	}
-
-	delete[]op->buf;
-
-	if (m_Is)
-	{
-		op->buf = new char[sizeof(DWORD)];
-		op->bufSize = sizeof(DWORD);
-	}
-	else
-	{
-		op->buf = new char[tcp_len];
-		op->bufSize = tcp_len;
-	}
-	op->state = tcp_recv_client;
-	op->bufOffset = 0;
-
-
-
-	if (1 == SoRecv(op))
-	{
-		OnClose(ercode, op);
-		return;
-	}
-}
-void tcp_client::OnRecv(bool ercode, P_tcpstruct_client op)
-{
-
-	if (ercode)
-	{
-		OnClose(ercode, op);
-		return;
+		return 0;
 	}
 
-	if (m_Is)
+	int send_frame(SOCKET so, BOOL framed, const char* buf, std::size_t len)
 	{
-
-		op->bufOffset += op->cb; //´С
-
-		if (op->bufOffset < op->bufSize) //Լ
+		char head[kHeaderSize];
+		put_header(head, std::uint32_t(len));
+		const std::size_t head_len = framed ? kHeaderSize : 0;
+#ifdef _WIN32
+		WSABUF wsabuf[2] = { { ULONG(head_len), head }, { ULONG(len), const_cast<char*>(buf) } };
+		DWORD sent = 0;
+		if (WSASend(so, wsabuf, 2, &sent, 0, NULL, NULL))
 		{
-			if (1 == SoRecv(op))
-			{
-				OnClose(ercode, op);
-				return;
-			}
-			return;
+			return -1;
 		}
-
-		DWORD size = *((DWORD*)(op->buf));
-
-		if (size > 65536000) //ݴ
+#else
+		iovec iov[2] = { { head, head_len }, { const_cast<char*>(buf), len } };
+		msghdr msg = {};
+		msg.msg_iov = iov;
+		msg.msg_iovlen = 2;
+		ssize_t sent;
+		do
 		{
-			OnClose(ercode, op);
-			return;
-		}
-
-		if (op->bufOffset < DWORD(sizeof(DWORD)) + size)  //Լ
+			sent = sendmsg(so, &msg, MSG_NOSIGNAL);
+		} while (sent < 0 && errno == EINTR);
+		if (sent < 0)
 		{
-
-			delete[] op->buf;
-
-			op->buf = new char[sizeof(DWORD) + size];
-			op->bufSize = sizeof(DWORD) + size;
-			op->bufOffset = sizeof(DWORD);
-
-			memcpy(op->buf, &size, sizeof(DWORD));
-
-			if (1 == SoRecv(op))
-			{
-				OnClose(ercode, op);
-				return;
-			}
-			return;
+			return -1;
 		}
-
-		if (op->bufSize - sizeof(DWORD) > 0)
+#endif
+		//׽ͨһη,ûĲβ
+		std::size_t done = std::size_t(sent);
+		if (done < head_len)
 		{
-			if (m_isok > 0)
+			if (send_all(so, head + done, head_len - done))
 			{
-				memcpy(m_buf, op->buf + sizeof(DWORD), op->bufSize - sizeof(DWORD));
-				m_isok = 0;
+				return -1;
 			}
-			g_fun_client(this, m_so, 2, op->buf + sizeof(DWORD), op->bufSize - sizeof(DWORD));
-
+			done = 0;
 		}
-
-		delete[] op->buf;
-		op->buf = new char[sizeof(DWORD)];
-		op->bufSize = sizeof(DWORD);
-
-	}
-	else
-	{
-
-		if (m_isok > 0)
+		else
 		{
-			memcpy(m_buf, op->buf, op->cb);
+			done -= head_len;
 		}
-		g_fun_client(this, m_so, 2, op->buf, op->cb);
-		m_isok = 0;
+		return send_all(so, buf + done, len - done);
 	}
 
-	op->bufOffset = 0;
-
-	if (1 == SoRecv(op))
+	bool frames_size(const etcp_buf* bufs, int count, BOOL framed, std::size_t& total)
 	{
-		OnClose(ercode, op);
-		return;
-	}
-}
-int tcp_client::SoRecv(P_tcpstruct_client op)
-{
-	op->so = this;
-	op->state = tcp_recv_client;
-
-	WSABUF wsabuf;
-	wsabuf.buf = op->buf + op->bufOffset;
-	wsabuf.len = op->bufSize - op->bufOffset;
-
-	DWORD Flg = 0;
-	if (WSARecv(m_so, &wsabuf, 1, &op->cb, &Flg, (LPWSAOVERLAPPED)op, NULL))
-	{
-		int ercode = WSAGetLastError();
-		if (ercode == WSAEFAULT)
+		total = 0;
+		if (count < 0 || (count && !bufs))
 		{
-			return 0;
+			return false;
 		}
-		else if (ercode != WSA_IO_PENDING)
+		for (int i = 0; i < count; i++)
 		{
-			return 1;
+			if (bufs[i].len < 0 || std::uint32_t(bufs[i].len) > kMaxFrame || (bufs[i].len && !bufs[i].buf))
+			{
+				return false;
+			}
+			total += (framed ? kHeaderSize : 0) + std::size_t(bufs[i].len);
+			//WSABUFĳֻ32λ
+			if (total > 0x7FFFFFFF)
+			{
+				return false;
+			}
 		}
+		return true;
 	}
-	return 0;
-}
-void tcp_client::OnClose(bool ercode, P_tcpstruct_client op)
-{
-	delete[]op->buf;
-	op->buf = NULL;
-
-	delete op;
-	op = NULL;
-
-	g_fun_client(this, m_so, 3, NULL, 0);
-
-	Close();
-}
-int tcp_client::Close()
-{
-	closesockets(m_so);
-	m_so = INVALID_SOCKET;
-	return 0;
-}
-
-int tcp_client::SoSend(char* buf, DWORD cb, int isok, char* outbuf, int outtime)
-{
-	if (cb > 65536000)
-	{
-		return 0;
-	}
-
-	m_isok = isok;
-	m_buf = outbuf;
-
-	tcpstruct_client* op = new tcpstruct_client;
-	memset(op, 0, sizeof(tcpstruct_client));
-	op->so = this;
-	op->state = tcp_send_client;
-
-	WSABUF wsabuf;
 
-	if (m_Is)
+	void pack_frames(char* out, const etcp_buf* bufs, int count, BOOL framed)
 	{
-		op->buf = new char[sizeof(DWORD) + cb];
-		op->bufSize = sizeof(DWORD) + cb;
-		wsabuf.buf = op->buf;
-		wsabuf.len = op->bufSize;
-		memcpy(wsabuf.buf, &cb, sizeof(DWORD));
-		memcpy(wsabuf.buf + sizeof(DWORD), buf, cb);
-	}
-	else
-	{
-		op->buf = buf;
-		op->bufSize = cb;
-		wsabuf.buf = op->buf;
-		wsabuf.len = op->bufSize;
-	}
-
-
-	if (WSASend(m_so, &wsabuf, 1, &op->cb, 0, (LPWSAOVERLAPPED)op, NULL))
-	{
-		int ercode = WSAGetLastError();
-		if (ercode != WSA_IO_PENDING)
+		for (int i = 0; i < count; i++)
 		{
-			delete[]op->buf;
-			delete op;
-			return 1;
-		}
-
-	}
-	int ni = 0;
-	if (outtime <= 0)
-	{
-		outtime = 2;
+			if (framed)
+			{
+				put_header(out, std::uint32_t(bufs[i].len));
+				out += kHeaderSize;
+			}
+			if (bufs[i].len)
+			{
+				memcpy(out, bufs[i].buf, bufs[i].len);
+				out += bufs[i].len;
+			}
+		}
 	}
-	outtime = outtime * 1000;
-	while (1 == m_isok)
+
+	void queue_bytes(std::deque<send_data>& q, const void* p, std::size_t len)
 	{
-		ni++;
-		if (ni > outtime)
+		if (len == 0)
 		{
-			m_isok = 0;
-			m_buf = NULL;
-			break;
+			return;
+		}
+		if (q.empty() || q.back().size() + len > kCoalesceSize)
+		{
+			q.emplace_back();
+			q.back().reserve(len < kCoalesceSize ? kCoalesceSize / 4 : len);
 		}
-		Sleep(1);
+		const auto b = static_cast<const unsigned char*>(p);
+		q.back().insert(q.back().end(), b, b + len);
 	}
-	return 0;
-}
 
-void tcp_client::OnSend(bool ercode, P_tcpstruct_client op)
-{
-	if (ercode)
-	{
-		OnClose(ercode, op);
-		return;
-	}
-	if (m_Is)
+	void queue_data(std::deque<send_data>& q, send_data&& data)
 	{
-		delete[]op->buf;
-		delete op;
+		if (!q.empty() && q.back().size() + data.size() <= kCoalesceSize)
+		{
+			q.back().insert(q.back().end(), data.begin(), data.end());
+			return;
+		}
+		if (!data.empty())
+		{
+			q.push_back(std::move(data));
+		}
 	}
-}
 
-int tcp_client::SoProxySocks4(PCHAR host, WORD port, PCHAR username, PCHAR userpass)
-{
-	PHOSTENT ph = gethostbyname(host);
-
-	if (NULL == ph)
+	void queue_frames(std::deque<send_data>& q, const etcp_buf* bufs, int count, BOOL framed)
 	{
-		return -1;
+		for (int i = 0; i < count; i++)
+		{
+			if (framed)
+			{
+				char head[kHeaderSize];
+				put_header(head, std::uint32_t(bufs[i].len));
+				queue_bytes(q, head, kHeaderSize);
+			}
+			queue_bytes(q, bufs[i].buf, std::size_t(bufs[i].len));
+		}
 	}
 
-	DWORD ip = *LPDWORD(ph->h_addr_list[0]);
-
-	int cb = 0;
-
-	BYTE buffer[1024];
-
-	buffer[cb] = 0x04; cb++;
-	buffer[cb] = 0x01; cb++;
-	buffer[cb] = BYTE(port >> 8); cb++;
-	buffer[cb] = BYTE(port >> 0); cb++;
-	buffer[cb] = BYTE(ip >> 0x00); cb++;
-	buffer[cb] = BYTE(ip >> 0x08); cb++;
-	buffer[cb] = BYTE(ip >> 0x10); cb++;
-	buffer[cb] = BYTE(ip >> 0x18); cb++;
-
-	lstrcpyA((PCHAR)buffer + cb, username); cb += 1 + lstrlenA(username);
-
-	cb = send(m_so, (PCHAR)buffer, cb, 0);
+	namespace {
+		thread_local bool t_request_valid = false;
+		thread_local std::uint32_t t_request_id = 0;
+	}
 
-	if (cb <= 0)
+	request_scope::request_scope(std::uint32_t flags, std::uint32_t id)
+		: m_prev_valid(t_request_valid), m_prev_id(t_request_id)
 	{
-		return -1;
+		t_request_valid = (flags & kRequestFlag) != 0;
+		t_request_id = id;
 	}
 
-	cb = recv(m_so, (PCHAR)buffer, sizeof(buffer), 0);
-
-	if (cb <= 0)
+	request_scope::~request_scope()
 	{
-		return -1;
+		t_request_valid = m_prev_valid;
+		t_request_id = m_prev_id;
 	}
 
-	if (buffer[0] != 0x00)
+	bool current_request(std::uint32_t& id)
 	{
-		return -1;
+		id = t_request_id;
+		return t_request_valid;
 	}
 
-	if (buffer[1] != 0x5A)
+	int recv_all(SOCKET so, char* buf, std::size_t len)
 	{
-		return -1;
+		while (len)
+		{
+			const int n = recv(so, buf, int(len < 0x40000000 ? len : 0x40000000), 0);
+			if (n <= 0)
+			{
+#ifndef _WIN32
+				if (n < 0 && errno == EINTR)
+					continue;
+#endif
+				return -1;
+			}
+			buf += n;
+			len -= n;
+		}
+		return 0;
 	}
+}
 
-	return 0;
+char* tcp::get_ip(SOCKET so)
+{
+	sockaddr_in in;
+	etcp::socklen len = sizeof(in);
+	getpeername(so, (sockaddr*)&in, &len);
+	return inet_ntoa(in.sin_addr);
 }
-int tcp_client::SoProxySocks5(PCHAR host, WORD port, PCHAR username, PCHAR userpass)
+u_short tcp::get_port()
 {
-	BYTE buffer[1024];
-
-	buffer[0x00] = 0x05;
-	buffer[0x01] = 0x02;
-	buffer[0x02] = 0x00;
-	buffer[0x03] = 0x02;
-
-	int cb;
-
-	cb = send(m_so, (PCHAR)buffer, 0x04, 0);
-
-	if (cb <= 0)
-	{
-		return -1;
-	}
-
-	cb = recv(m_so, (PCHAR)buffer, sizeof(buffer), 0);
+	sockaddr_in in;
+	etcp::socklen len = sizeof(in);
+	getsockname(m_so, (sockaddr*)&in, &len);
+	//return inet_ntoa(in.sin_addr);
+	return ntohs(in.sin_port);
+}
 
-	if (cb <= 0)
+int tcp_client::Init(char* host, unsigned short nPort, BOOL nIs, EProxyType proxyType, PCHAR proxyhost, WORD proxyport, PCHAR username, PCHAR userpass, int time)
+{
+	m_so = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+	if (INVALID_SOCKET == m_so)
 	{
-		return -1;
+		return etcp::last_error();
 	}
 
-	if (buffer[0x00] != 0x05)
-	{
-		return -1;
-	}
+	m_Is = nIs;
 
-	if (buffer[0x01] == 0x02)
+	if (PROXY_TYPE_NONE == proxyType)
 	{
-		int cbs = 0;
-		int cbuser = lstrlenA(username);
-		int cbpass = lstrlenA(userpass);
-
-		buffer[cbs] = 0x01;		cbs++;
-		buffer[cbs] = cbuser;	cbs++; cbs += (wsprintfA((PCHAR)buffer + cbs, username, cbuser));
-		buffer[cbs] = cbpass;	cbs++; cbs += (wsprintfA((PCHAR)buffer + cbs, userpass, cbpass));
-
-		cb = send(m_so, (PCHAR)buffer, cbs, 0);
-
-		if (cb <= 0)
+		if (etcp::connect_timeout(m_so, host, nPort, time))
 		{
-			return -1;
+			closesockets(m_so);
+			m_so = INVALID_SOCKET;
+			return 1;
 		}
-
-
-		cb = recv(m_so, (PCHAR)buffer, sizeof(buffer), 0);
-
-		if (cb <= 0)
+	}
+	else
+	{
+		if (etcp::connect_timeout(m_so, proxyhost, proxyport, time))
 		{
-			return -1;
+			closesockets(m_so);
+			m_so = INVALID_SOCKET;
+			return 1;
 		}
 
-		if (buffer[0x00] != 0x05)
-		{
-			//RFC 1929 NO EXPLAIN(Ժ֤)
-		}
+		etcp::set_io_timeout(m_so, 30000);
+		etcp::set_keepalive(m_so, 5000, 5000);
 
-		if (buffer[0x01] != 0x00)
+		int ercode = etcp::proxy_handshake(m_so, proxyType, host, nPort, username, userpass);
+		if (ercode)
 		{
-			return -1;
+			closesockets(m_so);
+			m_so = INVALID_SOCKET;
+			return ercode;
 		}
-
-	}
-	else if (buffer[0x01] == 0x00)
-	{
 	}
-	else
+
+	int ercode = Attach();
+	if (ercode)
 	{
-		return -1;
+		closesockets(m_so);
+		m_so = INVALID_SOCKET;
 	}
+	return ercode;
+}
 
-	int cbs = 0;
-	int cbhost = lstrlenA(host);
-
-	buffer[cbs] = 0x05;			cbs++;
-	buffer[cbs] = 0x01;			cbs++;
-	buffer[cbs] = 0x00;			cbs++;
-	buffer[cbs] = 0x03;			cbs++;
-	buffer[cbs] = cbhost;		cbs++; cbs += (wsprintfA((PCHAR)buffer + cbs, host, cbhost));
-	buffer[cbs] = (port >> 8);	cbs++;
-	buffer[cbs] = (port >> 0);	cbs++;
-
-	cb = send(m_so, (PCHAR)buffer, cbs, 0);
-
-	if (cb <= 0)
+int tcp::SoReply(SOCKET so, std::uint32_t id, const char* buf, DWORD cb)
+{
+	if (!m_Is || cb > etcp::kMaxFrame)
 	{
-		return -1;
+		return 1;
 	}
+	char head[etcp::kTaggedHeaderSize];
+	etcp::put_tagged_header(head, cb, etcp::kReplyFlag, id);
+	const etcp_buf bufs[2] = { { head, int(sizeof(head)) }, { buf, int(cb) } };
+	return PostSendv(so, bufs, 2, FALSE);
+}
 
-	cb = recv(m_so, (PCHAR)buffer, sizeof(buffer), 0);
+/*һRequestõȫһȴ*/
+struct tcp_client::request_batch
+{
+	std::condition_variable cv;
+	int remaining = 0;
+	bool closed = false;
+};
 
-	if (cb <= 0)
+int tcp_client::SoSend(char* buf, DWORD cb, int isok, char* outbuf, int outtime, std::size_t outsize)
+{
+	if (cb > etcp::kMaxFrame)
 	{
-		return -1;
+		return 1;
 	}
-
-
-	if (buffer[0x00] != 0x05)
+	if (isok)
 	{
-		return -1;
+		std::lock_guard<std::mutex> lock(m_wait_mu);
+		m_buf = outbuf;
+		m_buf_size = outsize;
+		m_isok = 1;
 	}
 
-	if (buffer[0x01] != 0x00)
+	const etcp_buf one = { buf, int(cb) };
+	const int ret = PostSendv(&one, 1, m_Is);
+	if (ret)
 	{
-		return -1;
+		CancelReply();
+		return ret;
 	}
-
+	WaitReply(outtime);
 	return 0;
 }
-int tcp_client::SoProxyHttp(PCHAR host, WORD port, PCHAR username, PCHAR userpass)
-{
-	int cb = 0;
-	int cbhdr;
-	int cbrecv;
-
-	char http[8192];
-
-	cb += (wsprintfA((PCHAR)http + cb, "CONNECT %s:%d HTTP/1.1\r\n", host, port));
-	cb += (wsprintfA((PCHAR)http + cb, "Host: %s:%d \r\n", host, port));
-	cb += (wsprintfA((PCHAR)http + cb, "Proxy-Connection: Keep-Alive\r\n"));
 
-
-	if (username && username[0])
+int tcp_client::SoSend(etcp::send_data&& data, int isok, char* outbuf, int outtime, std::size_t outsize)
+{
+	if (data.size() > etcp::kMaxFrame)
 	{
-		char b64[128];
-		char b64encode[256];
-
-		lstrcpyA(b64, username);
-		lstrcatA(b64, ":");
-		lstrcatA(b64, userpass);
-
-		if (CETCPBase64::b64Encode((PBYTE)b64, lstrlenA(b64), (PBYTE)b64encode, 256))
-		{
-			cb += (wsprintfA((PCHAR)http + cb, "Proxy-Authorization: Basic %s\r\n", b64encode));
-		}
-
+		return 1;
 	}
-	else
+	if (isok)
 	{
-		cb += (wsprintfA((PCHAR)http + cb, "Proxy-Authorization: Basic *\r\n"));
+		std::lock_guard<std::mutex> lock(m_wait_mu);
+		m_buf = outbuf;
+		m_buf_size = outsize;
+		m_isok = 1;
 	}
 
-	cb += (wsprintfA((PCHAR)http + cb, "Content-length: 0\r\n\r\n"));
-
-	unsigned long ul = 0;
-	ioctlsocket(m_so, FIONBIO, (unsigned long*)&ul);
-	cb = send(m_so, (PCHAR)http, cb, 0);
-
-
-	if (cb <= 0)
+	const int ret = PostSendData(std::move(data));
+	if (ret)
 	{
-		return -1;
+		CancelReply();
+		return ret;
 	}
+	WaitReply(outtime);
+	return 0;
+}
 
+/*outtime(0ʱΪ2),ֱOnDataѻظƵm_buf*/
+void tcp_client::WaitReply(int outtime)
+{
+	if (outtime <= 0)
+	{
+		outtime = 2;
+	}
+	const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(outtime);
+	std::unique_lock<std::mutex> lock(m_wait_mu);
+	m_reply_cv.wait_until(lock, deadline, [this] { return !m_isok; });
+	m_isok = 0;
+	m_buf = NULL;
+}
 
-	cb = 0;
-	cb = 0;
-	cb = 0;
+void tcp_client::CancelReply()
+{
+	std::lock_guard<std::mutex> lock(m_wait_mu);
+	m_isok = 0;
+	m_buf = NULL;
+}
 
-	while (1)
+int tcp_client::Request(const etcp_buf* bufs, int count, etcp::send_data* replies, int timeout_ms)
+{
+	std::size_t total = 0;
+	if (!m_Is || count <= 0 || !etcp::frames_size(bufs, count, TRUE, total))
 	{
+		return 1;
+	}
+	if (timeout_ms <= 0)
+	{
+		timeout_ms = 2000;
+	}
+	const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms);
 
-		cbrecv = recv(m_so, (PCHAR)http, 8192 - cb, 0);
-
-		if (cbrecv <= 0)
+	//ÿ"ŵĳͷ + ÷",ȫһν
+	request_batch batch;
+	std::vector<std::uint32_t> ids(count);
+	std::vector<char> heads(std::size_t(count) * etcp::kTaggedHeaderSize);
+	std::vector<etcp_buf> parts(std::size_t(count) * 2);
+	{
+		std::lock_guard<std::mutex> lock(m_wait_mu);
+		if (m_closed)
 		{
-			return -1;
+			return 2;
 		}
-
-		cb = cb + cbrecv;
-
-		for (cbhdr = 4; cbhdr <= cb; cbhdr++)
+		for (int i = 0; i < count; i++)
 		{
-			if (http[cbhdr - 4] == '\r')
-				if (http[cbhdr - 3] == '\n')
-					if (http[cbhdr - 2] == '\r')
-						if (http[cbhdr - 1] == '\n')
-						{
-							break;
-						}
-		}
+			while (m_pending.count(m_next_id))
+			{
+				m_next_id++;
+			}
+			ids[i] = m_next_id++;
+			m_pending[ids[i]] = { &batch, &replies[i] };
+			replies[i].clear();
 
-		if (cbhdr <= cb)
-		{
-			break;
+			char* head = &heads[std::size_t(i) * etcp::kTaggedHeaderSize];
+			etcp::put_tagged_header(head, std::uint32_t(bufs[i].len), etcp::kRequestFlag, ids[i]);
+			parts[std::size_t(i) * 2] = { head, int(etcp::kTaggedHeaderSize) };
+			parts[std::size_t(i) * 2 + 1] = bufs[i];
 		}
+		batch.remaining = count;
 	}
 
-	if (0 != (memcmp(http, "HTTP/1.0 200 ", 13)))
-		if (0 != (memcmp(http, "HTTP/1.1 200 ", 13)))
+	const bool sent = PostSendv(parts.data(), int(parts.size()), FALSE) == 0;
+
+	std::unique_lock<std::mutex> lock(m_wait_mu);
+	if (sent)
+	{
+		batch.cv.wait_until(lock, deadline, [&batch] { return batch.remaining == 0; });
+	}
+	//ʱϿʱ»ûлظ,֮ٵĻظ
+	for (std::uint32_t id : ids)
+	{
+		auto it = m_pending.find(id);
+		if (it != m_pending.end() && it->second.batch == &batch)
 		{
-			return -1;
+			m_pending.erase(it);
 		}
-
-	return 0;
+	}
+	if (!sent)
+	{
+		return 1;
+	}
+	return batch.remaining == 0 && !batch.closed ? 0 : 2;
 }
 
-
-
-
-
-
-
-
-
-
-
-unsigned __stdcall tcp_iocp_fun(void* pParam)
+void tcp_client::OnData(char* buf, DWORD len, std::uint32_t flags, std::uint32_t id)
 {
-	while (true)
+	if (flags & etcp::kReplyFlag)
 	{
-		ULONG cb = NULL;
-		ULONG_PTR key = NULL;
-		tcpstruct* op = NULL;
-		bool error = false;
-
-		if (!GetQueuedCompletionStatus(g_iocp, &cb, (PULONG_PTR)&key, (LPOVERLAPPED*)&op, INFINITE))
-		{
-			error = true;
-		}
-		tcp* so = op->so;
-		if (op->state == tcp_recv && 0 >= cb)
-		{
-			error = true;
-		}
-		op->cb = cb;
-
-		if (so->m_Close)
+		std::lock_guard<std::mutex> lock(m_wait_mu);
+		auto it = m_pending.find(id);
+		if (it != m_pending.end())
 		{
-			so->OnSend(true, op);
-			continue;
+			it->second.reply->assign((unsigned char*)buf, (unsigned char*)buf + len);
+			request_batch* batch = it->second.batch;
+			m_pending.erase(it);
+			if (--batch->remaining == 0)
+			{
+				batch->cv.notify_one();
+			}
 		}
-		switch (op->state)
+		//ظɵȴRequestȡ,ٽص
+		return;
+	}
+	{
+		std::lock_guard<std::mutex> lock(m_wait_mu);
+		if (m_isok)
 		{
-		case tcp_connt:
-			so->ClientAccept(error, op);
-			break;
-		case tcp_recv:
-			so->RecvData(error, op);
-			break;
-		case tcp_send:
-			so->OnSend(error, op);
-			break;
+			if (m_buf)
+			{
+				memcpy(m_buf, buf, len < m_buf_size ? len : m_buf_size);
+			}
+			m_isok = 0;
+			m_buf = NULL;
+			m_reply_cv.notify_one();
 		}
-
 	}
-	_endthreadex(0);
-	return 0;
+	g_fun_client(this, m_so, tcp_recv_client, buf, len);
 }
-unsigned __stdcall tcp_iocp_fun_client(void* pParam)
+
+void tcp_client::OnClosed()
 {
-	while (true)
 	{
-		ULONG cb = NULL;
-		ULONG_PTR key = NULL;
-		tcpstruct_client* op = NULL;
-		bool error = false;
-
-		if (!GetQueuedCompletionStatus(g_iocp_client, &cb, (PULONG_PTR)&key, (LPOVERLAPPED*)&op, INFINITE))
-		{
-			error = true;
-		}
-		tcp_client* so = op->so;
-		if (op->state == tcp_recv_client && 0 >= cb)
-		{
-			error = true;
-		}
-		op->cb = cb;
-
-		switch (op->state)
+		std::lock_guard<std::mutex> lock(m_wait_mu);
+		m_closed = true;
+		for (auto& it : m_pending)
 		{
-		case tcp_connt_client:
-			so->OnConnect(error, op);
-			break;
-		case tcp_recv_client:
-
-			so->OnRecv(error, op);
-			break;
-		case tcp_send_client:
-			so->OnSend(error, op);
-			break;
+			it.second.batch->remaining = 0;
+			it.second.batch->closed = true;
+			it.second.batch->cv.notify_one();
 		}
+		m_pending.clear();
+		m_isok = 0;
+		m_buf = NULL;
+		m_reply_cv.notify_one();
 	}
-	_endthreadex(0);
-	return 0;
+	g_fun_client(this, m_so, tcp_close_client, NULL, 0);
 }
 
 int __stdcall etcp_vip(tcp_fun nFun, tcp_fun_client cFun, int buflen)
@@ -1424,47 +643,13 @@ int __stdcall etcp_vip(tcp_fun nFun, tcp_fun_client cFun, int buflen)
 	}
 
 	buf_len = buflen;
-
-	WSAData wsa;
-	if (WSAStartup(MAKEWORD(2, 2), &wsa) != 0)
-	{
-		return WSAGetLastError();
-	}
 	g_fun = nFun;
 	g_fun_client = cFun;
-	g_iocp = CreateIoCompletionPort(INVALID_HANDLE_VALUE, NULL, NULL, 0);
-	if (NULL == g_iocp)
-	{
-		CloseHandle(g_iocp);
-		return GetLastError();
-	}
-
-	g_iocp_client = CreateIoCompletionPort(INVALID_HANDLE_VALUE, NULL, NULL, 0);
-	if (NULL == g_iocp_client)
-	{
-		CloseHandle(g_iocp_client);
-		return GetLastError();
-	}
-
-	SYSTEM_INFO info;
-	GetSystemInfo(&info);
-	g_cpu = info.dwNumberOfProcessors + 2;
-	if (g_cpu < 5)
-	{
-		g_cpu = 5;
-	}
-
-	for (int i = 0; i < g_cpu; i++)
-	{
-		CloseHandle((HANDLE)_beginthreadex(NULL, 0, &tcp_iocp_fun, NULL, 0, NULL));
-		CloseHandle((HANDLE)_beginthreadex(NULL, 0, &tcp_iocp_fun_client, NULL, 0, NULL));
-	}
-
-	return 0;
+	return etcp_get_backend()->Start();
 }
 void* __stdcall etcp_tcp_server(const char* host, unsigned short nPort, int nIs)
 {
-	tcp* t_tcp = new tcp;
+	tcp* t_tcp = etcp_get_backend()->NewServer();
 	//int  = t_tcp->Init(host, nPort, nIs);
 
 	if (0 != t_tcp->Init(host, nPort, nIs))
@@ -1483,13 +668,48 @@ int __stdcall etcp_tcp_sends(HANDLE sso, SOCKET so, char* buf, int len)
 {
 	return ((tcp*)sso)->SoSends(so, buf, len);
 }
+int __stdcall etcp_tcp_sendv(HANDLE sso, SOCKET so, const etcp_buf* bufs, int count)
+{
+	return ((tcp*)sso)->SoSendv(so, bufs, count);
+}
+int __stdcall etcp_tcp_request_id(unsigned int* id)
+{
+	std::uint32_t n = 0;
+	const bool is_request = etcp::current_request(n);
+	if (id)
+	{
+		*id = n;
+	}
+	return is_request ? 1 : 0;
+}
+int __stdcall etcp_tcp_reply(HANDLE sso, SOCKET so, unsigned int id, char* buf, int len)
+{
+	if (len < 0)
+	{
+		return 1;
+	}
+	return ((tcp*)sso)->SoReply(so, id, buf, len);
+}
+int __stdcall etcp_tcp_set_send_limits(HANDLE sso, unsigned int high, unsigned int low)
+{
+	((tcp*)sso)->m_limits.set(high, low);
+	return 0;
+}
+int __stdcall etcp_tcp_queue_info(HANDLE sso, SOCKET so, etcp_queue_info* info)
+{
+	return ((tcp*)sso)->QueueInfo(so, *info);
+}
 int __stdcall etcp_tcp_close_Client(SOCKET so)
 {
-	return closesockets(so);
+	return etcp_get_backend()->CloseSocket(so, true);
 }
 int __stdcall etcp_tcp_close(HANDLE so)
 {
+#ifdef _WIN32
 	if (IsBadReadPtr(so, 4) != 0)
+#else
+	if (!so)
+#endif
 	{
 		return 0;
 	}
@@ -1512,7 +732,7 @@ char* __stdcall etcp_tcp_get_ip(HANDLE so, SOCKET client_so)
 
 void* __stdcall etcp_tcp_client(char* host, unsigned short nPort, BOOL nIs, EProxyType proxyType, PCHAR proxyhost, WORD proxyport, PCHAR username, PCHAR userpass, int time)
 {
-	tcp_client* t_tcp = new tcp_client;
+	tcp_client* t_tcp = etcp_get_backend()->NewClient();
 	if (0 != t_tcp->Init(host, nPort, nIs, proxyType, proxyhost, proxyport, username, userpass, time))
 	{
 		delete t_tcp;
@@ -1525,7 +745,35 @@ int __stdcall etcp_tcp_client_send(HANDLE so, char* buf, int len, int isok, char
 {
 	return ((tcp_client*)so)->SoSend(buf, len, isok, outbuf, outtime);
 }
+int __stdcall etcp_tcp_client_sendv(HANDLE so, const etcp_buf* bufs, int count)
+{
+	return ((tcp_client*)so)->SoSendv(bufs, count);
+}
 
+int __stdcall etcp_tcp_client_request(HANDLE so, char* buf, int len, char* outbuf, int outsize, int* outlen, int timeout_ms)
+{
+	const etcp_buf one = { buf, len };
+	etcp::send_data reply;
+	const int ret = ((tcp_client*)so)->Request(&one, 1, &reply, timeout_ms);
+	if (outbuf && outsize > 0 && !reply.empty())
+	{
+		memcpy(outbuf, reply.data(), reply.size() < std::size_t(outsize) ? reply.size() : std::size_t(outsize));
+	}
+	if (outlen)
+	{
+		*outlen = int(reply.size());
+	}
+	return ret;
+}
+int __stdcall etcp_tcp_client_set_send_limits(HANDLE so, unsigned int high, unsigned int low)
+{
+	((tcp_client*)so)->m_limits.set(high, low);
+	return 0;
+}
+int __stdcall etcp_tcp_client_queue_info(HANDLE so, etcp_queue_info* info)
+{
+	return ((tcp_client*)so)->QueueInfo(*info);
+}
 int __stdcall etcp_tcp_client_close(HANDLE so)
 {
 	return ((tcp_client*)so)->Close();
@@ -1546,13 +794,13 @@ bool __stdcall etcp_get_ip(char* ip)
 		return false;
 	}
 	//3.ȡip
-	HOSTENT* host = gethostbyname(hostname);
-	if (host == NULL)
+	in_addr addr;
+	if (!etcp::resolve_ipv4(hostname, addr))
 	{
 		return false;
 	}
 	//4.תΪchar*
-	strcpy(ip, inet_ntoa(*(in_addr*)*host->h_addr_list));
+	strcpy(ip, inet_ntoa(addr));
 	return true;
 }
 
@@ -1562,6 +810,8 @@ SOCKET __stdcall etcp_tcp_get_socket(HANDLE so)
 }
 
 
+#ifdef _WIN32
+#include"Tace.hpp"
 namespace etcpkrnln {
 	///ⲿӿں
 
@@ -1593,10 +843,7 @@ namespace etcpkrnln {
 
 	bool  myetcp_server_close(SOCKET  hSoket, bool  is_retnow)//Ͽͻˡ
 	{
-		if (is_retnow) {
-			return etcp_tcp_close_Client(hSoket) == 0;
-		}
-		return closesocket(hSoket) == 0;
+		return etcp_get_backend()->CloseSocket(hSoket, is_retnow) == 0;
 	}
 	bool  myetcp_server_over(void* pS)//ر
 	{
@@ -1648,20 +895,36 @@ namespace etcpkrnln {
 
 	bool  clinet_send_f(void* pC, vector<unsigned char>  data, bool  is_ret = false, vector<unsigned char>* pRetData = NULL, int delay_ret = 2)//ͳɹtrue
 	{
-		size_t len = data.size();
 		if (IsBadReadPtr(pC, sizeof(void*)) != 0) {
 			return false;
 		}
+		//dataǱĸ,ֱӽ˷,ٸ
 		if (pRetData)
 		{
 			char* ret_data = new char[pRetData->size()];
-			bool Ret = etcp_tcp_client_send(pC, (char*)data.data(), len, is_ret, ret_data, delay_ret) == 0;
+			bool Ret = ((tcp_client*)pC)->SoSend(std::move(data), is_ret, ret_data, delay_ret, pRetData->size()) == 0;
 			*pRetData = vector<unsigned char>((unsigned char*)ret_data, (unsigned char*)ret_data + pRetData->size());
 			delete[]ret_data;
 			return Ret;
 		}
 
-		return etcp_tcp_client_send(pC, (char*)data.data(), len, is_ret, 0, delay_ret) == 0;
+		return ((tcp_client*)pC)->SoSend(std::move(data), is_ret, 0, delay_ret) == 0;
+	}
+	bool  clinet_sendv_f(void* pC, const vector<pair<const void*, size_t>>& datas)//ͳɹtrue
+	{
+		if (IsBadReadPtr(pC, sizeof(void*)) != 0) {
+			return false;
+		}
+		vector<etcp_buf> bufs(datas.size());
+		for (size_t i = 0; i < datas.size(); i++)
+		{
+			if (datas[i].second > etcp::kMaxFrame) {
+				return false;
+			}
+			bufs[i].buf = (const char*)datas[i].first;
+			bufs[i].len = int(datas[i].second);
+		}
+		return etcp_tcp_client_sendv(pC, bufs.data(), int(bufs.size())) == 0;
 	}
 
 	bool  myetcp_server_send(void* pS, SOCKET  scoket, vector<unsigned char> data, bool  is_ret)//ͳɹtrue
@@ -1673,10 +936,58 @@ namespace etcpkrnln {
 		if (is_ret) {
 			return etcp_tcp_sends(pS, scoket, (char*)data.data(), len) == 0;
 		}
-		return  etcp_tcp_send(pS, scoket, (char*)data.data(), len) == 0;
+		//dataǱĸ,ֱӽ˷,ٸ
+		return ((tcp*)pS)->SoSendData(scoket, std::move(data)) == 0;
+	}
+	bool  myetcp_server_set_limits(void* pS, unsigned int high, unsigned int low)
+	{
+		return etcp_tcp_set_send_limits(pS, high, low) == 0;
+	}
+	bool  myetcp_server_queue(void* pS, SOCKET  scoket, int* depth, long long* bytes)//ͻڷfalse
+	{
+		etcp_queue_info info = {};
+		if (etcp_tcp_queue_info(pS, scoket, &info)) {
+			return false;
+		}
+		*depth = info.depth;
+		*bytes = info.bytes;
+		return true;
+	}
+	bool  myetcp_server_sendv(void* pS, SOCKET  scoket, const vector<pair<const void*, size_t>>& datas)//ͳɹtrue
+	{
+		vector<etcp_buf> bufs(datas.size());
+		for (size_t i = 0; i < datas.size(); i++)
+		{
+			if (datas[i].second > etcp::kMaxFrame) {
+				return false;
+			}
+			bufs[i].buf = (const char*)datas[i].first;
+			bufs[i].len = int(datas[i].second);
+		}
+		return etcp_tcp_sendv(pS, scoket, bufs.data(), int(bufs.size())) == 0;
 	}
 
 
+	bool  clinet_set_limits_f(void* pC, unsigned int high, unsigned int low)
+	{
+		if (IsBadReadPtr(pC, sizeof(void*)) != 0) {
+			return false;
+		}
+		return etcp_tcp_client_set_send_limits(pC, high, low) == 0;
+	}
+	bool  clinet_queue_f(void* pC, int* depth, long long* bytes)
+	{
+		if (IsBadReadPtr(pC, sizeof(void*)) != 0) {
+			return false;
+		}
+		etcp_queue_info info = {};
+		if (etcp_tcp_client_queue_info(pC, &info)) {
+			return false;
+		}
+		*depth = info.depth;
+		*bytes = info.bytes;
+		return true;
+	}
 	bool  clinet_leave_f(void* pC)//Ͽ
 	{
 		if (IsBadReadPtr(pC, sizeof(void*)) != 0) {
@@ -1695,3 +1006,4 @@ namespace etcpkrnln {
 		return etcp_tcp_get_socket(pS);
 	}
 }
+#endif
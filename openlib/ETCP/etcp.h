@@ -1,12 +1,41 @@
+#pragma once
 #pragma warning(disable:4091)
+#ifdef _WIN32
 #include <SDKDDKVer.h>
 #define WIN32_LEAN_AND_MEAN
 #include <windows.h>
 #include <WinSock2.h>
+#include <WS2tcpip.h>
 #pragma comment(lib,"WS2_32.lib")
 #include <mswsock.h>
 #include <MSTcpIP.h>
 #include <process.h>
+#else
+/*Windowsƽ̨(epoll)ֻҪЩWindowsͬ,ʹӿڵдһ*/
+#include <cstdint>
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+#include <netdb.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <errno.h>
+typedef int SOCKET;
+typedef void* HANDLE;
+typedef std::uint32_t DWORD;
+typedef unsigned short WORD;
+typedef int BOOL;
+typedef char* PCHAR;
+#define INVALID_SOCKET	(-1)
+#define SOCKET_ERROR	(-1)
+#ifndef TRUE
+#define TRUE	1
+#define FALSE	0
+#endif
+#define __stdcall
+#endif
 
 #define tcp_connt	1
 #define tcp_recv	2
@@ -21,140 +50,63 @@
 
 #define tcp_len				65535
 
+/*첽͵ķֵ:ŶӴѴﵽˮλ,ûб.ˮλʱһtcp_send(ͻΪtcp_send_client)*/
+#define tcp_send_full		2
+
 typedef void(__stdcall* tcp_fun)(HANDLE Server, SOCKET so, int type, char* buf, int len, int count);
 typedef void(__stdcall* tcp_fun_client)(HANDLE Client, SOCKET so, int type, char* buf, int len);
 
-extern int buf_len;
-extern HANDLE g_iocp;
-extern HANDLE g_iocp_client;
-extern int g_cpu;
-extern tcp_fun g_fun;
-extern tcp_fun_client g_fun_client;
-int closesockets(SOCKET so);
-#pragma once
-
-
-
-class CETCPBase64
+enum EProxyType
 {
-public:
-	CETCPBase64(void);
-	~CETCPBase64(void);
-
-public:
-	static int b64Encode(LPBYTE srcbuf, int cbsrc, LPBYTE dstbuf, int cbdst);
-	static int b64Decode(LPBYTE srcbuf, int cbsrc, LPBYTE dstbuf, int cbdst);
-
-private:
-	static BYTE b64C2B(char c);
-	static char b64B2C(BYTE b);
+	PROXY_TYPE_NONE = 0,
+	PROXY_TYPE_SOCKS4 = 1,
+	PROXY_TYPE_SOCKS5 = 2,
+	PROXY_TYPE_HTTP = 3,
 
 };
 
-class tcp;
-typedef struct tcpstruct
+/*͵һ,֡ģʽÿһ֡*/
+struct etcp_buf
 {
-	OVERLAPPED	op;
-	tcp* so;
-	int			state;
-	SOCKET		c_so;
-	char* buf;
-	DWORD		slen;
-	DWORD		cb;
-
-	DWORD		bufSize;
-	DWORD		bufOffset;
-}S_tcpstruct, * P_tcpstruct;
-
-class tcp
-{
-public:
-	tcp();
-	~tcp();
-public:
-	int Init(const char* host, unsigned short nPort, int nIsSC);
-	int AcceptServer();
-	int Accept();
-	void ClientAccept(bool error, P_tcpstruct op);
-	void RecvData(bool error, P_tcpstruct op);
-	int Close();
-	int SoSend(SOCKET so, char* buf, DWORD cb);
-	int SoSends(SOCKET so, char* buf, DWORD cb);
-	void OnSend(bool ercode, P_tcpstruct op);
-	char* get_ip(SOCKET so)
-	{
-		sockaddr_in in;
-		int len = sizeof(in);
-		getpeername(so, (sockaddr*)&in, &len);
-		return inet_ntoa(in.sin_addr);
-	}
-	SOCKET get_socket()
-	{
-		return m_so;
-	}
-	u_short get_port()
-	{
-		sockaddr_in in;
-		int len = sizeof(in);
-		getsockname(m_so, (sockaddr*)&in, &len);
-		//return inet_ntoa(in.sin_addr);
-		return ntohs(in.sin_port);
-	}
-public:
-	SOCKET m_so;
-	int	m_cnum;
-	CRITICAL_SECTION m_cs;
-	BOOL m_Is;
-	BOOL m_Close;
+	const char* buf;
+	int len;
 };
 
-
-class tcp_client;
-typedef struct tcpstruct_client
+/*һӵķͶ*/
+struct etcp_queue_info
 {
-	OVERLAPPED	op;
-	tcp_client* so;
-	int			state;
-
-	char* buf;
-	DWORD		slen;
-	DWORD		cb;
+	int depth;			//ŶӺڷ͵Ŀ,ŶʱڵС֡Ϊһ
+	long long bytes;	//ѽܵûнϵͳֽ
+};
 
-	DWORD		bufSize;
-	DWORD		bufOffset;
-}S_tcpstruct_client, * P_tcpstruct_client;
-typedef enum EProxyType
-{
-	PROXY_TYPE_NONE = 0,
-	PROXY_TYPE_SOCKS4 = 1,
-	PROXY_TYPE_SOCKS5 = 2,
-	PROXY_TYPE_HTTP = 3,
+int closesockets(SOCKET so);
 
-};
-class tcp_client
-{
-public:
-	tcp_client();
-	~tcp_client();
-	int Init(char* host, unsigned short nPort, BOOL nIs, EProxyType proxyType, PCHAR proxyhost, WORD proxyport, PCHAR username, PCHAR userpass, int time);
-	void OnConnect(bool ercode, P_tcpstruct_client op);
-	void OnClose(bool ercode, P_tcpstruct_client op);
-	void OnRecv(bool ercode, P_tcpstruct_client op);
-	int SoRecv(P_tcpstruct_client op);
-	int Close();
-	int SoSend(char* buf, DWORD cb, int isok, char* outbuf, int outtime);
-	void OnSend(bool ercode, P_tcpstruct_client op);
-	SOCKET get_socket()
-	{
-		return m_so;
-	}
-private:
-	int SoProxySocks4(PCHAR host, WORD port, PCHAR username, PCHAR userpass);
-	int SoProxySocks5(PCHAR host, WORD port, PCHAR username, PCHAR userpass);
-	int SoProxyHttp(PCHAR host, WORD port, PCHAR username, PCHAR userpass);
-public:
-	SOCKET m_so;
-	BOOL m_Is;
-	int m_isok;
-	char* m_buf;
-};
\ No newline at end of file
+/*
+* ӿ.WindowsIOCP,Linuxepoll,ߵĻصʱͳ֡ʽͬ,etcp_backend.h
+*/
+int __stdcall etcp_vip(tcp_fun nFun, tcp_fun_client cFun, int buflen);
+void* __stdcall etcp_tcp_server(const char* host, unsigned short nPort, int nIs);
+int __stdcall etcp_tcp_send(HANDLE sso, SOCKET so, char* buf, int len);
+int __stdcall etcp_tcp_sends(HANDLE sso, SOCKET so, char* buf, int len);
+int __stdcall etcp_tcp_sendv(HANDLE sso, SOCKET so, const etcp_buf* bufs, int count);
+/*tcp_recvصе:һ֡ǿͻ˵ʱ1ȡ,򷵻0*/
+int __stdcall etcp_tcp_request_id(unsigned int* id);
+int __stdcall etcp_tcp_reply(HANDLE sso, SOCKET so, unsigned int id, char* buf, int len);
+/*ø÷ÿͻķͶиߵˮλ(ֽ),highΪ0ʱ.ĬΪ16MB4MB*/
+int __stdcall etcp_tcp_set_send_limits(HANDLE sso, unsigned int high, unsigned int low);
+int __stdcall etcp_tcp_queue_info(HANDLE sso, SOCKET so, etcp_queue_info* info);
+int __stdcall etcp_tcp_close_Client(SOCKET so);
+int __stdcall etcp_tcp_close(HANDLE so);
+u_short __stdcall etcp_tcp_get_port(HANDLE so);
+char* __stdcall etcp_tcp_get_ip(HANDLE so, SOCKET client_so);
+SOCKET __stdcall etcp_tcp_get_socket(HANDLE so);
+void* __stdcall etcp_tcp_client(char* host, unsigned short nPort, BOOL nIs, EProxyType proxyType, PCHAR proxyhost, WORD proxyport, PCHAR username, PCHAR userpass, int time);
+int __stdcall etcp_tcp_client_send(HANDLE so, char* buf, int len, int isok, char* outbuf, int outtime);
+int __stdcall etcp_tcp_client_sendv(HANDLE so, const etcp_buf* bufs, int count);
+/*󲢵ȴĻظ,ظǰoutsizeֽڸƵoutbuf,*outlenΪظʵʳ.ֵͬtcp_client::Request*/
+int __stdcall etcp_tcp_client_request(HANDLE so, char* buf, int len, char* outbuf, int outsize, int* outlen, int timeout_ms);
+int __stdcall etcp_tcp_client_set_send_limits(HANDLE so, unsigned int high, unsigned int low);
+int __stdcall etcp_tcp_client_queue_info(HANDLE so, etcp_queue_info* info);
+int __stdcall etcp_tcp_client_close(HANDLE so);
+SOCKET __stdcall etcp_tcp_client_so(HANDLE so);
+bool __stdcall etcp_get_ip(char* ip);
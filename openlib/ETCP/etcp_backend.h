@@ -0,0 +1,220 @@
+#pragma once
+#include "etcp.h"
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/*
+* ETCPշ.
+* WindowsΪIOCP(proactor:Ͷص,ɶ˿֪ͨ),etcp_iocp.cpp;
+* LinuxΪشepoll(reactor:׽־¼߳Լд),etcp_epoll.cpp.
+* ˶ϲıͬ:
+*   ÿһtcp_connt,֮ɴtcp_recv,Ͽʱһtcp_close,ͬһӵĻصͬʱ;
+*   ֡ģʽ(nIsΪ)ÿtcp_recvһ֡(etcp_frame.h),һյԭʼ;
+*   ͻtcp_client::Request֡Ҳtcp_recv,صڼȡԱظ;
+*   ÿӵ첽Ͱ˳Ŷ,ŶʱڵС֡Ϊһ.Ŷӵֽﵽˮλ,첽ͷtcp_send_fullҲ,
+*   ˮλʱһtcp_send(ͻΪtcp_send_client).IOCP֪ͨԷ,ӵصͬʱ;
+*   صĵһetcp_tcp_server/etcp_tcp_clientصľ.
+* ӵĽֺͳ֡ƽ̨޹,etcp.cppetcp_proxy.cppetcp_frame.h˹.
+*/
+
+namespace etcp {
+	/*÷ķ,˳ֱ,ڼ䲻ٸ*/
+	typedef std::vector<unsigned char> send_data;
+
+	/*Ͷеĸߵˮλ(ֽ),highΪ0ʱ.κ߳̾޸,֮ķЧ*/
+	struct send_limits
+	{
+		std::atomic<std::size_t> high{ 16 * 1024 * 1024 };
+		std::atomic<std::size_t> low{ 4 * 1024 * 1024 };
+		void set(std::size_t h, std::size_t l)
+		{
+			high = h;
+			low = h && l > h ? h : l;
+		}
+	};
+}
+
+extern tcp_fun g_fun;
+extern tcp_fun_client g_fun_client;
+extern int buf_len;
+
+class tcp
+{
+public:
+	virtual ~tcp() {}
+	virtual int Init(const char* host, unsigned short nPort, int nIs) = 0;
+	virtual int Close() = 0;
+	/*첽,ǰѸƻ򽻸ϵͳ,ɹ0*/
+	int SoSend(SOCKET so, const char* buf, DWORD cb)
+	{
+		const etcp_buf one = { buf, int(cb) };
+		return SoSendv(so, &one, 1);
+	}
+	/*첽Ͷ֡,ϳһϵͳ.ɹ0*/
+	int SoSendv(SOCKET so, const etcp_buf* bufs, int count)
+	{
+		return PostSendv(so, bufs, count, m_Is);
+	}
+	/*첽ظͻΪid(֡ģʽ).ɹ0*/
+	int SoReply(SOCKET so, std::uint32_t id, const char* buf, DWORD cb);
+	/*첽Ͳӹdata,֡ģʽ³ͷdataֿϵͳ,.ɹ0*/
+	virtual int SoSendData(SOCKET so, etcp::send_data&& data) = 0;
+	/*ûŶӵʱڵ߳нϵͳŷ,Ϊ˳Ŷ.ɹ0*/
+	virtual int SoSends(SOCKET so, const char* buf, DWORD cb) = 0;
+	/*ͻsoķͶ,soʱ1*/
+	virtual int QueueInfo(SOCKET so, etcp_queue_info& info) = 0;
+	char* get_ip(SOCKET so);
+	u_short get_port();
+	SOCKET get_socket()
+	{
+		return m_so;
+	}
+protected:
+	/*framedΪʱbufsԭ,ӳͷ*/
+	virtual int PostSendv(SOCKET so, const etcp_buf* bufs, int count, BOOL framed) = 0;
+public:
+	SOCKET m_so = INVALID_SOCKET;
+	BOOL m_Is = FALSE;
+	/*ÿͻķͶи԰*/
+	etcp::send_limits m_limits;
+};
+
+class tcp_client
+{
+public:
+	virtual ~tcp_client() {}
+	/*ӷ(ɾ),ɹ󽻸շtcp_connt_client.ɹ0*/
+	int Init(char* host, unsigned short nPort, BOOL nIs, EProxyType proxyType, PCHAR proxyhost, WORD proxyport, PCHAR username, PCHAR userpass, int time);
+	virtual int Close() = 0;
+	/*
+	* isokΪʱȴһյĲŵ,outsizeֽڸƵoutbuf,outtime.
+	* ͬһʱֻһĵȴ;ҪһͬʱȶظRequest.
+	*/
+	int SoSend(char* buf, DWORD cb, int isok, char* outbuf, int outtime, std::size_t outsize = SIZE_MAX);
+	int SoSend(etcp::send_data&& data, int isok, char* outbuf, int outtime, std::size_t outsize = SIZE_MAX);
+	int SoSendv(const etcp_buf* bufs, int count)
+	{
+		return PostSendv(bufs, count, m_Is);
+	}
+	/*
+	* count(֡ģʽ)ȴȫظ,timeout_ms,replies[i]bufs[i]Ļظ.
+	* ͬ,һν,ǰһĻظ;߳Ҳͬʱͬһ.
+	* ȫյ0;ʧܷ1;ʱӶϿ2,յĻظreplies.
+	*/
+	int Request(const etcp_buf* bufs, int count, etcp::send_data* replies, int timeout_ms);
+	virtual int QueueInfo(etcp_queue_info& info) = 0;
+	SOCKET get_socket()
+	{
+		return m_so;
+	}
+protected:
+	/*m_soӲɴ,ɺ˵ǼǲͶӳɹ֪ͨ*/
+	virtual int Attach() = 0;
+	/*tcp::PostSendvtcp::SoSendDataͬ,ɺ˷m_so*/
+	virtual int PostSendv(const etcp_buf* bufs, int count, BOOL framed) = 0;
+	virtual int PostSendData(etcp::send_data&& data) = 0;
+	/*ÿյһ֡һ,flagsidetcp_frame.h;ǳ֡ģʽÿݵflagsidΪ0*/
+	void OnData(char* buf, DWORD len, std::uint32_t flags, std::uint32_t id);
+	/*ӶϿʱһ:еȴظĵ,ٲtcp_close_client*/
+	void OnClosed();
+private:
+	struct request_batch;
+	struct pending_request
+	{
+		request_batch* batch;
+		etcp::send_data* reply;
+	};
+	void WaitReply(int outtime);
+	void CancelReply();
+public:
+	SOCKET m_so = INVALID_SOCKET;
+	BOOL m_Is = FALSE;
+	etcp::send_limits m_limits;
+private:
+	//m_wait_mu
+	std::mutex m_wait_mu;
+	std::condition_variable m_reply_cv;
+	int m_isok = 0;
+	char* m_buf = nullptr;
+	std::size_t m_buf_size = 0;
+	std::unordered_map<std::uint32_t, pending_request> m_pending;
+	std::uint32_t m_next_id = 0;
+	bool m_closed = false;
+};
+
+class etcp_backend
+{
+public:
+	virtual ~etcp_backend() {}
+	/*¼߳,etcp_vip*/
+	virtual int Start() = 0;
+	virtual tcp* NewServer() = 0;
+	virtual tcp_client* NewClient() = 0;
+	/*Ͽ˵һͻ,nowΪʱδλ*/
+	virtual int CloseSocket(SOCKET so, bool now) = 0;
+};
+etcp_backend* etcp_get_backend();
+
+/*ƽ̨޹ص׽ָ,ʵetcp.cpp;etcp_proxy.cpp*/
+namespace etcp {
+#ifdef _WIN32
+	typedef int socklen;
+#else
+	typedef socklen_t socklen;
+#endif
+	int last_error();
+	int set_nonblocking(SOCKET so, bool on);
+	bool resolve_ipv4(const char* host, in_addr& out);
+	/*timeӵhost:port,غ׽Ϊģʽ.ɹ0*/
+	int connect_timeout(SOCKET so, const char* host, unsigned short port, int time);
+	void set_io_timeout(SOCKET so, int ms);
+	void set_keepalive(SOCKET so, int idle_ms, int interval_ms);
+	/*طͻȫ,ɹ0*/
+	int send_all(SOCKET so, const char* buf, std::size_t len);
+	int recv_all(SOCKET so, char* buf, std::size_t len);
+	/*طһ֡,֡ģʽ³ͷͬһϵͳн.ɹ0*/
+	int send_frame(SOCKET so, BOOL framed, const char* buf, std::size_t len);
+
+	/*ŶʱССݲβĿ*/
+	constexpr std::size_t kCoalesceSize = 64 * 1024;
+	/*lenֽŵβ,ܲβĿʱһ*/
+	void queue_bytes(std::deque<send_data>& q, const void* p, std::size_t len);
+	/*:СĲβĿ,ֱӽӹ*/
+	void queue_data(std::deque<send_data>& q, send_data&& data);
+	/*֡ͬͷŵβ*/
+	void queue_frames(std::deque<send_data>& q, const etcp_buf* bufs, int count, BOOL framed);
+
+	/*֡ͬͷֽ,гȲϷ֡ʱfalse*/
+	bool frames_size(const etcp_buf* bufs, int count, BOOL framed, std::size_t& total);
+	/*Ѷ֡ͬͷдout,outĴСΪframes_sizeĽ*/
+	void pack_frames(char* out, const etcp_buf* bufs, int count, BOOL framed);
+
+	/*
+	* ˰֡tcp_recvصڼջϷһrequest_scope,
+	* صпcurrent_requestȡ,صغʧЧ.
+	*/
+	class request_scope
+	{
+	public:
+		request_scope(std::uint32_t flags, std::uint32_t id);
+		~request_scope();
+		request_scope(const request_scope&) = delete;
+		request_scope& operator=(const request_scope&) = delete;
+	private:
+		bool m_prev_valid;
+		std::uint32_t m_prev_id;
+	};
+	/*߳ڽtcp_recvص֡ʱtrueȡ*/
+	bool current_request(std::uint32_t& id);
+
+	std::string base64_encode(const void* data, std::size_t len);
+	/*Ӵ׽,ֱ֮host:port.ɹ0,ʧܷ-1*/
+	int proxy_handshake(SOCKET so, EProxyType type, const char* host, unsigned short port, const char* username, const char* userpass);
+}
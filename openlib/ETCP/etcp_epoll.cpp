@@ -0,0 +1,935 @@
+//ԴETCP:epoll
+#ifdef __linux__
+#include "etcp_backend.h"
+#include "etcp_frame.h"
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/uio.h>
+#include <algorithm>
+#include <climits>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+/*
+* ÿ¼߳Լepollʵ,׽Աش(EPOLLET)Ǽһ߳,ֻ֮ɸ̶߳ȡ͹ر,
+* ͬһӵĻصIOCPһͬʱ.
+* Ϳκ߳:ͶΪʱֱڵ߳д,дĲŶ,EPOLLOUTʱ¼̼߳д,
+* д֪ͨҲ¼̲߳.
+*/
+namespace {
+	/*ǼepollеĶ,epoll_event.data.ptrָ*/
+	class io_handler
+	{
+	public:
+		virtual ~io_handler() {}
+		virtual void OnEvent(std::uint32_t events) = 0;
+	};
+
+	class event_loop
+	{
+	public:
+		int Start(std::size_t rbuf_size)
+		{
+			m_rbuf.reset(new char[rbuf_size]);
+			m_ep = epoll_create1(EPOLL_CLOEXEC);
+			m_wake = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+			if (m_ep < 0 || m_wake < 0)
+			{
+				return errno;
+			}
+			epoll_event ev = {};
+			ev.events = EPOLLIN;
+			ev.data.ptr = nullptr;
+			if (epoll_ctl(m_ep, EPOLL_CTL_ADD, m_wake, &ev))
+			{
+				return errno;
+			}
+			std::thread(&event_loop::Run, this).detach();
+			return 0;
+		}
+
+		/*ڱִ߳,ڵǰ¼֮*/
+		void Post(std::function<void()> task)
+		{
+			{
+				std::lock_guard<std::mutex> lock(m_mu);
+				m_tasks.push_back(std::move(task));
+			}
+			const std::uint64_t one = 1;
+			(void)!write(m_wake, &one, sizeof(one));
+		}
+
+		/*ֻڱ̵߳:ǰ¼ͷ,Ѿȡ¼Կ԰ȫط*/
+		void Retire(std::shared_ptr<void> p)
+		{
+			m_retired.push_back(std::move(p));
+		}
+
+		int Add(SOCKET so, std::uint32_t events, io_handler* handler)
+		{
+			epoll_event ev = {};
+			ev.events = events;
+			ev.data.ptr = handler;
+			return epoll_ctl(m_ep, EPOLL_CTL_ADD, so, &ev);
+		}
+
+		void Del(SOCKET so)
+		{
+			epoll_event ev = {};
+			epoll_ctl(m_ep, EPOLL_CTL_DEL, so, &ev);
+		}
+
+		/*̵߳Ľջ,ͬһʱֻһ*/
+		char* Buffer()
+		{
+			return m_rbuf.get();
+		}
+
+	private:
+		void Run()
+		{
+			epoll_event events[256];
+			std::vector<std::function<void()>> tasks;
+			while (true)
+			{
+				const int n = epoll_wait(m_ep, events, 256, -1);
+				for (int i = 0; i < n; i++)
+				{
+					if (events[i].data.ptr)
+					{
+						static_cast<io_handler*>(events[i].data.ptr)->OnEvent(events[i].events);
+					}
+					else
+					{
+						std::uint64_t count;
+						(void)!read(m_wake, &count, sizeof(count));
+					}
+				}
+				{
+					std::lock_guard<std::mutex> lock(m_mu);
+					tasks.swap(m_tasks);
+				}
+				for (auto& task : tasks)
+				{
+					task();
+				}
+				tasks.clear();
+				m_retired.clear();
+			}
+		}
+
+		int m_ep = -1;
+		int m_wake = -1;
+		std::unique_ptr<char[]> m_rbuf;
+		std::mutex m_mu;
+		std::vector<std::function<void()>> m_tasks;
+		std::vector<std::shared_ptr<void>> m_retired;
+	};
+
+	/*¼̲߳˳,õevent_loopҲͷ*/
+	std::mutex g_loops_mu;
+	std::vector<event_loop*> g_loops;
+	std::size_t g_rbuf_size = 0;
+	std::atomic<unsigned> g_next_loop{ 0 };
+
+	event_loop* next_loop()
+	{
+		return g_loops[g_next_loop++ % g_loops.size()];
+	}
+
+	/*
+	* дiovе,ֱдͻ,дֽ,-1.
+	* غiovдĶγΪ0,дһֵĶָʣµ
+	*/
+	ssize_t write_some(SOCKET so, iovec* iov, int count)
+	{
+		ssize_t written = 0;
+		while (count && iov->iov_len == 0)
+		{
+			iov++;
+			count--;
+		}
+		while (count)
+		{
+			msghdr msg = {};
+			msg.msg_iov = iov;
+			msg.msg_iovlen = count < IOV_MAX ? count : IOV_MAX;
+			ssize_t n = sendmsg(so, &msg, MSG_NOSIGNAL);
+			if (n < 0)
+			{
+				if (errno == EINTR)
+					continue;
+				if (errno == EAGAIN || errno == EWOULDBLOCK)
+					break;
+				return -1;
+			}
+			written += n;
+			while (count && std::size_t(n) >= iov->iov_len)
+			{
+				n -= iov->iov_len;
+				iov->iov_len = 0;
+				iov++;
+				count--;
+			}
+			if (count)
+			{
+				iov->iov_base = static_cast<char*>(iov->iov_base) + n;
+				iov->iov_len -= n;
+			}
+		}
+		return written;
+	}
+
+	/*һӵ׽,˽ܵĿͻͿͻ˵Ӷ*/
+	class connection : public io_handler, public std::enable_shared_from_this<connection>
+	{
+	public:
+		connection(event_loop* loop, SOCKET so, BOOL framed, std::size_t chunk)
+			: m_loop(loop), m_so(so), m_Is(framed), m_chunk(std::min(chunk, g_rbuf_size))
+		{
+		}
+
+		/*Ǽǵ׽ֱ,Ȼ¼߳в֪ͨʼշ*/
+		void Open();
+		/*
+		* κ߳̾ɵ.ηiovе,дĲŶ,iovᱻ޸.
+		* ownedΪʱiovһεĴ洢,Ŷʱֱӽӹܶ.
+		* ɹ0;Ѵﵽlimitsĸˮλʱtcp_send_full,ݲ
+		*/
+		int Send(iovec* iov, int count, etcp::send_data* owned, const etcp::send_limits& limits);
+		void QueueInfo(etcp_queue_info& info);
+		/*κ߳̾ɵ.nowΪʱλ;Ŷӵݺرд,ȶԷر*/
+		void Shutdown(bool now);
+		void OnEvent(std::uint32_t events) override;
+		SOCKET socket() const
+		{
+			return m_so;
+		}
+
+	protected:
+		virtual void OnConnected() = 0;
+		virtual void OnFrame(char* buf, DWORD len, std::uint32_t flags, std::uint32_t id) = 0;
+		virtual void OnClosed() = 0;
+		/*عtcp_send_full,ڶѽˮλ*/
+		virtual void OnWritable() = 0;
+
+	private:
+		void ReadAll();
+		void Flush();
+		void WriteQueued();
+		void CloseNow();
+
+		event_loop* const m_loop;
+		const SOCKET m_so;
+		const BOOL m_Is;
+		const std::size_t m_chunk;
+		etcp::frame_decoder m_frame;
+		std::shared_ptr<connection> m_self;
+
+		std::mutex m_mu;
+		/*ݰ˳Ŷ,m_out_posǶдֽ,m_out_bytesǻûдֽ*/
+		std::deque<etcp::send_data> m_out;
+		std::size_t m_out_pos = 0;
+		std::size_t m_out_bytes = 0;
+		/*ܾʱΪ,нm_resume_atʱ֪ͨд*/
+		bool m_blocked = false;
+		std::size_t m_resume_at = 0;
+		bool m_closed = false;
+		std::atomic<bool> m_closing{ false };
+	};
+
+	/*֡ͬԵĳͷconn,һϵͳд֡*/
+	int SendFrames(connection& conn, BOOL framed, const etcp_buf* bufs, int count, const etcp::send_limits& limits)
+	{
+		std::size_t total = 0;
+		if (!etcp::frames_size(bufs, count, framed, total))
+		{
+			return 1;
+		}
+		if (total == 0)
+		{
+			return 0;
+		}
+		std::vector<char> heads(framed ? std::size_t(count) * etcp::kHeaderSize : 0);
+		std::vector<iovec> iov;
+		iov.reserve(framed ? count * 2 : count);
+		for (int i = 0; i < count; i++)
+		{
+			if (framed)
+			{
+				char* head = &heads[std::size_t(i) * etcp::kHeaderSize];
+				etcp::put_header(head, std::uint32_t(bufs[i].len));
+				iov.push_back({ head, etcp::kHeaderSize });
+			}
+			iov.push_back({ const_cast<char*>(bufs[i].buf), std::size_t(bufs[i].len) });
+		}
+		return conn.Send(iov.data(), int(iov.size()), nullptr, limits);
+	}
+
+	/*ͷdataνconn,ûдĲֱӽӹdata*/
+	int SendData(connection& conn, BOOL framed, etcp::send_data& data, const etcp::send_limits& limits)
+	{
+		if (data.size() > etcp::kMaxFrame)
+		{
+			return 1;
+		}
+		char head[etcp::kHeaderSize];
+		etcp::put_header(head, std::uint32_t(data.size()));
+		iovec iov[2] = { { head, framed ? etcp::kHeaderSize : 0 }, { data.data(), data.size() } };
+		return conn.Send(iov, 2, &data, limits);
+	}
+
+	/*SOCKETӵı,ֻSOCKETĽӿ(͡Ͽͻ)*/
+	class socket_table
+	{
+	public:
+		void Add(SOCKET so, const std::shared_ptr<connection>& conn)
+		{
+			auto& s = shard(so);
+			std::lock_guard<std::mutex> lock(s.mu);
+			s.map[so] = conn;
+		}
+		void Remove(SOCKET so, const connection* conn)
+		{
+			auto& s = shard(so);
+			std::lock_guard<std::mutex> lock(s.mu);
+			auto it = s.map.find(so);
+			if (it != s.map.end() && it->second.get() == conn)
+			{
+				s.map.erase(it);
+			}
+		}
+		std::shared_ptr<connection> Find(SOCKET so)
+		{
+			auto& s = shard(so);
+			std::lock_guard<std::mutex> lock(s.mu);
+			auto it = s.map.find(so);
+			return it == s.map.end() ? nullptr : it->second;
+		}
+		template<typename F>
+		void ForEach(F&& fn)
+		{
+			for (auto& s : m_shards)
+			{
+				std::vector<std::shared_ptr<connection>> conns;
+				{
+					std::lock_guard<std::mutex> lock(s.mu);
+					for (auto& kv : s.map)
+						conns.push_back(kv.second);
+				}
+				for (auto& conn : conns)
+					fn(conn);
+			}
+		}
+	private:
+		static constexpr unsigned kShards = 16;
+		struct table_shard
+		{
+			std::mutex mu;
+			std::unordered_map<SOCKET, std::shared_ptr<connection>> map;
+		};
+		table_shard& shard(SOCKET so)
+		{
+			return m_shards[unsigned(so) % kShards];
+		}
+		table_shard m_shards[kShards];
+	};
+	socket_table g_sockets;
+
+	void connection::Open()
+	{
+		m_self = shared_from_this();
+		g_sockets.Add(m_so, m_self);
+		m_loop->Post([this] {
+			OnConnected();
+			//Ǽʱ׽ѿɶдҲ,©֪֮ͨǰ
+			if (m_loop->Add(m_so, EPOLLIN | EPOLLOUT | EPOLLRDHUP | EPOLLET, this))
+			{
+				CloseNow();
+			}
+			});
+	}
+
+	int connection::Send(iovec* iov, int count, etcp::send_data* owned, const etcp::send_limits& limits)
+	{
+		std::lock_guard<std::mutex> lock(m_mu);
+		if (m_closed || m_closing)
+		{
+			return 1;
+		}
+		//IOCPsend_queue::Pushһ,ȼˮλپǷֱд
+		const std::size_t high = limits.high;
+		if (high && m_out_bytes >= high)
+		{
+			m_blocked = true;
+			m_resume_at = limits.low;
+			return tcp_send_full;
+		}
+		if (m_out.empty())
+		{
+			//ΪʱֱӴӵ÷Ļд
+			if (write_some(m_so, iov, count) < 0)
+			{
+				//¼߳ڶȡʱر
+				return 1;
+			}
+		}
+
+		//ûдĲŵβ:СββĿ,ownedӹ
+		for (int i = 0; i < count; i++)
+		{
+			const std::size_t len = iov[i].iov_len;
+			if (len == 0)
+			{
+				continue;
+			}
+			m_out_bytes += len;
+			if (owned && i == count - 1)
+			{
+				if (m_out.empty())
+				{
+					//дһ
+					m_out_pos = static_cast<unsigned char*>(iov[i].iov_base) - owned->data();
+					m_out.push_back(std::move(*owned));
+				}
+				else
+				{
+					etcp::queue_data(m_out, std::move(*owned));
+				}
+			}
+			else
+			{
+				etcp::queue_bytes(m_out, iov[i].iov_base, len);
+			}
+		}
+		return 0;
+	}
+
+	void connection::QueueInfo(etcp_queue_info& info)
+	{
+		std::lock_guard<std::mutex> lock(m_mu);
+		info.depth = int(m_out.size());
+		info.bytes = (long long)m_out_bytes;
+	}
+
+	void connection::Flush()
+	{
+		bool writable = false;
+		{
+			std::lock_guard<std::mutex> lock(m_mu);
+			if (m_closed)
+			{
+				return;
+			}
+			WriteQueued();
+			if (m_blocked && !m_closing && m_out_bytes <= m_resume_at)
+			{
+				m_blocked = false;
+				writable = true;
+			}
+		}
+		if (writable)
+		{
+			OnWritable();
+		}
+	}
+
+	/*m_mu*/
+	void connection::WriteQueued()
+	{
+		while (!m_out.empty())
+		{
+			iovec iov[64];
+			int count = 0;
+			std::size_t want = 0;
+			for (auto it = m_out.begin(); it != m_out.end() && count < 64; ++it, ++count)
+			{
+				const std::size_t skip = count ? 0 : m_out_pos;
+				iov[count].iov_base = it->data() + skip;
+				iov[count].iov_len = it->size() - skip;
+				want += iov[count].iov_len;
+			}
+			const ssize_t n = write_some(m_so, iov, count);
+			if (n < 0)
+			{
+				return;
+			}
+			m_out_bytes -= n;
+			std::size_t done = m_out_pos + n;
+			while (!m_out.empty() && done >= m_out.front().size())
+			{
+				done -= m_out.front().size();
+				m_out.pop_front();
+			}
+			m_out_pos = done;
+			if (std::size_t(n) < want)
+			{
+				//ͻ,һEPOLLOUT
+				return;
+			}
+		}
+		m_out_pos = 0;
+		if (m_closing)
+		{
+			shutdown(m_so, SHUT_WR);
+		}
+	}
+
+	void connection::Shutdown(bool now)
+	{
+		std::lock_guard<std::mutex> lock(m_mu);
+		if (m_closed)
+		{
+			return;
+		}
+		if (now)
+		{
+			struct linger lingerStruct;
+			lingerStruct.l_onoff = 1;
+			lingerStruct.l_linger = 0;
+			setsockopt(m_so, SOL_SOCKET, SO_LINGER, &lingerStruct, sizeof(lingerStruct));
+			shutdown(m_so, SHUT_RDWR);
+			m_closing = true;
+			return;
+		}
+		if (m_closing.exchange(true))
+		{
+			return;
+		}
+		if (m_out.empty())
+		{
+			shutdown(m_so, SHUT_WR);
+		}
+	}
+
+	void connection::OnEvent(std::uint32_t events)
+	{
+		if (events & (EPOLLIN | EPOLLRDHUP | EPOLLHUP | EPOLLERR))
+		{
+			ReadAll();
+		}
+		if (events & EPOLLOUT)
+		{
+			Flush();
+		}
+	}
+
+	void connection::ReadAll()
+	{
+		if (m_closed)
+		{
+			return;
+		}
+		char* buf = m_loop->Buffer();
+		//ÿô,µŵ̵߳,һռס¼߳
+		for (int round = 0; round < 16; round++)
+		{
+			const ssize_t n = recv(m_so, buf, m_chunk, 0);
+			if (n > 0)
+			{
+				if (m_closing)
+				{
+					continue;
+				}
+				if (m_Is)
+				{
+					if (!m_frame.feed(buf, n, [this](char* data, DWORD len, std::uint32_t flags, std::uint32_t id) { OnFrame(data, len, flags, id); }))
+					{
+						//ݴ
+						CloseNow();
+						return;
+					}
+				}
+				else
+				{
+					OnFrame(buf, DWORD(n), 0, 0);
+				}
+				continue;
+			}
+			if (n < 0 && errno == EINTR)
+			{
+				continue;
+			}
+			if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+			{
+				return;
+			}
+			CloseNow();
+			return;
+		}
+		auto self = shared_from_this();
+		m_loop->Post([self] { self->ReadAll(); });
+	}
+
+	void connection::CloseNow()
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_mu);
+			if (m_closed)
+			{
+				return;
+			}
+			m_closed = true;
+		}
+		//ȴӱƳ,׽ֹرպֵӸ
+		g_sockets.Remove(m_so, this);
+		m_loop->Del(m_so);
+		OnClosed();
+		close(m_so);
+		m_loop->Retire(std::move(m_self));
+	}
+
+	/*׽*/
+	class server_core : public io_handler, public std::enable_shared_from_this<server_core>
+	{
+	public:
+		server_core(HANDLE handle, SOCKET so, BOOL framed, event_loop* loop)
+			: m_handle(handle), m_Is(framed), m_loop(loop), m_so(so)
+		{
+		}
+
+		void OnEvent(std::uint32_t events) override;
+		/*رռ׽,֮ٽ*/
+		void Stop()
+		{
+			{
+				std::lock_guard<std::mutex> lock(m_mu);
+				if (INVALID_SOCKET == m_so)
+				{
+					return;
+				}
+				m_loop->Del(m_so);
+				close(m_so);
+				m_so = INVALID_SOCKET;
+			}
+			//¼߳̿Ѿȡ¼,һͷ
+			auto self = shared_from_this();
+			m_loop->Post([self] {});
+		}
+
+		const HANDLE m_handle;
+		const BOOL m_Is;
+		std::atomic<int> m_cnum{ 0 };
+
+	private:
+		event_loop* const m_loop;
+		std::mutex m_mu;
+		SOCKET m_so;
+	};
+
+	class server_conn : public connection
+	{
+	public:
+		server_conn(event_loop* loop, SOCKET so, std::shared_ptr<server_core> core)
+			: connection(loop, so, core->m_Is, buf_len), m_core(std::move(core))
+		{
+		}
+		const server_core* core() const
+		{
+			return m_core.get();
+		}
+
+	protected:
+		void OnConnected() override
+		{
+			const int count = ++m_core->m_cnum;
+			g_fun(m_core->m_handle, socket(), tcp_connt, NULL, 0, count);
+		}
+		void OnFrame(char* buf, DWORD len, std::uint32_t flags, std::uint32_t id) override
+		{
+			etcp::request_scope scope(flags, id);
+			g_fun(m_core->m_handle, socket(), tcp_recv, buf, len, m_core->m_cnum);
+		}
+		void OnClosed() override
+		{
+			const int count = --m_core->m_cnum;
+			g_fun(m_core->m_handle, socket(), tcp_close, NULL, 0, count);
+		}
+		void OnWritable() override
+		{
+			g_fun(m_core->m_handle, socket(), tcp_send, NULL, 0, m_core->m_cnum);
+		}
+
+	private:
+		const std::shared_ptr<server_core> m_core;
+	};
+
+	void server_core::OnEvent(std::uint32_t /*events*/)
+	{
+		std::lock_guard<std::mutex> lock(m_mu);
+		while (INVALID_SOCKET != m_so)
+		{
+			const SOCKET so = accept4(m_so, NULL, NULL, SOCK_NONBLOCK | SOCK_CLOEXEC);
+			if (so < 0)
+			{
+				if (errno == EINTR || errno == ECONNABORTED)
+				{
+					continue;
+				}
+				break;
+			}
+			etcp::set_keepalive(so, 1000 * 30, 1000 * 5);
+			std::make_shared<server_conn>(next_loop(), so, shared_from_this())->Open();
+		}
+	}
+
+	class epoll_tcp : public tcp
+	{
+	public:
+		~epoll_tcp()
+		{
+			Close();
+		}
+		int Init(const char* host, unsigned short nPort, int nIs) override
+		{
+			m_Is = nIs;
+			m_so = ::socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, IPPROTO_TCP);
+			if (INVALID_SOCKET == m_so)
+			{
+				return errno;
+			}
+			int bReuseaddr = 1;
+			setsockopt(m_so, SOL_SOCKET, SO_REUSEADDR, &bReuseaddr, sizeof(bReuseaddr));
+
+			sockaddr_in in = {};
+			in.sin_family = AF_INET;
+			in.sin_addr.s_addr = inet_addr(host);
+			in.sin_port = htons(nPort);
+			if (SOCKET_ERROR == bind(m_so, (sockaddr*)&in, sizeof(in)) || SOCKET_ERROR == listen(m_so, SOMAXCONN))
+			{
+				const int ercode = errno;
+				close(m_so);
+				m_so = INVALID_SOCKET;
+				return ercode;
+			}
+
+			event_loop* loop = next_loop();
+			m_core = std::make_shared<server_core>(this, m_so, m_Is, loop);
+			if (loop->Add(m_so, EPOLLIN | EPOLLET, m_core.get()))
+			{
+				const int ercode = errno;
+				close(m_so);
+				m_so = INVALID_SOCKET;
+				m_core.reset();
+				return ercode;
+			}
+			return 0;
+		}
+		int Close() override
+		{
+			if (m_core)
+			{
+				m_core->Stop();
+				const server_core* core = m_core.get();
+				g_sockets.ForEach([core](const std::shared_ptr<connection>& conn) {
+					auto client = dynamic_cast<server_conn*>(conn.get());
+					if (client && client->core() == core)
+					{
+						client->Shutdown(true);
+					}
+					});
+				m_core.reset();
+			}
+			m_so = INVALID_SOCKET;
+			return 0;
+		}
+		int SoSendData(SOCKET so, etcp::send_data&& data) override
+		{
+			auto conn = g_sockets.Find(so);
+			if (!conn)
+			{
+				return 1;
+			}
+			return SendData(*conn, m_Is, data, m_limits);
+		}
+		/*дĲڵ߳д,SoSendһŶ*/
+		int SoSends(SOCKET so, const char* buf, DWORD cb) override
+		{
+			return SoSend(so, buf, cb);
+		}
+		int QueueInfo(SOCKET so, etcp_queue_info& info) override
+		{
+			auto conn = g_sockets.Find(so);
+			if (!conn)
+			{
+				return 1;
+			}
+			conn->QueueInfo(info);
+			return 0;
+		}
+
+	protected:
+		int PostSendv(SOCKET so, const etcp_buf* bufs, int count, BOOL framed) override
+		{
+			auto conn = g_sockets.Find(so);
+			if (!conn)
+			{
+				return 1;
+			}
+			return SendFrames(*conn, framed, bufs, count, m_limits);
+		}
+
+	private:
+		std::shared_ptr<server_core> m_core;
+	};
+
+	class epoll_tcp_client;
+	class client_conn : public connection
+	{
+	public:
+		client_conn(event_loop* loop, SOCKET so, BOOL framed, epoll_tcp_client* owner)
+			: connection(loop, so, framed, tcp_len), m_owner(owner)
+		{
+		}
+
+	protected:
+		void OnConnected() override;
+		void OnFrame(char* buf, DWORD len, std::uint32_t flags, std::uint32_t id) override;
+		void OnClosed() override;
+		void OnWritable() override;
+
+	private:
+		epoll_tcp_client* const m_owner;
+	};
+
+	class epoll_tcp_client : public tcp_client
+	{
+	public:
+		int Close() override
+		{
+			if (m_conn)
+			{
+				m_conn->Shutdown(true);
+			}
+			return 0;
+		}
+		void Deliver(char* buf, DWORD len, std::uint32_t flags, std::uint32_t id)
+		{
+			OnData(buf, len, flags, id);
+		}
+		void Disconnected()
+		{
+			OnClosed();
+		}
+		int QueueInfo(etcp_queue_info& info) override
+		{
+			if (!m_conn)
+			{
+				return 1;
+			}
+			m_conn->QueueInfo(info);
+			return 0;
+		}
+
+	protected:
+		int Attach() override
+		{
+			if (etcp::set_nonblocking(m_so, true))
+			{
+				return errno;
+			}
+			m_conn = std::make_shared<client_conn>(next_loop(), m_so, m_Is, this);
+			m_conn->Open();
+			return 0;
+		}
+		int PostSendv(const etcp_buf* bufs, int count, BOOL framed) override
+		{
+			if (!m_conn)
+			{
+				return 1;
+			}
+			return SendFrames(*m_conn, framed, bufs, count, m_limits);
+		}
+		int PostSendData(etcp::send_data&& data) override
+		{
+			if (!m_conn)
+			{
+				return 1;
+			}
+			return SendData(*m_conn, m_Is, data, m_limits);
+		}
+
+	private:
+		std::shared_ptr<client_conn> m_conn;
+	};
+
+	void client_conn::OnConnected()
+	{
+		g_fun_client(m_owner, socket(), tcp_connt_client, NULL, 0);
+	}
+	void client_conn::OnFrame(char* buf, DWORD len, std::uint32_t flags, std::uint32_t id)
+	{
+		m_owner->Deliver(buf, len, flags, id);
+	}
+	void client_conn::OnClosed()
+	{
+		m_owner->Disconnected();
+	}
+	void client_conn::OnWritable()
+	{
+		g_fun_client(m_owner, socket(), tcp_send_client, NULL, 0);
+	}
+
+	class epoll_backend : public etcp_backend
+	{
+	public:
+		int Start() override
+		{
+			std::lock_guard<std::mutex> lock(g_loops_mu);
+			if (!g_loops.empty())
+			{
+				return 0;
+			}
+			unsigned count = std::thread::hardware_concurrency();
+			if (count == 0)
+			{
+				count = 1;
+			}
+			g_rbuf_size = std::max<std::size_t>(buf_len, tcp_len);
+			for (unsigned i = 0; i < count; i++)
+			{
+				event_loop* loop = new event_loop;
+				const int ercode = loop->Start(g_rbuf_size);
+				if (ercode)
+				{
+					delete loop;
+					return ercode;
+				}
+				g_loops.push_back(loop);
+			}
+			return 0;
+		}
+		tcp* NewServer() override
+		{
+			return new epoll_tcp;
+		}
+		tcp_client* NewClient() override
+		{
+			return new epoll_tcp_client;
+		}
+		int CloseSocket(SOCKET so, bool now) override
+		{
+			auto conn = g_sockets.Find(so);
+			if (!conn)
+			{
+				return -1;
+			}
+			//¼߳ӽ,tcp_closeر׽
+			conn->Shutdown(now);
+			return 0;
+		}
+	};
+}
+
+etcp_backend* etcp_get_backend()
+{
+	static epoll_backend backend;
+	return &backend;
+}
+#endif
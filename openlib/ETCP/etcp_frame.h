@@ -0,0 +1,185 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include "etcp_pool.h"
+
+/*
+* ETCP֡ģʽ(nIsΪ)֡ʽ:4ֽС˳ + .
+* ֵλǱ־(kRequestFlag/kReplyFlag),λʱֺٸ4ֽС˵,
+* ͻ˾ݴ˰ѻظӦ,һϿͬʱж;;/ظ˫ֻޱ־֡,ʽǰͬ.
+* ޱ־ҳΪ0֡ϲ;ȳkMaxFrameΪݴ,շӦϿ.
+* ﲻ漰׽,IOCPepoll˹ͬһݽ.
+*/
+namespace etcp {
+	constexpr std::uint32_t kHeaderSize = 4;
+	constexpr std::uint32_t kTaggedHeaderSize = 8;
+	constexpr std::uint32_t kMaxFrame = 65536000;
+	/*Ҫظ*/
+	constexpr std::uint32_t kRequestFlag = 0x80000000;
+	/*Ļظ,ͬ*/
+	constexpr std::uint32_t kReplyFlag = 0x40000000;
+	constexpr std::uint32_t kFlagMask = kRequestFlag | kReplyFlag;
+	static_assert((kMaxFrame & kFlagMask) == 0, "frame flags");
+
+	inline void put_header(char* out, std::uint32_t len)
+	{
+		out[0] = char(len);
+		out[1] = char(len >> 8);
+		out[2] = char(len >> 16);
+		out[3] = char(len >> 24);
+	}
+
+	inline std::uint32_t get_header(const char* in)
+	{
+		const auto p = reinterpret_cast<const unsigned char*>(in);
+		return std::uint32_t(p[0]) | std::uint32_t(p[1]) << 8 | std::uint32_t(p[2]) << 16 | std::uint32_t(p[3]) << 24;
+	}
+
+	/*ŵĳͷ,outkTaggedHeaderSizeֽ*/
+	inline void put_tagged_header(char* out, std::uint32_t len, std::uint32_t flags, std::uint32_t id)
+	{
+		put_header(out, len | flags);
+		put_header(out + kHeaderSize, id);
+	}
+
+	/*ɳֵõͷֽ*/
+	inline std::uint32_t header_size(std::uint32_t word)
+	{
+		return (word & kFlagMask) ? kTaggedHeaderSize : kHeaderSize;
+	}
+
+	/*
+	* յֽзֳ֡.
+	* ڱֱ֡ԭָ뽻ص,;ֻпԽνյ֡ƴӵڲ.
+	*/
+	class frame_decoder
+	{
+	public:
+		frame_decoder() = default;
+		frame_decoder(const frame_decoder&) = delete;
+		frame_decoder& operator=(const frame_decoder&) = delete;
+		~frame_decoder()
+		{
+			free_buffer(m_body, m_capacity);
+		}
+
+		/*
+		* on_frame(char* data, DWORD len, uint32_t flags, uint32_t id),dataֻڻصڼЧ,
+		* flagsΪkRequestFlag/kReplyFlag0,id(flagsΪ0ʱΪ0).
+		* ֡ʱfalse,֮ݲ,÷ӦϿ.
+		*/
+		template<typename F>
+		bool feed(char* data, std::size_t len, F&& on_frame)
+		{
+			while (len)
+			{
+				if (m_head_len < m_head_need)
+				{
+					if (m_head_len == 0 && len >= kHeaderSize)
+					{
+						const std::uint32_t word = get_header(data);
+						const std::uint32_t head = header_size(word);
+						const std::uint32_t size = word & ~kFlagMask;
+						if (size > kMaxFrame)
+							return false;
+						if (len >= head && len - head >= size)
+						{
+							if (size || (word & kFlagMask))
+								on_frame(data + head, size, word & kFlagMask, head > kHeaderSize ? get_header(data + kHeaderSize) : 0);
+							data += head + size;
+							len -= head + size;
+							continue;
+						}
+					}
+					const std::size_t n = len < m_head_need - m_head_len ? len : m_head_need - m_head_len;
+					std::memcpy(m_head + m_head_len, data, n);
+					m_head_len += std::uint32_t(n);
+					data += n;
+					len -= n;
+					if (m_head_len == kHeaderSize)
+						m_head_need = header_size(get_header(m_head));
+					if (m_head_len < m_head_need)
+						continue;
+					const std::uint32_t word = get_header(m_head);
+					if (!begin_body(word & ~kFlagMask))
+						return false;
+					m_flags = word & kFlagMask;
+					m_id = m_flags ? get_header(m_head + kHeaderSize) : 0;
+					if (m_size == 0)
+					{
+						next_head();
+						if (m_flags)
+							on_frame(m_body, 0, m_flags, m_id);
+						continue;
+					}
+				}
+				const std::size_t n = len < m_size - m_got ? len : m_size - m_got;
+				std::memcpy(m_body + m_got, data, n);
+				m_got += std::uint32_t(n);
+				data += n;
+				len -= n;
+				if (m_got == m_size)
+				{
+					next_head();
+					on_frame(m_body, m_size, m_flags, m_id);
+					end_body();
+				}
+			}
+			return true;
+		}
+
+		/*δɵ֡*/
+		void reset()
+		{
+			next_head();
+			end_body();
+		}
+
+	private:
+		/*ƴӴ֡ùĻСͻڴ,ⳤһֱռ*/
+		static constexpr std::uint32_t kKeepCapacity = 64 * 1024;
+
+		bool begin_body(std::uint32_t size)
+		{
+			if (size > kMaxFrame)
+				return false;
+			if (size > m_capacity)
+			{
+				free_buffer(m_body, m_capacity);
+				m_capacity = std::uint32_t(buffer_capacity(size));
+				m_body = alloc_buffer(m_capacity);
+			}
+			m_size = size;
+			m_got = 0;
+			return true;
+		}
+
+		void next_head()
+		{
+			m_head_len = 0;
+			m_head_need = kHeaderSize;
+		}
+
+		void end_body()
+		{
+			m_size = m_got = 0;
+			if (m_capacity > kKeepCapacity)
+			{
+				free_buffer(m_body, m_capacity);
+				m_body = nullptr;
+				m_capacity = 0;
+			}
+		}
+
+		char m_head[kTaggedHeaderSize] = {};
+		std::uint32_t m_head_len = 0;
+		std::uint32_t m_head_need = kHeaderSize;
+		std::uint32_t m_flags = 0;
+		std::uint32_t m_id = 0;
+		std::uint32_t m_size = 0;
+		std::uint32_t m_got = 0;
+		std::uint32_t m_capacity = 0;
+		char* m_body = nullptr;
+	};
+}
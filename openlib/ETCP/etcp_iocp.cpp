@@ -0,0 +1,1068 @@
+//ԴETCP:IOCP
+#ifdef _WIN32
+#pragma warning(disable:4996)
+#pragma warning(disable:6001)
+#pragma warning(disable:6386)
+#pragma warning(disable:26812)
+#pragma warning(disable:6387)
+#pragma warning(disable:6279)
+#pragma warning(disable:28183)
+#include "etcp_backend.h"
+#include "etcp_frame.h"
+#include "etcp_pool.h"
+#include <memory>
+#include <unordered_map>
+#include"Tace.hpp"
+static HANDLE g_iocp = NULL;
+static HANDLE g_iocp_client = NULL;
+static int g_cpu = 0;
+
+namespace {
+	/*
+	* һӵķͶ.ͬһͬһʱֻһWSASend;,ķͰ˳Ŷ,ڵС֡Ϊһ;
+	* ;ķɺ,ŶӵĿһWSASend.ԷյʱڴֻˮλΪֹ.
+	*/
+	class send_queue
+	{
+	public:
+		static constexpr int kPostNow = -1;
+		static constexpr std::size_t kMaxGather = 64;
+		static constexpr std::size_t kMaxGatherBytes = 4 * 1024 * 1024;
+
+		/*
+		* lenֽڵķ.û;ķʱkPostNow,ɵ÷ԼͶ,ɺComplete;
+		* ڵappend(std::deque<etcp::send_data>&)ŵβ0.
+		* ѶϿ1,дﵽˮλtcp_send_full
+		*/
+		template<typename F>
+		int Push(std::size_t len, const etcp::send_limits& limits, F&& append)
+		{
+			std::lock_guard<std::mutex> lock(m_mu);
+			if (m_closed)
+			{
+				return 1;
+			}
+			if (!m_busy)
+			{
+				m_busy = true;
+				m_bytes += len;
+				return kPostNow;
+			}
+			const std::size_t high = limits.high;
+			if (high && m_bytes >= high)
+			{
+				m_blocked = true;
+				m_resume_at = limits.low;
+				return tcp_send_full;
+			}
+			append(m_blocks);
+			m_bytes += len;
+			return 0;
+		}
+
+		/*;sentֽѷ,ŶӵĿƵnextɵ÷Ͷ.Ҫ֪ͨдʱtrue*/
+		bool Complete(std::size_t sent, std::vector<etcp::send_data>& next)
+		{
+			std::lock_guard<std::mutex> lock(m_mu);
+			m_bytes -= sent;
+			std::size_t gathered = 0;
+			while (!m_blocks.empty() && next.size() < kMaxGather && gathered < kMaxGatherBytes)
+			{
+				gathered += m_blocks.front().size();
+				next.push_back(std::move(m_blocks.front()));
+				m_blocks.pop_front();
+			}
+			m_busy = !next.empty();
+			if (m_blocked && !m_closed && m_bytes <= m_resume_at)
+			{
+				m_blocked = false;
+				return true;
+			}
+			return false;
+		}
+
+		/*ͶʧܻӶϿ,Ŷӵ,֮ķͶʧ*/
+		void Fail()
+		{
+			std::lock_guard<std::mutex> lock(m_mu);
+			m_closed = true;
+			m_busy = false;
+			m_blocks.clear();
+			m_bytes = 0;
+		}
+
+		void Info(etcp_queue_info& info)
+		{
+			std::lock_guard<std::mutex> lock(m_mu);
+			info.depth = int(m_blocks.size()) + (m_busy ? 1 : 0);
+			info.bytes = (long long)m_bytes;
+		}
+
+	private:
+		std::mutex m_mu;
+		std::deque<etcp::send_data> m_blocks;
+		//ѽܡWSASendûɵֽ,;
+		std::size_t m_bytes = 0;
+		std::size_t m_resume_at = 0;
+		bool m_busy = false;
+		bool m_blocked = false;
+		bool m_closed = false;
+	};
+
+	class iocp_tcp;
+	typedef struct tcpstruct : etcp::pooled<tcpstruct>
+	{
+		OVERLAPPED	op = {};
+		iocp_tcp* so = NULL;
+		int			state = 0;
+		SOCKET		c_so = INVALID_SOCKET;
+		char* buf = NULL;
+		DWORD		slen = 0;
+		DWORD		cb = 0;
+
+		DWORD		bufSize = 0;
+		DWORD		bufOffset = 0;
+		etcp::frame_decoder frame;
+		//SoSendDataӹܵݺĳͷ
+		char		head[etcp::kHeaderSize] = {};
+		etcp::send_data data;
+		//ӷͶȡɱWSASendĿ
+		std::vector<etcp::send_data> queued;
+		//ӵķͶ;ͲslenǱͶݵֽ
+		std::shared_ptr<send_queue> queue;
+	}S_tcpstruct, * P_tcpstruct;
+
+	class iocp_tcp : public tcp
+	{
+	public:
+		iocp_tcp();
+		~iocp_tcp();
+	public:
+		int Init(const char* host, unsigned short nPort, int nIsSC) override;
+		int AcceptServer();
+		int Accept();
+		void ClientAccept(bool error, P_tcpstruct op);
+		void RecvData(bool error, P_tcpstruct op);
+		int Close() override;
+		int SoSendData(SOCKET so, etcp::send_data&& data) override;
+		int SoSends(SOCKET so, const char* buf, DWORD cb) override;
+		int QueueInfo(SOCKET so, etcp_queue_info& info) override;
+		void OnSend(bool ercode, P_tcpstruct op);
+	protected:
+		int PostSendv(SOCKET so, const etcp_buf* bufs, int count, BOOL framed) override;
+	private:
+		int PostRecv(P_tcpstruct op);
+		int PostSendOp(SOCKET so, P_tcpstruct op, WSABUF* bufs, DWORD count);
+		int PostQueued(SOCKET so, const std::shared_ptr<send_queue>& queue, std::vector<etcp::send_data>&& blocks);
+		std::shared_ptr<send_queue> FindQueue(SOCKET so);
+		void Disconnect(P_tcpstruct op);
+	public:
+		int	m_cnum;
+		CRITICAL_SECTION m_cs;
+		BOOL m_Close;
+	private:
+		LPFN_ACCEPTEX m_AcceptEx = NULL;
+		//ӵĿͻķͶ,ʱǼ,ϿʱƳ
+		std::mutex m_queues_mu;
+		std::unordered_map<SOCKET, std::shared_ptr<send_queue>> m_queues;
+	};
+
+	class iocp_tcp_client;
+	typedef struct tcpstruct_client : etcp::pooled<tcpstruct_client>
+	{
+		OVERLAPPED	op = {};
+		iocp_tcp_client* so = NULL;
+		int			state = 0;
+
+		char* buf = NULL;
+		DWORD		slen = 0;
+		DWORD		cb = 0;
+
+		DWORD		bufSize = 0;
+		DWORD		bufOffset = 0;
+		etcp::frame_decoder frame;
+		char		head[etcp::kHeaderSize] = {};
+		etcp::send_data data;
+		std::vector<etcp::send_data> queued;
+	}S_tcpstruct_client, * P_tcpstruct_client;
+
+	/*ĺĻȡڴ(etcp_pool.h),ɺһ黹*/
+	void FreeOp(P_tcpstruct op)
+	{
+		etcp::free_buffer(op->buf, op->bufSize);
+		delete op;
+	}
+	void FreeOp(P_tcpstruct_client op)
+	{
+		etcp::free_buffer(op->buf, op->bufSize);
+		delete op;
+	}
+
+	class iocp_tcp_client : public tcp_client
+	{
+	public:
+		void OnConnect(bool ercode, P_tcpstruct_client op);
+		void OnClose(bool ercode, P_tcpstruct_client op);
+		void OnRecv(bool ercode, P_tcpstruct_client op);
+		int SoRecv(P_tcpstruct_client op);
+		int Close() override;
+		int QueueInfo(etcp_queue_info& info) override;
+		void OnSend(bool ercode, P_tcpstruct_client op);
+	protected:
+		int Attach() override;
+		int PostSendv(const etcp_buf* bufs, int count, BOOL framed) override;
+		int PostSendData(etcp::send_data&& data) override;
+	private:
+		int PostSendOp(P_tcpstruct_client op, WSABUF* bufs, DWORD count);
+		int PostQueued(std::vector<etcp::send_data>&& blocks);
+		send_queue m_queue;
+	};
+}
+
+
+iocp_tcp::iocp_tcp()
+{
+	m_Is = FALSE;
+	m_Close = FALSE;
+	InitializeCriticalSection(&m_cs);
+	m_cnum = 0;
+	m_so = INVALID_SOCKET;
+}
+iocp_tcp::~iocp_tcp()
+{
+	m_cnum = 0;
+	m_so = INVALID_SOCKET;
+}
+int iocp_tcp::Init(const char* host, unsigned short nPort, int nIs)
+{
+	m_Is = nIs;
+	m_so = WSASocket(AF_INET, SOCK_STREAM, IPPROTO_TCP, 0, 0, WSA_FLAG_OVERLAPPED);
+	if (INVALID_SOCKET == m_so)
+	{
+		return WSAGetLastError();
+	}
+	HANDLE t = CreateIoCompletionPort((HANDLE)m_so, g_iocp, NULL, 0);
+	if (NULL == t)
+	{
+		Close();
+		return GetLastError();
+	}
+
+	sockaddr_in in;
+	in.sin_family = AF_INET;
+	in.sin_addr.S_un.S_addr = inet_addr(host);
+	in.sin_port = htons(nPort);
+	if (SOCKET_ERROR == bind(m_so, (SOCKADDR*)&in, sizeof(in)))
+	{
+		Close();
+		return WSAGetLastError();
+	}
+
+	if (SOCKET_ERROR == listen(m_so, g_cpu))
+	{
+		Close();
+		return WSAGetLastError();
+	}
+
+	return AcceptServer();
+}
+int iocp_tcp::AcceptServer()
+{
+	GUID lGUID = WSAID_ACCEPTEX;
+	DWORD cb = 0;
+	if (WSAIoctl(m_so, SIO_GET_EXTENSION_FUNCTION_POINTER, &lGUID, sizeof(GUID), &m_AcceptEx, sizeof(m_AcceptEx), &cb, NULL, NULL))
+	{
+		Close();
+		return 2;
+	}
+	const int ercode = Accept();
+	if (ercode)
+	{
+		Close();
+	}
+	return ercode;
+}
+int iocp_tcp::Close()
+{
+	m_Close = TRUE;
+	m_cnum = 0;
+	closesockets(m_so);
+
+	m_so = INVALID_SOCKET;
+	return 0;
+}
+int iocp_tcp::Accept()
+{
+	tcpstruct* op = new tcpstruct;
+
+	//ڼ,˷ѳеĿռ
+	op->bufSize = DWORD(etcp::buffer_capacity(buf_len));
+	op->buf = etcp::alloc_buffer(op->bufSize);
+	op->so = this;
+	op->bufOffset = 0;
+
+	op->state = tcp_connt;
+	op->c_so = WSASocket(AF_INET, SOCK_STREAM, IPPROTO_TCP, 0, 0, WSA_FLAG_OVERLAPPED);
+	if (INVALID_SOCKET == op->c_so)
+	{
+		const int ercode = WSAGetLastError();
+		FreeOp(op);
+		return ercode;
+	}
+
+	//
+	setsockopt(op->c_so, SOL_SOCKET, SO_RCVBUF, (const char*)&buf_len, sizeof(int));
+	int nSendBuf = 0;
+	setsockopt(op->c_so, SOL_SOCKET, SO_SNDBUF, (const char*)&nSendBuf, sizeof(int));
+	BOOL bReuseaddr = TRUE;
+	setsockopt(op->c_so, SOL_SOCKET, SO_REUSEADDR, (const char*)&bReuseaddr, sizeof(BOOL));
+
+	if (NULL == CreateIoCompletionPort((HANDLE)op->c_so, g_iocp, NULL, 0))
+	{
+		const int ercode = GetLastError();
+		closesockets(op->c_so);
+		FreeOp(op);
+		return ercode;
+	}
+
+	//AcceptExɹʱͬͶ֪ͨ,ֻзFALSEҲǹʧ,ʱ֪ͨ,opͷ
+	DWORD Cb = 0;
+	if (!m_AcceptEx(m_so, op->c_so, op->buf, 0, sizeof(sockaddr) + 16, sizeof(sockaddr) + 16, &Cb, (LPOVERLAPPED)op))
+	{
+		const int ercode = WSAGetLastError();
+		if (ercode != ERROR_IO_PENDING)
+		{
+			closesockets(op->c_so);
+			FreeOp(op);
+			return ercode;
+		}
+	}
+	return 0;
+}
+
+void iocp_tcp::ClientAccept(bool error, P_tcpstruct nop)
+{
+	while (!m_Close && 0 != Accept())
+	{
+		Sleep(1);
+	}
+
+	setsockopt(nop->c_so, SOL_SOCKET, SO_UPDATE_ACCEPT_CONTEXT, (char*)&m_so, sizeof(SOCKET));
+
+	etcp::set_keepalive(nop->c_so, 1000 * 30, 1000 * 5);
+
+	EnterCriticalSection(&m_cs);
+	m_cnum++;
+	LeaveCriticalSection(&m_cs);
+
+	//ȵǼǷͶ,ӻصоͿԷ
+	if (!error)
+	{
+		nop->queue = std::make_shared<send_queue>();
+		std::lock_guard<std::mutex> lock(m_queues_mu);
+		m_queues[nop->c_so] = nop->queue;
+	}
+
+	g_fun(this, nop->c_so, tcp_connt, NULL, NULL, m_cnum);
+
+	//ÿͻ˽ͶϿ
+	if (error)
+	{
+		EnterCriticalSection(&m_cs);
+		m_cnum--;
+		LeaveCriticalSection(&m_cs);
+
+		g_fun(this, nop->c_so, tcp_close, NULL, NULL, m_cnum);
+		closesockets(nop->c_so);
+		nop->c_so = INVALID_SOCKET;
+
+		FreeOp(nop);
+		return;
+	}
+
+	//ջAcceptEx,֡ģʽframe_decoderз
+	if (PostRecv(nop))
+	{
+		Disconnect(nop);
+	}
+}
+
+int iocp_tcp::PostRecv(P_tcpstruct nop)
+{
+	nop->state = tcp_recv;
+	nop->bufOffset = 0;
+
+	WSABUF wsabuf;
+	wsabuf.buf = nop->buf;
+	wsabuf.len = nop->bufSize;
+
+	DWORD Cb = 0;
+	DWORD Flg = 0;
+	if (WSARecv(nop->c_so, &wsabuf, 1, &Cb, &Flg, (LPWSAOVERLAPPED)nop, NULL))
+	{
+		int ercode = WSAGetLastError();
+		if (ercode != WSA_IO_PENDING)
+		{
+			return ercode;
+		}
+	}
+	return 0;
+}
+
+void iocp_tcp::Disconnect(P_tcpstruct nop)
+{
+	EnterCriticalSection(&m_cs);
+	m_cnum--;
+	LeaveCriticalSection(&m_cs);
+
+	if (nop->queue)
+	{
+		nop->queue->Fail();
+		//׽־ѱӸ,ֻƳԼ
+		std::lock_guard<std::mutex> lock(m_queues_mu);
+		auto it = m_queues.find(nop->c_so);
+		if (it != m_queues.end() && it->second == nop->queue)
+		{
+			m_queues.erase(it);
+		}
+	}
+
+	g_fun(this, nop->c_so, tcp_close, NULL, NULL, m_cnum);
+
+	//closesockets(nop->c_so);
+	//nop->c_so = INVALID_SOCKET;
+
+	FreeOp(nop);
+}
+
+void iocp_tcp::RecvData(bool error, P_tcpstruct nop)
+{
+	if (error)
+	{
+		Disconnect(nop);
+		return;
+	}
+
+	if (m_Is)
+	{
+		const SOCKET so = nop->c_so;
+		auto on_frame = [&](char* data, DWORD len, std::uint32_t flags, std::uint32_t id) {
+			etcp::request_scope scope(flags, id);
+			g_fun(this, so, tcp_recv, data, len, m_cnum);
+		};
+		if (!nop->frame.feed(nop->buf, nop->cb, on_frame))
+		{
+			//ݴ
+			Disconnect(nop);
+			return;
+		}
+	}
+	else
+	{
+		g_fun(this, nop->c_so, tcp_recv, nop->buf, nop->cb, m_cnum);
+	}
+
+	if (PostRecv(nop))
+	{
+		Disconnect(nop);
+	}
+}
+std::shared_ptr<send_queue> iocp_tcp::FindQueue(SOCKET so)
+{
+	std::lock_guard<std::mutex> lock(m_queues_mu);
+	auto it = m_queues.find(so);
+	return it == m_queues.end() ? nullptr : it->second;
+}
+int iocp_tcp::PostSendOp(SOCKET so, P_tcpstruct op, WSABUF* bufs, DWORD count)
+{
+	op->so = this;
+	op->c_so = so;
+	op->state = tcp_send;
+	if (WSASend(so, bufs, count, &op->cb, 0, (LPWSAOVERLAPPED)op, NULL))
+	{
+		int ercode = WSAGetLastError();
+		if (ercode != WSA_IO_PENDING)
+		{
+			op->queue->Fail();
+			FreeOp(op);
+			return 1;
+		}
+
+	}
+	return 0;
+}
+int iocp_tcp::PostQueued(SOCKET so, const std::shared_ptr<send_queue>& queue, std::vector<etcp::send_data>&& blocks)
+{
+	tcpstruct* op = new tcpstruct;
+	op->queue = queue;
+	op->queued = std::move(blocks);
+
+	WSABUF wsabuf[send_queue::kMaxGather];
+	DWORD n = 0;
+	for (auto& block : op->queued)
+	{
+		wsabuf[n].buf = (char*)block.data();
+		wsabuf[n].len = DWORD(block.size());
+		op->slen += wsabuf[n].len;
+		n++;
+	}
+	return PostSendOp(so, op, wsabuf, n);
+}
+int iocp_tcp::PostSendv(SOCKET so, const etcp_buf* bufs, int count, BOOL framed)
+{
+	std::size_t total = 0;
+	if (!etcp::frames_size(bufs, count, framed, total))
+	{
+		return 1;
+	}
+	if (total == 0)
+	{
+		return 0;
+	}
+	std::shared_ptr<send_queue> queue = FindQueue(so);
+	if (!queue)
+	{
+		return 1;
+	}
+	//з;ʱŶ,ɺŶӵһ𷢳
+	const int ret = queue->Push(total, m_limits, [&](std::deque<etcp::send_data>& q) {
+		etcp::queue_frames(q, bufs, count, framed);
+		});
+	if (ret != send_queue::kPostNow)
+	{
+		return ret;
+	}
+
+	//SO_SNDBUFΪ0ʱWSASendֱʹĻ,÷ڷغͿʧЧ,Ըһ;֡Ͻͬһ,һͶ
+	tcpstruct* op = new tcpstruct;
+	op->queue = std::move(queue);
+	op->bufSize = DWORD(total);
+	op->buf = etcp::alloc_buffer(op->bufSize);
+	op->bufOffset = 0;
+	op->slen = op->bufSize;
+	etcp::pack_frames(op->buf, bufs, count, framed);
+
+	WSABUF wsabuf;
+	wsabuf.buf = op->buf;
+	wsabuf.len = op->bufSize;
+	return PostSendOp(so, op, &wsabuf, 1);
+}
+int iocp_tcp::SoSendData(SOCKET so, etcp::send_data&& data)
+{
+	if (data.size() > etcp::kMaxFrame)
+	{
+		return 1;
+	}
+	const std::size_t total = (m_Is ? etcp::kHeaderSize : 0) + data.size();
+	if (total == 0)
+	{
+		return 0;
+	}
+	std::shared_ptr<send_queue> queue = FindQueue(so);
+	if (!queue)
+	{
+		return 1;
+	}
+	const int ret = queue->Push(total, m_limits, [&](std::deque<etcp::send_data>& q) {
+		if (m_Is)
+		{
+			char head[etcp::kHeaderSize];
+			etcp::put_header(head, DWORD(data.size()));
+			etcp::queue_bytes(q, head, etcp::kHeaderSize);
+		}
+		etcp::queue_data(q, std::move(data));
+		});
+	if (ret != send_queue::kPostNow)
+	{
+		return ret;
+	}
+
+	//opе,ͷΪһ
+	tcpstruct* op = new tcpstruct;
+	op->queue = std::move(queue);
+	op->data = std::move(data);
+	op->slen = DWORD(total);
+	etcp::put_header(op->head, DWORD(op->data.size()));
+
+	WSABUF wsabuf[2];
+	DWORD n = 0;
+	if (m_Is)
+	{
+		wsabuf[n].buf = op->head;
+		wsabuf[n].len = etcp::kHeaderSize;
+		n++;
+	}
+	wsabuf[n].buf = (char*)op->data.data();
+	wsabuf[n].len = DWORD(op->data.size());
+	n++;
+	return PostSendOp(so, op, wsabuf, n);
+}
+int iocp_tcp::SoSends(SOCKET so, const char* buf, DWORD cb)
+{
+	if (cb > etcp::kMaxFrame)
+	{
+		return 1;
+	}
+	std::shared_ptr<send_queue> queue = FindQueue(so);
+	if (!queue)
+	{
+		return 1;
+	}
+	const etcp_buf one = { buf, int(cb) };
+	const std::size_t total = (m_Is ? etcp::kHeaderSize : 0) + cb;
+	const int ret = queue->Push(total, m_limits, [&](std::deque<etcp::send_data>& q) {
+		etcp::queue_frames(q, &one, 1, m_Is);
+		});
+	if (ret != send_queue::kPostNow)
+	{
+		//з;,Ϊ˳SoSendһŶ
+		return ret;
+	}
+
+	//ûз;,÷ȴ,ֱӴĻ,
+	const bool failed = etcp::send_frame(so, m_Is, buf, cb) != 0;
+	if (failed)
+	{
+		queue->Fail();
+		return 1;
+	}
+	std::vector<etcp::send_data> next;
+	const bool writable = queue->Complete(total, next);
+	if (!next.empty())
+	{
+		PostQueued(so, queue, std::move(next));
+	}
+	if (writable)
+	{
+		g_fun(this, so, tcp_send, NULL, NULL, m_cnum);
+	}
+	return 0;
+}
+int iocp_tcp::QueueInfo(SOCKET so, etcp_queue_info& info)
+{
+	std::shared_ptr<send_queue> queue = FindQueue(so);
+	if (!queue)
+	{
+		return 1;
+	}
+	queue->Info(info);
+	return 0;
+}
+void iocp_tcp::OnSend(bool ercode, P_tcpstruct nop)
+{
+	SOCKET n_so = nop->c_so;
+	std::shared_ptr<send_queue> queue = std::move(nop->queue);
+	const DWORD sent = nop->slen;
+	FreeOp(nop);
+
+	if (ercode)
+	{
+		if (queue)
+		{
+			queue->Fail();
+		}
+		closesockets(n_so);
+		g_fun(this, n_so, tcp_server_close, NULL, NULL, m_cnum);
+		n_so = INVALID_SOCKET;
+		return;
+	}
+
+	std::vector<etcp::send_data> next;
+	const bool writable = queue->Complete(sent, next);
+	if (!next.empty())
+	{
+		PostQueued(n_so, queue, std::move(next));
+	}
+	if (writable)
+	{
+		g_fun(this, n_so, tcp_send, NULL, NULL, m_cnum);
+	}
+}
+
+
+int iocp_tcp_client::Attach()
+{
+	HANDLE t = CreateIoCompletionPort((HANDLE)m_so, g_iocp_client, NULL, 0);
+	if (NULL == t)
+	{
+		return GetLastError();
+	}
+
+	tcpstruct_client* op = new tcpstruct_client;
+	op->so = this;
+	op->state = tcp_connt_client;
+	op->buf = NULL;
+	op->bufSize = 0;
+	op->bufOffset = 0;
+
+	PostQueuedCompletionStatus(g_iocp_client, 0, NULL, (LPOVERLAPPED)op);
+	return 0;
+}
+
+void iocp_tcp_client::OnConnect(bool ercode, P_tcpstruct_client op)
+{
+
+	setsockopt(m_so, SOL_SOCKET, 0x7010, NULL, 0);
+	debug_put((void*)g_fun_client);
+
+	g_fun_client(this, m_so, tcp_connt_client, NULL, 0);
+
+	if (ercode)
+	{
+		OnClose(ercode, op);
+		return;
+	}
+
+	op->bufSize = DWORD(etcp::buffer_capacity(tcp_len));
+	op->buf = etcp::alloc_buffer(op->bufSize);
+	op->state = tcp_recv_client;
+	op->bufOffset = 0;
+
+	if (1 == SoRecv(op))
+	{
+		OnClose(ercode, op);
+		return;
+	}
+}
+void iocp_tcp_client::OnRecv(bool ercode, P_tcpstruct_client op)
+{
+
+	if (ercode)
+	{
+		OnClose(ercode, op);
+		return;
+	}
+
+	if (m_Is)
+	{
+		auto on_frame = [this](char* data, DWORD len, std::uint32_t flags, std::uint32_t id) { OnData(data, len, flags, id); };
+		if (!op->frame.feed(op->buf, op->cb, on_frame))
+		{
+			//ݴ
+			OnClose(ercode, op);
+			return;
+		}
+	}
+	else
+	{
+		OnData(op->buf, op->cb, 0, 0);
+	}
+
+	op->bufOffset = 0;
+
+	if (1 == SoRecv(op))
+	{
+		OnClose(ercode, op);
+		return;
+	}
+}
+int iocp_tcp_client::SoRecv(P_tcpstruct_client op)
+{
+	op->so = this;
+	op->state = tcp_recv_client;
+
+	WSABUF wsabuf;
+	wsabuf.buf = op->buf + op->bufOffset;
+	wsabuf.len = op->bufSize - op->bufOffset;
+
+	DWORD Flg = 0;
+	if (WSARecv(m_so, &wsabuf, 1, &op->cb, &Flg, (LPWSAOVERLAPPED)op, NULL))
+	{
+		int ercode = WSAGetLastError();
+		if (ercode != WSA_IO_PENDING)
+		{
+			return 1;
+		}
+	}
+	return 0;
+}
+void iocp_tcp_client::OnClose(bool ercode, P_tcpstruct_client op)
+{
+	FreeOp(op);
+	m_queue.Fail();
+
+	OnClosed();
+
+	Close();
+}
+int iocp_tcp_client::Close()
+{
+	closesockets(m_so);
+	m_so = INVALID_SOCKET;
+	return 0;
+}
+
+int iocp_tcp_client::PostSendOp(P_tcpstruct_client op, WSABUF* bufs, DWORD count)
+{
+	op->so = this;
+	op->state = tcp_send_client;
+	if (WSASend(m_so, bufs, count, &op->cb, 0, (LPWSAOVERLAPPED)op, NULL))
+	{
+		int ercode = WSAGetLastError();
+		if (ercode != WSA_IO_PENDING)
+		{
+			m_queue.Fail();
+			FreeOp(op);
+			return 1;
+		}
+
+	}
+	return 0;
+}
+int iocp_tcp_client::PostQueued(std::vector<etcp::send_data>&& blocks)
+{
+	tcpstruct_client* op = new tcpstruct_client;
+	op->queued = std::move(blocks);
+
+	WSABUF wsabuf[send_queue::kMaxGather];
+	DWORD n = 0;
+	for (auto& block : op->queued)
+	{
+		wsabuf[n].buf = (char*)block.data();
+		wsabuf[n].len = DWORD(block.size());
+		op->slen += wsabuf[n].len;
+		n++;
+	}
+	return PostSendOp(op, wsabuf, n);
+}
+int iocp_tcp_client::PostSendv(const etcp_buf* bufs, int count, BOOL framed)
+{
+	std::size_t total = 0;
+	if (!etcp::frames_size(bufs, count, framed, total))
+	{
+		return 1;
+	}
+	if (total == 0)
+	{
+		return 0;
+	}
+	const int ret = m_queue.Push(total, m_limits, [&](std::deque<etcp::send_data>& q) {
+		etcp::queue_frames(q, bufs, count, framed);
+		});
+	if (ret != send_queue::kPostNow)
+	{
+		return ret;
+	}
+
+	tcpstruct_client* op = new tcpstruct_client;
+	op->bufSize = DWORD(total);
+	op->buf = etcp::alloc_buffer(op->bufSize);
+	op->slen = op->bufSize;
+	etcp::pack_frames(op->buf, bufs, count, framed);
+
+	WSABUF wsabuf;
+	wsabuf.buf = op->buf;
+	wsabuf.len = op->bufSize;
+	return PostSendOp(op, &wsabuf, 1);
+}
+int iocp_tcp_client::PostSendData(etcp::send_data&& data)
+{
+	const std::size_t total = (m_Is ? etcp::kHeaderSize : 0) + data.size();
+	if (total == 0)
+	{
+		return 0;
+	}
+	const int ret = m_queue.Push(total, m_limits, [&](std::deque<etcp::send_data>& q) {
+		if (m_Is)
+		{
+			char head[etcp::kHeaderSize];
+			etcp::put_header(head, DWORD(data.size()));
+			etcp::queue_bytes(q, head, etcp::kHeaderSize);
+		}
+		etcp::queue_data(q, std::move(data));
+		});
+	if (ret != send_queue::kPostNow)
+	{
+		return ret;
+	}
+
+	tcpstruct_client* op = new tcpstruct_client;
+	op->data = std::move(data);
+	op->slen = DWORD(total);
+	etcp::put_header(op->head, DWORD(op->data.size()));
+
+	WSABUF wsabuf[2];
+	DWORD n = 0;
+	if (m_Is)
+	{
+		wsabuf[n].buf = op->head;
+		wsabuf[n].len = etcp::kHeaderSize;
+		n++;
+	}
+	wsabuf[n].buf = (char*)op->data.data();
+	wsabuf[n].len = DWORD(op->data.size());
+	n++;
+	return PostSendOp(op, wsabuf, n);
+}
+int iocp_tcp_client::QueueInfo(etcp_queue_info& info)
+{
+	m_queue.Info(info);
+	return 0;
+}
+
+void iocp_tcp_client::OnSend(bool ercode, P_tcpstruct_client op)
+{
+	const DWORD sent = op->slen;
+	FreeOp(op);
+	//ʧʱֻر׽,Ľ֮ʧ,OnRecvΨһһζϿ֪ͨ
+	if (ercode)
+	{
+		m_queue.Fail();
+		Close();
+		return;
+	}
+
+	std::vector<etcp::send_data> next;
+	const bool writable = m_queue.Complete(sent, next);
+	if (!next.empty())
+	{
+		PostQueued(std::move(next));
+	}
+	if (writable)
+	{
+		g_fun_client(this, m_so, tcp_send_client, NULL, 0);
+	}
+}
+
+
+static unsigned __stdcall tcp_iocp_fun(void* pParam)
+{
+	while (true)
+	{
+		ULONG cb = NULL;
+		ULONG_PTR key = NULL;
+		tcpstruct* op = NULL;
+		bool error = false;
+
+		if (!GetQueuedCompletionStatus(g_iocp, &cb, (PULONG_PTR)&key, (LPOVERLAPPED*)&op, INFINITE))
+		{
+			error = true;
+		}
+		iocp_tcp* so = op->so;
+		if (op->state == tcp_recv && 0 >= cb)
+		{
+			error = true;
+		}
+		op->cb = cb;
+
+		if (so->m_Close)
+		{
+			so->OnSend(true, op);
+			continue;
+		}
+		switch (op->state)
+		{
+		case tcp_connt:
+			so->ClientAccept(error, op);
+			break;
+		case tcp_recv:
+			so->RecvData(error, op);
+			break;
+		case tcp_send:
+			so->OnSend(error, op);
+			break;
+		}
+
+	}
+	_endthreadex(0);
+	return 0;
+}
+static unsigned __stdcall tcp_iocp_fun_client(void* pParam)
+{
+	while (true)
+	{
+		ULONG cb = NULL;
+		ULONG_PTR key = NULL;
+		tcpstruct_client* op = NULL;
+		bool error = false;
+
+		if (!GetQueuedCompletionStatus(g_iocp_client, &cb, (PULONG_PTR)&key, (LPOVERLAPPED*)&op, INFINITE))
+		{
+			error = true;
+		}
+		iocp_tcp_client* so = op->so;
+		if (op->state == tcp_recv_client && 0 >= cb)
+		{
+			error = true;
+		}
+		op->cb = cb;
+
+		switch (op->state)
+		{
+		case tcp_connt_client:
+			so->OnConnect(error, op);
+			break;
+		case tcp_recv_client:
+
+			so->OnRecv(error, op);
+			break;
+		case tcp_send_client:
+			so->OnSend(error, op);
+			break;
+		}
+	}
+	_endthreadex(0);
+	return 0;
+}
+
+namespace {
+	class iocp_backend : public etcp_backend
+	{
+	public:
+		int Start() override
+		{
+			WSAData wsa;
+			if (WSAStartup(MAKEWORD(2, 2), &wsa) != 0)
+			{
+				return WSAGetLastError();
+			}
+			g_iocp = CreateIoCompletionPort(INVALID_HANDLE_VALUE, NULL, NULL, 0);
+			if (NULL == g_iocp)
+			{
+				return GetLastError();
+			}
+
+			g_iocp_client = CreateIoCompletionPort(INVALID_HANDLE_VALUE, NULL, NULL, 0);
+			if (NULL == g_iocp_client)
+			{
+				return GetLastError();
+			}
+
+			SYSTEM_INFO info;
+			GetSystemInfo(&info);
+			g_cpu = info.dwNumberOfProcessors + 2;
+			if (g_cpu < 5)
+			{
+				g_cpu = 5;
+			}
+
+			for (int i = 0; i < g_cpu; i++)
+			{
+				CloseHandle((HANDLE)_beginthreadex(NULL, 0, &tcp_iocp_fun, NULL, 0, NULL));
+				CloseHandle((HANDLE)_beginthreadex(NULL, 0, &tcp_iocp_fun_client, NULL, 0, NULL));
+			}
+
+			return 0;
+		}
+		tcp* NewServer() override
+		{
+			return new iocp_tcp;
+		}
+		tcp_client* NewClient() override
+		{
+			return new iocp_tcp_client;
+		}
+		int CloseSocket(SOCKET so, bool now) override
+		{
+			//WSARecv֮ʧ,ɹ̲߳tcp_close
+			return now ? closesockets(so) : closesocket(so);
+		}
+	};
+}
+
+etcp_backend* etcp_get_backend()
+{
+	static iocp_backend backend;
+	return &backend;
+}
+#endif
@@ -0,0 +1,157 @@
+//ԴETCP:շڴ
+#include "etcp_pool.h"
+#include <atomic>
+#include <new>
+
+namespace {
+	using etcp::block_cache;
+
+	/*ļϸֲ,ü*/
+	constexpr std::size_t kMaxCaches = 32;
+	block_cache* g_caches[kMaxCaches] = {};
+	std::atomic<std::size_t> g_cache_count{ 0 };
+
+	/*ÿ̶߳ÿblock_cacheһ,߳˳ʱʣµĿ齻زֿ*/
+	struct thread_caches
+	{
+		block_cache::local lists[kMaxCaches] = {};
+		~thread_caches()
+		{
+			const std::size_t n = g_cache_count.load(std::memory_order_acquire);
+			for (std::size_t i = 0; i < n && i < kMaxCaches; i++)
+			{
+				if (lists[i].head && g_caches[i])
+					g_caches[i]->flush(lists[i], 0);
+			}
+		}
+	};
+	thread_local thread_caches t_caches;
+
+	constexpr std::size_t kBufferClasses = 13;//256 << 12 == kMaxBuffer
+	static_assert((etcp::kMinBuffer << (kBufferClasses - 1)) == etcp::kMaxBuffer, "buffer classes");
+
+	std::size_t buffer_class(std::size_t size)
+	{
+		std::size_t c = 0;
+		while ((etcp::kMinBuffer << c) < size)
+			c++;
+		return c;
+	}
+
+	block_cache& buffer_cache(std::size_t c)
+	{
+		static block_cache* const* caches = [] {
+			static block_cache* list[kBufferClasses];
+			for (std::size_t i = 0; i < kBufferClasses; i++)
+				list[i] = new block_cache(etcp::kMinBuffer << i, 16 * 1024 * 1024);
+			return list;
+		}();
+		return *caches[c];
+	}
+}
+
+namespace etcp {
+	block_cache::block_cache(std::size_t size, std::size_t depot_bytes)
+		: m_size(size < sizeof(node) ? sizeof(node) : size)
+		, m_depot_max(depot_bytes / m_size)
+	{
+		m_id = g_cache_count.fetch_add(1);
+		if (m_id >= kMaxCaches)
+			throw std::bad_alloc();
+		g_caches[m_id] = this;
+	}
+
+	void* block_cache::get()
+	{
+		local& l = t_caches.lists[m_id];
+		if (!l.head)
+			refill(l);
+		if (node* n = l.head)
+		{
+			l.head = n->next;
+			l.count--;
+			return n;
+		}
+		return ::operator new(m_size);
+	}
+
+	void block_cache::put(void* p)
+	{
+		local& l = t_caches.lists[m_id];
+		node* n = static_cast<node*>(p);
+		n->next = l.head;
+		l.head = n;
+		if (++l.count >= kBatch * 2)
+			flush(l, kBatch);
+	}
+
+	void block_cache::refill(local& l)
+	{
+		std::lock_guard<std::mutex> lock(m_mu);
+		while (m_depot && l.count < kBatch)
+		{
+			node* n = m_depot;
+			m_depot = n->next;
+			m_depot_count--;
+			n->next = l.head;
+			l.head = n;
+			l.count++;
+		}
+	}
+
+	void block_cache::flush(local& l, std::size_t keep)
+	{
+		if (l.count <= keep)
+			return;
+		//ժµkeep֮
+		node** cut = &l.head;
+		for (std::size_t i = 0; i < keep; i++)
+			cut = &(*cut)->next;
+		node* first = *cut;
+		*cut = nullptr;
+		l.count = keep;
+
+		{
+			std::lock_guard<std::mutex> lock(m_mu);
+			while (first && m_depot_count < m_depot_max)
+			{
+				node* next = first->next;
+				first->next = m_depot;
+				m_depot = first;
+				m_depot_count++;
+				first = next;
+			}
+		}
+		//ֿ,Ļϵͳ
+		while (first)
+		{
+			node* next = first->next;
+			::operator delete(first);
+			first = next;
+		}
+	}
+
+	std::size_t buffer_capacity(std::size_t size)
+	{
+		return size > kMaxBuffer ? size : kMinBuffer << buffer_class(size);
+	}
+
+	char* alloc_buffer(std::size_t size)
+	{
+		if (size > kMaxBuffer)
+			return new char[size];
+		return static_cast<char*>(buffer_cache(buffer_class(size)).get());
+	}
+
+	void free_buffer(char* p, std::size_t size)
+	{
+		if (!p)
+			return;
+		if (size > kMaxBuffer)
+		{
+			delete[] p;
+			return;
+		}
+		buffer_cache(buffer_class(size)).put(p);
+	}
+}
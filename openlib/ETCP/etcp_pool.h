@@ -0,0 +1,81 @@
+#pragma once
+#include <cstddef>
+#include <mutex>
+
+/*
+* ETCPڴ.
+* ÿνܡաͶҪһĺһ黺,ɺͷ,ӶࡢϢʱȫֶѵҪ.
+* block_cache̶Сڴ:ÿ߳ԼĿ,ܶ˻ù˲ų빲ֿ⽻,
+* Լʹ"߳롢߳ͷ"̵ֿ߳÷,ƽÿkBatchβŽһ.
+*/
+namespace etcp {
+	class block_cache
+	{
+	public:
+		/*depot_bytesǹֿౣֽ,Ŀ黹ϵͳ*/
+		block_cache(std::size_t size, std::size_t depot_bytes);
+		void* get();
+		void put(void* p);
+
+		struct node
+		{
+			node* next;
+		};
+		struct local
+		{
+			node* head;
+			std::size_t count;
+		};
+		/*߳гǰkeepĿ齻ֿ,߳˳ʱkeepΪ0*/
+		void flush(local& l, std::size_t keep);
+
+	private:
+		static constexpr std::size_t kBatch = 32;
+		void refill(local& l);
+
+		const std::size_t m_size;
+		const std::size_t m_depot_max;
+		std::size_t m_id;
+		std::mutex m_mu;
+		node* m_depot = nullptr;
+		std::size_t m_depot_count = 0;
+	};
+
+	/*
+	* շ2ݷּ,kMinBufferkMaxBuffer֮ȡԶӦblock_cache,
+	* (ƴӳ֡ʱ)ֱϵͳ.
+	*/
+	constexpr std::size_t kMinBuffer = 256;
+	constexpr std::size_t kMaxBuffer = 1024 * 1024;
+	/*sizeֽʵܵõ*/
+	std::size_t buffer_capacity(std::size_t size);
+	char* alloc_buffer(std::size_t size);
+	/*sizealloc_bufferʱͬ(ͬһ),pΪ*/
+	void free_buffer(char* p, std::size_t size);
+
+	/*pooled<T>,Tnew/deleteרõblock_cacheṩ,÷*/
+	template<typename T>
+	struct pooled
+	{
+		static void* operator new(std::size_t size)
+		{
+			return size == sizeof(T) ? cache().get() : ::operator new(size);
+		}
+		static void operator delete(void* p, std::size_t size)
+		{
+			if (!p)
+				return;
+			if (size == sizeof(T))
+				cache().put(p);
+			else
+				::operator delete(p);
+		}
+	private:
+		static block_cache& cache()
+		{
+			//ֿʱܱ߳˳ʱ,Բ
+			static block_cache& c = *new block_cache(sizeof(T), 4 * 1024 * 1024);
+			return c;
+		}
+	};
+}
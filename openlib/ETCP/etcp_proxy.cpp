@@ -0,0 +1,216 @@
+//ԴETCP:ͻ˾ʱ,ֻõsend/recv,շ޹
+#include "etcp_backend.h"
+#include <cstring>
+
+namespace {
+	/*ȡһHTTPӦͷ,ֱ.ֽڶȡ,ߴ֮*/
+	int recv_http_head(SOCKET so, std::string& head)
+	{
+		char c;
+		while (head.size() < 8192)
+		{
+			if (etcp::recv_all(so, &c, 1))
+				return -1;
+			head.push_back(c);
+			if (head.size() >= 4 && head.compare(head.size() - 4, 4, "\r\n\r\n") == 0)
+				return 0;
+		}
+		return -1;
+	}
+
+	int SoProxySocks4(SOCKET so, const char* host, WORD port, const char* username)
+	{
+		in_addr addr;
+		if (!etcp::resolve_ipv4(host, addr))
+		{
+			return -1;
+		}
+
+		std::string request;
+		request.push_back(0x04);
+		request.push_back(0x01);
+		request.push_back(char(port >> 8));
+		request.push_back(char(port >> 0));
+		request.append(reinterpret_cast<const char*>(&addr), 4);
+		request.append(username);
+		request.push_back('\0');
+
+		if (etcp::send_all(so, request.data(), request.size()))
+		{
+			return -1;
+		}
+
+		unsigned char reply[8];
+		if (etcp::recv_all(so, (char*)reply, sizeof(reply)))
+		{
+			return -1;
+		}
+		if (reply[0] != 0x00 || reply[1] != 0x5A)
+		{
+			return -1;
+		}
+		return 0;
+	}
+
+	int SoProxySocks5(SOCKET so, const char* host, WORD port, const char* username, const char* userpass)
+	{
+		const size_t cbhost = strlen(host), cbuser = strlen(username), cbpass = strlen(userpass);
+		if (cbhost > 255 || cbuser > 255 || cbpass > 255)
+		{
+			return -1;
+		}
+
+		//֧֤û֤(RFC 1929)
+		const char hello[] = { 0x05, 0x02, 0x00, 0x02 };
+		if (etcp::send_all(so, hello, sizeof(hello)))
+		{
+			return -1;
+		}
+		unsigned char reply[4];
+		if (etcp::recv_all(so, (char*)reply, 2) || reply[0] != 0x05)
+		{
+			return -1;
+		}
+
+		if (reply[1] == 0x02)
+		{
+			std::string auth;
+			auth.push_back(0x01);
+			auth.push_back(char(cbuser));
+			auth.append(username, cbuser);
+			auth.push_back(char(cbpass));
+			auth.append(userpass, cbpass);
+			if (etcp::send_all(so, auth.data(), auth.size()))
+			{
+				return -1;
+			}
+			//RFC 1929ûй涨ظİ汾,ֻ״̬
+			if (etcp::recv_all(so, (char*)reply, 2) || reply[1] != 0x00)
+			{
+				return -1;
+			}
+		}
+		else if (reply[1] != 0x00)
+		{
+			return -1;
+		}
+
+		std::string request;
+		request.push_back(0x05);
+		request.push_back(0x01);
+		request.push_back(0x00);
+		request.push_back(0x03);
+		request.push_back(char(cbhost));
+		request.append(host, cbhost);
+		request.push_back(char(port >> 8));
+		request.push_back(char(port >> 0));
+		if (etcp::send_all(so, request.data(), request.size()))
+		{
+			return -1;
+		}
+
+		if (etcp::recv_all(so, (char*)reply, 4) || reply[0] != 0x05 || reply[1] != 0x00)
+		{
+			return -1;
+		}
+		//󶨵ĵַͶ˿,֮Ŀ
+		size_t cbaddr = 0;
+		switch (reply[3])
+		{
+		case 0x01: cbaddr = 4; break;
+		case 0x04: cbaddr = 16; break;
+		case 0x03:
+		{
+			unsigned char n;
+			if (etcp::recv_all(so, (char*)&n, 1))
+			{
+				return -1;
+			}
+			cbaddr = n;
+			break;
+		}
+		default:
+			return -1;
+		}
+		char bound[255 + 2];
+		if (etcp::recv_all(so, bound, cbaddr + 2))
+		{
+			return -1;
+		}
+		return 0;
+	}
+
+	int SoProxyHttp(SOCKET so, const char* host, WORD port, const char* username, const char* userpass)
+	{
+		const std::string target = std::string(host) + ':' + std::to_string(port);
+		std::string http = "CONNECT " + target + " HTTP/1.1\r\n";
+		http += "Host: " + target + "\r\n";
+		http += "Proxy-Connection: Keep-Alive\r\n";
+		if (username[0])
+		{
+			const std::string user = std::string(username) + ':' + userpass;
+			http += "Proxy-Authorization: Basic " + etcp::base64_encode(user.data(), user.size()) + "\r\n";
+		}
+		http += "Content-length: 0\r\n\r\n";
+
+		if (etcp::send_all(so, http.data(), http.size()))
+		{
+			return -1;
+		}
+
+		std::string head;
+		if (recv_http_head(so, head))
+		{
+			return -1;
+		}
+		if (head.compare(0, 13, "HTTP/1.0 200 ") != 0 && head.compare(0, 13, "HTTP/1.1 200 ") != 0)
+		{
+			return -1;
+		}
+		return 0;
+	}
+}
+
+namespace etcp {
+	std::string base64_encode(const void* data, std::size_t len)
+	{
+		static const char table[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+		const auto p = static_cast<const unsigned char*>(data);
+		std::string out;
+		out.reserve((len + 2) / 3 * 4);
+		std::size_t i = 0;
+		for (; i + 3 <= len; i += 3)
+		{
+			const unsigned v = p[i] << 16 | p[i + 1] << 8 | p[i + 2];
+			out.push_back(table[v >> 18]);
+			out.push_back(table[v >> 12 & 0x3F]);
+			out.push_back(table[v >> 6 & 0x3F]);
+			out.push_back(table[v & 0x3F]);
+		}
+		if (i < len)
+		{
+			const unsigned v = p[i] << 16 | (i + 1 < len ? p[i + 1] << 8 : 0);
+			out.push_back(table[v >> 18]);
+			out.push_back(table[v >> 12 & 0x3F]);
+			out.push_back(i + 1 < len ? table[v >> 6 & 0x3F] : '=');
+			out.push_back('=');
+		}
+		return out;
+	}
+
+	int proxy_handshake(SOCKET so, EProxyType type, const char* host, unsigned short port, const char* username, const char* userpass)
+	{
+		if (!username)
+			username = "";
+		if (!userpass)
+			userpass = "";
+		switch (type)
+		{
+		case PROXY_TYPE_SOCKS4:	return SoProxySocks4(so, host, port, username);
+		case PROXY_TYPE_SOCKS5:	return SoProxySocks5(so, host, port, username, userpass);
+		case PROXY_TYPE_HTTP:	return SoProxyHttp(so, host, port, username, userpass);
+		default:
+			return -1;//ERROR_INVALID_PARAMETER;
+		}
+	}
+}
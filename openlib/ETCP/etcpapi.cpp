@@ -19,12 +19,18 @@ namespace etcpkrnln {
 	void* myetcp_sever_create(u_short u_port, bool mod, const char* IP);
 	bool myetcp_init(void* _servercallback, void* _clinetcallback, int _inbuffer = 0);
 	bool  myetcp_server_send(void* pS, SOCKET  pC, vector<unsigned char>  data, bool  is_ret = false);
+	bool  myetcp_server_sendv(void* pS, SOCKET  pC, const vector<pair<const void*, size_t>>& datas);
+	bool  myetcp_server_set_limits(void* pS, unsigned int high, unsigned int low);
+	bool  myetcp_server_queue(void* pS, SOCKET  pC, int* depth, long long* bytes);
 	bool  myetcp_server_close(SOCKET  pC, bool  is_now = false);
 	bool  myetcp_server_over(void* pS);
 	char* myetcp_server_getclinet(void* pS, SOCKET  pC);
 	u_short  myetcp_server_get_port(void* pS);
 	void* clinet_con_f(const char* ip, u_short  uport, int  timedout = 10, bool  mod = false, int  type = 0, const char* proxyip = "", u_short  proxyport = 0, const char* name = "", const char* password = "");
 	bool  clinet_send_f(void* pC, vector<unsigned char>  data, bool  is_ret = false, vector<unsigned char>* ret_data = NULL, int delay_ret = 2);
+	bool  clinet_sendv_f(void* pC, const vector<pair<const void*, size_t>>& datas);
+	bool  clinet_set_limits_f(void* pC, unsigned int high, unsigned int low);
+	bool  clinet_queue_f(void* pC, int* depth, long long* bytes);
 	bool  clinet_leave_f(void* pC);
 	SOCKET  get_clinet_soket(void* pC);
 	string get_ip_this_a();
@@ -146,7 +152,13 @@ public:
 	bool breakoff(SOCKET pC, bool is_now = false);
 	string get_clinet_ip(SOCKET pC);
 	wstring get_clinet_ip_w(SOCKET pC);
-	bool send(SOCKET pClinet, const vector<unsigned char>& data, bool is_ret = false);
+	bool send(SOCKET pClinet, vector<unsigned char> data, bool is_ret = false);
+	//ÿΪһ֡,һύϵͳ;ڷǰѸƻ򷢳
+	bool send_batch(SOCKET pClinet, const vector<pair<const void*, size_t>>& datas);
+	//ÿͻķͶдﵽˮλͷfalse,ֱˮλ;highΪ0ʱ
+	bool set_send_limits(unsigned int high, unsigned int low);
+	//ȡͻͶеĿֽ
+	bool get_send_queue(SOCKET pClinet, int* depth, long long* bytes);
 	//ڻص ##ͻ##ݵ##ͻ뿪 ʹ;
 	SOCKET get_clinet();
 	//bool Ͽ(ͻ ҪϿĿͻ, bool Ͽ = false);
@@ -365,11 +377,35 @@ wstring eServer::get_clinet_ip_w(SOCKET pClinet) {
 	}
 	return L"";
 };
-bool  eServer::send(SOCKET pClinet, const vector<unsigned char>& data, bool  is_ret)//ͳɹtrue
+bool  eServer::send(SOCKET pClinet, vector<unsigned char> data, bool  is_ret)//ͳɹtrue
 {
 	if (m_sever_num)
 	{
-		return myetcp_server_send(m_sever_num, pClinet, data, is_ret);
+		return myetcp_server_send(m_sever_num, pClinet, std::move(data), is_ret);
+	}
+	return false;
+}
+bool  eServer::send_batch(SOCKET pClinet, const vector<pair<const void*, size_t>>& datas)//ͳɹtrue
+{
+	if (m_sever_num)
+	{
+		return myetcp_server_sendv(m_sever_num, pClinet, datas);
+	}
+	return false;
+}
+bool  eServer::set_send_limits(unsigned int high, unsigned int low)
+{
+	if (m_sever_num)
+	{
+		return myetcp_server_set_limits(m_sever_num, high, low);
+	}
+	return false;
+}
+bool  eServer::get_send_queue(SOCKET pClinet, int* depth, long long* bytes)
+{
+	if (m_sever_num)
+	{
+		return myetcp_server_queue(m_sever_num, pClinet, depth, bytes);
 	}
 	return false;
 }
@@ -421,7 +457,13 @@ public:
 	eClinet(void* clinet_connect_cb = NULL, void* data_get_cb = NULL, void* clinet_backoff_cb = NULL);
 	bool connect(string ip, u_short  port, int  timeout = 10, bool  mod = false, int  type = 0, string pxoryip = "", u_short  proxy_port = 0, string name = "", string password = "");
 	bool connect(wstring ip, u_short  port, int  timeout = 10, bool  mod = false, int  type = 0, wstring pxoryip = L"", u_short  proxy_port = 0, wstring name = L"", wstring password = L"");
-	bool  send(const vector<unsigned char>& data, bool is_ret = false, vector<unsigned char>* ret_data = NULL, int delay_ret = 2);
+	bool  send(vector<unsigned char> data, bool is_ret = false, vector<unsigned char>* ret_data = NULL, int delay_ret = 2);
+	//ÿΪһ֡,һύϵͳ;ڷǰѸƻ򷢳
+	bool send_batch(const vector<pair<const void*, size_t>>& datas);
+	//Ͷдﵽˮλͷfalse,ֱˮλ;highΪ0ʱ
+	bool set_send_limits(unsigned int high, unsigned int low);
+	//ȡͶеĿֽ
+	bool get_send_queue(int* depth, long long* bytes);
 	bool backoff();
 	SOCKET get_socket();
 	//##ݵ##ʹ;
@@ -470,16 +512,40 @@ bool eClinet::connect(wstring ip, u_short  port, int  timeout, bool  mode, int
 	return true;
 };
 
-bool  eClinet::send(const vector<unsigned char>& data, bool is_ret, vector<unsigned char>* pRet_Data, int delay_ret) {
+bool  eClinet::send(vector<unsigned char> data, bool is_ret, vector<unsigned char>* pRet_Data, int delay_ret) {
 
 	if (m_clinet_num)
 	{
-		return clinet_send_f(m_clinet_num, data, is_ret, pRet_Data, delay_ret);
+		return clinet_send_f(m_clinet_num, std::move(data), is_ret, pRet_Data, delay_ret);
 	}
 	return false;
 
 
 };
+bool  eClinet::send_batch(const vector<pair<const void*, size_t>>& datas) {
+
+	if (m_clinet_num)
+	{
+		return clinet_sendv_f(m_clinet_num, datas);
+	}
+	return false;
+};
+bool  eClinet::set_send_limits(unsigned int high, unsigned int low) {
+
+	if (m_clinet_num)
+	{
+		return clinet_set_limits_f(m_clinet_num, high, low);
+	}
+	return false;
+};
+bool  eClinet::get_send_queue(int* depth, long long* bytes) {
+
+	if (m_clinet_num)
+	{
+		return clinet_queue_f(m_clinet_num, depth, bytes);
+	}
+	return false;
+};
 
 bool eClinet::backoff() {
 	if (m_clinet_num)
@@ -21,7 +21,13 @@ public:
 	eClinet(void* clinet_connect_cb = NULL, void* data_get_cb = NULL, void* clinet_backoff_cb = NULL);
 	bool connect(string ip, u_short  port, int  timeout = 10, bool  mod = false, int  type = 0, string pxoryip = "", u_short  proxy_port = 0, string name = "", string password = "");
 	bool connect(wstring ip, u_short  port, int  timeout = 10, bool  mod = false, int  type = 0, wstring pxoryip = L"", u_short  proxy_port = 0, wstring name = L"", wstring password = L"");
-	bool  send(const vector<unsigned char>& data, bool is_ret = false, vector<unsigned char>* ret_data = NULL, int delay_ret = 2);
+	bool  send(vector<unsigned char> data, bool is_ret = false, vector<unsigned char>* ret_data = NULL, int delay_ret = 2);
+	//ÿΪһ֡,һύϵͳ;ڷǰѸƻ򷢳
+	bool send_batch(const vector<pair<const void*, size_t>>& datas);
+	//Ͷдﵽˮλͷfalse,ֱˮλ;highΪ0ʱ
+	bool set_send_limits(unsigned int high, unsigned int low);
+	//ȡͶеĿֽ
+	bool get_send_queue(int* depth, long long* bytes);
 	bool backoff();
 	SOCKET get_socket();
 	//##ݵ##ʹ;
@@ -59,7 +65,13 @@ public:
 	bool breakoff(SOCKET pC, bool is_now = false);
 	string get_clinet_ip(SOCKET pC);
 	wstring get_clinet_ip_w(SOCKET pC);
-	bool send(SOCKET pClinet, const vector<unsigned char>& data, bool is_ret = false);
+	bool send(SOCKET pClinet, vector<unsigned char> data, bool is_ret = false);
+	//ÿΪһ֡,һύϵͳ;ڷǰѸƻ򷢳
+	bool send_batch(SOCKET pClinet, const vector<pair<const void*, size_t>>& datas);
+	//ÿͻķͶдﵽˮλͷfalse,ֱˮλ;highΪ0ʱ
+	bool set_send_limits(unsigned int high, unsigned int low);
+	//ȡͻͶеĿֽ
+	bool get_send_queue(SOCKET pClinet, int* depth, long long* bytes);
 	//ڻص ##ͻ##ݵ##ͻ뿪 ʹ;
 	SOCKET get_clinet();
 	//bool Ͽ(ͻ ҪϿĿͻ, bool Ͽ = false);
@@ -4,7 +4,7 @@
 
 
 #define CLINETEX L"my_e_clinet_ex"
-static INT s_clinet_cmd[] = { 46,47,48,49 };
+static INT s_clinet_cmd[] = { 46,47,48,49,506,509,510 };
 
 static HBITMAP g_hbmp_clinet = NULL;
 
@@ -366,5 +366,139 @@ FucInfo  Clinet_Send = { {
 		/*arg lp*/  Args,
 	} ,Fn_Clinet_Send ,"Fn_Clinet_Send" };
 
+static ARG_INFO Args_SendBatch[] =
+{
+	{
+		/*name*/    "",
+		/*explain*/ ("͵ֽڼ,ÿԱΪһη͵"),
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_BIN,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_RECEIVE_ARRAY_DATA,
+	}
+};
+
+EXTERN_C void Fn_Clinet_SendBatch(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	HWND hWnd = elibstl::get_hwnd_from_arg(pArgInf);
+	eClinet* pClinet = (eClinet*)GetWindowLongPtrW(hWnd, GWL_USERDATA);
+	size_t count = 0;
+	LPBYTE* pAryData = elibstl::get_array_element_inf<LPBYTE*>(pArgInf[1].m_pAryData, &count);
+	std::vector<std::pair<const void*, size_t>> datas(count);
+	for (size_t i = 0; i < count; i++)
+	{
+		if (pAryData[i])
+		{
+			datas[i].first = pAryData[i] + sizeof(INT) * 2;
+			datas[i].second = *reinterpret_cast<INT*>(pAryData[i] + sizeof(INT));
+		}
+	}
+	pRetData->m_bool = pClinet->send_batch(datas);
+}
+
+FucInfo  Clinet_SendBatch = { {
+		/*ccname*/  (""),
+		/*egname*/  ("SendBatch"),
+		/*explain*/ ("ηеÿԱ,ԷԱֱյݺϲύ,áݡСɹ棬ʧܷؼ١"),
+		/*category*/-1,
+		/*state*/   NULL,
+		/*ret*/     SDT_BOOL,
+		/*reserved*/NULL,
+		/*level*/   LVL_HIGH,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*ArgCount*/1,
+		/*arg lp*/  Args_SendBatch,
+	} ,Fn_Clinet_SendBatch ,"Fn_Clinet_SendBatch" };
+
+static ARG_INFO Args_SetSendLimits[] =
+{
+	{
+		/*name*/    "ˮλ",
+		/*explain*/ ("Ͷδֽﵽֵ,ݷؼҲݡΪ0ʱ"),
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_INT,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_NONE,
+	},
+	{
+		/*name*/    "ˮλ",
+		/*explain*/ ("ﵽˮλ,нֵ²½ݡڸˮλʱˮλ"),
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_INT,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_NONE,
+	}
+};
+
+EXTERN_C void Fn_Clinet_SetSendLimits(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	HWND hWnd = elibstl::get_hwnd_from_arg(pArgInf);
+	eClinet* pClinet = (eClinet*)GetWindowLongPtrW(hWnd, GWL_USERDATA);
+	pRetData->m_bool = pClinet->set_send_limits(pArgInf[1].m_int < 0 ? 0 : pArgInf[1].m_int, pArgInf[2].m_int < 0 ? 0 : pArgInf[2].m_int);
+}
+
+FucInfo Clinet_SetSendLimits = { {
+		/*ccname*/  ("÷ˮλ"),
+		/*egname*/  ("SetSendLimits"),
+		/*explain*/ ("÷Ͷеĸߵˮλ(ֽ)ʱڶлѹ,ﵽˮλ󡰷ݡ롰͡ؼ,áȡͶС鿴ѹ,ˮλָĬϸˮλ16MBˮλ4MBӺ,ɹ档"),
+		/*category*/-1,
+		/*state*/   NULL,
+		/*ret*/     SDT_BOOL,
+		/*reserved*/NULL,
+		/*level*/   LVL_HIGH,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*ArgCount*/2,
+		/*arg lp*/  Args_SetSendLimits,
+	} ,Fn_Clinet_SetSendLimits ,"Fn_Clinet_SetSendLimits" };
+
+static ARG_INFO Args_GetSendQueue[] =
+{
+	{
+		/*name*/    "Ŷӿ",
+		/*explain*/ ("Աʡԡṩʱ,ضδϵͳݿ"),
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_INT,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_RECEIVE_VAR | ArgMark::AS_DEFAULT_VALUE_IS_EMPTY,
+	}
+};
+
+EXTERN_C void Fn_Clinet_GetSendQueue(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	HWND hWnd = elibstl::get_hwnd_from_arg(pArgInf);
+	eClinet* pClinet = (eClinet*)GetWindowLongPtrW(hWnd, GWL_USERDATA);
+	int depth = 0;
+	long long bytes = 0;
+	if (!pClinet->get_send_queue(&depth, &bytes))
+	{
+		pRetData->m_int64 = -1;
+		return;
+	}
+	if (pArgInf[1].m_pInt)
+		*pArgInf[1].m_pInt = depth;
+	pRetData->m_int64 = bytes;
+}
+
+FucInfo Clinet_GetSendQueue = { {
+		/*ccname*/  ("ȡͶ"),
+		/*egname*/  ("GetSendQueue"),
+		/*explain*/ ("ύδµֽ,ڷ͵ĺŶӵġδʱ-1"),
+		/*category*/-1,
+		/*state*/   NULL,
+		/*ret*/     SDT_INT64,
+		/*reserved*/NULL,
+		/*level*/   LVL_HIGH,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*ArgCount*/1,
+		/*arg lp*/  Args_GetSendQueue,
+	} ,Fn_Clinet_GetSendQueue ,"Fn_Clinet_GetSendQueue" };
+
 
 #pragma endregion
@@ -0,0 +1,1600 @@
+#include"ElibHelp.h"
+#include"eplDirWalk.h"
+#include<algorithm>
+#include<chrono>
+#ifndef _WIN32
+#include<cerrno>
+#include<climits>
+#include<cstdlib>
+#include<dirent.h>
+#include<fcntl.h>
+#include<sys/stat.h>
+#include<unistd.h>
+#endif
+
+namespace {
+	using namespace elibstl::dirwalk;
+	using char_type = path_type::value_type;
+
+#ifdef _WIN32
+	constexpr char_type kSep = L'\\';
+#else
+	constexpr char_type kSep = '/';
+#endif
+	/*ÿܹ߳ôٽ÷,ټ*/
+	constexpr size_t kBatchSize = 256;
+	/*Ŀ¼ʱȵļ*/
+	constexpr std::chrono::milliseconds kProgressInterval{ 200 };
+
+	std::uint32_t last_error()
+	{
+#ifdef _WIN32
+		return ::GetLastError();
+#else
+		return static_cast<std::uint32_t>(errno);
+#endif
+	}
+
+	bool is_not_empty(std::uint32_t code)
+	{
+#ifdef _WIN32
+		return code == ERROR_DIR_NOT_EMPTY;
+#else
+		return code == ENOTEMPTY || code == EEXIST;
+#endif
+	}
+
+#ifdef _WIN32
+	inline wchar_t fold(wchar_t c)
+	{
+		if (c < 0x80)
+			return (c >= L'a' && c <= L'z') ? static_cast<wchar_t>(c - 32) : c;
+		return static_cast<wchar_t>(reinterpret_cast<ULONG_PTR>(::CharUpperW(reinterpret_cast<LPWSTR>(static_cast<ULONG_PTR>(c)))));
+	}
+
+	bool same_text(const wchar_t* a, const wchar_t* b, size_t n)
+	{
+		return ::CompareStringOrdinal(a, static_cast<int>(n), b, static_cast<int>(n), TRUE) == CSTR_EQUAL;
+	}
+
+	std::int64_t to_filetime(const FILETIME& ft)
+	{
+		return static_cast<std::int64_t>((static_cast<std::uint64_t>(ft.dwHighDateTime) << 32) | ft.dwLowDateTime);
+	}
+#else
+	inline char fold(char c)
+	{
+		return c;
+	}
+
+	bool same_text(const char* a, const char* b, size_t n)
+	{
+		return std::char_traits<char>::compare(a, b, n) == 0;
+	}
+#endif
+
+	/*ȥĩβķָ,Ŀ¼(C:\/)*/
+	void trim_separators(path_type& path)
+	{
+		while (path.size() > 1 && path.back() == kSep && path[path.size() - 2] != ':')
+			path.pop_back();
+	}
+
+	/*dirĩβзָʱ*/
+	path_type join(const path_type& dir, const path_type& tail)
+	{
+		if (tail.empty())
+			return dir;
+		if (!dir.empty() && dir.back() == kSep && tail.front() == kSep)
+			return dir + tail.substr(1);
+		if (!dir.empty() && dir.back() != kSep && tail.front() != kSep)
+			return dir + kSep + tail;
+		return dir + tail;
+	}
+
+	bool is_within(const path_type& path, const path_type& dir)
+	{
+		if (path.size() < dir.size() || !same_text(path.c_str(), dir.c_str(), dir.size()))
+			return false;
+		return path.size() == dir.size() || dir.back() == kSep || path[dir.size()] == kSep;
+	}
+
+	bool is_directory(const path_type& path)
+	{
+#ifdef _WIN32
+		const DWORD attr = ::GetFileAttributesW(path.back() == kSep ? path.c_str() : (path + kSep).c_str());
+		return attr != INVALID_FILE_ATTRIBUTES && (attr & FILE_ATTRIBUTE_DIRECTORY);
+#else
+		struct stat st;
+		return ::stat(path.c_str(), &st) == 0 && S_ISDIR(st.st_mode);
+#endif
+	}
+
+	/*ӻĿ¼ӱ,;ļռλؽ㲻*/
+	bool is_link(const path_type& path)
+	{
+#ifdef _WIN32
+		WIN32_FIND_DATAW fd;
+		const HANDLE find = ::FindFirstFileExW(path.c_str(), FindExInfoBasic, &fd, FindExSearchNameMatch, NULL, 0);
+		if (find == INVALID_HANDLE_VALUE)
+			return false;
+		::FindClose(find);
+		return (fd.dwFileAttributes & FILE_ATTRIBUTE_REPARSE_POINT)
+			&& (fd.dwReserved0 == IO_REPARSE_TAG_SYMLINK || fd.dwReserved0 == IO_REPARSE_TAG_MOUNT_POINT);
+#else
+		struct stat st;
+		return ::lstat(path.c_str(), &st) == 0 && S_ISLNK(st.st_mode);
+#endif
+	}
+
+	/*Ŀ¼д:ʵʲõڲ·,Լ÷ԭʼд*/
+	struct root_path
+	{
+		path_type internal;
+		path_type display;
+		bool link = false;    /*rootǷӻĿ¼,internalָӶĿ*/
+
+		path_type to_display(const path_type& path) const
+		{
+			if (!is_within(path, internal))
+				return path;
+			return join(display, path.substr(internal.size()));
+		}
+	};
+
+	bool make_root(const path_type& path, root_path& root)
+	{
+		path_type p(path);
+#ifdef _WIN32
+		std::replace(p.begin(), p.end(), L'/', L'\\');
+#endif
+		trim_separators(p);
+		if (p.empty())
+			return false;
+		root.display = p;
+#ifdef _WIN32
+		if (p.compare(0, 4, L"\\\\?\\") == 0 || p.compare(0, 4, L"\\\\.\\") == 0)
+		{
+			root.internal = p;
+			root.link = is_link(p);
+			return true;
+		}
+		/*\\?\ʽ·ٽ...,ȡ·*/
+		DWORD n = ::GetFullPathNameW(p.c_str(), 0, NULL, NULL);
+		if (n == 0)
+			return false;
+		path_type full(n, L'\0');
+		n = ::GetFullPathNameW(p.c_str(), n, &full[0], NULL);
+		if (n == 0 || n >= full.size())
+			return false;
+		full.resize(n);
+		trim_separators(full);
+		root.internal = full.compare(0, 2, L"\\\\") == 0 ? L"\\\\?\\UNC\\" + full.substr(2) : L"\\\\?\\" + full;
+		root.link = is_link(root.internal);
+#else
+		/*realpath,ѱĿ.ĿĿ¼ܻ,ʱֻȫΪ·*/
+		root.link = is_link(p);
+		if (char* full = root.link ? nullptr : ::realpath(p.c_str(), nullptr))
+		{
+			root.internal = full;
+			std::free(full);
+		}
+		else if (p.front() != kSep)
+		{
+			char cwd[PATH_MAX];
+			if (::getcwd(cwd, sizeof(cwd)) == nullptr)
+				return false;
+			root.internal = join(cwd, p);
+		}
+		else
+			root.internal = p;
+#endif
+		return true;
+	}
+
+	/*̷Ŀ¼Ŀ¼"\\server\share"ĹĿ¼/ΪĿ¼*/
+	bool is_root(const root_path& root)
+	{
+#ifdef _WIN32
+		if (root.display.size() == 2 && root.display[1] == L':')//"C:"Ǹ̵ĵǰĿ¼,岻ȷ
+			return true;
+		/*ȥ\\?\ǰ׺,ʣ"C:\...""Volume{...}\...""\\server\share\..."*/
+		path_type full = root.internal;
+		if (full.compare(0, 8, L"\\\\?\\UNC\\") == 0)
+			full = L"\\\\" + full.substr(8);
+		else if (full.compare(0, 4, L"\\\\?\\") == 0 || full.compare(0, 4, L"\\\\.\\") == 0)
+			full.erase(0, 4);
+		const bool unc = full.compare(0, 2, L"\\\\") == 0;
+		const size_t top = unc ? 2 : 1;
+#else
+		const path_type& full = root.internal;
+		const bool unc = false;
+		const size_t top = 0;
+#endif
+		/*"C:""Volume{...}""\\server\share"֮ûĿ¼ĶǸĿ¼*/
+		size_t parts = 0;
+		for (size_t i = unc ? 2 : 0; i < full.size();)
+		{
+			const size_t end = full.find(kSep, i);
+			if (end != i)
+				parts++;
+			if (end == path_type::npos)
+				break;
+			i = end + 1;
+		}
+		return parts <= top;
+	}
+
+	struct dir_node
+	{
+		path_type path;
+		dir_node* parent = nullptr;
+		std::atomic<size_t> pending{ 1 };  /*öټδĿ¼*/
+		unsigned depth = 0;
+	};
+
+	class engine
+	{
+	public:
+		/*ʼöĿ¼ǰ,ؼʱĿ¼*/
+		std::function<bool(const dir_node& dir)> on_enter;
+		/*ÿ,descendʾĿ¼ᱻö;ؼʱֹͣ*/
+		std::function<bool(const entry& e, bool descend, unsigned worker)> on_entry;
+		/*Ŀ¼,ʱĿ¼on_leaveѷ*/
+		std::function<void(const dir_node& dir)> on_leave;
+		/*߳˳ǰ*/
+		std::function<void(unsigned worker)> on_exit;
+
+		engine(const root_path& root, const options& opt, error_list* errors)
+			: m_root(root), m_opt(opt), m_errors(errors),
+			m_threads(opt.threads > 0 ? opt.threads : (std::max)(2u, std::thread::hardware_concurrency() * 2))
+		{
+		}
+
+		unsigned threads() const { return m_threads; }
+		bool stopped() const { return m_stop; }
+
+		void stop()
+		{
+			m_stop = true;
+			std::lock_guard<std::mutex> lock(m_lock);
+			m_cv.notify_all();
+		}
+
+		void fail(const path_type& path, std::uint32_t code)
+		{
+			if (m_errors)
+				m_errors->add(m_root.to_display(path), code);
+		}
+
+		/*ɷ,ֹͣؼ*/
+		bool run()
+		{
+			auto root = new dir_node;
+			root->path = m_root.internal;
+			m_queue.push_back(root);
+			std::vector<std::thread> pool;
+			for (unsigned i = 1; i < m_threads; i++)
+				pool.emplace_back(&engine::worker, this, i);
+			worker(0);
+			for (auto& t : pool)
+				t.join();
+			/*ֹͣʣµĿ¼ö,ֻͷ*/
+			for (auto dir : m_queue)
+				finish(dir);
+			m_queue.clear();
+			return !m_stop;
+		}
+
+	private:
+		void worker(unsigned index)
+		{
+			entry e;
+			for (dir_node* dir; (dir = pop()) != nullptr;)
+			{
+				if (!m_stop && (!on_enter || on_enter(*dir)))
+					enumerate(*dir, e, index);
+				finish(dir);
+			}
+			if (on_exit)
+				on_exit(index);
+		}
+
+		dir_node* pop()
+		{
+			std::unique_lock<std::mutex> lock(m_lock);
+			m_cv.wait(lock, [&] { return !m_queue.empty() || m_done || m_stop; });
+			if (m_queue.empty() || m_stop)
+				return nullptr;
+			/*ȳ,ȴշֵĿ¼,вΪչúܳ*/
+			const auto dir = m_queue.back();
+			m_queue.pop_back();
+			return dir;
+		}
+
+		void push(dir_node* dir)
+		{
+			{
+				std::lock_guard<std::mutex> lock(m_lock);
+				m_queue.push_back(dir);
+			}
+			m_cv.notify_one();
+		}
+
+		void finish(dir_node* dir)
+		{
+			while (dir != nullptr && --dir->pending == 0)
+			{
+				if (!m_stop && on_leave)
+					on_leave(*dir);
+				const auto parent = dir->parent;
+				delete dir;
+				if (parent == nullptr)
+				{
+					std::lock_guard<std::mutex> lock(m_lock);
+					m_done = true;
+					m_cv.notify_all();
+				}
+				dir = parent;
+			}
+		}
+
+		bool visit(dir_node& dir, entry& e, unsigned index)
+		{
+			const bool descend = e.is_dir && (!e.is_link || m_opt.follow_links)
+				&& (m_opt.max_depth < 0 || e.depth < static_cast<unsigned>(m_opt.max_depth));
+			if (!on_entry(e, descend, index))
+			{
+				stop();
+				return false;
+			}
+			if (descend)
+			{
+				auto child = new dir_node;
+				child->path = e.path;
+				child->parent = &dir;
+				child->depth = e.depth;
+				++dir.pending;
+				push(child);
+			}
+			return !m_stop;
+		}
+
+		void enumerate(dir_node& dir, entry& e, unsigned index)
+		{
+			/*e.pathΪ̵߳·,ֻĩβ滻ļ*/
+			e.path.assign(dir.path);
+			if (e.path.back() != kSep)
+				e.path.push_back(kSep);
+			const size_t base = e.path.size();
+			e.name_offset = base;
+			e.depth = dir.depth + 1;
+#ifdef _WIN32
+			e.path.push_back(L'*');
+			WIN32_FIND_DATAW fd;
+			const HANDLE find = ::FindFirstFileExW(e.path.c_str(), FindExInfoBasic, &fd, FindExSearchNameMatch, NULL, FIND_FIRST_EX_LARGE_FETCH);
+			if (find == INVALID_HANDLE_VALUE)
+			{
+				const DWORD code = ::GetLastError();
+				if (code != ERROR_FILE_NOT_FOUND)
+					fail(dir.path, code);
+				return;
+			}
+			do
+			{
+				if (fd.cFileName[0] == L'.' && (fd.cFileName[1] == L'\0' || (fd.cFileName[1] == L'.' && fd.cFileName[2] == L'\0')))
+					continue;
+				e.path.resize(base);
+				e.path.append(fd.cFileName);
+				e.size = (static_cast<std::uint64_t>(fd.nFileSizeHigh) << 32) | fd.nFileSizeLow;
+				e.mtime = to_filetime(fd.ftLastWriteTime);
+				e.is_dir = (fd.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) != 0;
+				/*ļռλҲؽ,ֻзӺĿ¼Ӳ*/
+				e.is_link = (fd.dwFileAttributes & FILE_ATTRIBUTE_REPARSE_POINT)
+					&& (fd.dwReserved0 == IO_REPARSE_TAG_SYMLINK || fd.dwReserved0 == IO_REPARSE_TAG_MOUNT_POINT);
+				if (!visit(dir, e, index))
+					break;
+			} while (::FindNextFileW(find, &fd));
+			::FindClose(find);
+#else
+			DIR* handle = ::opendir(dir.path.c_str());
+			if (handle == nullptr)
+			{
+				if (errno != ENOENT)
+					fail(dir.path, last_error());
+				return;
+			}
+			const int dir_fd = ::dirfd(handle);
+			while (const dirent* de = ::readdir(handle))
+			{
+				if (de->d_name[0] == '.' && (de->d_name[1] == '\0' || (de->d_name[1] == '.' && de->d_name[2] == '\0')))
+					continue;
+				e.path.resize(base);
+				e.path.append(de->d_name);
+				struct stat st;
+				if (::fstatat(dir_fd, de->d_name, &st, AT_SYMLINK_NOFOLLOW) != 0)
+				{
+					if (errno != ENOENT)
+						fail(e.path, last_error());
+					continue;
+				}
+				e.is_link = S_ISLNK(st.st_mode);
+				e.is_dir = S_ISDIR(st.st_mode);
+				if (e.is_link && m_opt.follow_links)
+				{
+					struct stat target;
+					if (::fstatat(dir_fd, de->d_name, &target, 0) == 0 && S_ISDIR(target.st_mode))
+						e.is_dir = true;
+				}
+				e.size = S_ISREG(st.st_mode) ? static_cast<std::uint64_t>(st.st_size) : 0;
+				/*WindowsͬFILETIMEֵ*/
+				e.mtime = (static_cast<std::int64_t>(st.st_mtim.tv_sec) + 11644473600ll) * 10000000 + st.st_mtim.tv_nsec / 100;
+				if (!visit(dir, e, index))
+					break;
+			}
+			::closedir(handle);
+#endif
+		}
+
+		const root_path& m_root;
+		const options m_opt;
+		error_list* const m_errors;
+		const unsigned m_threads;
+		std::mutex m_lock;
+		std::condition_variable m_cv;
+		std::vector<dir_node*> m_queue;
+		bool m_done = false;
+		std::atomic<bool> m_stop{ false };
+	};
+
+	bool remove_file(const path_type& path)
+	{
+#ifdef _WIN32
+		if (::DeleteFileW(path.c_str()))
+			return true;
+		if (::GetLastError() != ERROR_ACCESS_DENIED)
+			return false;
+		const DWORD attr = ::GetFileAttributesW(path.c_str());
+		if (attr == INVALID_FILE_ATTRIBUTES || !(attr & FILE_ATTRIBUTE_READONLY))
+		{
+			::SetLastError(ERROR_ACCESS_DENIED);
+			return false;
+		}
+		const DWORD cleared = attr & ~FILE_ATTRIBUTE_READONLY;
+		return ::SetFileAttributesW(path.c_str(), cleared ? cleared : FILE_ATTRIBUTE_NORMAL) && ::DeleteFileW(path.c_str());
+#else
+		return ::unlink(path.c_str()) == 0;
+#endif
+	}
+
+	/*
+	* ɾļ(ɱ),ھرպʧ,
+	* ڼɾĿ¼ᱨĿ¼ǿ,retryΪʱԵȺԼ.
+	*/
+	bool remove_dir(const path_type& path, bool retry)
+	{
+#ifdef _WIN32
+		bool cleared = false;
+		for (int attempt = 0;; attempt++)
+		{
+			if (::RemoveDirectoryW(path.c_str()))
+				return true;
+			const DWORD code = ::GetLastError();
+			if (code == ERROR_ACCESS_DENIED && !cleared)
+			{
+				cleared = true;
+				const DWORD attr = ::GetFileAttributesW(path.c_str());
+				if (attr != INVALID_FILE_ATTRIBUTES && (attr & FILE_ATTRIBUTE_READONLY)
+					&& ::SetFileAttributesW(path.c_str(), attr & ~FILE_ATTRIBUTE_READONLY))
+					continue;
+			}
+			if (!retry || code != ERROR_DIR_NOT_EMPTY || attempt >= 3)
+			{
+				::SetLastError(code);
+				return false;
+			}
+			::Sleep(10u << attempt);
+		}
+#else
+		(void)retry;
+		return ::rmdir(path.c_str()) == 0;
+#endif
+	}
+
+	/*1ʾ½,0ʾѴ,-1ʾʧ*/
+	int make_dir(const path_type& path)
+	{
+#ifdef _WIN32
+		if (::CreateDirectoryW(path.c_str(), NULL))
+			return 1;
+		const DWORD code = ::GetLastError();
+		if (is_directory(path))
+			return 0;
+		::SetLastError(code);
+		return -1;
+#else
+		if (::mkdir(path.c_str(), 0755) == 0)
+			return 1;
+		const int code = errno;
+		if (is_directory(path))
+			return 0;
+		errno = code;
+		return -1;
+#endif
+	}
+
+	bool create_directories(const path_type& path)
+	{
+		if (make_dir(path) >= 0)
+			return true;
+#ifdef _WIN32
+		if (::GetLastError() != ERROR_PATH_NOT_FOUND)
+			return false;
+#else
+		if (errno != ENOENT)
+			return false;
+#endif
+		const auto slash = path.find_last_of(kSep);
+		if (slash == path_type::npos || slash == 0)
+			return false;
+		return create_directories(path.substr(0, slash)) && make_dir(path) >= 0;
+	}
+}
+
+namespace elibstl {
+	namespace dirwalk {
+		bool glob_match(const path_type::value_type* pattern, const path_type::value_type* name)
+		{
+			/*סһ*֮λ,ʧʱ*һַ,Ҫݹ*/
+			const char_type* star = nullptr;
+			const char_type* retry = nullptr;
+			while (*name)
+			{
+				if (*pattern == '*')
+				{
+					star = ++pattern;
+					retry = name;
+					continue;
+				}
+				if (*pattern && (*pattern == '?' || fold(*pattern) == fold(*name)))
+				{
+					++pattern;
+					++name;
+					continue;
+				}
+				if (star == nullptr)
+					return false;
+				pattern = star;
+				name = ++retry;
+			}
+			while (*pattern == '*')
+				++pattern;
+			return *pattern == '\0';
+		}
+
+		bool filter::trivial() const
+		{
+			return include.empty() && exclude.empty() && min_size == 0 && max_size == UINT64_MAX
+				&& modified_after == INT64_MIN && modified_before == INT64_MAX;
+		}
+
+		bool filter::match(const entry& e) const
+		{
+			if (e.is_dir ? !dirs : !files)
+				return false;
+			if (!e.is_dir && (e.size < min_size || e.size > max_size))
+				return false;
+			if (e.mtime < modified_after || e.mtime > modified_before)
+				return false;
+			const auto name = e.name();
+			if (!include.empty() && std::none_of(include.begin(), include.end(), [&](const path_type& p) { return glob_match(p.c_str(), name); }))
+				return false;
+			return std::none_of(exclude.begin(), exclude.end(), [&](const path_type& p) { return glob_match(p.c_str(), name); });
+		}
+
+		void error_list::add(const path_type& path, std::uint32_t code)
+		{
+			if (m_count++ >= kMaxKept)
+				return;
+			std::lock_guard<std::mutex> lock(m_lock);
+			m_items.push_back({ path, code });
+		}
+
+		std::vector<error_info> error_list::take()
+		{
+			std::lock_guard<std::mutex> lock(m_lock);
+			return std::move(m_items);
+		}
+
+		void error_list::clear()
+		{
+			std::lock_guard<std::mutex> lock(m_lock);
+			m_items.clear();
+			m_count = 0;
+		}
+
+		bool is_root_dir(const path_type& path)
+		{
+			root_path r;
+			return !make_root(path, r) || is_root(r);
+		}
+
+		bool walk(const path_type& root, const filter& f, const options& opt,
+			const std::function<bool(std::vector<entry>& batch)>& sink, error_list* errors)
+		{
+			root_path r;
+			if (!make_root(root, r) || (r.link && !opt.follow_links) || !is_directory(r.internal))
+				return false;
+			engine eng(r, opt, errors);
+			std::mutex sink_lock;
+			std::vector<std::vector<entry>> batches(eng.threads());
+			const auto flush = [&](std::vector<entry>& batch) {
+				std::lock_guard<std::mutex> lock(sink_lock);
+				const bool ok = !eng.stopped() && sink(batch);
+				batch.clear();
+				return ok;
+			};
+			eng.on_entry = [&](const entry& e, bool, unsigned worker) {
+				if (!f.match(e))
+					return true;
+				auto& batch = batches[worker];
+				batch.push_back(e);
+				auto& item = batch.back();
+				item.path = r.to_display(e.path);
+				item.name_offset = item.path.size() - (e.path.size() - e.name_offset);
+				return batch.size() < kBatchSize || flush(batch);
+			};
+			eng.on_exit = [&](unsigned worker) {
+				if (!batches[worker].empty() && !flush(batches[worker]))
+					eng.stop();
+			};
+			return eng.run();
+		}
+
+		bool remove_tree(const path_type& root, const filter& f, const options& opt,
+			bool remove_dirs, bool keep_root, bulk_result& result)
+		{
+			result = bulk_result();
+			root_path r;
+			/*ֹɾ,޷·Ҳܾ*/
+			if (!make_root(root, r) || is_root(r) || !is_directory(r.internal))
+				return false;
+			/*rootʱ,ֻɾ;rootɾĿ¼ʱûп*/
+			if (r.link)
+			{
+				if (!remove_dirs || keep_root)
+					return false;
+#ifdef _WIN32
+				if (!remove_dir(r.internal, false))
+#else
+				if (!remove_file(r.internal))
+#endif
+					return false;
+				result.dirs = 1;
+				return true;
+			}
+			options o = opt;
+			o.follow_links = false;
+			filter files_only = f;
+			files_only.files = true;
+			files_only.dirs = false;
+			/*ûκʱĿ¼Ӧȫɾ,ɾķǿĿ¼ʧ*/
+			const bool everything = f.trivial() && opt.max_depth < 0;
+			error_list errors;
+			engine eng(r, o, &errors);
+			std::atomic<std::uint64_t> files{ 0 }, dirs{ 0 }, bytes{ 0 };
+			eng.on_entry = [&](const entry& e, bool descend, unsigned) {
+				if (descend)
+					return true;
+				if (e.is_dir)
+				{
+					/*ֻɾӱ;ûнĿ¼*/
+					if (e.is_link && remove_dirs)
+					{
+						if (remove_dir(e.path, false))
+							++dirs;
+						else
+							eng.fail(e.path, last_error());
+					}
+					return true;
+				}
+				if (!files_only.match(e))
+					return true;
+				if (remove_file(e.path))
+				{
+					++files;
+					bytes += e.size;
+				}
+				else
+					eng.fail(e.path, last_error());
+				return true;
+			};
+			eng.on_leave = [&](const dir_node& dir) {
+				if (!remove_dirs || (keep_root && dir.parent == nullptr))
+					return;
+				if (remove_dir(dir.path, everything))
+					++dirs;
+				else
+				{
+					const auto code = last_error();
+					if (everything || !is_not_empty(code))
+						eng.fail(dir.path, code);
+				}
+			};
+			eng.run();
+			result.files = files;
+			result.dirs = dirs;
+			result.bytes = bytes;
+			result.failed = errors.count();
+			result.errors = errors.take();
+			return true;
+		}
+
+		bool copy_tree(const path_type& from, const path_type& to, const filter& f, const options& opt,
+			const fastcopy::copy_options& copy, bulk_result& result)
+		{
+			result = bulk_result();
+			root_path src, dst;
+			if (!make_root(from, src) || (src.link && !opt.follow_links) || !is_directory(src.internal) || !make_root(to, dst))
+				return false;
+			/*ĿԴĿ¼֮ʱ,Ƴļᱻٴα*/
+			if (is_within(dst.internal, src.internal) || !create_directories(dst.internal))
+				return false;
+			filter files_only = f;
+			files_only.files = true;
+			files_only.dirs = false;
+			const auto target_of = [&](const path_type& path) { return join(dst.internal, path.substr(src.internal.size())); };
+			error_list errors;
+			engine eng(src, opt, &errors);
+			std::atomic<std::uint64_t> files{ 0 }, dirs{ 0 }, bytes{ 0 };
+			/*ҵĺѴֽ,ֻڱ*/
+			std::atomic<std::uint64_t> found{ 0 }, processed{ 0 };
+			std::atomic<bool> cancelled{ false };
+			eng.on_enter = [&](const dir_node& dir) {
+				if (dir.parent == nullptr)
+					return true;
+				const int made = make_dir(target_of(dir.path));
+				if (made < 0)
+				{
+					eng.fail(dir.path, last_error());
+					return false;
+				}
+				dirs += made;
+				return true;
+			};
+			eng.on_entry = [&](const entry& e, bool, unsigned) {
+				if (e.is_dir || (e.is_link && !opt.follow_links) || !files_only.match(e))
+					return true;
+				found += e.size;
+				fastcopy::copy_options one = copy;
+				std::uint64_t reported = 0;
+				if (copy.progress)
+				{
+					one.progress = [&](std::uint64_t done, std::uint64_t) {
+						processed += done - reported;
+						reported = done;
+						return !cancelled;
+					};
+				}
+				std::uint64_t written = 0;
+				const auto status = fastcopy::copy_file(e.path, target_of(e.path), one, &written);
+				/*ļڱ˳ߴʱҵʱĳߴ,Ȳᳬ*/
+				processed += e.size > reported ? e.size - reported : 0;
+				switch (status)
+				{
+				case fastcopy::status::copied:
+					++files;
+					bytes += written;
+					break;
+				case fastcopy::status::failed:
+					eng.fail(e.path, last_error());
+					break;
+				case fastcopy::status::cancelled:
+					return false;
+				default:
+					break;
+				}
+				return !cancelled;
+			};
+			if (!copy.progress)
+				eng.run();
+			else
+			{
+				/*͸Ʒŵ̨,ڵ÷߳б,صӳ򲻱ؿǶ߳*/
+				std::mutex lock;
+				std::condition_variable cv;
+				bool finished = false;
+				std::thread runner([&] {
+					eng.run();
+					std::lock_guard<std::mutex> guard(lock);
+					finished = true;
+					cv.notify_all();
+				});
+				std::unique_lock<std::mutex> guard(lock);
+				while (!finished)
+				{
+					cv.wait_for(guard, kProgressInterval, [&] { return finished; });
+					const bool last = finished;
+					guard.unlock();
+					/*һαʱȫ,ؼҲȡ*/
+					if (!copy.progress(processed, found) && !last && !cancelled)
+					{
+						cancelled = true;
+						eng.stop();
+					}
+					guard.lock();
+				}
+				guard.unlock();
+				runner.join();
+			}
+			result.files = files;
+			result.dirs = dirs;
+			result.bytes = bytes;
+			result.failed = errors.count();
+			result.errors = errors.take();
+			return !cancelled;
+		}
+
+		bool walker::start(const path_type& root, const filter& f, const options& opt)
+		{
+			stop();
+			root_path r;
+			if (!make_root(root, r) || (r.link && !opt.follow_links) || !is_directory(r.internal))
+				return false;
+			{
+				std::lock_guard<std::mutex> lock(m_lock);
+				m_cancel = false;
+				m_running = true;
+			}
+			m_found = 0;
+			m_errors.clear();
+			m_thread = std::thread([this, root, f, opt] {
+				walk(root, f, opt, [this](std::vector<entry>& batch) {
+					std::unique_lock<std::mutex> lock(m_lock);
+					m_cv.wait(lock, [&] { return m_cancel || m_queue.size() < kQueueLimit; });
+					if (m_cancel)
+						return false;
+					for (auto& e : batch)
+						m_queue.push_back(std::move(e.path));
+					m_found += batch.size();
+					m_cv.notify_all();
+					return true;
+					}, &m_errors);
+				std::lock_guard<std::mutex> lock(m_lock);
+				m_running = false;
+				m_cv.notify_all();
+				});
+			return true;
+		}
+
+		bool walker::next_batch(size_t max_count, int timeout_ms, std::vector<path_type>& out)
+		{
+			out.clear();
+			std::unique_lock<std::mutex> lock(m_lock);
+			const auto ready = [&] { return !m_queue.empty() || !m_running; };
+			if (timeout_ms < 0)
+				m_cv.wait(lock, ready);
+			else
+				m_cv.wait_for(lock, std::chrono::milliseconds(timeout_ms), ready);
+			const size_t n = (std::min)(max_count, m_queue.size());
+			out.reserve(n);
+			for (size_t i = 0; i < n; i++)
+			{
+				out.push_back(std::move(m_queue.front()));
+				m_queue.pop_front();
+			}
+			if (n > 0)
+				m_cv.notify_all();
+			return n > 0 || m_running;
+		}
+
+		void walker::stop()
+		{
+			{
+				std::lock_guard<std::mutex> lock(m_lock);
+				m_cancel = true;
+			}
+			m_cv.notify_all();
+			if (m_thread.joinable())
+				m_thread.join();
+			std::lock_guard<std::mutex> lock(m_lock);
+			m_queue.clear();
+			m_running = false;
+		}
+
+		bool walker::done()
+		{
+			std::lock_guard<std::mutex> lock(m_lock);
+			return !m_running && m_queue.empty();
+		}
+	}
+}
+
+using elibstl::dirwalk::bulk_result;
+using elibstl::dirwalk::error_info;
+using elibstl::dirwalk::filter;
+using elibstl::dirwalk::options;
+using elibstl::dirwalk::walker;
+
+namespace {
+	/*;ָĶͨ,յĺ*/
+	std::vector<std::wstring> split_patterns(std::wstring_view text)
+	{
+		std::vector<std::wstring> patterns;
+		while (!text.empty())
+		{
+			const auto pos = text.find(L';');
+			const auto item = text.substr(0, pos);
+			if (!item.empty())
+				patterns.emplace_back(item);
+			if (pos == std::wstring_view::npos)
+				break;
+			text.remove_prefix(pos + 1);
+		}
+		return patterns;
+	}
+
+	/*ԵʱǱʱ,ļʱͬUTC FILETIMEֵ*/
+	std::int64_t date_to_filetime(DATE date, std::int64_t fallback)
+	{
+		SYSTEMTIME local, utc;
+		FILETIME ft;
+		if (!::VariantTimeToSystemTime(date, &local) || !::TzSpecificLocalTimeToSystemTime(NULL, &local, &utc) || !::SystemTimeToFileTime(&utc, &ft))
+			return fallback;
+		return static_cast<std::int64_t>((static_cast<std::uint64_t>(ft.dwHighDateTime) << 32) | ft.dwLowDateTime);
+	}
+
+	/*firstʼΪ:ͨųͨСߴ硢ߴ硢޸ʱڡ޸ʱ*/
+	filter args_to_filter(PMDATA_INF pArgInf, int first)
+	{
+		filter f;
+		if (pArgInf[first].m_dtDataType != _SDT_NULL)
+			f.include = split_patterns(elibstl::args_to_wsdata(pArgInf, first));
+		if (pArgInf[first + 1].m_dtDataType != _SDT_NULL)
+			f.exclude = split_patterns(elibstl::args_to_wsdata(pArgInf, first + 1));
+		if (pArgInf[first + 2].m_dtDataType != _SDT_NULL && pArgInf[first + 2].m_int64 > 0)
+			f.min_size = static_cast<std::uint64_t>(pArgInf[first + 2].m_int64);
+		if (pArgInf[first + 3].m_dtDataType != _SDT_NULL)
+			f.max_size = pArgInf[first + 3].m_int64 < 0 ? 0 : static_cast<std::uint64_t>(pArgInf[first + 3].m_int64);
+		if (pArgInf[first + 4].m_dtDataType != _SDT_NULL)
+			f.modified_after = date_to_filetime(pArgInf[first + 4].m_date, INT64_MIN);
+		if (pArgInf[first + 5].m_dtDataType != _SDT_NULL)
+			f.modified_before = date_to_filetime(pArgInf[first + 5].m_date, INT64_MAX);
+		return f;
+	}
+
+	options args_to_options(PMDATA_INF pArgInf, int threads)
+	{
+		options opt;
+		const auto n = elibstl::args_to_data<INT>(pArgInf, threads).value_or(0);
+		opt.threads = n > 0 ? static_cast<unsigned>(n) : 0;
+		return opt;
+	}
+
+	void put_failures(MDATA_INF& arg, const std::vector<error_info>& errors)
+	{
+		if (arg.m_dtDataType == _SDT_NULL)
+			return;
+		std::vector<std::wstring> paths;
+		paths.reserve(errors.size());
+		for (const auto& e : errors)
+			paths.push_back(e.path);
+		elibstl::free_text_array_var(arg.m_ppAryData);
+		*arg.m_ppAryData = elibstl::create_text_array(paths);
+	}
+}
+
+static ARG_INFO Args_RemoveTree[] =
+{
+	{
+		/*name*/    "Ŀ¼",
+		/*explain*/ "",
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_BIN,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_NONE,
+	},
+	{
+		/*name*/    "ͨ",
+		/*explain*/ "Աʡԡֻļ֮ƥļ,֧*?,ִСд,ͨá;ָ,硰*.tmp;*.log",
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_BIN,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_DEFAULT_VALUE_IS_EMPTY,
+	},
+	{
+		/*name*/    "ųͨ",
+		/*explain*/ "Աʡԡļ֮ƥļ,дͬͨ",
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_BIN,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_DEFAULT_VALUE_IS_EMPTY,
+	},
+	{
+		/*name*/    "Сߴ",
+		/*explain*/ "ԱʡԡֻСڴֽļ",
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_INT64,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_DEFAULT_VALUE_IS_EMPTY,
+	},
+	{
+		/*name*/    "ߴ",
+		/*explain*/ "Աʡԡֻڴֽļ",
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_INT64,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_DEFAULT_VALUE_IS_EMPTY,
+	},
+	{
+		/*name*/    "޸ʱ",
+		/*explain*/ "Աʡԡֻ޸ʱ䲻ڴʱ",
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_DATE_TIME,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_DEFAULT_VALUE_IS_EMPTY,
+	},
+	{
+		/*name*/    "޸ʱ",
+		/*explain*/ "Աʡԡֻ޸ʱ䲻ڴʱ",
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_DATE_TIME,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_DEFAULT_VALUE_IS_EMPTY,
+	},
+	{
+		/*name*/    "ɾĿ¼",
+		/*explain*/ "ԱʡԡΪʱļɾɾյĿ¼(Ŀ¼);ΪʱֻɾļĬΪ",
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_BOOL,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_DEFAULT_VALUE_IS_EMPTY,
+	},
+	{
+		/*name*/    "߳",
+		/*explain*/ "ԱʡԡΪ0ʡʱʹCPU,̲󲿷ʱڵȴ,̶߳ں",
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_INT,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_DEFAULT_VALUE_IS_EMPTY,
+	},
+	{
+		/*name*/    "ʧб",
+		/*explain*/ "Աʡԡṩʱд봦ʧܵ·,ౣ1000",
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_BIN,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_RECEIVE_VAR_ARRAY | ArgMark::AS_DEFAULT_VALUE_IS_EMPTY,
+	}
+};
+EXTERN_C void fn_remove_tree_W(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	bulk_result result;
+	const std::wstring root(elibstl::args_to_wsdata(pArgInf, 0));
+	if (!elibstl::dirwalk::remove_tree(root, args_to_filter(pArgInf, 1), args_to_options(pArgInf, 8),
+		elibstl::args_to_data<BOOL>(pArgInf, 7).value_or(FALSE) != FALSE, true, result))
+	{
+		pRetData->m_int64 = -1;
+		return;
+	}
+	put_failures(pArgInf[9], result.errors);
+	pRetData->m_int64 = static_cast<INT64>(result.files);
+}
+FucInfo Fn_remove_tree_W = { {
+		/*ccname*/  ("ɾW"),
+		/*egname*/  ("remove_treeW"),
+		/*explain*/ ("ɾĿ¼Ŀ¼зļ,ɾļ,Ŀ¼ʱ-1߳ͬʱöٺɾ,ֻļȥֻԡĿ¼ӺͷӡĳļɾʧܲӰļ,ʧܵ·롰ʧб"),
+		/*category*/4,
+		/*state*/   NULL,
+		/*ret*/     SDT_INT64,
+		/*reserved*/NULL,
+		/*level*/   LVL_HIGH,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+	ESTLARG(Args_RemoveTree)
+	} ,ESTLFNAME(fn_remove_tree_W) };
+
+static ARG_INFO Args_CopyTree[] =
+{
+	{
+		/*name*/    "ԴĿ¼",
+		/*explain*/ "",
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_BIN,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_NONE,
+	},
+	{
+		/*name*/    "ĿĿ¼",
+		/*explain*/ "ʱԶ,λԴĿ¼֮",
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_BIN,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_NONE,
+	},
+	{
+		/*name*/    "ͨ",
+		/*explain*/ "Աʡԡֻļ֮ƥļ,֧*?,ִСд,ͨá;ָ,硰*.tmp;*.log",
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_BIN,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_DEFAULT_VALUE_IS_EMPTY,
+	},
+	{
+		/*name*/    "ųͨ",
+		/*explain*/ "Աʡԡļ֮ƥļ,дͬͨ",
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_BIN,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_DEFAULT_VALUE_IS_EMPTY,
+	},
+	{
+		/*name*/    "Сߴ",
+		/*explain*/ "ԱʡԡֻСڴֽļ",
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_INT64,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_DEFAULT_VALUE_IS_EMPTY,
+	},
+	{
+		/*name*/    "ߴ",
+		/*explain*/ "Աʡԡֻڴֽļ",
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_INT64,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_DEFAULT_VALUE_IS_EMPTY,
+	},
+	{
+		/*name*/    "޸ʱ",
+		/*explain*/ "Աʡԡֻ޸ʱ䲻ڴʱ",
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_DATE_TIME,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_DEFAULT_VALUE_IS_EMPTY,
+	},
+	{
+		/*name*/    "޸ʱ",
+		/*explain*/ "Աʡԡֻ޸ʱ䲻ڴʱ",
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_DATE_TIME,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_DEFAULT_VALUE_IS_EMPTY,
+	},
+	{
+		/*name*/    "",
+		/*explain*/ "ԱʡԡΪʱĿѴڵļĬΪ",
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_BOOL,
+		/*default*/ TRUE,
+		/*state*/   ArgMark::AS_HAS_DEFAULT_VALUE,
+	},
+	{
+		/*name*/    "߳",
+		/*explain*/ "ԱʡԡΪ0ʡʱʹCPU,̲󲿷ʱڵȴ,̶߳ں",
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_INT,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_DEFAULT_VALUE_IS_EMPTY,
+	},
+	{
+		/*name*/    "ʧб",
+		/*explain*/ "Աʡԡṩʱд봦ʧܵ·,ౣ1000",
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_BIN,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_RECEIVE_VAR_ARRAY | ArgMark::AS_DEFAULT_VALUE_IS_EMPTY,
+	},
+	{
+		/*name*/    "ϵ",
+		/*explain*/ "ԱʡԡΪʱĿûļ˶ĩβ1MBԴļͬŸ,ļ;ʧܻȡʱѸƵĲ֡ĬΪ",
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_BOOL,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_DEFAULT_VALUE_IS_EMPTY,
+	},
+	{
+		/*name*/    "Ȼصӳ",
+		/*explain*/ "Աʡԡƹڱ߳ÿ0.2һ,ӳͲ:Ѵֽҵֽ,;ؼʱȡ",
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    _SDT_ALL,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_DEFAULT_VALUE_IS_EMPTY,
+	}
+};
+EXTERN_C void fn_copy_tree_W(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	bulk_result result;
+	const std::wstring from(elibstl::args_to_wsdata(pArgInf, 0));
+	const std::wstring to(elibstl::args_to_wsdata(pArgInf, 1));
+	elibstl::fastcopy::copy_options copy;
+	copy.overwrite = pArgInf[8].m_bool != FALSE;
+	copy.resume = elibstl::args_to_data<BOOL>(pArgInf, 11).value_or(FALSE) != FALSE;
+	copy.progress = elibstl::fastcopy::progress_from_arg(pArgInf[12]);
+	if (!elibstl::dirwalk::copy_tree(from, to, args_to_filter(pArgInf, 2), args_to_options(pArgInf, 9), copy, result))
+	{
+		pRetData->m_int64 = -1;
+		return;
+	}
+	put_failures(pArgInf[10], result.errors);
+	pRetData->m_int64 = static_cast<INT64>(result.files);
+}
+FucInfo Fn_copy_tree_W = { {
+		/*ccname*/  ("W"),
+		/*egname*/  ("copy_treeW"),
+		/*explain*/ ("ԴĿ¼Ŀ¼зļƵĿĿ¼µĶӦλ,ظƵļ,ԴĿ¼ڡĿĿ¼޷ȡʱ-1߳ͬʱ,ÿļĸƷʽͬٸļW,Ŀ¼ӺͷӲơĳļʧܲӰļ,ʧܵԴ·롰ʧб"),
+		/*category*/4,
+		/*state*/   NULL,
+		/*ret*/     SDT_INT64,
+		/*reserved*/NULL,
+		/*level*/   LVL_HIGH,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+	ESTLARG(Args_CopyTree)
+	} ,ESTLFNAME(fn_copy_tree_W) };
+
+//
+EXTERN_C void fn_dirwalk_structure(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto& self = elibstl::args_to_obj<walker>(pArgInf);
+	self = new walker;
+}
+FucInfo Fn_dirwalk_structure = { {
+		/*ccname*/  "",
+		/*egname*/  "",
+		/*explain*/ NULL,
+		/*category*/ -1,
+		/*state*/  _CMD_OS(__OS_WIN) | CT_IS_HIDED | CT_IS_OBJ_CONSTURCT_CMD,
+		/*ret*/ _SDT_NULL,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*ArgCount*/0,
+		/*arg lp*/  NULL,
+	} ,ESTLFNAME(fn_dirwalk_structure) };
+
+static ARG_INFO s_DirwalkCopyArgs[] =
+{
+	{
+		/*name*/    "",
+		/*explain*/ "",
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/	(DATA_TYPE)36,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_DEFAULT_VALUE_IS_EMPTY,
+	}
+};
+//
+EXTERN_C void fn_dirwalk_copy(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto& self = elibstl::classhelp::get_this<walker>(pArgInf);
+	self = new walker;
+	put_errmsg(L"Ŀ¼к̨߳,ܸ,Ƶõδʼ¶!");
+}
+FucInfo Fn_dirwalk_copy = { {
+		/*ccname*/  "",
+		/*egname*/  "",
+		/*explain*/ NULL,
+		/*category*/ -1,
+		/*state*/   _CMD_OS(__OS_WIN) | CT_IS_HIDED | CT_IS_OBJ_COPY_CMD,
+		/*ret*/ _SDT_NULL,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*ArgCount*/1,
+		/*arg lp*/  s_DirwalkCopyArgs,
+	} ,ESTLFNAME(fn_dirwalk_copy) };
+
+//
+EXTERN_C void fn_dirwalk_destruct(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto& self = elibstl::args_to_obj<walker>(pArgInf);
+	if (self)
+		delete self;
+	self = nullptr;
+}
+FucInfo Fn_dirwalk_destruct = { {
+		/*ccname*/  "",
+		/*egname*/  "",
+		/*explain*/ NULL,
+		/*category*/ -1,
+		/*state*/    _CMD_OS(__OS_WIN) | CT_IS_HIDED | CT_IS_OBJ_FREE_CMD,
+		/*ret*/ _SDT_NULL,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*ArgCount*/0,
+		/*arg lp*/  NULL,
+	} ,ESTLFNAME(fn_dirwalk_destruct) };
+
+static ARG_INFO Args_DirwalkStart[] =
+{
+	{
+		/*name*/    "Ŀ¼",
+		/*explain*/ "",
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_BIN,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_NONE,
+	},
+	{
+		/*name*/    "ͨ",
+		/*explain*/ "Աʡԡֻļ֮ƥļ,֧*?,ִСд,ͨá;ָ,硰*.tmp;*.log",
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_BIN,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_DEFAULT_VALUE_IS_EMPTY,
+	},
+	{
+		/*name*/    "ųͨ",
+		/*explain*/ "Աʡԡļ֮ƥļ,дͬͨ",
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_BIN,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_DEFAULT_VALUE_IS_EMPTY,
+	},
+	{
+		/*name*/    "Ŀ¼",
+		/*explain*/ "ԱʡԡΪʱֻгĿ¼µֱĬΪ",
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_BOOL,
+		/*default*/ TRUE,
+		/*state*/   ArgMark::AS_HAS_DEFAULT_VALUE,
+	},
+	{
+		/*name*/    "гĿ¼",
+		/*explain*/ "ԱʡԡΪʱҲĿ¼(ߴĿ¼)ĬΪ",
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_BOOL,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_DEFAULT_VALUE_IS_EMPTY,
+	},
+	{
+		/*name*/    "Сߴ",
+		/*explain*/ "ԱʡԡֻСڴֽļ",
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_INT64,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_DEFAULT_VALUE_IS_EMPTY,
+	},
+	{
+		/*name*/    "ߴ",
+		/*explain*/ "Աʡԡֻڴֽļ",
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_INT64,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_DEFAULT_VALUE_IS_EMPTY,
+	},
+	{
+		/*name*/    "޸ʱ",
+		/*explain*/ "Աʡԡֻ޸ʱ䲻ڴʱ",
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_DATE_TIME,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_DEFAULT_VALUE_IS_EMPTY,
+	},
+	{
+		/*name*/    "޸ʱ",
+		/*explain*/ "Աʡԡֻ޸ʱ䲻ڴʱ",
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_DATE_TIME,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_DEFAULT_VALUE_IS_EMPTY,
+	},
+	{
+		/*name*/    "߳",
+		/*explain*/ "ԱʡԡΪ0ʡʱʹCPU,̲󲿷ʱڵȴ,̶߳ں",
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_INT,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_DEFAULT_VALUE_IS_EMPTY,
+	}
+};
+EXTERN_C void fn_dirwalk_start(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto& self = elibstl::args_to_obj<walker>(pArgInf);
+	/*һǶ,Ĳ,ȰѺĸŲǰ*/
+	MDATA_INF args[6] = { pArgInf[2], pArgInf[3], pArgInf[6], pArgInf[7], pArgInf[8], pArgInf[9] };
+	auto f = args_to_filter(args, 0);
+	f.dirs = elibstl::args_to_data<BOOL>(pArgInf, 5).value_or(FALSE) != FALSE;
+	auto opt = args_to_options(pArgInf, 10);
+	if (pArgInf[4].m_bool == FALSE)
+		opt.max_depth = 1;
+	pRetData->m_bool = self->start(std::wstring(elibstl::args_to_wsdata(pArgInf, 1)), f, opt);
+}
+FucInfo Fn_dirwalk_start = { {
+		/*ccname*/  "ʼ",
+		/*egname*/  "start",
+		/*explain*/ "ֹͣһα,ں̨߳пʼĿ¼,֮áȡһȡ·Ŀ¼ӺͷӡĿ¼ʱؼ١",
+		/*category*/ -1,
+		/*state*/    _CMD_OS(__OS_WIN) ,
+		/*ret*/ SDT_BOOL,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		ESTLARG(Args_DirwalkStart)
+	} ,ESTLFNAME(fn_dirwalk_start) };
+
+static ARG_INFO Args_DirwalkNext[] =
+{
+	{
+		/*name*/    "",
+		/*explain*/ "Աʡԡȡ·,ĬΪ1000",
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_INT,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_DEFAULT_VALUE_IS_EMPTY,
+	},
+	{
+		/*name*/    "ȴʱ",
+		/*explain*/ "Աʡԡûнʱȴĺ,-1ΪһֱȵнĬΪ-1",
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_INT,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_DEFAULT_VALUE_IS_EMPTY,
+	}
+};
+EXTERN_C void fn_dirwalk_next(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto& self = elibstl::args_to_obj<walker>(pArgInf);
+	const auto max_count = elibstl::args_to_data<INT>(pArgInf, 1).value_or(1000);
+	const auto timeout = elibstl::args_to_data<INT>(pArgInf, 2).value_or(-1);
+	std::vector<std::wstring> paths;
+	self->next_batch(max_count > 0 ? static_cast<size_t>(max_count) : 1000, timeout, paths);
+	pRetData->m_pAryData = elibstl::create_text_array(paths);
+}
+FucInfo Fn_dirwalk_next = { {
+		/*ccname*/  "ȡһ",
+		/*egname*/  "next",
+		/*explain*/ "ȡҵһ·,Unicodeı顣ȴʱѽʱؿ,áǷɡжǷȫȡȡߵĽҵĽʱ̨ͣ,ڴռòĿ¼ģ",
+		/*category*/ -1,
+		/*state*/    _CMD_OS(__OS_WIN) | CT_RETRUN_ARY_TYPE_DATA,
+		/*ret*/ SDT_BIN,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		ESTLARG(Args_DirwalkNext)
+	} ,ESTLFNAME(fn_dirwalk_next) };
+
+EXTERN_C void fn_dirwalk_done(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto& self = elibstl::args_to_obj<walker>(pArgInf);
+	pRetData->m_bool = self->done();
+}
+FucInfo Fn_dirwalk_done = { {
+		/*ccname*/  "Ƿ",
+		/*egname*/  "done",
+		/*explain*/ "ѽҽȫȡʱ,δʼʱҲ档",
+		/*category*/ -1,
+		/*state*/    _CMD_OS(__OS_WIN) ,
+		/*ret*/ SDT_BOOL,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*ArgCount*/0,
+		/*arg lp*/  0,
+	} ,ESTLFNAME(fn_dirwalk_done) };
+
+EXTERN_C void fn_dirwalk_stop(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto& self = elibstl::args_to_obj<walker>(pArgInf);
+	self->stop();
+}
+FucInfo Fn_dirwalk_stop = { {
+		/*ccname*/  "ֹͣ",
+		/*egname*/  "stop",
+		/*explain*/ "ֹͣδȡĽ,ȴ̨߳˳󷵻ء",
+		/*category*/ -1,
+		/*state*/    _CMD_OS(__OS_WIN) ,
+		/*ret*/ _SDT_NULL,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*ArgCount*/0,
+		/*arg lp*/  0,
+	} ,ESTLFNAME(fn_dirwalk_stop) };
+
+EXTERN_C void fn_dirwalk_found(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto& self = elibstl::args_to_obj<walker>(pArgInf);
+	pRetData->m_int64 = static_cast<INT64>(self->found());
+}
+FucInfo Fn_dirwalk_found = { {
+		/*ccname*/  "ȡҵ",
+		/*egname*/  "found",
+		/*explain*/ "رαĿǰΪֹҵķ,δȡġ",
+		/*category*/ -1,
+		/*state*/    _CMD_OS(__OS_WIN) ,
+		/*ret*/ SDT_INT64,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*ArgCount*/0,
+		/*arg lp*/  0,
+	} ,ESTLFNAME(fn_dirwalk_found) };
+
+EXTERN_C void fn_dirwalk_errors(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto& self = elibstl::args_to_obj<walker>(pArgInf);
+	pRetData->m_int64 = static_cast<INT64>(self->errors());
+}
+FucInfo Fn_dirwalk_errors = { {
+		/*ccname*/  "ȡ",
+		/*egname*/  "errors",
+		/*explain*/ "رα޷򿪵Ŀ¼,ûзȨ޵Ŀ¼",
+		/*category*/ -1,
+		/*state*/    _CMD_OS(__OS_WIN) ,
+		/*ret*/ SDT_INT64,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*ArgCount*/0,
+		/*arg lp*/  0,
+	} ,ESTLFNAME(fn_dirwalk_errors) };
+
+static INT s_dtCmdIndexcommobj_dirwalk[] = { 479,480,481,482,483,484,485,486,487 };
+namespace elibstl {
+
+
+	LIB_DATA_TYPE_INFO Obj_DirWalker =
+	{
+		"Ŀ¼",
+		"DirWalker",
+		"̱߳Ŀ¼,ļߴ硢޸ʱ,ں̨ܺúȡ,ʺļܶĿ¼",
+		sizeof(s_dtCmdIndexcommobj_dirwalk) / sizeof(s_dtCmdIndexcommobj_dirwalk[0]),
+		 s_dtCmdIndexcommobj_dirwalk,
+		_DT_OS(__OS_WIN),
+		0,
+		NULL,
+		NULL,
+		NULL,
+		NULL,
+		NULL,
+		0,
+		0
+	};
+}
@@ -0,0 +1,169 @@
+#pragma once
+#ifdef _WIN32
+#include<windows.h>
+#endif
+#include<atomic>
+#include<condition_variable>
+#include<cstddef>
+#include<cstdint>
+#include<deque>
+#include<functional>
+#include<mutex>
+#include<string>
+#include<thread>
+#include<vector>
+#include"eplFastCopy.h"
+
+/*
+* ߳Ŀ¼.Ŀ¼ŽĹ,߳ȡö,Ŀ¼ٷŻض;
+* ÿ̸߳ͬһ·ƴļ,ֻĿ¼ᵥ·.
+* Ŀ¼,ɾݴɾҪݹ.
+* Windowsڲʹ\\?\ʽ·,MAX_PATH;Ŀ¼ӺͷĬϲ.
+*/
+namespace elibstl {
+	namespace dirwalk {
+#ifdef _WIN32
+		using path_type = std::wstring;
+#else
+		using path_type = std::string;
+#endif
+
+		struct entry
+		{
+			path_type path;
+			size_t name_offset = 0;   /*ļpathеʼλ*/
+			std::uint64_t size = 0;
+			std::int64_t mtime = 0;   /*޸ʱ,FILETIMEֵ(UTC,1601100)*/
+			unsigned depth = 0;       /*Ŀ¼µΪ1*/
+			bool is_dir = false;
+			bool is_link = false;     /*ӻĿ¼*/
+
+			const path_type::value_type* name() const { return path.c_str() + name_offset; }
+		};
+
+		/*֧ͨ*?,Windows²ִСд*/
+		bool glob_match(const path_type::value_type* pattern, const path_type::value_type* name);
+
+		struct filter
+		{
+			std::vector<path_type> include;  /*ļͨ,Ϊʱȫƥ*/
+			std::vector<path_type> exclude;
+			std::uint64_t min_size = 0;
+			std::uint64_t max_size = UINT64_MAX;
+			std::int64_t modified_after = INT64_MIN;
+			std::int64_t modified_before = INT64_MAX;
+			bool files = true;
+			bool dirs = false;
+
+			/*Ƿκ,ûʱɾŻɾķǿĿ¼*/
+			bool trivial() const;
+			/*Ŀ¼ߴ*/
+			bool match(const entry& e) const;
+		};
+
+		struct options
+		{
+			unsigned threads = 0;     /*Ϊ0ʱCPU*/
+			int max_depth = -1;       /*-1,1ֻĿ¼µ*/
+			bool follow_links = false;
+		};
+
+		struct error_info
+		{
+			path_type path;
+			std::uint32_t code = 0;   /*GetLastErrorerrno*/
+		};
+
+		/*̹߳õĴ¼,ֻǰkMaxKept,*/
+		class error_list
+		{
+		public:
+			static constexpr size_t kMaxKept = 1000;
+
+			void add(const path_type& path, std::uint32_t code);
+			std::uint64_t count() const { return m_count; }
+			std::vector<error_info> take();
+			void clear();
+
+		private:
+			std::mutex m_lock;
+			std::vector<error_info> m_items;
+			std::atomic<std::uint64_t> m_count{ 0 };
+		};
+
+		struct bulk_result
+		{
+			std::uint64_t files = 0;  /*ɾƵļ*/
+			std::uint64_t dirs = 0;   /*ɾ򴴽Ŀ¼*/
+			std::uint64_t bytes = 0;
+			std::uint64_t failed = 0;
+			std::vector<error_info> errors;
+		};
+
+		/*
+		* root,ƥsink,sinkڹ߳еõᲢ;sinkؼʱֹͣ.
+		* sink·rootдһ.rootĿ¼;ֹͣʱؼ,rootҲʱҲؼ.
+		*/
+		bool walk(const path_type& root, const filter& f, const options& opt,
+			const std::function<bool(std::vector<entry>& batch)>& sink, error_list* errors = nullptr);
+
+		/*̷ĸĿ¼(/),޷·Ҳ*/
+		bool is_root_dir(const path_type& path);
+
+		/*
+		* ɾrootƥļ;remove_dirsΪʱɾյĿ¼,keep_rootΪʱroot.
+		* ֻļȥֻɾ.Ŀ¼Ӻͷ,ֻɾӱ.
+		* һʧܲӰ,ʧܵ¼result.errors.rootĿ¼ǸĿ¼(is_root_dir)ʱؼ.
+		* rootʱֻɾ(keep_rootΪremove_dirsΪʱʲôؼ).
+		*/
+		bool remove_tree(const path_type& root, const filter& f, const options& opt,
+			bool remove_dirs, bool keep_root, bulk_result& result);
+
+		/*
+		* fromƥļƵtoµĶӦλ,Ŀ¼ṹ贴.toλfrom֮.
+		* ÿļcopy,ʱѴڵļ,ʧ.ʱӱ.
+		* copy.progressΪʱڵ߳жʱ,ΪѴҵֽ,;
+		* ؼʱȡ,ڸƵļҲֹ.ȡʱؼ.
+		*/
+		bool copy_tree(const path_type& from, const path_type& to, const filter& f, const options& opt,
+			const fastcopy::copy_options& copy, bulk_result& result);
+
+		/*
+		* ں̨̱߳,Ž޵Ķɵ÷ȡ,ʱͣ.
+		* ڻصнսĳ(Գ߳)ʹ.
+		*/
+		class walker
+		{
+		public:
+			static constexpr size_t kQueueLimit = 65536;
+
+			walker() = default;
+			walker(const walker&) = delete;
+			walker& operator=(const walker&) = delete;
+			~walker() { stop(); }
+
+			/*ֹͣһαʼµı,rootĿ¼ʱؼ*/
+			bool start(const path_type& root, const filter& f, const options& opt);
+			/*
+			* ȡmax_count,Ϊʱȴtimeout_ms(-1Ϊһֱȴ).
+			* ѽҽȫȡʱؼ.
+			*/
+			bool next_batch(size_t max_count, int timeout_ms, std::vector<path_type>& out);
+			void stop();
+			/*ѽҽȫȡ*/
+			bool done();
+			std::uint64_t found() const { return m_found; }
+			std::uint64_t errors() const { return m_errors.count(); }
+
+		private:
+			std::thread m_thread;
+			std::mutex m_lock;
+			std::condition_variable m_cv;
+			std::deque<path_type> m_queue;
+			std::atomic<std::uint64_t> m_found{ 0 };
+			error_list m_errors;
+			bool m_running = false;
+			bool m_cancel = false;
+		};
+	}
+}
@@ -0,0 +1,745 @@
+#include"eplDirWatch.h"
+#include<algorithm>
+#include<atomic>
+#include<chrono>
+#include<condition_variable>
+#include<mutex>
+#include<thread>
+#include<unordered_map>
+#ifndef _WIN32
+#include<cerrno>
+#include<dirent.h>
+#include<fcntl.h>
+#include<poll.h>
+#include<sys/inotify.h>
+#include<sys/stat.h>
+#include<unistd.h>
+#endif
+
+namespace {
+	using namespace elibstl::dirwatch;
+	using clock_type = std::chrono::steady_clock;
+
+#ifdef _WIN32
+	constexpr path_type::value_type kSep = L'\\';
+#else
+	constexpr path_type::value_type kSep = '/';
+#endif
+	/*ÿδϵͳȡ仯ĻС,繲ʱܳ64KB*/
+	constexpr size_t kBufferSize = 64 * 1024;
+
+	path_type join(const path_type& dir, const path_type& name)
+	{
+		if (name.empty())
+			return dir;
+		return !dir.empty() && dir.back() == kSep ? dir + name : dir + kSep + name;
+	}
+
+	/*ߵߵζ,Ǽ߳,ȡ¼߳*/
+	template<typename T>
+	class spsc_queue
+	{
+	public:
+		explicit spsc_queue(size_t capacity) : m_slots(capacity + 1) {}
+
+		bool push(T&& value)
+		{
+			const size_t tail = m_tail.load(std::memory_order_relaxed);
+			const size_t next = tail + 1 == m_slots.size() ? 0 : tail + 1;
+			if (next == m_head.load(std::memory_order_acquire))
+				return false;
+			m_slots[tail] = std::move(value);
+			m_tail.store(next, std::memory_order_release);
+			return true;
+		}
+
+		bool pop(T& value)
+		{
+			const size_t head = m_head.load(std::memory_order_relaxed);
+			if (head == m_tail.load(std::memory_order_acquire))
+				return false;
+			value = std::move(m_slots[head]);
+			m_slots[head] = T();
+			m_head.store(head + 1 == m_slots.size() ? 0 : head + 1, std::memory_order_release);
+			return true;
+		}
+
+		bool empty() const
+		{
+			return m_head.load(std::memory_order_acquire) == m_tail.load(std::memory_order_acquire);
+		}
+
+	private:
+		std::vector<T> m_slots;
+		/*ͷβڲͬĻ,̸߳дĲụ*/
+		alignas(64) std::atomic<size_t> m_head{ 0 };
+		alignas(64) std::atomic<size_t> m_tail{ 0 };
+	};
+
+	/*·ϲʱڵ仯,ֻڼ߳ʹ*/
+	class coalescer
+	{
+	public:
+		explicit coalescer(unsigned delay_ms) : m_delay(delay_ms) {}
+
+		void record(change kind, const path_type& path, const path_type& old_path = path_type())
+		{
+			const auto due = clock_type::now() + m_delay;
+			m_next_due = (std::min)(m_next_due, due);
+			if (kind == change::renamed)
+			{
+				record_rename(path, old_path, due);
+				return;
+			}
+			auto it = m_items.find(path);
+			if (it == m_items.end())
+			{
+				m_items.emplace(path, pending{ kind, path_type(), due, m_seq++ });
+				return;
+			}
+			auto& item = it->second;
+			item.due = due;
+			switch (item.kind)
+			{
+			case change::added:
+				/*ɾ,ʲôû*/
+				if (kind == change::removed)
+					m_items.erase(it);
+				break;
+			case change::removed:
+				/*ɾֳ,Ǳ༭ɾдı淽ʽ*/
+				if (kind != change::removed)
+					item.kind = change::modified;
+				break;
+			case change::renamed:
+				/*ɾ,ɾԭļ*/
+				if (kind == change::removed)
+				{
+					const path_type origin = item.old_path;
+					m_items.erase(it);
+					record(change::removed, origin);
+				}
+				break;
+			default:
+				if (kind == change::removed)
+					item.kind = change::removed;
+				break;
+			}
+		}
+
+		/*ѵڵ¼˳򽻸emit,allΪʱǷ,ؽĸ*/
+		template<typename Emit>
+		size_t flush(bool all, Emit&& emit)
+		{
+			if (m_items.empty())
+			{
+				m_next_due = clock_type::time_point::max();
+				return 0;
+			}
+			const auto now = clock_type::now();
+			if (!all && now < m_next_due)
+				return 0;
+			std::vector<std::pair<std::uint64_t, path_type>> due;
+			m_next_due = clock_type::time_point::max();
+			for (const auto& item : m_items)
+			{
+				if (all || item.second.due <= now)
+					due.emplace_back(item.second.seq, item.first);
+				else
+					m_next_due = (std::min)(m_next_due, item.second.due);
+			}
+			std::sort(due.begin(), due.end());
+			for (auto& d : due)
+			{
+				auto it = m_items.find(d.second);
+				event e;
+				e.kind = it->second.kind;
+				e.old_path = std::move(it->second.old_path);
+				e.path = std::move(d.second);
+				m_items.erase(it);
+				emit(std::move(e));
+			}
+			return due.size();
+		}
+
+		/*¼ڻжٺ,ûд¼ʱΪ-1*/
+		int next_timeout() const
+		{
+			if (m_items.empty())
+				return -1;
+			const auto left = std::chrono::duration_cast<std::chrono::milliseconds>(m_next_due - clock_type::now()).count();
+			return left <= 0 ? 0 : static_cast<int>((std::min)(left, static_cast<std::chrono::milliseconds::rep>(INT32_MAX)));
+		}
+
+		size_t size() const { return m_items.size(); }
+
+		void clear()
+		{
+			m_items.clear();
+			m_next_due = clock_type::time_point::max();
+		}
+
+	private:
+		struct pending
+		{
+			change kind;
+			path_type old_path;
+			clock_type::time_point due;
+			std::uint64_t seq;
+		};
+
+		void record_rename(const path_type& path, const path_type& old_path, clock_type::time_point due)
+		{
+			change kind = change::renamed;
+			path_type origin = old_path;
+			std::uint64_t seq = m_seq++;
+			auto old_it = m_items.find(old_path);
+			if (old_it != m_items.end())
+			{
+				seq = old_it->second.seq;
+				if (old_it->second.kind == change::added)
+					kind = change::added;   /*½,Ϊִ*/
+				else if (old_it->second.kind == change::renamed)
+					origin = old_it->second.old_path;   /*a->b->cϲΪa->c*/
+				m_items.erase(old_it);
+			}
+			if (kind == change::renamed && origin == path)
+				kind = change::modified;
+			auto it = m_items.find(path);
+			if (it != m_items.end())
+			{
+				/*˸ɾļ,дʱļٸı淽ʽ*/
+				if (it->second.kind == change::removed)
+					kind = change::modified;
+				it->second = pending{ kind, kind == change::renamed ? origin : path_type(), due, it->second.seq };
+				return;
+			}
+			m_items.emplace(path, pending{ kind, kind == change::renamed ? origin : path_type(), due, seq });
+		}
+
+		std::unordered_map<path_type, pending> m_items;
+		std::chrono::milliseconds m_delay;
+		std::uint64_t m_seq = 0;
+		clock_type::time_point m_next_due = clock_type::time_point::max();
+	};
+}
+
+namespace elibstl {
+	namespace dirwatch {
+		struct monitor::impl
+		{
+			options opt;
+			path_type root;
+			std::function<void()> notify;
+			spsc_queue<event> queue{ kQueueCapacity };
+			/*¼,ȡ¼һoverflow*/
+			std::atomic<bool> lost{ false };
+			std::atomic<bool> alive{ true };
+			std::atomic<std::uint64_t> overflows{ 0 };
+			std::mutex wait_lock;
+			std::condition_variable wait_cv;
+			coalescer pending;
+			std::thread thread;
+#ifdef _WIN32
+			HANDLE dir = INVALID_HANDLE_VALUE;
+			HANDLE stop_event = NULL;
+#else
+			int fd = -1;
+			int stop_pipe[2] = { -1, -1 };
+			std::unordered_map<int, path_type> watches;
+			/*IN_MOVED_FROMҪȵͬһcookieIN_MOVED_TO֪ǸƳ*/
+			struct
+			{
+				bool valid = false;
+				bool is_dir = false;
+				std::uint32_t cookie = 0;
+				path_type path;
+			} move_from;
+#endif
+
+			explicit impl(const options& o) : opt(o), pending(o.debounce_ms) {}
+
+			~impl()
+			{
+#ifdef _WIN32
+				if (dir != INVALID_HANDLE_VALUE)
+					::CloseHandle(dir);
+				if (stop_event != NULL)
+					::CloseHandle(stop_event);
+#else
+				if (fd >= 0)
+					::close(fd);
+				for (int p : stop_pipe)
+				{
+					if (p >= 0)
+						::close(p);
+				}
+#endif
+			}
+
+			void emit(event&& e)
+			{
+				if (!queue.push(std::move(e)))
+					lost = true;
+			}
+
+			void publish()
+			{
+				{
+					std::lock_guard<std::mutex> lock(wait_lock);
+				}
+				wait_cv.notify_all();
+				if (notify)
+					notify();
+			}
+
+			void flush(bool all)
+			{
+				if (pending.flush(all, [this](event&& e) { emit(std::move(e)); }) > 0)
+					publish();
+			}
+
+			/*֮ǰµı仯Ѳ,һ,ֻҪɨ*/
+			void overflow()
+			{
+				pending.clear();
+				++overflows;
+				event e;
+				e.kind = change::overflow;
+				e.path = root;
+				emit(std::move(e));
+			}
+
+			/*޷ʱoverflow*/
+			void fail()
+			{
+				flush(true);
+				overflow();
+				alive = false;
+				publish();
+			}
+
+#ifdef _WIN32
+			bool open()
+			{
+				dir = ::CreateFileW(root.c_str(), FILE_LIST_DIRECTORY, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+					NULL, OPEN_EXISTING, FILE_FLAG_BACKUP_SEMANTICS | FILE_FLAG_OVERLAPPED, NULL);
+				if (dir == INVALID_HANDLE_VALUE)
+					return false;
+				stop_event = ::CreateEventW(NULL, TRUE, FALSE, NULL);
+				return stop_event != NULL;
+			}
+
+			void signal_stop()
+			{
+				::SetEvent(stop_event);
+			}
+
+			void parse(const unsigned char* p)
+			{
+				path_type rename_from;
+				bool has_from = false;
+				for (;;)
+				{
+					const auto info = reinterpret_cast<const FILE_NOTIFY_INFORMATION*>(p);
+					path_type path = join(root, path_type(info->FileName, info->FileNameLength / sizeof(WCHAR)));
+					switch (info->Action)
+					{
+					case FILE_ACTION_ADDED:
+						pending.record(change::added, path);
+						break;
+					case FILE_ACTION_REMOVED:
+						pending.record(change::removed, path);
+						break;
+					case FILE_ACTION_MODIFIED:
+						pending.record(change::modified, path);
+						break;
+					case FILE_ACTION_RENAMED_OLD_NAME:
+						if (has_from)
+							pending.record(change::removed, rename_from);
+						rename_from = std::move(path);
+						has_from = true;
+						break;
+					case FILE_ACTION_RENAMED_NEW_NAME:
+						if (has_from)
+							pending.record(change::renamed, path, rename_from);
+						else
+							pending.record(change::added, path);
+						has_from = false;
+						break;
+					default:
+						break;
+					}
+					if (info->NextEntryOffset == 0)
+						break;
+					p += info->NextEntryOffset;
+				}
+				/*¾ͬһɶԳ,䵥ľ˵Ƴ˼ӷΧ*/
+				if (has_from)
+					pending.record(change::removed, rename_from);
+			}
+
+			void run()
+			{
+				const DWORD filter = FILE_NOTIFY_CHANGE_FILE_NAME | FILE_NOTIFY_CHANGE_DIR_NAME | FILE_NOTIFY_CHANGE_SIZE
+					| FILE_NOTIFY_CHANGE_LAST_WRITE | FILE_NOTIFY_CHANGE_CREATION;
+				/*黺彻ʹ,һ齻ϵͳµı仯ʱһ,ڼı仯ᶪ*/
+				std::vector<DWORD> buffers[2] = { std::vector<DWORD>(kBufferSize / sizeof(DWORD)), std::vector<DWORD>(kBufferSize / sizeof(DWORD)) };
+				int current = 0;
+				OVERLAPPED ov = {};
+				ov.hEvent = ::CreateEventW(NULL, TRUE, FALSE, NULL);
+				const auto issue = [&] {
+					::ResetEvent(ov.hEvent);
+					return ::ReadDirectoryChangesW(dir, buffers[current].data(), static_cast<DWORD>(kBufferSize), opt.recursive, filter, NULL, &ov, NULL) != FALSE;
+				};
+				bool reading = ov.hEvent != NULL && issue();
+				const HANDLE handles[2] = { ov.hEvent, stop_event };
+				while (reading)
+				{
+					const int timeout = pending.next_timeout();
+					const DWORD wait = ::WaitForMultipleObjects(2, handles, FALSE, timeout < 0 ? INFINITE : static_cast<DWORD>(timeout));
+					if (wait == WAIT_OBJECT_0 + 1)
+						break;
+					if (wait == WAIT_OBJECT_0)
+					{
+						DWORD bytes = 0;
+						if (!::GetOverlappedResult(dir, &ov, &bytes, FALSE))
+						{
+							/*Ŀ¼ɾߵ,ټ*/
+							if (::GetLastError() != ERROR_NOTIFY_ENUM_DIR)
+							{
+								reading = false;
+								break;
+							}
+							overflow();
+							reading = issue();
+						}
+						else if (bytes == 0)
+						{
+							/*仯̫,ϵͳŲ*/
+							overflow();
+							reading = issue();
+						}
+						else
+						{
+							const int done = current;
+							current ^= 1;
+							reading = issue();
+							parse(reinterpret_cast<const unsigned char*>(buffers[done].data()));
+							if (pending.size() > kMaxPending)
+								overflow();
+						}
+						if (opt.debounce_ms == 0)
+							flush(true);
+					}
+					flush(false);
+				}
+				if (reading)
+				{
+					DWORD bytes = 0;
+					::CancelIoEx(dir, &ov);
+					::GetOverlappedResult(dir, &ov, &bytes, TRUE);
+					flush(true);
+				}
+				else
+					fail();
+				if (ov.hEvent != NULL)
+					::CloseHandle(ov.hEvent);
+			}
+#else
+			static constexpr std::uint32_t kMask = IN_CREATE | IN_DELETE | IN_MODIFY | IN_ATTRIB | IN_MOVED_FROM | IN_MOVED_TO
+				| IN_DELETE_SELF | IN_MOVE_SELF | IN_ONLYDIR | IN_EXCL_UNLINK;
+
+			bool open()
+			{
+				struct stat st;
+				if (::stat(root.c_str(), &st) != 0 || !S_ISDIR(st.st_mode))
+					return false;
+				fd = ::inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+				if (fd < 0 || ::pipe2(stop_pipe, O_NONBLOCK | O_CLOEXEC) != 0)
+					return false;
+				const int wd = ::inotify_add_watch(fd, root.c_str(), kMask);
+				if (wd < 0)
+					return false;
+				watches[wd] = root;
+				if (opt.recursive)
+					watch_children(root, false);
+				return true;
+			}
+
+			void signal_stop()
+			{
+				const char c = 0;
+				(void)::write(stop_pipe[1], &c, 1);
+			}
+
+			/*Ӽг,½Ŀ¼ڼЧǰѳֵreportΪ*/
+			void watch_children(const path_type& dir, bool report)
+			{
+				DIR* handle = ::opendir(dir.c_str());
+				if (handle == nullptr)
+					return;
+				while (const dirent* de = ::readdir(handle))
+				{
+					if (de->d_name[0] == '.' && (de->d_name[1] == '\0' || (de->d_name[1] == '.' && de->d_name[2] == '\0')))
+						continue;
+					const path_type path = join(dir, de->d_name);
+					if (report)
+						pending.record(change::added, path);
+					bool is_dir = de->d_type == DT_DIR;
+					if (de->d_type == DT_UNKNOWN)
+					{
+						struct stat st;
+						is_dir = ::lstat(path.c_str(), &st) == 0 && S_ISDIR(st.st_mode);
+					}
+					if (is_dir)
+						watch_tree(path, report);
+				}
+				::closedir(handle);
+			}
+
+			void watch_tree(const path_type& dir, bool report)
+			{
+				const int wd = ::inotify_add_watch(fd, dir.c_str(), kMask);
+				if (wd < 0)
+				{
+					/*ﵽϵͳ(max_user_watches),ⲿֱ仯ղ*/
+					if (errno == ENOSPC)
+						overflow();
+					return;
+				}
+				watches[wd] = dir;
+				watch_children(dir, report);
+			}
+
+			/*Ŀ¼,мӼ¼·Ÿ*/
+			void rename_watches(const path_type& from, const path_type& to)
+			{
+				for (auto& w : watches)
+				{
+					if (w.second == from)
+						w.second = to;
+					else if (w.second.size() > from.size() && w.second.compare(0, from.size(), from) == 0 && w.second[from.size()] == kSep)
+						w.second = to + w.second.substr(from.size());
+				}
+			}
+
+			/*Ŀ¼ƳӷΧ,ټĿ¼*/
+			void unwatch_tree(const path_type& dir)
+			{
+				for (const auto& w : watches)
+				{
+					if (w.second == dir || (w.second.size() > dir.size() && w.second.compare(0, dir.size(), dir) == 0 && w.second[dir.size()] == kSep))
+						::inotify_rm_watch(fd, w.first);
+				}
+			}
+
+			void resolve_move_from()
+			{
+				if (!move_from.valid)
+					return;
+				move_from.valid = false;
+				pending.record(change::removed, move_from.path);
+				if (move_from.is_dir)
+					unwatch_tree(move_from.path);
+			}
+
+			/*ؼٱʾӵĿ¼Ѳ*/
+			bool parse(const char* p, size_t n)
+			{
+				for (const char* end = p + n; p < end;)
+				{
+					const auto ev = reinterpret_cast<const inotify_event*>(p);
+					p += sizeof(inotify_event) + ev->len;
+					if (ev->mask & IN_Q_OVERFLOW)
+					{
+						overflow();
+						continue;
+					}
+					const auto it = watches.find(ev->wd);
+					if (it == watches.end())
+						continue;
+					if (ev->mask & IN_IGNORED)
+					{
+						const bool is_root = it->second == root;
+						watches.erase(it);
+						if (is_root)
+							return false;
+						continue;
+					}
+					if (ev->mask & (IN_DELETE_SELF | IN_MOVE_SELF))
+					{
+						if (it->second == root)
+							return false;
+						continue;
+					}
+					const path_type path = ev->len > 0 ? join(it->second, ev->name) : it->second;
+					const bool is_dir = (ev->mask & IN_ISDIR) != 0;
+					if ((ev->mask & IN_MOVED_TO) && move_from.valid && move_from.cookie == ev->cookie)
+					{
+						move_from.valid = false;
+						pending.record(change::renamed, path, move_from.path);
+						if (is_dir)
+							rename_watches(move_from.path, path);
+						continue;
+					}
+					resolve_move_from();
+					if (ev->mask & IN_MOVED_FROM)
+					{
+						move_from.valid = true;
+						move_from.is_dir = is_dir;
+						move_from.cookie = ev->cookie;
+						move_from.path = path;
+					}
+					else if (ev->mask & (IN_CREATE | IN_MOVED_TO))
+					{
+						pending.record(change::added, path);
+						if (is_dir && opt.recursive)
+							watch_tree(path, true);
+					}
+					else if (ev->mask & IN_DELETE)
+						pending.record(change::removed, path);
+					else if (ev->mask & (IN_MODIFY | IN_ATTRIB))
+					{
+						/*Ŀ¼Ա仯,ı仯ᵥ*/
+						if (!is_dir || ev->len > 0)
+							pending.record(change::modified, path);
+					}
+				}
+				return true;
+			}
+
+			void run()
+			{
+				pollfd fds[2] = { { fd, POLLIN, 0 }, { stop_pipe[0], POLLIN, 0 } };
+				alignas(inotify_event) char buffer[kBufferSize];
+				bool ok = true;
+				while (ok)
+				{
+					const int ready = ::poll(fds, 2, pending.next_timeout());
+					if (ready < 0 && errno != EINTR)
+					{
+						ok = false;
+						break;
+					}
+					if (ready > 0 && fds[1].revents)
+						break;
+					if (ready > 0 && (fds[0].revents & POLLIN))
+					{
+						/*һֱû,ɶԵĸ¼ʹȡָҲ*/
+						for (;;)
+						{
+							const auto n = ::read(fd, buffer, sizeof(buffer));
+							if (n <= 0)
+								break;
+							if (!parse(buffer, static_cast<size_t>(n)))
+							{
+								ok = false;
+								break;
+							}
+						}
+						resolve_move_from();
+						if (pending.size() > kMaxPending)
+							overflow();
+						if (opt.debounce_ms == 0)
+							flush(true);
+					}
+					flush(false);
+				}
+				if (ok)
+					flush(true);
+				else
+					fail();
+			}
+#endif
+		};
+
+		monitor::monitor() = default;
+
+		monitor::~monitor()
+		{
+			stop();
+		}
+
+		bool monitor::start(const path_type& dir, const options& opt)
+		{
+			stop();
+			if (dir.empty())
+				return false;
+			auto p = std::make_unique<impl>(opt);
+			p->root = dir;
+			while (p->root.size() > 1 && p->root.back() == kSep && p->root[p->root.size() - 2] != ':')
+				p->root.pop_back();
+			p->notify = m_notify;
+			if (!p->open())
+				return false;
+			p->thread = std::thread(&impl::run, p.get());
+			m_impl = std::move(p);
+			return true;
+		}
+
+		void monitor::stop()
+		{
+			if (!m_impl)
+				return;
+			m_impl->signal_stop();
+			if (m_impl->thread.joinable())
+				m_impl->thread.join();
+			m_impl.reset();
+		}
+
+		bool monitor::running() const
+		{
+			return m_impl && m_impl->alive;
+		}
+
+		bool monitor::pop(event& e)
+		{
+			if (!m_impl)
+				return false;
+			if (m_impl->queue.pop(e))
+				return true;
+			/*ڿպٱ涪ʧ,֤overflowȡ¼֮*/
+			if (m_impl->lost.exchange(false))
+			{
+				++m_impl->overflows;
+				e = event();
+				e.kind = change::overflow;
+				e.path = m_impl->root;
+				return true;
+			}
+			return false;
+		}
+
+		size_t monitor::poll(std::vector<event>& out, size_t max_count)
+		{
+			size_t n = 0;
+			event e;
+			while (n < max_count && pop(e))
+			{
+				out.push_back(std::move(e));
+				n++;
+			}
+			return n;
+		}
+
+		bool monitor::wait(int timeout_ms)
+		{
+			if (!m_impl)
+				return false;
+			auto& s = *m_impl;
+			const auto ready = [&] { return !s.queue.empty() || s.lost || !s.alive; };
+			std::unique_lock<std::mutex> lock(s.wait_lock);
+			if (timeout_ms < 0)
+				s.wait_cv.wait(lock, ready);
+			else
+				s.wait_cv.wait_for(lock, std::chrono::milliseconds(timeout_ms), ready);
+			return !s.queue.empty() || s.lost;
+		}
+
+		std::uint64_t monitor::overflows() const
+		{
+			return m_impl ? m_impl->overflows.load() : 0;
+		}
+	}
+}
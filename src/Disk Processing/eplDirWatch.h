@@ -0,0 +1,86 @@
+#pragma once
+#ifdef _WIN32
+#include<windows.h>
+#endif
+#include<cstddef>
+#include<cstdint>
+#include<functional>
+#include<memory>
+#include<string>
+#include<vector>
+
+/*
+* Ŀ¼仯.WindowsʹصI/OReadDirectoryChangesW,LinuxʹinotifyΪÿĿ¼Ӽ.
+* ͬһ·ڶʱڵĶα仯ϲΪһ¼(紴дֻ洴),¾һ.
+* ϵͳ¼ʱoverflow,ʱӦɨĿ¼.
+* ¼ɼ̷߳Žߵߵ,ȡ¼ֻͬһ߳.
+*/
+namespace elibstl {
+	namespace dirwatch {
+#ifdef _WIN32
+		using path_type = std::wstring;
+#else
+		using path_type = std::string;
+#endif
+
+		/*ֵEе¼һ,ҪĶ*/
+		enum class change : int
+		{
+			added = 1,
+			removed = 2,
+			modified = 3,
+			renamed = 4,
+			overflow = 5,   /*б仯ûм,Ҫɨ;pathΪӵĿ¼*/
+		};
+
+		struct event
+		{
+			change kind = change::modified;
+			path_type path;
+			path_type old_path;   /*ֻrenamedʱЧ*/
+		};
+
+		struct options
+		{
+			bool recursive = true;
+			/*ͬһ·һα仯ȴôû±仯ű,Ϊ0ʱÿһ仯ͱ*/
+			unsigned debounce_ms = 50;
+		};
+
+		class monitor
+		{
+		public:
+			/*¼е,߳µ¼ʱoverflow*/
+			static constexpr size_t kQueueCapacity = 16384;
+			/*ȴϲ·*/
+			static constexpr size_t kMaxPending = 100000;
+
+			monitor();
+			monitor(const monitor&) = delete;
+			monitor& operator=(const monitor&) = delete;
+			~monitor();
+
+			/*¼ȡʱڼ߳е,start֮ǰ*/
+			void set_notify(std::function<void()> notify) { m_notify = std::move(notify); }
+
+			/*ֹͣһμӺʼdir,dirĿ¼޷ʱؼ*/
+			bool start(const path_type& dir, const options& opt = options());
+			/*ֹͣ,δȡ¼*/
+			void stop();
+			/*ӵĿ¼ɾԭʹн*/
+			bool running() const;
+
+			bool pop(event& e);
+			size_t poll(std::vector<event>& out, size_t max_count);
+			/*ȴ¼ȡӽʱ,timeout_msΪ-1ʱһֱȴ*/
+			bool wait(int timeout_ms);
+			/*ۼƱoverflowĴ*/
+			std::uint64_t overflows() const;
+
+		private:
+			struct impl;
+			std::unique_ptr<impl> m_impl;
+			std::function<void()> m_notify;
+		};
+	}
+}
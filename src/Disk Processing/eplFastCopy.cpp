@@ -0,0 +1,551 @@
+#include"ElibHelp.h"
+#include"eplFastCopy.h"
+#include<algorithm>
+#include<cstring>
+#include<vector>
+#ifndef _WIN32
+#include<cerrno>
+#include<fcntl.h>
+#include<sys/sendfile.h>
+#include<sys/stat.h>
+#include<unistd.h>
+#endif
+
+namespace {
+	using namespace elibstl::fastcopy;
+
+	/*ʽÿĴС,ҲǱȵļ*/
+	constexpr size_t kBlockSize = 4 * 1024 * 1024;
+
+	bool report(const copy_options& opt, std::uint64_t done, std::uint64_t total)
+	{
+		return !opt.progress || opt.progress(done, total);
+	}
+
+#ifdef _WIN32
+	/*޻дҪƫƺͳȰ,ȡ*/
+	constexpr DWORD kSectorSize = 4096;
+
+	struct scoped_handle
+	{
+		HANDLE h = INVALID_HANDLE_VALUE;
+
+		scoped_handle() = default;
+		explicit scoped_handle(HANDLE value) : h(value) {}
+		scoped_handle(const scoped_handle&) = delete;
+		scoped_handle& operator=(const scoped_handle&) = delete;
+		~scoped_handle() { close(); }
+
+		bool valid() const { return h != INVALID_HANDLE_VALUE && h != NULL; }
+		void reset(HANDLE value) { close(); h = value; }
+		void close()
+		{
+			if (valid())
+				::CloseHandle(h);
+			h = INVALID_HANDLE_VALUE;
+		}
+	};
+
+	bool get_size(const path_type& path, std::uint64_t& size, DWORD* attr = nullptr)
+	{
+		WIN32_FILE_ATTRIBUTE_DATA data;
+		if (!::GetFileAttributesExW(path.c_str(), GetFileExInfoStandard, &data))
+			return false;
+		if (data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY)
+		{
+			::SetLastError(ERROR_DIRECTORY);
+			return false;
+		}
+		size = (static_cast<std::uint64_t>(data.nFileSizeHigh) << 32) | data.nFileSizeLow;
+		if (attr)
+			*attr = data.dwFileAttributes;
+		return true;
+	}
+
+	bool read_range(const path_type& path, std::uint64_t offset, void* buffer, size_t size)
+	{
+		scoped_handle file(::CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+			NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL));
+		if (!file.valid())
+			return false;
+		OVERLAPPED ov = {};
+		ov.Offset = static_cast<DWORD>(offset);
+		ov.OffsetHigh = static_cast<DWORD>(offset >> 32);
+		DWORD got = 0;
+		return ::ReadFile(file.h, buffer, static_cast<DWORD>(size), &got, &ov) && got == size;
+	}
+
+	/*Ŀֻļʱȥֻ,Ա㸲*/
+	bool clear_readonly(const path_type& path, DWORD code)
+	{
+		if (code != ERROR_ACCESS_DENIED)
+			return false;
+		const DWORD attr = ::GetFileAttributesW(path.c_str());
+		return attr != INVALID_FILE_ATTRIBUTES && (attr & FILE_ATTRIBUTE_READONLY)
+			&& ::SetFileAttributesW(path.c_str(), attr & ~FILE_ATTRIBUTE_READONLY);
+	}
+
+#else
+	bool get_size(const path_type& path, std::uint64_t& size)
+	{
+		struct stat st;
+		if (::stat(path.c_str(), &st) != 0)
+			return false;
+		if (S_ISDIR(st.st_mode))
+		{
+			errno = EISDIR;
+			return false;
+		}
+		size = static_cast<std::uint64_t>(st.st_size);
+		return true;
+	}
+
+	bool read_range(const path_type& path, std::uint64_t offset, void* buffer, size_t size)
+	{
+		const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+		if (fd < 0)
+			return false;
+		size_t done = 0;
+		while (done < size)
+		{
+			const auto n = ::pread(fd, static_cast<char*>(buffer) + done, size - done, static_cast<off_t>(offset + done));
+			if (n < 0 && errno == EINTR)
+				continue;
+			if (n <= 0)
+				break;
+			done += static_cast<size_t>(n);
+		}
+		::close(fd);
+		return done == size;
+	}
+#endif
+
+	/*
+	* ,0ʾͷ.㰴kResumeAlign,޻дʱƫҲ;
+	* ĿԴһʱΪļߴ,˶ͨͲҪٸ.
+	* ˶Եһ߶Ҫ,ֱӱȽ,У.
+	*/
+	std::uint64_t resume_point(const path_type& from, const path_type& to, std::uint64_t size, std::uint64_t existing)
+	{
+		if (existing == 0 || existing > size)
+			return 0;
+		const std::uint64_t start = existing == size ? size : existing / kResumeAlign * kResumeAlign;
+		if (start == 0)
+			return 0;
+		const auto length = static_cast<size_t>((std::min)(start, kResumeAlign));
+		std::vector<unsigned char> source(length), target(length);
+		if (!read_range(from, start - length, source.data(), length) || !read_range(to, start - length, target.data(), length))
+			return 0;
+		return std::memcmp(source.data(), target.data(), length) == 0 ? start : 0;
+	}
+
+#ifdef _WIN32
+	DWORD CALLBACK copy_progress(LARGE_INTEGER total, LARGE_INTEGER done, LARGE_INTEGER, LARGE_INTEGER,
+		DWORD, DWORD, HANDLE, HANDLE, LPVOID data)
+	{
+		const auto opt = static_cast<const copy_options*>(data);
+		return report(*opt, static_cast<std::uint64_t>(done.QuadPart), static_cast<std::uint64_t>(total.QuadPart)) ? PROGRESS_CONTINUE : PROGRESS_CANCEL;
+	}
+
+	/*ͷƽϵͳ,ͬһֵ֧繲ϿԲڴ*/
+	status system_copy(const path_type& from, const path_type& to, const copy_options& opt, std::uint64_t size)
+	{
+		DWORD flags = opt.overwrite ? 0 : COPY_FILE_FAIL_IF_EXISTS;
+		if (size >= kUnbufferedThreshold)
+			flags |= COPY_FILE_NO_BUFFERING;
+		const auto run = [&] {
+			return ::CopyFileExW(from.c_str(), to.c_str(), opt.progress ? copy_progress : NULL,
+				const_cast<copy_options*>(&opt), NULL, flags) != FALSE;
+		};
+		if (run())
+			return status::copied;
+		const DWORD code = ::GetLastError();
+		if (code == ERROR_REQUEST_ABORTED)
+			return status::cancelled;
+		if (!opt.overwrite && (code == ERROR_FILE_EXISTS || code == ERROR_ALREADY_EXISTS))
+			return status::skipped;
+		if (opt.overwrite && clear_readonly(to, code) && run())
+			return status::copied;
+		::SetLastError(code);
+		return status::failed;
+	}
+
+	void set_offset(OVERLAPPED& ov, std::uint64_t offset)
+	{
+		ov.Offset = static_cast<DWORD>(offset);
+		ov.OffsetHigh = static_cast<DWORD>(offset >> 32);
+	}
+
+	/*
+	* offsetŸ.黺彻ʹ,дһͬʱһ;дϵͳ,
+	* һ鰴д,ٰļصʵʳߴ.
+	*/
+	status stream_copy(const path_type& from, const path_type& to, const copy_options& opt,
+		std::uint64_t offset, std::uint64_t size, std::uint64_t& written)
+	{
+		scoped_handle in(::CreateFileW(from.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE, NULL, OPEN_EXISTING,
+			FILE_FLAG_NO_BUFFERING | FILE_FLAG_OVERLAPPED | FILE_FLAG_SEQUENTIAL_SCAN, NULL));
+		if (!in.valid())
+			return status::failed;
+		const auto open_out = [&] {
+			return ::CreateFileW(to.c_str(), GENERIC_WRITE, 0, NULL, OPEN_ALWAYS, FILE_FLAG_NO_BUFFERING | FILE_FLAG_OVERLAPPED, NULL);
+		};
+		scoped_handle out(open_out());
+		if (!out.valid() && clear_readonly(to, ::GetLastError()))
+			out.reset(open_out());
+		if (!out.valid())
+			return status::failed;
+		/*ճߴԤȷռ,Ƭ*/
+		FILE_ALLOCATION_INFO alloc;
+		alloc.AllocationSize.QuadPart = static_cast<LONGLONG>(size);
+		::SetFileInformationByHandle(out.h, FileAllocationInfo, &alloc, sizeof(alloc));
+
+		const auto memory = static_cast<unsigned char*>(::VirtualAlloc(NULL, kBlockSize * 2, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE));
+		if (memory == nullptr)
+			return status::failed;
+		unsigned char* const buffers[2] = { memory, memory + kBlockSize };
+		scoped_handle read_event(::CreateEventW(NULL, TRUE, FALSE, NULL)), write_event(::CreateEventW(NULL, TRUE, FALSE, NULL));
+		OVERLAPPED rov = {}, wov = {};
+		rov.hEvent = read_event.h;
+		wov.hEvent = write_event.h;
+		bool read_pending = false;
+
+		const auto begin_read = [&](int index, std::uint64_t pos) {
+			set_offset(rov, pos);
+			if (::ReadFile(in.h, buffers[index], static_cast<DWORD>(kBlockSize), NULL, &rov) || ::GetLastError() == ERROR_IO_PENDING)
+			{
+				read_pending = true;
+				return true;
+			}
+			return ::GetLastError() == ERROR_HANDLE_EOF;
+		};
+		/*ضֽ,ļβΪ0,ʧΪ-1*/
+		const auto end_read = [&]() -> long long {
+			if (!read_pending)
+				return 0;
+			read_pending = false;
+			DWORD got = 0;
+			if (::GetOverlappedResult(in.h, &rov, &got, TRUE))
+				return got;
+			return ::GetLastError() == ERROR_HANDLE_EOF ? 0 : -1;
+		};
+
+		status result = status::copied;
+		std::uint64_t pos = offset;
+		int current = 0;
+		long long got = read_event.valid() && write_event.valid() && begin_read(current, pos) ? end_read() : -1;
+		while (got > 0)
+		{
+			const auto length = static_cast<DWORD>((got + kSectorSize - 1) / kSectorSize * kSectorSize);
+			std::memset(buffers[current] + got, 0, length - static_cast<size_t>(got));
+			set_offset(wov, pos);
+			if (!::WriteFile(out.h, buffers[current], length, NULL, &wov) && ::GetLastError() != ERROR_IO_PENDING)
+			{
+				got = -1;
+				break;
+			}
+			/*˵ܻ,дʱһ*/
+			const bool more = got == static_cast<long long>(kBlockSize);
+			const bool reading = more && begin_read(current ^ 1, pos + got);
+			DWORD put = 0;
+			const bool wrote = ::GetOverlappedResult(out.h, &wov, &put, TRUE) && put == length;
+			const auto next = end_read();
+			if (!wrote || (more && !reading) || next < 0)
+			{
+				got = -1;
+				break;
+			}
+			pos += static_cast<std::uint64_t>(got);
+			written += static_cast<std::uint64_t>(got);
+			if (!report(opt, pos, size))
+			{
+				result = status::cancelled;
+				break;
+			}
+			got = next;
+			current ^= 1;
+		}
+		const DWORD code = ::GetLastError();
+		::VirtualFree(memory, 0, MEM_RELEASE);
+		/*дĲֺԤĿռ䶼Ҫص,ȡʱҲصѸƵλ,Ա´*/
+		FILE_END_OF_FILE_INFO eof;
+		eof.EndOfFile.QuadPart = static_cast<LONGLONG>(pos);
+		::SetFileInformationByHandle(out.h, FileEndOfFileInfo, &eof, sizeof(eof));
+		if (got < 0)
+		{
+			::SetLastError(code);
+			return status::failed;
+		}
+		if (result == status::copied)
+		{
+			FILETIME created, accessed, modified;
+			if (::GetFileTime(in.h, &created, &accessed, &modified))
+				::SetFileTime(out.h, &created, &accessed, &modified);
+		}
+		return result;
+	}
+#else
+	enum class method
+	{
+		copy_range,
+		sendfile,
+		plain,
+	};
+
+	/*ǰļ,Ӧһ*/
+	bool unsupported(int code)
+	{
+		return code == ENOSYS || code == EXDEV || code == EINVAL || code == EOPNOTSUPP || code == ENOTSUP;
+	}
+
+	status stream_copy(const path_type& from, const path_type& to, const copy_options& opt,
+		std::uint64_t offset, bool exists, std::uint64_t& written)
+	{
+		const int in = ::open(from.c_str(), O_RDONLY | O_CLOEXEC);
+		if (in < 0)
+			return status::failed;
+		struct stat st;
+		if (::fstat(in, &st) != 0)
+		{
+			const int code = errno;
+			::close(in);
+			errno = code;
+			return status::failed;
+		}
+		const int flags = O_WRONLY | O_CREAT | O_CLOEXEC | (!exists && !opt.overwrite ? O_EXCL : 0);
+		const int out = ::open(to.c_str(), flags, st.st_mode & 0777);
+		if (out < 0)
+		{
+			const int code = errno;
+			::close(in);
+			errno = code;
+			return !opt.overwrite && code == EEXIST ? status::skipped : status::failed;
+		}
+		const auto size = static_cast<std::uint64_t>(st.st_size);
+		/*ȥ֮ľ,ͷʱ*/
+		bool ok = ::ftruncate(out, static_cast<off_t>(offset)) == 0;
+		::posix_fadvise(in, static_cast<off_t>(offset), 0, POSIX_FADV_SEQUENTIAL);
+		status result = status::copied;
+		method how = method::copy_range;
+		std::vector<char> buffer;
+		std::uint64_t pos = offset;
+		while (ok)
+		{
+			const size_t want = kBlockSize;
+			ssize_t n = -1;
+			if (how == method::copy_range)
+			{
+				loff_t in_pos = static_cast<loff_t>(pos), out_pos = static_cast<loff_t>(pos);
+				n = ::copy_file_range(in, &in_pos, out, &out_pos, want, 0);
+				if (n < 0 && unsupported(errno))
+				{
+					how = method::sendfile;
+					continue;
+				}
+			}
+			else if (how == method::sendfile)
+			{
+				off_t in_pos = static_cast<off_t>(pos);
+				n = ::lseek(out, static_cast<off_t>(pos), SEEK_SET) < 0 ? -1 : ::sendfile(out, in, &in_pos, want);
+				if (n < 0 && unsupported(errno))
+				{
+					how = method::plain;
+					continue;
+				}
+			}
+			else
+			{
+				if (buffer.empty())
+					buffer.resize(kBlockSize);
+				n = ::pread(in, buffer.data(), buffer.size(), static_cast<off_t>(pos));
+				for (ssize_t done = 0; n > 0 && done < n;)
+				{
+					const auto put = ::pwrite(out, buffer.data() + done, static_cast<size_t>(n - done), static_cast<off_t>(pos + done));
+					if (put < 0 && errno == EINTR)
+						continue;
+					if (put <= 0)
+					{
+						n = -1;
+						break;
+					}
+					done += put;
+				}
+			}
+			if (n < 0 && errno == EINTR)
+				continue;
+			if (n <= 0)
+			{
+				ok = n == 0;
+				break;
+			}
+			pos += static_cast<std::uint64_t>(n);
+			written += static_cast<std::uint64_t>(n);
+			if (!report(opt, pos, size))
+			{
+				result = status::cancelled;
+				break;
+			}
+		}
+		const int code = errno;
+		if (ok && result == status::copied)
+		{
+			const struct timespec times[2] = { st.st_atim, st.st_mtim };
+			::futimens(out, times);
+			::fchmod(out, st.st_mode & 07777);
+		}
+		::close(in);
+		::close(out);
+		/*ʱȱĿûô*/
+		if ((!ok || result == status::cancelled) && !opt.resume)
+			::unlink(to.c_str());
+		errno = code;
+		return ok ? result : status::failed;
+	}
+#endif
+}
+
+namespace elibstl {
+	namespace fastcopy {
+		status copy_file(const path_type& from, const path_type& to, const copy_options& opt, std::uint64_t* bytes)
+		{
+			std::uint64_t written = 0;
+			if (bytes)
+				*bytes = 0;
+			std::uint64_t size = 0, existing = 0;
+#ifdef _WIN32
+			DWORD attr = 0;
+			if (!get_size(from, size, &attr))
+				return status::failed;
+#else
+			if (!get_size(from, size))
+				return status::failed;
+#endif
+			const bool exists = get_size(to, existing);
+			if (exists && !opt.overwrite && !opt.resume)
+				return status::skipped;
+			std::uint64_t offset = 0;
+			if (exists && opt.resume)
+			{
+				offset = resume_point(from, to, size, existing);
+				if (offset == size && existing == size)
+					return status::skipped;
+				/*ʱֻŸȷͬһļĲ*/
+				if (offset == 0 && !opt.overwrite)
+					return status::skipped;
+			}
+			status result;
+#ifdef _WIN32
+			if (opt.resume)
+				result = stream_copy(from, to, opt, offset, size, written);
+			else
+			{
+				result = system_copy(from, to, opt, size);
+				if (result == status::copied)
+					written = size;
+			}
+			if (result == status::copied && opt.resume)
+				::SetFileAttributesW(to.c_str(), attr);
+#else
+			result = stream_copy(from, to, opt, offset, exists, written);
+#endif
+			if (bytes)
+				*bytes = written;
+			return result;
+		}
+	}
+}
+
+namespace elibstl {
+	namespace fastcopy {
+		typedef BOOL(__stdcall* COPYPROGRESSPROC)(INT64 done, INT64 total);
+
+		progress_fn progress_from_arg(const MDATA_INF& arg)
+		{
+			COPYPROGRESSPROC proc = nullptr;
+			if (arg.m_dtDataType == SDT_SUB_PTR)
+				proc = (COPYPROGRESSPROC)arg.m_dwSubCodeAdr;
+			else if (arg.m_dtDataType == SDT_INT)
+				proc = (COPYPROGRESSPROC)arg.m_int;
+			if (!proc)
+				return nullptr;
+			return [proc](std::uint64_t done, std::uint64_t total) {
+				return proc(static_cast<INT64>(done), static_cast<INT64>(total)) != FALSE;
+			};
+		}
+	}
+}
+
+using elibstl::fastcopy::copy_options;
+using elibstl::fastcopy::status;
+
+static ARG_INFO Args_FastCopy[] =
+{
+	{
+		/*name*/    "Դļ",
+		/*explain*/ "",
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_BIN,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_NONE,
+	},
+	{
+		/*name*/    "Ŀļ",
+		/*explain*/ "Ŀ¼Ѵ",
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_BIN,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_NONE,
+	},
+	{
+		/*name*/    "",
+		/*explain*/ "ԱʡԡΪʱĿļѴ򲻸Ʋ档ĬΪ",
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_BOOL,
+		/*default*/ TRUE,
+		/*state*/   ArgMark::AS_HAS_DEFAULT_VALUE,
+	},
+	{
+		/*name*/    "ϵ",
+		/*explain*/ "ԱʡԡΪʱĿļϴûĲ,˶ĩβ1MBԴļͬŸ;ʧܻȡʱѸƵĲ֡ĬΪ",
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_BOOL,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_DEFAULT_VALUE_IS_EMPTY,
+	},
+	{
+		/*name*/    "Ȼصӳ",
+		/*explain*/ "Աʡԡƹڱ߳з,ӳͲ:ѸƵֽļߴ;ؼʱȡ",
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    _SDT_ALL,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_DEFAULT_VALUE_IS_EMPTY,
+	}
+};
+EXTERN_C void fn_fast_copy_W(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	copy_options opt;
+	opt.overwrite = pArgInf[2].m_bool != FALSE;
+	opt.resume = elibstl::args_to_data<BOOL>(pArgInf, 3).value_or(FALSE) != FALSE;
+	opt.progress = elibstl::fastcopy::progress_from_arg(pArgInf[4]);
+	const auto result = elibstl::fastcopy::copy_file(std::wstring(elibstl::args_to_wsdata(pArgInf, 0)),
+		std::wstring(elibstl::args_to_wsdata(pArgInf, 1)), opt);
+	pRetData->m_bool = result == status::copied || result == status::skipped;
+}
+FucInfo Fn_fast_copy_W = { {
+		/*ccname*/  ("ٸļW"),
+		/*egname*/  ("fast_copyW"),
+		/*explain*/ ("ļ,ɹ档ϵͳֱӸ,ͬһֵ֧繲ݿԲ,256MBϵļϵͳ;ϵʱ黺彻е޻дʧܻȡʱؼ١"),
+		/*category*/4,
+		/*state*/   NULL,
+		/*ret*/     SDT_BOOL,
+		/*reserved*/NULL,
+		/*level*/   LVL_HIGH,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+	ESTLARG(Args_FastCopy)
+	} ,ESTLFNAME(fn_fast_copy_W) };
@@ -0,0 +1,58 @@
+#pragma once
+#ifdef _WIN32
+#include<windows.h>
+#endif
+#include<cstddef>
+#include<cstdint>
+#include<functional>
+#include<string>
+
+struct MDATA_INF;
+
+/*
+* ļĿٸ.Windows¸ƵļCopyFileExW,ϵͳǷڴ洢ɸ,
+* ļϵͳ;ϵʱ黺彻е޻صд.
+* Linuxcopy_file_rangeںи,֧ʱ˻sendfileͨд.
+*/
+namespace elibstl {
+	namespace fastcopy {
+#ifdef _WIN32
+		using path_type = std::wstring;
+#else
+		using path_type = std::string;
+#endif
+
+		enum class status
+		{
+			copied,
+			skipped,    /*ĿѴҲ,ϵʱĿ*/
+			failed,     /*GetLastErrorerrnoΪʧԭ*/
+			cancelled,
+		};
+
+		/*ѸƵֽ(ǰеĲ)ļߴ,ؼʱȡ*/
+		using progress_fn = std::function<bool(std::uint64_t done, std::uint64_t total)>;
+
+		struct copy_options
+		{
+			bool overwrite = true;
+			/*
+			* ĿļԴļʱ,˶ĿĩβһԴļͬλõ,ͬŸ,
+			* ͬ޷˶ʱͷ.ʧܻȡʱѸƵĲ.
+			*/
+			bool resume = false;
+			progress_fn progress;
+		};
+
+		/*ļСڴ˳ߴʱϵͳ,⸴ƴļѻݼȥ*/
+		constexpr std::uint64_t kUnbufferedThreshold = 256ull * 1024 * 1024;
+		/*㰴˶,˶ԵҲ֮ǰôһ*/
+		constexpr std::uint64_t kResumeAlign = 1024 * 1024;
+
+		/*bytesΪʵдֽ,Ϊnullptr*/
+		status copy_file(const path_type& from, const path_type& to, const copy_options& opt, std::uint64_t* bytes = nullptr);
+
+		/*EĽȻص(ӳָ)װΪprogress_fn,Ϊʱؿ.ӳͲ,ؼʱȡ*/
+		progress_fn progress_from_arg(const MDATA_INF& arg);
+	}
+}
@@ -0,0 +1,265 @@
+#include"eplFileIO.h"
+#include<algorithm>
+#include<atomic>
+#ifndef _WIN32
+#include<cerrno>
+#include<fcntl.h>
+#include<sys/stat.h>
+#include<unistd.h>
+#endif
+
+namespace {
+	using elibstl::fileio::path_type;
+	using elibstl::fileio::kChunkSize;
+
+	std::atomic<unsigned> s_temp_counter{ 0 };
+
+#ifdef _WIN32
+	using native_file = HANDLE;
+
+	void close_file(native_file file)
+	{
+		::CloseHandle(file);
+	}
+
+	bool write_all(native_file file, const unsigned char* data, size_t size)
+	{
+		while (size > 0)
+		{
+			const auto chunk = static_cast<DWORD>((std::min)(size, kChunkSize));
+			DWORD written = 0;
+			if (!::WriteFile(file, data, chunk, &written, NULL) || written == 0)
+				return false;
+			data += written;
+			size -= written;
+		}
+		return true;
+	}
+
+	bool seek_to(native_file file, std::uint64_t offset)
+	{
+		LARGE_INTEGER pos;
+		pos.QuadPart = static_cast<LONGLONG>(offset);
+		return ::SetFilePointerEx(file, pos, NULL, FILE_BEGIN) != FALSE;
+	}
+
+	/*ļߴ,дλͣļβ*/
+	bool set_size(native_file file, std::uint64_t size)
+	{
+		return seek_to(file, size) && ::SetEndOfFile(file);
+	}
+
+	/*ʱļĿͬһĿ¼,֤*/
+	path_type temp_path(const path_type& path)
+	{
+		return path + L"." + std::to_wstring(::GetCurrentProcessId()) + L"." + std::to_wstring(++s_temp_counter) + L".tmp";
+	}
+#else
+	using native_file = int;
+
+	void close_file(native_file file)
+	{
+		::close(file);
+	}
+
+	bool write_all(native_file file, const unsigned char* data, size_t size)
+	{
+		while (size > 0)
+		{
+			const auto n = ::write(file, data, (std::min)(size, kChunkSize));
+			if (n < 0)
+			{
+				if (errno == EINTR)
+					continue;
+				return false;
+			}
+			if (n == 0)
+				return false;
+			data += n;
+			size -= static_cast<size_t>(n);
+		}
+		return true;
+	}
+
+	bool seek_to(native_file file, std::uint64_t offset)
+	{
+		return ::lseek(file, static_cast<off_t>(offset), SEEK_SET) >= 0;
+	}
+
+	bool set_size(native_file file, std::uint64_t size)
+	{
+		return ::ftruncate(file, static_cast<off_t>(size)) == 0 && seek_to(file, size);
+	}
+
+	path_type temp_path(const path_type& path)
+	{
+		return path + "." + std::to_string(::getpid()) + "." + std::to_string(++s_temp_counter) + ".tmp";
+	}
+#endif
+
+	/*Ԥصļд,дٽضϵʵʳߴ*/
+	bool write_body(native_file file, const void* data, size_t size, std::uint64_t preallocate)
+	{
+		const bool prealloc = preallocate > size;
+		if (prealloc && !(set_size(file, preallocate) && seek_to(file, 0)))
+			return false;
+		if (!write_all(file, static_cast<const unsigned char*>(data), size))
+			return false;
+		return !prealloc || set_size(file, size);
+	}
+}
+
+namespace elibstl {
+	namespace fileio {
+		std::int64_t file_size(const path_type& path)
+		{
+#ifdef _WIN32
+			WIN32_FILE_ATTRIBUTE_DATA info;
+			if (!::GetFileAttributesExW(path.c_str(), GetFileExInfoStandard, &info) || (info.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY))
+				return -1;
+			return (static_cast<std::int64_t>(info.nFileSizeHigh) << 32) | info.nFileSizeLow;
+#else
+			struct stat st;
+			if (::stat(path.c_str(), &st) != 0 || S_ISDIR(st.st_mode))
+				return -1;
+			return static_cast<std::int64_t>(st.st_size);
+#endif
+		}
+
+		bool read_file(const path_type& path, std::uint64_t max_size,
+			const std::function<unsigned char* (std::uint64_t size)>& alloc, std::uint64_t& size_read)
+		{
+			size_read = 0;
+#ifdef _WIN32
+			const HANDLE file = ::CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+				NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+			if (file == INVALID_HANDLE_VALUE)
+				return false;
+			LARGE_INTEGER file_size;
+			if (!::GetFileSizeEx(file, &file_size) || static_cast<std::uint64_t>(file_size.QuadPart) > max_size)
+			{
+				::CloseHandle(file);
+				return false;
+			}
+			const auto size = static_cast<std::uint64_t>(file_size.QuadPart);
+#else
+			const int file = ::open(path.c_str(), O_RDONLY);
+			if (file < 0)
+				return false;
+			struct stat st;
+			if (::fstat(file, &st) != 0 || static_cast<std::uint64_t>(st.st_size) > max_size)
+			{
+				::close(file);
+				return false;
+			}
+			const auto size = static_cast<std::uint64_t>(st.st_size);
+			::posix_fadvise(file, 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+			unsigned char* buffer = alloc(size);
+			if (buffer == nullptr)
+			{
+				close_file(file);
+				return false;
+			}
+			bool ok = true;
+			while (size_read < size)
+			{
+				const auto chunk = static_cast<size_t>((std::min<std::uint64_t>)(size - size_read, kChunkSize));
+#ifdef _WIN32
+				DWORD got = 0;
+				if (!::ReadFile(file, buffer + size_read, static_cast<DWORD>(chunk), &got, NULL))
+				{
+					ok = false;
+					break;
+				}
+#else
+				const auto got = ::read(file, buffer + size_read, chunk);
+				if (got < 0)
+				{
+					if (errno == EINTR)
+						continue;
+					ok = false;
+					break;
+				}
+#endif
+				if (got == 0)
+					break;
+				size_read += static_cast<std::uint64_t>(got);
+			}
+			close_file(file);
+			return ok;
+		}
+
+		bool write_file(const path_type& path, const void* data, size_t size, write_mode mode, std::uint64_t preallocate)
+		{
+			if (path.empty() || (data == nullptr && size > 0))
+				return false;
+#ifdef _WIN32
+			if (mode == write_mode::append)
+			{
+				/*FILE_APPEND_DATA֤ÿдļβ,ͬʱ׷Ҳụา*/
+				const HANDLE file = ::CreateFileW(path.c_str(), FILE_APPEND_DATA | SYNCHRONIZE, FILE_SHARE_READ | FILE_SHARE_WRITE,
+					NULL, OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+				if (file == INVALID_HANDLE_VALUE)
+					return false;
+				const bool ok = write_all(file, static_cast<const unsigned char*>(data), size);
+				::CloseHandle(file);
+				return ok;
+			}
+			const path_type target = mode == write_mode::atomic ? temp_path(path) : path;
+			const HANDLE file = ::CreateFileW(target.c_str(), GENERIC_WRITE, 0, NULL,
+				mode == write_mode::atomic ? CREATE_NEW : CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+			if (file == INVALID_HANDLE_VALUE)
+				return false;
+			bool ok = write_body(file, data, size, preallocate);
+			if (ok && mode == write_mode::atomic)
+				ok = ::FlushFileBuffers(file) != FALSE;
+			::CloseHandle(file);
+			if (mode != write_mode::atomic)
+				return ok;
+			if (ok)
+				ok = ::MoveFileExW(target.c_str(), path.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) != FALSE;
+			if (!ok)
+				::DeleteFileW(target.c_str());
+			return ok;
+#else
+			if (mode == write_mode::append)
+			{
+				const int file = ::open(path.c_str(), O_WRONLY | O_CREAT | O_APPEND, 0644);
+				if (file < 0)
+					return false;
+				const bool ok = write_all(file, static_cast<const unsigned char*>(data), size);
+				::close(file);
+				return ok;
+			}
+			const path_type target = mode == write_mode::atomic ? temp_path(path) : path;
+			const int file = ::open(target.c_str(), O_WRONLY | O_CREAT | (mode == write_mode::atomic ? O_EXCL : O_TRUNC), 0644);
+			if (file < 0)
+				return false;
+			bool ok = write_body(file, data, size, preallocate);
+			if (ok && mode == write_mode::atomic)
+				ok = ::fsync(file) == 0;
+			::close(file);
+			if (mode != write_mode::atomic)
+				return ok;
+			if (ok)
+				ok = ::rename(target.c_str(), path.c_str()) == 0;
+			if (!ok)
+			{
+				::unlink(target.c_str());
+				return false;
+			}
+			/*ҲҪˢµ,ϵĿ¼ܻǾļ*/
+			const auto slash = path.find_last_of('/');
+			const path_type dir = slash == path_type::npos ? path_type(".") : (slash == 0 ? path_type("/") : path.substr(0, slash));
+			const int dir_fd = ::open(dir.c_str(), O_RDONLY);
+			if (dir_fd >= 0)
+			{
+				::fsync(dir_fd);
+				::close(dir_fd);
+			}
+			return true;
+#endif
+		}
+	}
+}
@@ -0,0 +1,46 @@
+#pragma once
+#ifdef _WIN32
+#include<windows.h>
+#endif
+#include<cstddef>
+#include<cstdint>
+#include<string>
+#include<functional>
+
+/*
+* ļĶд.ߴ簴64λ,дֿ.
+* ȫ滻ģʽдͬĿ¼ʱļˢµ,ٸԭļ,;ϵʱԭļ.
+*/
+namespace elibstl {
+	namespace fileio {
+#ifdef _WIN32
+		using path_type = std::wstring;
+#else
+		using path_type = std::string;
+#endif
+
+		enum class write_mode
+		{
+			overwrite, /*ֱӸԭļ*/
+			atomic,    /*ʱļ+ˢ+*/
+			append,    /*׷ӵļβ,ļʱ*/
+		};
+
+		/*ֿдĴС*/
+		constexpr size_t kChunkSize = 16 * 1024 * 1024;
+
+		/*ļߴ,ʧܷ-1*/
+		std::int64_t file_size(const path_type& path);
+
+		/*
+		* ļ.ļߴallocȡû,allocnullptrʱʧ;ߴ糬max_sizeʱallocֱʧ.
+		* ȡڼļʱsize_readСڷĳߴ.
+		*/
+		bool read_file(const path_type& path, std::uint64_t max_size,
+			const std::function<unsigned char* (std::uint64_t size)>& alloc, std::uint64_t& size_read);
+
+		/*preallocatesizeʱԤΪļôռ,Ƭ,дʵʳߴض*/
+		bool write_file(const path_type& path, const void* data, size_t size,
+			write_mode mode = write_mode::overwrite, std::uint64_t preallocate = 0);
+	}
+}
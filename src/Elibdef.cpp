@@ -82,7 +82,7 @@ static LIB_INFO s_LibInfo =
 	/*m_nDataTypeCount*/		sizeof(g_DataType) / sizeof(g_DataType[0]), // Զ͵Ŀ
 	/*g_DataType_web*/			g_DataType, // еԶ
 
-	/*m_nCategoryCount*/        17, // ȫĿ, Ϊ0
+	/*m_nCategoryCount*/        18, // ȫĿ, Ϊ0
 	/*m_szzCategory*/
 	"0000\0"
 	"0000ı\0"
@@ -101,6 +101,7 @@ static LIB_INFO s_LibInfo =
 	"0000ڴ\0"
 	"0000ƴ\0"
 	"0000ݴ\0"
+	"0000ʱ\0"
 	"\0",
 
 	/*m_nCmdCount*/             0, // ṩ(ȫ)Ŀ, Ϊ0
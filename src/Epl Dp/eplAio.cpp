@@ -0,0 +1,944 @@
+#include"ElibHelp.h"
+#include"eplAio.h"
+#include<algorithm>
+#include<chrono>
+#include<climits>
+#include<cstring>
+#ifndef _WIN32
+#include<cerrno>
+#include<cstdlib>
+#include<fcntl.h>
+#include<unistd.h>
+#endif
+
+namespace {
+#ifdef _WIN32
+	/*ɶ˿ڵɼ,ļʱʹkIoKey*/
+	constexpr ULONG_PTR kIoKey = 0;
+	constexpr ULONG_PTR kFlushKey = 1;
+	constexpr ULONG_PTR kErrorKey = 2;
+	constexpr ULONG_PTR kStopKey = 3;
+	constexpr std::uint32_t kInvalidParameter = ERROR_INVALID_PARAMETER;
+#else
+	constexpr std::uint32_t kInvalidParameter = EINVAL;
+#endif
+}
+
+namespace elibstl {
+	namespace aio {
+		struct engine::op_state
+		{
+#ifdef _WIN32
+			OVERLAPPED overlapped;  /*ǵһԱ,ʱOVERLAPPED*תop_state*/
+			HANDLE handle = INVALID_HANDLE_VALUE;
+#else
+			int fd = -1;
+#endif
+			request req;
+			void* buffer = nullptr;
+			std::uint32_t error = 0;  /*ύǰȷĴ*/
+		};
+
+		bool engine::start(unsigned queue_depth, unsigned threads)
+		{
+			std::lock_guard<std::mutex> guard(m_lock);
+			if (m_running)
+				return false;
+			m_depth = (std::max)(queue_depth, 1u);
+			m_slots = m_inflight = 0;
+			m_done.clear();
+#ifdef _WIN32
+			if (threads == 0)
+				threads = 2;
+			m_port = ::CreateIoCompletionPort(INVALID_HANDLE_VALUE, NULL, 0, threads);
+			if (m_port == NULL)
+				return false;
+#else
+			if (threads == 0)
+				threads = 4;
+			m_stopping = false;
+#endif
+			for (unsigned i = 0; i < threads; i++)
+				m_threads.emplace_back(&engine::worker, this);
+			m_running = true;
+			return true;
+		}
+
+		void engine::stop()
+		{
+			if (!m_running)
+				return;
+			wait_idle();
+#ifdef _WIN32
+			for (size_t i = 0; i < m_threads.size(); i++)
+				::PostQueuedCompletionStatus(m_port, 0, kStopKey, NULL);
+#else
+			{
+				std::lock_guard<std::mutex> guard(m_lock);
+				m_stopping = true;
+			}
+			m_queue_cv.notify_all();
+#endif
+			for (auto& thread : m_threads)
+				thread.join();
+			m_threads.clear();
+
+			std::lock_guard<std::mutex> guard(m_lock);
+			for (auto& item : m_files)
+			{
+#ifdef _WIN32
+				if (item.handle != INVALID_HANDLE_VALUE)
+					::CloseHandle(item.handle);
+#else
+				if (item.fd >= 0)
+					::close(item.fd);
+#endif
+			}
+			m_files.clear();
+			free_buffers();
+#ifdef _WIN32
+			::CloseHandle(m_port);
+			m_port = NULL;
+#endif
+			m_running = false;
+		}
+
+		int engine::open(const path_type& path, bool writable)
+		{
+			if (!m_running || path.empty())
+				return -1;
+			file_entry entry;
+#ifdef _WIN32
+			entry.handle = ::CreateFileW(path.c_str(), GENERIC_READ | (writable ? GENERIC_WRITE : 0), FILE_SHARE_READ | FILE_SHARE_WRITE,
+				NULL, writable ? OPEN_ALWAYS : OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_OVERLAPPED, NULL);
+			if (entry.handle == INVALID_HANDLE_VALUE)
+				return -1;
+			if (::CreateIoCompletionPort(entry.handle, m_port, kIoKey, 0) == NULL)
+			{
+				::CloseHandle(entry.handle);
+				return -1;
+			}
+#else
+			entry.fd = ::open(path.c_str(), writable ? (O_RDWR | O_CREAT) : O_RDONLY, 0644);
+			if (entry.fd < 0)
+				return -1;
+#endif
+			std::lock_guard<std::mutex> guard(m_lock);
+			for (size_t i = 0; i < m_files.size(); i++)
+			{
+#ifdef _WIN32
+				if (m_files[i].handle == INVALID_HANDLE_VALUE)
+#else
+				if (m_files[i].fd < 0)
+#endif
+				{
+					m_files[i] = entry;
+					return static_cast<int>(i);
+				}
+			}
+			m_files.push_back(entry);
+			return static_cast<int>(m_files.size() - 1);
+		}
+
+		bool engine::close(int file)
+		{
+			wait_idle();
+			std::lock_guard<std::mutex> guard(m_lock);
+			if (file < 0 || static_cast<size_t>(file) >= m_files.size())
+				return false;
+			auto& entry = m_files[file];
+#ifdef _WIN32
+			if (entry.handle == INVALID_HANDLE_VALUE)
+				return false;
+			::CloseHandle(entry.handle);
+			entry.handle = INVALID_HANDLE_VALUE;
+#else
+			if (entry.fd < 0)
+				return false;
+			::close(entry.fd);
+			entry.fd = -1;
+#endif
+			return true;
+		}
+
+		int engine::register_buffer(size_t size)
+		{
+			if (size == 0)
+				return -1;
+			registered_buffer item;
+			item.size = size;
+#ifdef _WIN32
+			item.data = static_cast<unsigned char*>(::VirtualAlloc(NULL, size, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE));
+#else
+			void* p = nullptr;
+			if (::posix_memalign(&p, 4096, size) == 0)
+				item.data = static_cast<unsigned char*>(p);
+#endif
+			if (item.data == nullptr)
+				return -1;
+			std::lock_guard<std::mutex> guard(m_lock);
+			m_buffers.push_back(item);
+			return static_cast<int>(m_buffers.size() - 1);
+		}
+
+		unsigned char* engine::buffer(int id) const
+		{
+			std::lock_guard<std::mutex> guard(m_lock);
+			return id >= 0 && static_cast<size_t>(id) < m_buffers.size() ? m_buffers[id].data : nullptr;
+		}
+
+		size_t engine::buffer_size(int id) const
+		{
+			std::lock_guard<std::mutex> guard(m_lock);
+			return id >= 0 && static_cast<size_t>(id) < m_buffers.size() ? m_buffers[id].size : 0;
+		}
+
+		void engine::free_buffers()
+		{
+			for (auto& item : m_buffers)
+			{
+#ifdef _WIN32
+				::VirtualFree(item.data, 0, MEM_RELEASE);
+#else
+				::free(item.data);
+#endif
+			}
+			m_buffers.clear();
+		}
+
+		void engine::set_callback(callback cb)
+		{
+			std::lock_guard<std::mutex> guard(m_lock);
+			m_callback = std::move(cb);
+		}
+
+		size_t engine::submit(const request* reqs, size_t count)
+		{
+			std::vector<op_state*> states;
+			{
+				std::lock_guard<std::mutex> guard(m_lock);
+				if (!m_running || reqs == nullptr)
+					return 0;
+				count = (std::min)(count, m_depth - m_slots);
+				states.reserve(count);
+				for (size_t i = 0; i < count; i++)
+				{
+					auto state = new op_state{};
+					const auto& req = reqs[i];
+					state->req = req;
+					state->buffer = req.buffer;
+					if (state->buffer == nullptr && req.kind != op_kind::fsync)
+					{
+						if (req.registered >= 0 && static_cast<size_t>(req.registered) < m_buffers.size()
+							&& req.size <= m_buffers[req.registered].size)
+							state->buffer = m_buffers[req.registered].data;
+						else
+							state->error = kInvalidParameter;
+					}
+					if (req.file >= 0 && static_cast<size_t>(req.file) < m_files.size())
+					{
+#ifdef _WIN32
+						state->handle = m_files[req.file].handle;
+						if (state->handle == INVALID_HANDLE_VALUE)
+#else
+						state->fd = m_files[req.file].fd;
+						if (state->fd < 0)
+#endif
+							state->error = kInvalidParameter;
+					}
+					else
+						state->error = kInvalidParameter;
+					states.push_back(state);
+				}
+				m_slots += count;
+				m_inflight += count;
+#ifndef _WIN32
+				/*һμ*/
+				m_queue.insert(m_queue.end(), states.begin(), states.end());
+#endif
+			}
+#ifdef _WIN32
+			for (auto state : states)
+				dispatch(state);
+#else
+			if (count == 1)
+				m_queue_cv.notify_one();
+			else if (count > 1)
+				m_queue_cv.notify_all();
+#endif
+			return count;
+		}
+
+#ifdef _WIN32
+		void engine::dispatch(op_state* state)
+		{
+			if (state->error != 0)
+			{
+				::PostQueuedCompletionStatus(m_port, 0, kErrorKey, &state->overlapped);
+				return;
+			}
+			/*FlushFileBuffersû첽汾,ִ߳*/
+			if (state->req.kind == op_kind::fsync)
+			{
+				::PostQueuedCompletionStatus(m_port, 0, kFlushKey, &state->overlapped);
+				return;
+			}
+			state->overlapped.Offset = static_cast<DWORD>(state->req.offset);
+			state->overlapped.OffsetHigh = static_cast<DWORD>(state->req.offset >> 32);
+			const BOOL ok = state->req.kind == op_kind::read
+				? ::ReadFile(state->handle, state->buffer, state->req.size, NULL, &state->overlapped)
+				: ::WriteFile(state->handle, state->buffer, state->req.size, NULL, &state->overlapped);
+			/*ͬʱҲɶ˿Ͷ,ֻʧܵҪԼͶ*/
+			if (!ok)
+			{
+				const DWORD error = ::GetLastError();
+				if (error != ERROR_IO_PENDING)
+				{
+					state->error = error;
+					::PostQueuedCompletionStatus(m_port, 0, kErrorKey, &state->overlapped);
+				}
+			}
+		}
+
+		void engine::worker()
+		{
+			while (true)
+			{
+				DWORD bytes = 0;
+				ULONG_PTR key = 0;
+				OVERLAPPED* overlapped = nullptr;
+				const BOOL ok = ::GetQueuedCompletionStatus(m_port, &bytes, &key, &overlapped, INFINITE);
+				if (overlapped == nullptr)
+				{
+					if (!ok || key == kStopKey)
+						break;
+					continue;
+				}
+				auto state = reinterpret_cast<op_state*>(overlapped);
+				switch (key)
+				{
+				case kFlushKey:
+					complete(state, 0, ::FlushFileBuffers(state->handle) ? 0 : ::GetLastError());
+					break;
+				case kErrorKey:
+					complete(state, 0, state->error);
+					break;
+				default:
+					complete(state, bytes, ok ? 0 : ::GetLastError());
+					break;
+				}
+			}
+		}
+#else
+		void engine::dispatch(op_state* state)
+		{
+			std::uint32_t error = state->error;
+			size_t done = 0;
+			if (error == 0)
+			{
+				auto p = static_cast<unsigned char*>(state->buffer);
+				const auto offset = static_cast<off_t>(state->req.offset);
+				switch (state->req.kind)
+				{
+				case op_kind::read:
+				case op_kind::write:
+					/*pread/pwriteֻһ,ļβʱǰ*/
+					while (done < state->req.size)
+					{
+						const auto n = state->req.kind == op_kind::read
+							? ::pread(state->fd, p + done, state->req.size - done, offset + static_cast<off_t>(done))
+							: ::pwrite(state->fd, p + done, state->req.size - done, offset + static_cast<off_t>(done));
+						if (n < 0)
+						{
+							if (errno == EINTR)
+								continue;
+							error = static_cast<std::uint32_t>(errno);
+							break;
+						}
+						if (n == 0)
+							break;
+						done += static_cast<size_t>(n);
+					}
+					break;
+				case op_kind::fsync:
+					if (::fsync(state->fd) != 0)
+						error = static_cast<std::uint32_t>(errno);
+					break;
+				}
+			}
+			complete(state, static_cast<std::uint32_t>(done), error);
+		}
+
+		void engine::worker()
+		{
+			while (true)
+			{
+				op_state* state = nullptr;
+				{
+					std::unique_lock<std::mutex> guard(m_lock);
+					m_queue_cv.wait(guard, [this] { return m_stopping || !m_queue.empty(); });
+					if (m_queue.empty())
+						break;
+					state = m_queue.front();
+					m_queue.pop_front();
+				}
+				dispatch(state);
+			}
+		}
+#endif
+
+		void engine::complete(op_state* state, std::uint32_t transferred, std::uint32_t error)
+		{
+			completion result;
+			result.user_data = state->req.user_data;
+			result.kind = state->req.kind;
+			result.transferred = transferred;
+#ifdef _WIN32
+			/*ļβʼ,ƽ̨һ·0ֽ*/
+			if (error == ERROR_HANDLE_EOF)
+				error = 0;
+#endif
+			result.error = error;
+			result.buffer = state->buffer;
+			delete state;
+
+			if (m_callback)
+			{
+				m_callback(result);
+				std::lock_guard<std::mutex> guard(m_lock);
+				m_inflight--;
+				m_slots--;
+			}
+			else
+			{
+				std::lock_guard<std::mutex> guard(m_lock);
+				m_done.push_back(result);
+				m_inflight--;
+			}
+			m_done_cv.notify_all();
+		}
+
+		size_t engine::poll(completion* out, size_t max)
+		{
+			std::lock_guard<std::mutex> guard(m_lock);
+			const auto count = (std::min)(max, m_done.size());
+			for (size_t i = 0; i < count; i++)
+			{
+				out[i] = m_done.front();
+				m_done.pop_front();
+			}
+			m_slots -= count;
+			return count;
+		}
+
+		size_t engine::wait(completion* out, size_t max, int timeout_ms)
+		{
+			{
+				std::unique_lock<std::mutex> guard(m_lock);
+				/*ûδɵʱн,ֱӷ*/
+				const auto ready = [this] { return !m_done.empty() || m_inflight == 0; };
+				if (timeout_ms < 0)
+					m_done_cv.wait(guard, ready);
+				else
+					m_done_cv.wait_for(guard, std::chrono::milliseconds(timeout_ms), ready);
+			}
+			return poll(out, max);
+		}
+
+		void engine::wait_idle()
+		{
+			std::unique_lock<std::mutex> guard(m_lock);
+			m_done_cv.wait(guard, [this] { return m_inflight == 0; });
+		}
+
+		size_t engine::outstanding() const
+		{
+			std::lock_guard<std::mutex> guard(m_lock);
+			return m_slots;
+		}
+	}
+}
+
+namespace {
+	/*Զֻһļ*/
+	struct async_file
+	{
+		elibstl::aio::engine engine;
+		int file = -1;
+	};
+
+	/*ĻǷظԵֽڼ,ǰֽڼͷ*/
+	void free_completion(const elibstl::aio::completion& item)
+	{
+		if (item.buffer == nullptr)
+			return;
+		if (item.kind == elibstl::aio::op_kind::read)
+			elibstl::efree(static_cast<LPBYTE>(item.buffer) - 2 * sizeof(INT));
+		else
+			elibstl::efree(item.buffer);
+	}
+
+	void close_async_file(async_file* self)
+	{
+		self->engine.stop();
+		self->file = -1;
+		elibstl::aio::completion item;
+		while (self->engine.poll(&item, 1))
+			free_completion(item);
+	}
+
+	bool submit_one(async_file* self, const elibstl::aio::request& req)
+	{
+		return self->file >= 0 && self->engine.submit(req);
+	}
+}
+
+//
+EXTERN_C void fn_aio_structure(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto& self = elibstl::args_to_obj<async_file>(pArgInf);
+	self = new async_file;
+}
+FucInfo Fn_aio_structure = { {
+		/*ccname*/  "",
+		/*egname*/  "",
+		/*explain*/ NULL,
+		/*category*/ -1,
+		/*state*/  _CMD_OS(__OS_WIN) | CT_IS_HIDED | CT_IS_OBJ_CONSTURCT_CMD,
+		/*ret*/ _SDT_NULL,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*ArgCount*/0,
+		/*arg lp*/  NULL,
+	} ,ESTLFNAME(fn_aio_structure) };
+
+static ARG_INFO s_AioCopyArgs[] =
+{
+	{
+		/*name*/    "",
+		/*explain*/ "",
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/	(DATA_TYPE)33,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_DEFAULT_VALUE_IS_EMPTY,
+	}
+};
+//
+EXTERN_C void fn_aio_copy(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto& self = elibstl::classhelp::get_this<async_file>(pArgInf);
+	self = new async_file;
+	put_errmsg(L"첽ļδɵ,ܸ,Ƶõδ򿪵¶!");
+}
+FucInfo Fn_aio_copy = { {
+		/*ccname*/  "",
+		/*egname*/  "",
+		/*explain*/ NULL,
+		/*category*/ -1,
+		/*state*/   _CMD_OS(__OS_WIN) | CT_IS_HIDED | CT_IS_OBJ_COPY_CMD,
+		/*ret*/ _SDT_NULL,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*ArgCount*/1,
+		/*arg lp*/  s_AioCopyArgs,
+	} ,ESTLFNAME(fn_aio_copy) };
+
+//
+EXTERN_C void fn_aio_destruct(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto& self = elibstl::args_to_obj<async_file>(pArgInf);
+	if (self)
+	{
+		close_async_file(self);
+		delete self;
+	}
+	self = nullptr;
+}
+FucInfo Fn_aio_destruct = { {
+		/*ccname*/  "",
+		/*egname*/  "",
+		/*explain*/ NULL,
+		/*category*/ -1,
+		/*state*/    _CMD_OS(__OS_WIN) | CT_IS_HIDED | CT_IS_OBJ_FREE_CMD,
+		/*ret*/ _SDT_NULL,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*ArgCount*/0,
+		/*arg lp*/  NULL,
+	} ,ESTLFNAME(fn_aio_destruct) };
+
+static ARG_INFO Args_AioOpen[] =
+{
+	{
+		/*name*/    "ļ",
+		/*explain*/ "",
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_BIN,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_NONE,
+	},
+	{
+		/*name*/    "Ƿд",
+		/*explain*/ "Ϊʱļ򴴽ĬΪ,ֻύ",
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_BOOL,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_DEFAULT_VALUE_IS_EMPTY,
+	},
+	{
+		/*name*/    "",
+		/*explain*/ "ͬʱڵ(ɵûáȴɡȡߵ),ĬΪ128",
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_INT,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_DEFAULT_VALUE_IS_EMPTY,
+	}
+};
+EXTERN_C void fn_aio_open(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto& self = elibstl::args_to_obj<async_file>(pArgInf);
+	close_async_file(self);
+	const auto writable = elibstl::args_to_data<BOOL>(pArgInf, 2).value_or(FALSE);
+	const auto depth = elibstl::args_to_data<INT>(pArgInf, 3).value_or(128);
+	if (!self->engine.start(depth > 0 ? static_cast<unsigned>(depth) : 128))
+		return;
+	self->file = self->engine.open(std::wstring(elibstl::args_to_wsdata(pArgInf, 1)), writable != FALSE);
+	if (self->file < 0)
+	{
+		close_async_file(self);
+		return;
+	}
+	pRetData->m_bool = TRUE;
+}
+FucInfo Fn_aio_open = { {
+		/*ccname*/  "",
+		/*egname*/  "open",
+		/*explain*/ "صʽļ,֮һύдȴɹ档",
+		/*category*/ -1,
+		/*state*/    _CMD_OS(__OS_WIN) ,
+		/*ret*/ SDT_BOOL,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		ESTLARG(Args_AioOpen)
+	} ,ESTLFNAME(fn_aio_open) };
+
+EXTERN_C void fn_aio_close(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto& self = elibstl::args_to_obj<async_file>(pArgInf);
+	close_async_file(self);
+}
+FucInfo Fn_aio_close = { {
+		/*ccname*/  "ر",
+		/*egname*/  "close",
+		/*explain*/ "ȴύȫɺرļ,ûȡߵɽ",
+		/*category*/ -1,
+		/*state*/    _CMD_OS(__OS_WIN) ,
+		/*ret*/ _SDT_NULL,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*ArgCount*/0,
+		/*arg lp*/  0,
+	} ,ESTLFNAME(fn_aio_close) };
+
+static ARG_INFO Args_AioRead[] =
+{
+	{
+		/*name*/    "ƫ",
+		/*explain*/ "0ʼ",
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_INT64,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_NONE,
+	},
+	{
+		/*name*/    "",
+		/*explain*/ "",
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_INT,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_NONE,
+	},
+	{
+		/*name*/    "",
+		/*explain*/ "ʱԭ,ֲͬ",
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_INT,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_DEFAULT_VALUE_IS_EMPTY,
+	}
+};
+EXTERN_C void fn_aio_submit_read(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto& self = elibstl::args_to_obj<async_file>(pArgInf);
+	const auto size = pArgInf[2].m_int;
+	if (pArgInf[1].m_int64 < 0 || size <= 0 || size > INT_MAX - static_cast<INT>(2 * sizeof(INT)))
+		return;
+	auto bin = static_cast<LPBYTE>(elibstl::ealloc(size + 2 * sizeof(INT)));
+	reinterpret_cast<INT*>(bin)[0] = 1;
+	reinterpret_cast<INT*>(bin)[1] = size;
+	elibstl::aio::request req;
+	req.kind = elibstl::aio::op_kind::read;
+	req.file = self->file;
+	req.offset = static_cast<std::uint64_t>(pArgInf[1].m_int64);
+	req.buffer = bin + 2 * sizeof(INT);
+	req.size = static_cast<std::uint32_t>(size);
+	req.user_data = static_cast<std::uint32_t>(elibstl::args_to_data<INT>(pArgInf, 3).value_or(0));
+	if (submit_one(self, req))
+		pRetData->m_bool = TRUE;
+	else
+		elibstl::efree(bin);
+}
+FucInfo Fn_aio_submit_read = { {
+		/*ccname*/  "ύ",
+		/*egname*/  "submitRead",
+		/*explain*/ "ύһ,ɡȴɡȡءδʱؼ١",
+		/*category*/ -1,
+		/*state*/    _CMD_OS(__OS_WIN) ,
+		/*ret*/ SDT_BOOL,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		ESTLARG(Args_AioRead)
+	} ,ESTLFNAME(fn_aio_submit_read) };
+
+static ARG_INFO Args_AioWrite[] =
+{
+	{
+		/*name*/    "ƫ",
+		/*explain*/ "0ʼ",
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_INT64,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_NONE,
+	},
+	{
+		/*name*/    "",
+		/*explain*/ "ύʱһ,֮޸ԭ",
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_BIN,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_NONE,
+	},
+	{
+		/*name*/    "",
+		/*explain*/ "ʱԭ,ֲͬ",
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_INT,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_DEFAULT_VALUE_IS_EMPTY,
+	}
+};
+EXTERN_C void fn_aio_submit_write(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto& self = elibstl::args_to_obj<async_file>(pArgInf);
+	const auto data = elibstl::args_to_ebin(pArgInf, 2);
+	if (pArgInf[1].m_int64 < 0 || data == nullptr || data->m_size == 0)
+		return;
+	auto copy = elibstl::ealloc(static_cast<int>(data->m_size));
+	memcpy(copy, data->m_data, data->m_size);
+	elibstl::aio::request req;
+	req.kind = elibstl::aio::op_kind::write;
+	req.file = self->file;
+	req.offset = static_cast<std::uint64_t>(pArgInf[1].m_int64);
+	req.buffer = copy;
+	req.size = static_cast<std::uint32_t>(data->m_size);
+	req.user_data = static_cast<std::uint32_t>(elibstl::args_to_data<INT>(pArgInf, 3).value_or(0));
+	if (submit_one(self, req))
+		pRetData->m_bool = TRUE;
+	else
+		elibstl::efree(copy);
+}
+FucInfo Fn_aio_submit_write = { {
+		/*ccname*/  "ύд",
+		/*egname*/  "submitWrite",
+		/*explain*/ "ύһд,ҪԿдʽ򿪡д֮䲻֤˳򡣶δʱؼ١",
+		/*category*/ -1,
+		/*state*/    _CMD_OS(__OS_WIN) ,
+		/*ret*/ SDT_BOOL,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		ESTLARG(Args_AioWrite)
+	} ,ESTLFNAME(fn_aio_submit_write) };
+
+static ARG_INFO Args_AioSync[] =
+{
+	{
+		/*name*/    "",
+		/*explain*/ "ʱԭ,ֲͬ",
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_INT,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_DEFAULT_VALUE_IS_EMPTY,
+	}
+};
+EXTERN_C void fn_aio_submit_sync(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto& self = elibstl::args_to_obj<async_file>(pArgInf);
+	elibstl::aio::request req;
+	req.kind = elibstl::aio::op_kind::fsync;
+	req.file = self->file;
+	req.user_data = static_cast<std::uint32_t>(elibstl::args_to_data<INT>(pArgInf, 1).value_or(0));
+	pRetData->m_bool = submit_one(self, req);
+}
+FucInfo Fn_aio_submit_sync = { {
+		/*ccname*/  "ύͬ",
+		/*egname*/  "submitSync",
+		/*explain*/ "ύһļдش̵ֻ֤֮ǰѾɵдд,Ҫϸ˳ʱȵȴ֮ǰдɡ",
+		/*category*/ -1,
+		/*state*/    _CMD_OS(__OS_WIN) ,
+		/*ret*/ SDT_BOOL,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		ESTLARG(Args_AioSync)
+	} ,ESTLFNAME(fn_aio_submit_sync) };
+
+static ARG_INFO Args_AioWait[] =
+{
+	{
+		/*name*/    "ʱ",
+		/*explain*/ "λΪ,Ϊ0ʱֻ鲻ȴ,Ϊ-1ʡʱһֱȴ",
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_INT,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_DEFAULT_VALUE_IS_EMPTY,
+	},
+	{
+		/*name*/    "",
+		/*explain*/ "ύʱı",
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_INT,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_RECEIVE_VAR | ArgMark::AS_DEFAULT_VALUE_IS_EMPTY,
+	},
+	{
+		/*name*/    "",
+		/*explain*/ "ɹʱʵʶдֽ,ļβʱСĳ;ʧʱոϵͳ",
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_INT,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_RECEIVE_VAR | ArgMark::AS_DEFAULT_VALUE_IS_EMPTY,
+	},
+	{
+		/*name*/    "",
+		/*explain*/ "ն,տֽڼ",
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_BIN,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_RECEIVE_VAR | ArgMark::AS_DEFAULT_VALUE_IS_EMPTY,
+	}
+};
+EXTERN_C void fn_aio_wait(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto& self = elibstl::args_to_obj<async_file>(pArgInf);
+	const auto timeout = elibstl::args_to_data<INT>(pArgInf, 1).value_or(-1);
+	elibstl::aio::completion item;
+	const auto count = timeout == 0 ? self->engine.poll(&item, 1) : self->engine.wait(&item, 1, timeout);
+	if (count == 0)
+		return;
+	if (pArgInf[2].m_pInt)
+		*pArgInf[2].m_pInt = static_cast<INT>(item.user_data);
+	if (pArgInf[3].m_pInt)
+		*pArgInf[3].m_pInt = item.error != 0 ? -static_cast<INT>(item.error) : static_cast<INT>(item.transferred);
+	LPBYTE bin = nullptr;
+	if (item.kind == elibstl::aio::op_kind::read)
+	{
+		bin = static_cast<LPBYTE>(item.buffer) - 2 * sizeof(INT);
+		reinterpret_cast<INT*>(bin)[1] = item.error != 0 ? 0 : static_cast<INT>(item.transferred);
+	}
+	else
+		free_completion(item);
+	if (pArgInf[4].m_ppBin)
+	{
+		elibstl::efree(*pArgInf[4].m_ppBin);
+		*pArgInf[4].m_ppBin = bin;
+	}
+	else if (bin)
+		elibstl::efree(bin);
+	pRetData->m_bool = TRUE;
+}
+FucInfo Fn_aio_wait = { {
+		/*ccname*/  "ȴ",
+		/*egname*/  "wait",
+		/*explain*/ "ȡһɵ,ûȴʱ˳һύ˳ͬ,ñ֡ȡ,ʱûδɵʱؼ١",
+		/*category*/ -1,
+		/*state*/    _CMD_OS(__OS_WIN) ,
+		/*ret*/ SDT_BOOL,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		ESTLARG(Args_AioWait)
+	} ,ESTLFNAME(fn_aio_wait) };
+
+EXTERN_C void fn_aio_outstanding(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto& self = elibstl::args_to_obj<async_file>(pArgInf);
+	pRetData->m_int = static_cast<INT>(self->engine.outstanding());
+}
+FucInfo Fn_aio_outstanding = { {
+		/*ccname*/  "ȡδ",
+		/*egname*/  "outstanding",
+		/*explain*/ "ػûáȴɡȡߵ,ڽеĺɵġ",
+		/*category*/ -1,
+		/*state*/    _CMD_OS(__OS_WIN) ,
+		/*ret*/ SDT_INT,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*ArgCount*/0,
+		/*arg lp*/  0,
+	} ,ESTLFNAME(fn_aio_outstanding) };
+
+static INT s_dtCmdIndexcommobj_aio[] = { 444,445,446,447,448,449,450,451,452,453 };
+namespace elibstl {
+
+
+	LIB_DATA_TYPE_INFO Obj_AsyncFile =
+	{
+		"첽ļ",
+		"AsyncFile",
+		"صI/Oдļ,һύȴ,ʺ϶Թ̬Ӳȡ",
+		sizeof(s_dtCmdIndexcommobj_aio) / sizeof(s_dtCmdIndexcommobj_aio[0]),
+		 s_dtCmdIndexcommobj_aio,
+		_DT_OS(__OS_WIN),
+		0,
+		NULL,
+		NULL,
+		NULL,
+		NULL,
+		NULL,
+		0,
+		0
+	};
+}
@@ -0,0 +1,141 @@
+#pragma once
+#ifdef _WIN32
+#include<windows.h>
+#endif
+#include<cstddef>
+#include<cstdint>
+#include<string>
+#include<vector>
+#include<deque>
+#include<memory>
+#include<mutex>
+#include<thread>
+#include<condition_variable>
+#include<functional>
+
+/*
+* 첽ļд,һύ,ɺͨصѯȡؽ.
+* WindowsʹصI/Oɶ˿,ƽ̨ʹִ̳߳pread/pwrite.
+* ͬʱڵ(δ+ɵδȡ),ʱsubmitֻܷµĲ.
+*/
+namespace elibstl {
+	namespace aio {
+		enum class op_kind : std::uint8_t
+		{
+			read,
+			write,
+			fsync,
+		};
+
+		struct request
+		{
+			op_kind kind = op_kind::read;
+			int file = -1;                /*openصļ*/
+			std::uint64_t offset = 0;
+			void* buffer = nullptr;       /*ΪʱʹregisteredָעỺ*/
+			int registered = -1;
+			std::uint32_t size = 0;
+			std::uint64_t user_data = 0;  /*ԭcompletion*/
+		};
+
+		struct completion
+		{
+			std::uint64_t user_data = 0;
+			op_kind kind = op_kind::read;
+			std::uint32_t transferred = 0; /*ļβʱСĳ*/
+			std::uint32_t error = 0;       /*ϵͳ,0Ϊɹ*/
+			void* buffer = nullptr;
+		};
+
+		/*߳е,Ҫڻصﳤʱ*/
+		using callback = std::function<void(const completion&)>;
+
+#ifdef _WIN32
+		using path_type = std::wstring;
+#else
+		using path_type = std::string;
+#endif
+
+		class engine
+		{
+		public:
+			engine() = default;
+			engine(const engine&) = delete;
+			engine& operator=(const engine&) = delete;
+			~engine() { stop(); }
+
+			/*threadsΪ0ʱWindowsʹ2߳,ƽ̨ʹ4߳*/
+			bool start(unsigned queue_depth = 128, unsigned threads = 0);
+			/*ȴύɺֹͣ,δȡߵɽԿpoll*/
+			void stop();
+			bool running() const { return m_running; }
+
+			/*صʽѴڵļ,writableΪļʱ.ļ,ʧܷ-1*/
+			int open(const path_type& path, bool writable);
+			/*ȴύȫɺر*/
+			bool close(int file);
+
+			/*䰴ҳĻ,engineֹͣǰһֱЧ.ػ,ʧܷ-1*/
+			int register_buffer(size_t size);
+			unsigned char* buffer(int id) const;
+			size_t buffer_size(int id) const;
+
+			/*úɽصٽѯ,ύǰ*/
+			void set_callback(callback cb);
+
+			/*ؽܵ,ֻжδʱŻcount.ЧҲᱻ,Դʽ*/
+			size_t submit(const request* reqs, size_t count);
+			bool submit(const request& req) { return submit(&req, 1) == 1; }
+
+			/*ȡɵĽ,ȴ*/
+			size_t poll(completion* out, size_t max);
+			/*ȡһʱŷ,timeout_msΪ-1ʱһֱȴ*/
+			size_t wait(completion* out, size_t max, int timeout_ms = -1);
+			/*ȴύȫ(Ҫȡ)*/
+			void wait_idle();
+
+			/*δԼɵδȡߵ*/
+			size_t outstanding() const;
+
+		private:
+			struct op_state;
+			struct file_entry
+			{
+#ifdef _WIN32
+				HANDLE handle = INVALID_HANDLE_VALUE;
+#else
+				int fd = -1;
+#endif
+			};
+			struct registered_buffer
+			{
+				unsigned char* data = nullptr;
+				size_t size = 0;
+			};
+
+			void dispatch(op_state* state);
+			void complete(op_state* state, std::uint32_t transferred, std::uint32_t error);
+			void worker();
+			void free_buffers();
+
+			mutable std::mutex m_lock;
+			std::condition_variable m_done_cv;  /*ɽȫ*/
+			std::deque<completion> m_done;
+			callback m_callback;
+			std::vector<std::thread> m_threads;
+			std::vector<file_entry> m_files;
+			std::vector<registered_buffer> m_buffers;
+			size_t m_depth = 0;
+			size_t m_slots = 0;     /*δ+δȡ*/
+			size_t m_inflight = 0;  /*δ*/
+			bool m_running = false;
+#ifdef _WIN32
+			HANDLE m_port = NULL;
+#else
+			std::condition_variable m_queue_cv;
+			std::deque<op_state*> m_queue;
+			bool m_stopping = false;
+#endif
+		};
+	}
+}
@@ -0,0 +1,1630 @@
+#include"ElibHelp.h"
+#include"eplHash.h"
+#include<intrin.h>
+#include<thread>
+#include<memory>
+#include<algorithm>
+
+namespace {
+	struct cpu_features
+	{
+		bool ssse3 = false;
+		bool sse41 = false;
+		bool sse42 = false;
+		bool pclmul = false;
+		bool sha = false;
+	};
+	const cpu_features& cpu()
+	{
+		static const cpu_features s_cpu = []() {
+			cpu_features f;
+			int info[4]{};
+			__cpuid(info, 0);
+			const int max_leaf = info[0];
+			__cpuid(info, 1);
+			f.pclmul = (info[2] & (1 << 1)) != 0;
+			f.ssse3 = (info[2] & (1 << 9)) != 0;
+			f.sse41 = (info[2] & (1 << 19)) != 0;
+			f.sse42 = (info[2] & (1 << 20)) != 0;
+			if (max_leaf >= 7)
+			{
+				__cpuidex(info, 7, 0);
+				f.sha = (info[1] & (1 << 29)) != 0;
+			}
+			return f;
+		}();
+		return s_cpu;
+	}
+
+	inline std::uint32_t load_be32(const unsigned char* p)
+	{
+		return ((std::uint32_t)p[0] << 24) | ((std::uint32_t)p[1] << 16) | ((std::uint32_t)p[2] << 8) | (std::uint32_t)p[3];
+	}
+	inline void store_be32(unsigned char* p, std::uint32_t v)
+	{
+		p[0] = (unsigned char)(v >> 24);
+		p[1] = (unsigned char)(v >> 16);
+		p[2] = (unsigned char)(v >> 8);
+		p[3] = (unsigned char)v;
+	}
+	inline void store_be64(unsigned char* p, std::uint64_t v)
+	{
+		store_be32(p, (std::uint32_t)(v >> 32));
+		store_be32(p + 4, (std::uint32_t)v);
+	}
+	inline std::uint32_t rotl32(std::uint32_t x, int n) { return (x << n) | (x >> (32 - n)); }
+	inline std::uint32_t rotr32(std::uint32_t x, int n) { return (x >> n) | (x << (32 - n)); }
+
+#pragma region SHA-1/SHA-256
+	/*SHA-1SHA-256õ64ֽڷ,˳*/
+	class md_hasher : public elibstl::hash::hasher
+	{
+	protected:
+		std::uint32_t m_state[8]{};
+		unsigned char m_buf[64]{};
+		std::uint64_t m_total = 0;
+		size_t m_buffered = 0;
+
+		virtual void compress(std::uint32_t state[8], const unsigned char* data, size_t blocks) const = 0;
+	public:
+		void update(const unsigned char* data, size_t size) override
+		{
+			if (!data || size == 0)
+				return;
+			m_total += size;
+			if (m_buffered)
+			{
+				const size_t fill = (std::min)(size, 64 - m_buffered);
+				memcpy(m_buf + m_buffered, data, fill);
+				m_buffered += fill;
+				data += fill;
+				size -= fill;
+				if (m_buffered < 64)
+					return;
+				compress(m_state, m_buf, 1);
+				m_buffered = 0;
+			}
+			if (size >= 64)
+			{
+				compress(m_state, data, size / 64);
+				data += size & ~size_t(63);
+				size &= 63;
+			}
+			if (size)
+			{
+				memcpy(m_buf, data, size);
+				m_buffered = size;
+			}
+		}
+		std::vector<unsigned char> final() override
+		{
+			std::uint32_t state[8];
+			memcpy(state, m_state, sizeof(state));
+			unsigned char tail[128]{};
+			memcpy(tail, m_buf, m_buffered);
+			tail[m_buffered] = 0x80;
+			const size_t blocks = m_buffered < 56 ? 1 : 2;
+			store_be64(tail + blocks * 64 - 8, m_total << 3);
+			compress(state, tail, blocks);
+			std::vector<unsigned char> ret(digest_size());
+			for (size_t i = 0; i < ret.size() / 4; i++)
+			{
+				store_be32(ret.data() + i * 4, state[i]);
+			}
+			return ret;
+		}
+	};
+
+	void sha1_compress_scalar(std::uint32_t state[8], const unsigned char* data, size_t blocks)
+	{
+		std::uint32_t w[80];
+		for (; blocks; blocks--, data += 64)
+		{
+			for (int i = 0; i < 16; i++)
+				w[i] = load_be32(data + i * 4);
+			for (int i = 16; i < 80; i++)
+				w[i] = rotl32(w[i - 3] ^ w[i - 8] ^ w[i - 14] ^ w[i - 16], 1);
+			std::uint32_t a = state[0], b = state[1], c = state[2], d = state[3], e = state[4];
+			for (int i = 0; i < 80; i++)
+			{
+				std::uint32_t f, k;
+				if (i < 20) { f = (b & c) | (~b & d); k = 0x5a827999; }
+				else if (i < 40) { f = b ^ c ^ d; k = 0x6ed9eba1; }
+				else if (i < 60) { f = (b & c) | (b & d) | (c & d); k = 0x8f1bbcdc; }
+				else { f = b ^ c ^ d; k = 0xca62c1d6; }
+				const std::uint32_t t = rotl32(a, 5) + f + e + k + w[i];
+				e = d;
+				d = c;
+				c = rotl32(b, 30);
+				b = a;
+				a = t;
+			}
+			state[0] += a;
+			state[1] += b;
+			state[2] += c;
+			state[3] += d;
+			state[4] += e;
+		}
+	}
+
+	/*SHAչָ(SHA-NI),ÿδһԼȴC3~4*/
+	void sha1_compress_ni(std::uint32_t state[8], const unsigned char* data, size_t blocks)
+	{
+		const __m128i mask = _mm_set_epi64x(0x0001020304050607ULL, 0x08090a0b0c0d0e0fULL);
+		__m128i abcd = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(state)), 0x1B);
+		__m128i e0 = _mm_set_epi32((int)state[4], 0, 0, 0);
+		__m128i e1, msg0, msg1, msg2, msg3;
+		for (; blocks; blocks--, data += 64)
+		{
+			const __m128i abcd_save = abcd;
+			const __m128i e0_save = e0;
+
+			/* Rounds 0-3 */
+			msg0 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0)), mask);
+			e0 = _mm_add_epi32(e0, msg0);
+			e1 = abcd;
+			abcd = _mm_sha1rnds4_epu32(abcd, e0, 0);
+
+			/* Rounds 4-7 */
+			msg1 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 16)), mask);
+			e1 = _mm_sha1nexte_epu32(e1, msg1);
+			e0 = abcd;
+			abcd = _mm_sha1rnds4_epu32(abcd, e1, 0);
+			msg0 = _mm_sha1msg1_epu32(msg0, msg1);
+
+			/* Rounds 8-11 */
+			msg2 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 32)), mask);
+			e0 = _mm_sha1nexte_epu32(e0, msg2);
+			e1 = abcd;
+			abcd = _mm_sha1rnds4_epu32(abcd, e0, 0);
+			msg1 = _mm_sha1msg1_epu32(msg1, msg2);
+			msg0 = _mm_xor_si128(msg0, msg2);
+
+			/* Rounds 12-15 */
+			msg3 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 48)), mask);
+			e1 = _mm_sha1nexte_epu32(e1, msg3);
+			e0 = abcd;
+			msg0 = _mm_sha1msg2_epu32(msg0, msg3);
+			abcd = _mm_sha1rnds4_epu32(abcd, e1, 0);
+			msg2 = _mm_sha1msg1_epu32(msg2, msg3);
+			msg1 = _mm_xor_si128(msg1, msg3);
+
+			/* Rounds 16-19 */
+			e0 = _mm_sha1nexte_epu32(e0, msg0);
+			e1 = abcd;
+			msg1 = _mm_sha1msg2_epu32(msg1, msg0);
+			abcd = _mm_sha1rnds4_epu32(abcd, e0, 0);
+			msg3 = _mm_sha1msg1_epu32(msg3, msg0);
+			msg2 = _mm_xor_si128(msg2, msg0);
+
+			/* Rounds 20-23 */
+			e1 = _mm_sha1nexte_epu32(e1, msg1);
+			e0 = abcd;
+			msg2 = _mm_sha1msg2_epu32(msg2, msg1);
+			abcd = _mm_sha1rnds4_epu32(abcd, e1, 1);
+			msg0 = _mm_sha1msg1_epu32(msg0, msg1);
+			msg3 = _mm_xor_si128(msg3, msg1);
+
+			/* Rounds 24-27 */
+			e0 = _mm_sha1nexte_epu32(e0, msg2);
+			e1 = abcd;
+			msg3 = _mm_sha1msg2_epu32(msg3, msg2);
+			abcd = _mm_sha1rnds4_epu32(abcd, e0, 1);
+			msg1 = _mm_sha1msg1_epu32(msg1, msg2);
+			msg0 = _mm_xor_si128(msg0, msg2);
+
+			/* Rounds 28-31 */
+			e1 = _mm_sha1nexte_epu32(e1, msg3);
+			e0 = abcd;
+			msg0 = _mm_sha1msg2_epu32(msg0, msg3);
+			abcd = _mm_sha1rnds4_epu32(abcd, e1, 1);
+			msg2 = _mm_sha1msg1_epu32(msg2, msg3);
+			msg1 = _mm_xor_si128(msg1, msg3);
+
+			/* Rounds 32-35 */
+			e0 = _mm_sha1nexte_epu32(e0, msg0);
+			e1 = abcd;
+			msg1 = _mm_sha1msg2_epu32(msg1, msg0);
+			abcd = _mm_sha1rnds4_epu32(abcd, e0, 1);
+			msg3 = _mm_sha1msg1_epu32(msg3, msg0);
+			msg2 = _mm_xor_si128(msg2, msg0);
+
+			/* Rounds 36-39 */
+			e1 = _mm_sha1nexte_epu32(e1, msg1);
+			e0 = abcd;
+			msg2 = _mm_sha1msg2_epu32(msg2, msg1);
+			abcd = _mm_sha1rnds4_epu32(abcd, e1, 1);
+			msg0 = _mm_sha1msg1_epu32(msg0, msg1);
+			msg3 = _mm_xor_si128(msg3, msg1);
+
+			/* Rounds 40-43 */
+			e0 = _mm_sha1nexte_epu32(e0, msg2);
+			e1 = abcd;
+			msg3 = _mm_sha1msg2_epu32(msg3, msg2);
+			abcd = _mm_sha1rnds4_epu32(abcd, e0, 2);
+			msg1 = _mm_sha1msg1_epu32(msg1, msg2);
+			msg0 = _mm_xor_si128(msg0, msg2);
+
+			/* Rounds 44-47 */
+			e1 = _mm_sha1nexte_epu32(e1, msg3);
+			e0 = abcd;
+			msg0 = _mm_sha1msg2_epu32(msg0, msg3);
+			abcd = _mm_sha1rnds4_epu32(abcd, e1, 2);
+			msg2 = _mm_sha1msg1_epu32(msg2, msg3);
+			msg1 = _mm_xor_si128(msg1, msg3);
+
+			/* Rounds 48-51 */
+			e0 = _mm_sha1nexte_epu32(e0, msg0);
+			e1 = abcd;
+			msg1 = _mm_sha1msg2_epu32(msg1, msg0);
+			abcd = _mm_sha1rnds4_epu32(abcd, e0, 2);
+			msg3 = _mm_sha1msg1_epu32(msg3, msg0);
+			msg2 = _mm_xor_si128(msg2, msg0);
+
+			/* Rounds 52-55 */
+			e1 = _mm_sha1nexte_epu32(e1, msg1);
+			e0 = abcd;
+			msg2 = _mm_sha1msg2_epu32(msg2, msg1);
+			abcd = _mm_sha1rnds4_epu32(abcd, e1, 2);
+			msg0 = _mm_sha1msg1_epu32(msg0, msg1);
+			msg3 = _mm_xor_si128(msg3, msg1);
+
+			/* Rounds 56-59 */
+			e0 = _mm_sha1nexte_epu32(e0, msg2);
+			e1 = abcd;
+			msg3 = _mm_sha1msg2_epu32(msg3, msg2);
+			abcd = _mm_sha1rnds4_epu32(abcd, e0, 2);
+			msg1 = _mm_sha1msg1_epu32(msg1, msg2);
+			msg0 = _mm_xor_si128(msg0, msg2);
+
+			/* Rounds 60-63 */
+			e1 = _mm_sha1nexte_epu32(e1, msg3);
+			e0 = abcd;
+			msg0 = _mm_sha1msg2_epu32(msg0, msg3);
+			abcd = _mm_sha1rnds4_epu32(abcd, e1, 3);
+			msg2 = _mm_sha1msg1_epu32(msg2, msg3);
+			msg1 = _mm_xor_si128(msg1, msg3);
+
+			/* Rounds 64-67 */
+			e0 = _mm_sha1nexte_epu32(e0, msg0);
+			e1 = abcd;
+			msg1 = _mm_sha1msg2_epu32(msg1, msg0);
+			abcd = _mm_sha1rnds4_epu32(abcd, e0, 3);
+			msg3 = _mm_sha1msg1_epu32(msg3, msg0);
+			msg2 = _mm_xor_si128(msg2, msg0);
+
+			/* Rounds 68-71 */
+			e1 = _mm_sha1nexte_epu32(e1, msg1);
+			e0 = abcd;
+			msg2 = _mm_sha1msg2_epu32(msg2, msg1);
+			abcd = _mm_sha1rnds4_epu32(abcd, e1, 3);
+			msg3 = _mm_xor_si128(msg3, msg1);
+
+			/* Rounds 72-75 */
+			e0 = _mm_sha1nexte_epu32(e0, msg2);
+			e1 = abcd;
+			msg3 = _mm_sha1msg2_epu32(msg3, msg2);
+			abcd = _mm_sha1rnds4_epu32(abcd, e0, 3);
+
+			/* Rounds 76-79 */
+			e1 = _mm_sha1nexte_epu32(e1, msg3);
+			e0 = abcd;
+			abcd = _mm_sha1rnds4_epu32(abcd, e1, 3);
+			e0 = _mm_sha1nexte_epu32(e0, e0_save);
+			abcd = _mm_add_epi32(abcd, abcd_save);
+		}
+		abcd = _mm_shuffle_epi32(abcd, 0x1B);
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(state), abcd);
+		state[4] = (std::uint32_t)_mm_extract_epi32(e0, 3);
+	}
+
+	class sha1_hasher : public md_hasher
+	{
+	protected:
+		void compress(std::uint32_t state[8], const unsigned char* data, size_t blocks) const override
+		{
+			if (cpu().sha && cpu().sse41)
+				sha1_compress_ni(state, data, blocks);
+			else
+				sha1_compress_scalar(state, data, blocks);
+		}
+	public:
+		sha1_hasher() { reset(); }
+		void reset() override
+		{
+			static constexpr std::uint32_t init[5] = { 0x67452301, 0xefcdab89, 0x98badcfe, 0x10325476, 0xc3d2e1f0 };
+			memcpy(m_state, init, sizeof(init));
+			m_total = 0;
+			m_buffered = 0;
+		}
+		hasher* clone() const override { return new sha1_hasher(*this); }
+		size_t digest_size() const override { return 20; }
+	};
+
+	alignas(16) constexpr std::uint32_t s_sha256_k[64] = {
+		0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+		0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+		0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+		0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+		0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+		0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+		0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+		0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2,
+	};
+
+	void sha256_compress_scalar(std::uint32_t state[8], const unsigned char* data, size_t blocks)
+	{
+		std::uint32_t w[64];
+		for (; blocks; blocks--, data += 64)
+		{
+			for (int i = 0; i < 16; i++)
+				w[i] = load_be32(data + i * 4);
+			for (int i = 16; i < 64; i++)
+			{
+				const std::uint32_t s0 = rotr32(w[i - 15], 7) ^ rotr32(w[i - 15], 18) ^ (w[i - 15] >> 3);
+				const std::uint32_t s1 = rotr32(w[i - 2], 17) ^ rotr32(w[i - 2], 19) ^ (w[i - 2] >> 10);
+				w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+			}
+			std::uint32_t a = state[0], b = state[1], c = state[2], d = state[3];
+			std::uint32_t e = state[4], f = state[5], g = state[6], h = state[7];
+			for (int i = 0; i < 64; i++)
+			{
+				const std::uint32_t s1 = rotr32(e, 6) ^ rotr32(e, 11) ^ rotr32(e, 25);
+				const std::uint32_t ch = (e & f) ^ (~e & g);
+				const std::uint32_t t1 = h + s1 + ch + s_sha256_k[i] + w[i];
+				const std::uint32_t s0 = rotr32(a, 2) ^ rotr32(a, 13) ^ rotr32(a, 22);
+				const std::uint32_t maj = (a & b) ^ (a & c) ^ (b & c);
+				const std::uint32_t t2 = s0 + maj;
+				h = g;
+				g = f;
+				f = e;
+				e = d + t1;
+				d = c;
+				c = b;
+				b = a;
+				a = t1 + t2;
+			}
+			state[0] += a;
+			state[1] += b;
+			state[2] += c;
+			state[3] += d;
+			state[4] += e;
+			state[5] += f;
+			state[6] += g;
+			state[7] += h;
+		}
+	}
+
+	void sha256_compress_ni(std::uint32_t state[8], const unsigned char* data, size_t blocks)
+	{
+		const __m128i mask = _mm_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+		const std::uint32_t* k = s_sha256_k;
+		__m128i tmp = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(state)), 0xB1);
+		__m128i state1 = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(state + 4)), 0x1B);
+		__m128i state0 = _mm_alignr_epi8(tmp, state1, 8);
+		state1 = _mm_blend_epi16(state1, tmp, 0xF0);
+		__m128i msg, msg0, msg1, msg2, msg3;
+		for (; blocks; blocks--, data += 64)
+		{
+			const __m128i abef_save = state0;
+			const __m128i cdgh_save = state1;
+
+			/* Rounds 0-3 */
+			msg0 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0)), mask);
+			msg = _mm_add_epi32(msg0, _mm_loadu_si128(reinterpret_cast<const __m128i*>(k + 0)));
+			state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+			msg = _mm_shuffle_epi32(msg, 0x0E);
+			state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+
+			/* Rounds 4-7 */
+			msg1 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 16)), mask);
+			msg = _mm_add_epi32(msg1, _mm_loadu_si128(reinterpret_cast<const __m128i*>(k + 4)));
+			state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+			msg = _mm_shuffle_epi32(msg, 0x0E);
+			state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+			msg0 = _mm_sha256msg1_epu32(msg0, msg1);
+
+			/* Rounds 8-11 */
+			msg2 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 32)), mask);
+			msg = _mm_add_epi32(msg2, _mm_loadu_si128(reinterpret_cast<const __m128i*>(k + 8)));
+			state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+			msg = _mm_shuffle_epi32(msg, 0x0E);
+			state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+			msg1 = _mm_sha256msg1_epu32(msg1, msg2);
+
+			/* Rounds 12-15 */
+			msg3 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 48)), mask);
+			msg = _mm_add_epi32(msg3, _mm_loadu_si128(reinterpret_cast<const __m128i*>(k + 12)));
+			state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+			tmp = _mm_alignr_epi8(msg3, msg2, 4);
+			msg0 = _mm_add_epi32(msg0, tmp);
+			msg0 = _mm_sha256msg2_epu32(msg0, msg3);
+			msg = _mm_shuffle_epi32(msg, 0x0E);
+			state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+			msg2 = _mm_sha256msg1_epu32(msg2, msg3);
+
+			/* Rounds 16-19 */
+			msg = _mm_add_epi32(msg0, _mm_loadu_si128(reinterpret_cast<const __m128i*>(k + 16)));
+			state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+			tmp = _mm_alignr_epi8(msg0, msg3, 4);
+			msg1 = _mm_add_epi32(msg1, tmp);
+			msg1 = _mm_sha256msg2_epu32(msg1, msg0);
+			msg = _mm_shuffle_epi32(msg, 0x0E);
+			state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+			msg3 = _mm_sha256msg1_epu32(msg3, msg0);
+
+			/* Rounds 20-23 */
+			msg = _mm_add_epi32(msg1, _mm_loadu_si128(reinterpret_cast<const __m128i*>(k + 20)));
+			state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+			tmp = _mm_alignr_epi8(msg1, msg0, 4);
+			msg2 = _mm_add_epi32(msg2, tmp);
+			msg2 = _mm_sha256msg2_epu32(msg2, msg1);
+			msg = _mm_shuffle_epi32(msg, 0x0E);
+			state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+			msg0 = _mm_sha256msg1_epu32(msg0, msg1);
+
+			/* Rounds 24-27 */
+			msg = _mm_add_epi32(msg2, _mm_loadu_si128(reinterpret_cast<const __m128i*>(k + 24)));
+			state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+			tmp = _mm_alignr_epi8(msg2, msg1, 4);
+			msg3 = _mm_add_epi32(msg3, tmp);
+			msg3 = _mm_sha256msg2_epu32(msg3, msg2);
+			msg = _mm_shuffle_epi32(msg, 0x0E);
+			state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+			msg1 = _mm_sha256msg1_epu32(msg1, msg2);
+
+			/* Rounds 28-31 */
+			msg = _mm_add_epi32(msg3, _mm_loadu_si128(reinterpret_cast<const __m128i*>(k + 28)));
+			state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+			tmp = _mm_alignr_epi8(msg3, msg2, 4);
+			msg0 = _mm_add_epi32(msg0, tmp);
+			msg0 = _mm_sha256msg2_epu32(msg0, msg3);
+			msg = _mm_shuffle_epi32(msg, 0x0E);
+			state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+			msg2 = _mm_sha256msg1_epu32(msg2, msg3);
+
+			/* Rounds 32-35 */
+			msg = _mm_add_epi32(msg0, _mm_loadu_si128(reinterpret_cast<const __m128i*>(k + 32)));
+			state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+			tmp = _mm_alignr_epi8(msg0, msg3, 4);
+			msg1 = _mm_add_epi32(msg1, tmp);
+			msg1 = _mm_sha256msg2_epu32(msg1, msg0);
+			msg = _mm_shuffle_epi32(msg, 0x0E);
+			state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+			msg3 = _mm_sha256msg1_epu32(msg3, msg0);
+
+			/* Rounds 36-39 */
+			msg = _mm_add_epi32(msg1, _mm_loadu_si128(reinterpret_cast<const __m128i*>(k + 36)));
+			state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+			tmp = _mm_alignr_epi8(msg1, msg0, 4);
+			msg2 = _mm_add_epi32(msg2, tmp);
+			msg2 = _mm_sha256msg2_epu32(msg2, msg1);
+			msg = _mm_shuffle_epi32(msg, 0x0E);
+			state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+			msg0 = _mm_sha256msg1_epu32(msg0, msg1);
+
+			/* Rounds 40-43 */
+			msg = _mm_add_epi32(msg2, _mm_loadu_si128(reinterpret_cast<const __m128i*>(k + 40)));
+			state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+			tmp = _mm_alignr_epi8(msg2, msg1, 4);
+			msg3 = _mm_add_epi32(msg3, tmp);
+			msg3 = _mm_sha256msg2_epu32(msg3, msg2);
+			msg = _mm_shuffle_epi32(msg, 0x0E);
+			state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+			msg1 = _mm_sha256msg1_epu32(msg1, msg2);
+
+			/* Rounds 44-47 */
+			msg = _mm_add_epi32(msg3, _mm_loadu_si128(reinterpret_cast<const __m128i*>(k + 44)));
+			state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+			tmp = _mm_alignr_epi8(msg3, msg2, 4);
+			msg0 = _mm_add_epi32(msg0, tmp);
+			msg0 = _mm_sha256msg2_epu32(msg0, msg3);
+			msg = _mm_shuffle_epi32(msg, 0x0E);
+			state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+			msg2 = _mm_sha256msg1_epu32(msg2, msg3);
+
+			/* Rounds 48-51 */
+			msg = _mm_add_epi32(msg0, _mm_loadu_si128(reinterpret_cast<const __m128i*>(k + 48)));
+			state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+			tmp = _mm_alignr_epi8(msg0, msg3, 4);
+			msg1 = _mm_add_epi32(msg1, tmp);
+			msg1 = _mm_sha256msg2_epu32(msg1, msg0);
+			msg = _mm_shuffle_epi32(msg, 0x0E);
+			state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+			msg3 = _mm_sha256msg1_epu32(msg3, msg0);
+
+			/* Rounds 52-55 */
+			msg = _mm_add_epi32(msg1, _mm_loadu_si128(reinterpret_cast<const __m128i*>(k + 52)));
+			state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+			tmp = _mm_alignr_epi8(msg1, msg0, 4);
+			msg2 = _mm_add_epi32(msg2, tmp);
+			msg2 = _mm_sha256msg2_epu32(msg2, msg1);
+			msg = _mm_shuffle_epi32(msg, 0x0E);
+			state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+
+			/* Rounds 56-59 */
+			msg = _mm_add_epi32(msg2, _mm_loadu_si128(reinterpret_cast<const __m128i*>(k + 56)));
+			state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+			tmp = _mm_alignr_epi8(msg2, msg1, 4);
+			msg3 = _mm_add_epi32(msg3, tmp);
+			msg3 = _mm_sha256msg2_epu32(msg3, msg2);
+			msg = _mm_shuffle_epi32(msg, 0x0E);
+			state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+
+			/* Rounds 60-63 */
+			msg = _mm_add_epi32(msg3, _mm_loadu_si128(reinterpret_cast<const __m128i*>(k + 60)));
+			state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+			msg = _mm_shuffle_epi32(msg, 0x0E);
+			state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+			state0 = _mm_add_epi32(state0, abef_save);
+			state1 = _mm_add_epi32(state1, cdgh_save);
+		}
+		tmp = _mm_shuffle_epi32(state0, 0x1B);
+		state1 = _mm_shuffle_epi32(state1, 0xB1);
+		state0 = _mm_blend_epi16(tmp, state1, 0xF0);
+		state1 = _mm_alignr_epi8(state1, tmp, 8);
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(state), state0);
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(state + 4), state1);
+	}
+
+	class sha256_hasher : public md_hasher
+	{
+	protected:
+		void compress(std::uint32_t state[8], const unsigned char* data, size_t blocks) const override
+		{
+			if (cpu().sha && cpu().sse41)
+				sha256_compress_ni(state, data, blocks);
+			else
+				sha256_compress_scalar(state, data, blocks);
+		}
+	public:
+		sha256_hasher() { reset(); }
+		void reset() override
+		{
+			static constexpr std::uint32_t init[8] = { 0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19 };
+			memcpy(m_state, init, sizeof(init));
+			m_total = 0;
+			m_buffered = 0;
+		}
+		hasher* clone() const override { return new sha256_hasher(*this); }
+		size_t digest_size() const override { return 32; }
+	};
+#pragma endregion
+
+#pragma region CRC32/CRC32C
+	/*slice-by-8,ÿδ8ֽ*/
+	struct crc_table
+	{
+		std::uint32_t t[8][256];
+		explicit crc_table(std::uint32_t poly)
+		{
+			for (std::uint32_t i = 0; i < 256; i++)
+			{
+				std::uint32_t c = i;
+				for (int k = 0; k < 8; k++)
+					c = (c & 1) ? (c >> 1) ^ poly : c >> 1;
+				t[0][i] = c;
+			}
+			for (std::uint32_t i = 0; i < 256; i++)
+			{
+				for (int s = 1; s < 8; s++)
+					t[s][i] = (t[s - 1][i] >> 8) ^ t[0][t[s - 1][i] & 0xff];
+			}
+		}
+		/*crcΪȡڲ״̬*/
+		std::uint32_t update(std::uint32_t crc, const unsigned char* p, size_t n) const
+		{
+			while (n && (reinterpret_cast<uintptr_t>(p) & 7))
+			{
+				crc = (crc >> 8) ^ t[0][(crc ^ *p++) & 0xff];
+				n--;
+			}
+			while (n >= 8)
+			{
+				const std::uint32_t lo = crc ^ ((std::uint32_t)p[0] | ((std::uint32_t)p[1] << 8) | ((std::uint32_t)p[2] << 16) | ((std::uint32_t)p[3] << 24));
+				const std::uint32_t hi = (std::uint32_t)p[4] | ((std::uint32_t)p[5] << 8) | ((std::uint32_t)p[6] << 16) | ((std::uint32_t)p[7] << 24);
+				crc = t[7][lo & 0xff] ^ t[6][(lo >> 8) & 0xff] ^ t[5][(lo >> 16) & 0xff] ^ t[4][lo >> 24] ^
+					t[3][hi & 0xff] ^ t[2][(hi >> 8) & 0xff] ^ t[1][(hi >> 16) & 0xff] ^ t[0][hi >> 24];
+				p += 8;
+				n -= 8;
+			}
+			while (n--)
+				crc = (crc >> 8) ^ t[0][(crc ^ *p++) & 0xff];
+			return crc;
+		}
+	};
+	const crc_table& crc32_table()
+	{
+		static const crc_table s_table(0xedb88320);
+		return s_table;
+	}
+	const crc_table& crc32c_table()
+	{
+		static const crc_table s_table(0x82f63b78);
+		return s_table;
+	}
+
+	/*
+	* PCLMULQDQ۵(IntelƤ"Fast CRC Computation Using PCLMULQDQ",zlib/chromiumʵһ).
+	* Ҫlen>=64Ϊ16ı,crcΪȡڲ״̬.
+	*/
+	std::uint32_t crc32_pclmul(std::uint32_t crc, const unsigned char* buf, size_t len)
+	{
+		alignas(16) static const std::uint64_t k1k2[] = { 0x0154442bd4, 0x01c6e41596 };
+		alignas(16) static const std::uint64_t k3k4[] = { 0x01751997d0, 0x00ccaa009e };
+		alignas(16) static const std::uint64_t k5k0[] = { 0x0163cd6124, 0x0000000000 };
+		alignas(16) static const std::uint64_t poly[] = { 0x01db710641, 0x01f7011641 };
+		__m128i x0, x1, x2, x3, x4, x5, x6, x7, x8, y5, y6, y7, y8;
+
+		x1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(buf + 0x00));
+		x2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(buf + 0x10));
+		x3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(buf + 0x20));
+		x4 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(buf + 0x30));
+		x1 = _mm_xor_si128(x1, _mm_cvtsi32_si128((int)crc));
+		x0 = _mm_load_si128(reinterpret_cast<const __m128i*>(k1k2));
+		buf += 64;
+		len -= 64;
+
+		/*4·۵,ÿ64ֽ*/
+		while (len >= 64)
+		{
+			x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+			x6 = _mm_clmulepi64_si128(x2, x0, 0x00);
+			x7 = _mm_clmulepi64_si128(x3, x0, 0x00);
+			x8 = _mm_clmulepi64_si128(x4, x0, 0x00);
+			x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+			x2 = _mm_clmulepi64_si128(x2, x0, 0x11);
+			x3 = _mm_clmulepi64_si128(x3, x0, 0x11);
+			x4 = _mm_clmulepi64_si128(x4, x0, 0x11);
+			y5 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(buf + 0x00));
+			y6 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(buf + 0x10));
+			y7 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(buf + 0x20));
+			y8 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(buf + 0x30));
+			x1 = _mm_xor_si128(_mm_xor_si128(x1, x5), y5);
+			x2 = _mm_xor_si128(_mm_xor_si128(x2, x6), y6);
+			x3 = _mm_xor_si128(_mm_xor_si128(x3, x7), y7);
+			x4 = _mm_xor_si128(_mm_xor_si128(x4, x8), y8);
+			buf += 64;
+			len -= 64;
+		}
+
+		/*ϲΪ128λ*/
+		x0 = _mm_load_si128(reinterpret_cast<const __m128i*>(k3k4));
+		x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+		x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+		x1 = _mm_xor_si128(_mm_xor_si128(x1, x2), x5);
+		x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+		x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+		x1 = _mm_xor_si128(_mm_xor_si128(x1, x3), x5);
+		x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+		x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+		x1 = _mm_xor_si128(_mm_xor_si128(x1, x4), x5);
+
+		while (len >= 16)
+		{
+			x2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(buf));
+			x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+			x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+			x1 = _mm_xor_si128(_mm_xor_si128(x1, x2), x5);
+			buf += 16;
+			len -= 16;
+		}
+
+		/*128λ64λ*/
+		x2 = _mm_clmulepi64_si128(x1, x0, 0x10);
+		x3 = _mm_setr_epi32(~0, 0, ~0, 0);
+		x1 = _mm_srli_si128(x1, 8);
+		x1 = _mm_xor_si128(x1, x2);
+		x0 = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(k5k0));
+		x2 = _mm_srli_si128(x1, 4);
+		x1 = _mm_and_si128(x1, x3);
+		x1 = _mm_clmulepi64_si128(x1, x0, 0x00);
+		x1 = _mm_xor_si128(x1, x2);
+
+		/*BarrettԼ32λ*/
+		x0 = _mm_load_si128(reinterpret_cast<const __m128i*>(poly));
+		x2 = _mm_and_si128(x1, x3);
+		x2 = _mm_clmulepi64_si128(x2, x0, 0x10);
+		x2 = _mm_and_si128(x2, x3);
+		x2 = _mm_clmulepi64_si128(x2, x0, 0x00);
+		x1 = _mm_xor_si128(x1, x2);
+		return (std::uint32_t)_mm_extract_epi32(x1, 1);
+	}
+
+	/*SSE4.2crc32ָΪCastagnoliʽ*/
+	std::uint32_t crc32c_sse42(std::uint32_t crc, const unsigned char* p, size_t n)
+	{
+		while (n && (reinterpret_cast<uintptr_t>(p) & 7))
+		{
+			crc = _mm_crc32_u8(crc, *p++);
+			n--;
+		}
+#if defined(_M_X64)
+		std::uint64_t crc64 = crc;
+		for (; n >= 8; n -= 8, p += 8)
+			crc64 = _mm_crc32_u64(crc64, *reinterpret_cast<const std::uint64_t*>(p));
+		crc = (std::uint32_t)crc64;
+#else
+		for (; n >= 4; n -= 4, p += 4)
+			crc = _mm_crc32_u32(crc, *reinterpret_cast<const std::uint32_t*>(p));
+#endif
+		while (n--)
+			crc = _mm_crc32_u8(crc, *p++);
+		return crc;
+	}
+
+	class crc_hasher : public elibstl::hash::hasher
+	{
+		std::uint32_t m_crc = 0;
+		bool m_castagnoli;
+	public:
+		explicit crc_hasher(bool castagnoli) : m_castagnoli(castagnoli) {}
+		void update(const unsigned char* data, size_t size) override
+		{
+			m_crc = m_castagnoli ? elibstl::hash::crc32c(m_crc, data, size) : elibstl::hash::crc32(m_crc, data, size);
+		}
+		std::vector<unsigned char> final() override
+		{
+			std::vector<unsigned char> ret(4);
+			store_be32(ret.data(), m_crc);
+			return ret;
+		}
+		void reset() override { m_crc = 0; }
+		hasher* clone() const override { return new crc_hasher(*this); }
+		size_t digest_size() const override { return 4; }
+	};
+#pragma endregion
+
+#pragma region XXH3
+	/*XXH3(Ϊ0,ĬԿ),64λ128λóۼӲ*/
+	namespace xxh3 {
+		constexpr std::uint64_t P32_1 = 0x9E3779B1U;
+		constexpr std::uint64_t P32_2 = 0x85EBCA77U;
+		constexpr std::uint64_t P32_3 = 0xC2B2AE3DU;
+		constexpr std::uint64_t P64_1 = 0x9E3779B185EBCA87ULL;
+		constexpr std::uint64_t P64_2 = 0xC2B2AE3D27D4EB4FULL;
+		constexpr std::uint64_t P64_3 = 0x165667B19E3779F9ULL;
+		constexpr std::uint64_t P64_4 = 0x85EBCA77C2B2AE63ULL;
+		constexpr std::uint64_t P64_5 = 0x27D4EB2F165667C5ULL;
+		constexpr std::uint64_t PRIME_MX1 = 0x165667919E3779F9ULL;
+		constexpr std::uint64_t PRIME_MX2 = 0x9FB21C651E98DF25ULL;
+		constexpr size_t SECRET_SIZE = 192;
+		constexpr size_t STRIPE_LEN = 64;
+		constexpr size_t STRIPES_PER_BLOCK = (SECRET_SIZE - STRIPE_LEN) / 8;
+		constexpr size_t MIDSIZE_MAX = 240;
+
+		alignas(64) constexpr unsigned char kSecret[SECRET_SIZE] = {
+			0xb8, 0xfe, 0x6c, 0x39, 0x23, 0xa4, 0x4b, 0xbe, 0x7c, 0x01, 0x81, 0x2c, 0xf7, 0x21, 0xad, 0x1c,
+			0xde, 0xd4, 0x6d, 0xe9, 0x83, 0x90, 0x97, 0xdb, 0x72, 0x40, 0xa4, 0xa4, 0xb7, 0xb3, 0x67, 0x1f,
+			0xcb, 0x79, 0xe6, 0x4e, 0xcc, 0xc0, 0xe5, 0x78, 0x82, 0x5a, 0xd0, 0x7d, 0xcc, 0xff, 0x72, 0x21,
+			0xb8, 0x08, 0x46, 0x74, 0xf7, 0x43, 0x24, 0x8e, 0xe0, 0x35, 0x90, 0xe6, 0x81, 0x3a, 0x26, 0x4c,
+			0x3c, 0x28, 0x52, 0xbb, 0x91, 0xc3, 0x00, 0xcb, 0x88, 0xd0, 0x65, 0x8b, 0x1b, 0x53, 0x2e, 0xa3,
+			0x71, 0x64, 0x48, 0x97, 0xa2, 0x0d, 0xf9, 0x4e, 0x38, 0x19, 0xef, 0x46, 0xa9, 0xde, 0xac, 0xd8,
+			0xa8, 0xfa, 0x76, 0x3f, 0xe3, 0x9c, 0x34, 0x3f, 0xf9, 0xdc, 0xbb, 0xc7, 0xc7, 0x0b, 0x4f, 0x1d,
+			0x8a, 0x51, 0xe0, 0x4b, 0xcd, 0xb4, 0x59, 0x31, 0xc8, 0x9f, 0x7e, 0xc9, 0xd9, 0x78, 0x73, 0x64,
+			0xea, 0xc5, 0xac, 0x83, 0x34, 0xd3, 0xeb, 0xc3, 0xc5, 0x81, 0xa0, 0xff, 0xfa, 0x13, 0x63, 0xeb,
+			0x17, 0x0d, 0xdd, 0x51, 0xb7, 0xf0, 0xda, 0x49, 0xd3, 0x16, 0x55, 0x26, 0x29, 0xd4, 0x68, 0x9e,
+			0x2b, 0x16, 0xbe, 0x58, 0x7d, 0x47, 0xa1, 0xfc, 0x8f, 0xf8, 0xb8, 0xd1, 0x7a, 0xd0, 0x31, 0xce,
+			0x45, 0xcb, 0x3a, 0x8f, 0x95, 0x16, 0x04, 0x28, 0xaf, 0xd7, 0xfb, 0xca, 0xbb, 0x4b, 0x40, 0x7e,
+		};
+
+		inline std::uint32_t read32(const unsigned char* p) { std::uint32_t v; memcpy(&v, p, 4); return v; }
+		inline std::uint64_t read64(const unsigned char* p) { std::uint64_t v; memcpy(&v, p, 8); return v; }
+		inline std::uint64_t rotl64(std::uint64_t x, int n) { return (x << n) | (x >> (64 - n)); }
+		inline std::uint32_t swap32(std::uint32_t x) { return ((x << 24) & 0xff000000) | ((x << 8) & 0x00ff0000) | ((x >> 8) & 0x0000ff00) | ((x >> 24) & 0x000000ff); }
+		inline std::uint64_t swap64(std::uint64_t x) { return ((std::uint64_t)swap32((std::uint32_t)x) << 32) | swap32((std::uint32_t)(x >> 32)); }
+
+		/*64x64->128λ˷,ص64λ,64λдhi*/
+		inline std::uint64_t mult64to128(std::uint64_t a, std::uint64_t b, std::uint64_t* hi)
+		{
+#if defined(_M_X64)
+			return _umul128(a, b, hi);
+#else
+			const std::uint64_t lo_lo = (a & 0xffffffff) * (b & 0xffffffff);
+			const std::uint64_t hi_lo = (a >> 32) * (b & 0xffffffff);
+			const std::uint64_t lo_hi = (a & 0xffffffff) * (b >> 32);
+			const std::uint64_t hi_hi = (a >> 32) * (b >> 32);
+			const std::uint64_t cross = (lo_lo >> 32) + (hi_lo & 0xffffffff) + lo_hi;
+			*hi = (hi_lo >> 32) + (cross >> 32) + hi_hi;
+			return (cross << 32) | (lo_lo & 0xffffffff);
+#endif
+		}
+		inline std::uint64_t mul128_fold64(std::uint64_t a, std::uint64_t b)
+		{
+			std::uint64_t hi;
+			const std::uint64_t lo = mult64to128(a, b, &hi);
+			return lo ^ hi;
+		}
+		inline std::uint64_t xxh64_avalanche(std::uint64_t h)
+		{
+			h ^= h >> 33;
+			h *= P64_2;
+			h ^= h >> 29;
+			h *= P64_3;
+			h ^= h >> 32;
+			return h;
+		}
+		inline std::uint64_t avalanche(std::uint64_t h)
+		{
+			h ^= h >> 37;
+			h *= PRIME_MX1;
+			h ^= h >> 32;
+			return h;
+		}
+		inline std::uint64_t rrmxmx(std::uint64_t h, std::uint64_t len)
+		{
+			h ^= rotl64(h, 49) ^ rotl64(h, 24);
+			h *= PRIME_MX2;
+			h ^= (h >> 35) + len;
+			h *= PRIME_MX2;
+			return h ^ (h >> 28);
+		}
+		inline std::uint64_t mix16(const unsigned char* in, const unsigned char* sec)
+		{
+			return mul128_fold64(read64(in) ^ read64(sec), read64(in + 8) ^ read64(sec + 8));
+		}
+
+		std::uint64_t hash64_short(const unsigned char* in, size_t len)
+		{
+			const unsigned char* s = kSecret;
+			if (len > 128)
+			{
+				std::uint64_t acc = len * P64_1;
+				for (size_t i = 0; i < 8; i++)
+					acc += mix16(in + 16 * i, s + 16 * i);
+				std::uint64_t acc_end = mix16(in + len - 16, s + 136 - 17);
+				acc = avalanche(acc);
+				for (size_t i = 8; i < len / 16; i++)
+					acc_end += mix16(in + 16 * i, s + 16 * (i - 8) + 3);
+				return avalanche(acc + acc_end);
+			}
+			if (len > 16)
+			{
+				std::uint64_t acc = len * P64_1;
+				if (len > 32)
+				{
+					if (len > 64)
+					{
+						if (len > 96)
+						{
+							acc += mix16(in + 48, s + 96);
+							acc += mix16(in + len - 64, s + 112);
+						}
+						acc += mix16(in + 32, s + 64);
+						acc += mix16(in + len - 48, s + 80);
+					}
+					acc += mix16(in + 16, s + 32);
+					acc += mix16(in + len - 32, s + 48);
+				}
+				acc += mix16(in, s);
+				acc += mix16(in + len - 16, s + 16);
+				return avalanche(acc);
+			}
+			if (len > 8)
+			{
+				const std::uint64_t lo = read64(in) ^ (read64(s + 24) ^ read64(s + 32));
+				const std::uint64_t hi = read64(in + len - 8) ^ (read64(s + 40) ^ read64(s + 48));
+				return avalanche(len + swap64(lo) + hi + mul128_fold64(lo, hi));
+			}
+			if (len >= 4)
+			{
+				const std::uint64_t in64 = read32(in + len - 4) + ((std::uint64_t)read32(in) << 32);
+				return rrmxmx(in64 ^ (read64(s + 8) ^ read64(s + 16)), len);
+			}
+			if (len)
+			{
+				const std::uint32_t combined = ((std::uint32_t)in[0] << 16) | ((std::uint32_t)in[len >> 1] << 24) | (std::uint32_t)in[len - 1] | ((std::uint32_t)len << 8);
+				return xxh64_avalanche((std::uint64_t)combined ^ (read32(s) ^ read32(s + 4)));
+			}
+			return xxh64_avalanche(read64(s + 56) ^ read64(s + 64));
+		}
+
+		inline void mix32(std::uint64_t acc[2], const unsigned char* in1, const unsigned char* in2, const unsigned char* sec)
+		{
+			acc[0] += mix16(in1, sec);
+			acc[0] ^= read64(in2) + read64(in2 + 8);
+			acc[1] += mix16(in2, sec + 16);
+			acc[1] ^= read64(in1) + read64(in1 + 8);
+		}
+		/*out[0]Ϊ64λ,out[1]Ϊ64λ*/
+		void hash128_short(const unsigned char* in, size_t len, std::uint64_t out[2])
+		{
+			const unsigned char* s = kSecret;
+			std::uint64_t lo, hi;
+			if (len > 16)
+			{
+				std::uint64_t acc[2] = { len * P64_1, 0 };
+				if (len > 128)
+				{
+					for (size_t i = 32; i < 160; i += 32)
+						mix32(acc, in + i - 32, in + i - 16, s + i - 32);
+					acc[0] = avalanche(acc[0]);
+					acc[1] = avalanche(acc[1]);
+					for (size_t i = 160; i <= len; i += 32)
+						mix32(acc, in + i - 32, in + i - 16, s + 3 + i - 160);
+					mix32(acc, in + len - 16, in + len - 32, s + 136 - 17 - 16);
+				}
+				else
+				{
+					if (len > 32)
+					{
+						if (len > 64)
+						{
+							if (len > 96)
+								mix32(acc, in + 48, in + len - 64, s + 96);
+							mix32(acc, in + 32, in + len - 48, s + 64);
+						}
+						mix32(acc, in + 16, in + len - 32, s + 32);
+					}
+					mix32(acc, in, in + len - 16, s);
+				}
+				lo = avalanche(acc[0] + acc[1]);
+				hi = 0 - avalanche(acc[0] * P64_1 + acc[1] * P64_4 + len * P64_2);
+			}
+			else if (len > 8)
+			{
+				const std::uint64_t bitflipl = read64(s + 32) ^ read64(s + 40);
+				const std::uint64_t bitfliph = read64(s + 48) ^ read64(s + 56);
+				const std::uint64_t input_lo = read64(in);
+				std::uint64_t input_hi = read64(in + len - 8);
+				std::uint64_t m_hi;
+				std::uint64_t m_lo = mult64to128(input_lo ^ input_hi ^ bitflipl, P64_1, &m_hi);
+				m_lo += (std::uint64_t)(len - 1) << 54;
+				input_hi ^= bitfliph;
+				m_hi += input_hi + (input_hi & 0xffffffff) * (P32_2 - 1);
+				m_lo ^= swap64(m_hi);
+				std::uint64_t h_hi;
+				std::uint64_t h_lo = mult64to128(m_lo, P64_2, &h_hi);
+				h_hi += m_hi * P64_2;
+				lo = avalanche(h_lo);
+				hi = avalanche(h_hi);
+			}
+			else if (len >= 4)
+			{
+				const std::uint64_t in64 = read32(in) + ((std::uint64_t)read32(in + len - 4) << 32);
+				const std::uint64_t keyed = in64 ^ (read64(s + 16) ^ read64(s + 24));
+				std::uint64_t m_hi;
+				std::uint64_t m_lo = mult64to128(keyed, P64_1 + (len << 2), &m_hi);
+				m_hi += m_lo << 1;
+				m_lo ^= m_hi >> 3;
+				m_lo ^= m_lo >> 35;
+				m_lo *= PRIME_MX2;
+				m_lo ^= m_lo >> 28;
+				lo = m_lo;
+				hi = avalanche(m_hi);
+			}
+			else if (len)
+			{
+				const std::uint32_t combinedl = ((std::uint32_t)in[0] << 16) | ((std::uint32_t)in[len >> 1] << 24) | (std::uint32_t)in[len - 1] | ((std::uint32_t)len << 8);
+				const std::uint32_t swapped = swap32(combinedl);
+				const std::uint32_t combinedh = (swapped << 13) | (swapped >> 19);
+				lo = xxh64_avalanche((std::uint64_t)combinedl ^ (read32(s) ^ read32(s + 4)));
+				hi = xxh64_avalanche((std::uint64_t)combinedh ^ (read32(s + 8) ^ read32(s + 12)));
+			}
+			else
+			{
+				lo = xxh64_avalanche(read64(s + 64) ^ read64(s + 72));
+				hi = xxh64_avalanche(read64(s + 80) ^ read64(s + 88));
+			}
+			out[0] = hi;
+			out[1] = lo;
+		}
+
+		/*SSE2һδ64λͨ,汾һ*/
+		inline void accumulate_512(std::uint64_t acc[8], const unsigned char* in, const unsigned char* sec)
+		{
+			__m128i* xacc = reinterpret_cast<__m128i*>(acc);
+			for (size_t i = 0; i < 4; i++)
+			{
+				const __m128i data_vec = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in) + i);
+				const __m128i key_vec = _mm_loadu_si128(reinterpret_cast<const __m128i*>(sec) + i);
+				const __m128i data_key = _mm_xor_si128(data_vec, key_vec);
+				const __m128i data_key_lo = _mm_shuffle_epi32(data_key, _MM_SHUFFLE(0, 3, 0, 1));
+				const __m128i product = _mm_mul_epu32(data_key, data_key_lo);
+				const __m128i data_swap = _mm_shuffle_epi32(data_vec, _MM_SHUFFLE(1, 0, 3, 2));
+				const __m128i sum = _mm_add_epi64(_mm_load_si128(xacc + i), data_swap);
+				_mm_store_si128(xacc + i, _mm_add_epi64(product, sum));
+			}
+		}
+		inline void scramble(std::uint64_t acc[8], const unsigned char* sec)
+		{
+			__m128i* xacc = reinterpret_cast<__m128i*>(acc);
+			const __m128i prime32 = _mm_set1_epi32((int)P32_1);
+			for (size_t i = 0; i < 4; i++)
+			{
+				const __m128i acc_vec = _mm_load_si128(xacc + i);
+				const __m128i data_vec = _mm_xor_si128(acc_vec, _mm_srli_epi64(acc_vec, 47));
+				const __m128i key_vec = _mm_loadu_si128(reinterpret_cast<const __m128i*>(sec) + i);
+				const __m128i data_key = _mm_xor_si128(data_vec, key_vec);
+				const __m128i data_key_hi = _mm_shuffle_epi32(data_key, _MM_SHUFFLE(0, 3, 0, 1));
+				const __m128i prod_lo = _mm_mul_epu32(data_key, prime32);
+				const __m128i prod_hi = _mm_mul_epu32(data_key_hi, prime32);
+				_mm_store_si128(xacc + i, _mm_add_epi64(prod_lo, _mm_slli_epi64(prod_hi, 32)));
+			}
+		}
+		inline std::uint64_t merge_accs(const std::uint64_t acc[8], const unsigned char* sec, std::uint64_t start)
+		{
+			std::uint64_t result = start;
+			for (size_t i = 0; i < 4; i++)
+				result += mul128_fold64(acc[2 * i] ^ read64(sec + 16 * i), acc[2 * i + 1] ^ read64(sec + 16 * i + 8));
+			return avalanche(result);
+		}
+
+		/*
+		* ״̬.ֻں滹ʱе,
+		* һڻ(m_prev),һԼ"(len-1)/64"ֱһ.
+		*/
+		class state
+		{
+			alignas(16) std::uint64_t m_acc[8];
+			unsigned char m_buf[256];
+			unsigned char m_prev[STRIPE_LEN];
+			size_t m_buffered;
+			size_t m_stripes;
+			std::uint64_t m_total;
+
+			void consume(std::uint64_t acc[8], size_t& stripes, const unsigned char* in, size_t n) const
+			{
+				for (size_t i = 0; i < n; i++)
+				{
+					accumulate_512(acc, in + i * STRIPE_LEN, kSecret + stripes * 8);
+					if (++stripes == STRIPES_PER_BLOCK)
+					{
+						scramble(acc, kSecret + SECRET_SIZE - STRIPE_LEN);
+						stripes = 0;
+					}
+				}
+			}
+			void digest_long(std::uint64_t acc[8]) const
+			{
+				memcpy(acc, m_acc, sizeof(m_acc));
+				size_t stripes = m_stripes;
+				consume(acc, stripes, m_buf, (m_buffered - 1) / STRIPE_LEN);
+				unsigned char last[STRIPE_LEN];
+				if (m_buffered >= STRIPE_LEN)
+				{
+					memcpy(last, m_buf + m_buffered - STRIPE_LEN, STRIPE_LEN);
+				}
+				else
+				{
+					const size_t from_prev = STRIPE_LEN - m_buffered;
+					memcpy(last, m_prev + STRIPE_LEN - from_prev, from_prev);
+					memcpy(last + from_prev, m_buf, m_buffered);
+				}
+				accumulate_512(acc, last, kSecret + SECRET_SIZE - STRIPE_LEN - 7);
+			}
+		public:
+			state() { reset(); }
+			void reset()
+			{
+				static constexpr std::uint64_t init[8] = { P32_3, P64_1, P64_2, P64_3, P64_4, P32_2, P64_5, P32_1 };
+				memcpy(m_acc, init, sizeof(init));
+				m_buffered = 0;
+				m_stripes = 0;
+				m_total = 0;
+			}
+			void update(const unsigned char* in, size_t len)
+			{
+				if (!in || len == 0)
+					return;
+				m_total += len;
+				if (m_buffered + len <= sizeof(m_buf))
+				{
+					memcpy(m_buf + m_buffered, in, len);
+					m_buffered += len;
+					return;
+				}
+				if (m_buffered)
+				{
+					const size_t fill = sizeof(m_buf) - m_buffered;
+					memcpy(m_buf + m_buffered, in, fill);
+					in += fill;
+					len -= fill;
+					consume(m_acc, m_stripes, m_buf, sizeof(m_buf) / STRIPE_LEN);
+					memcpy(m_prev, m_buf + sizeof(m_buf) - STRIPE_LEN, STRIPE_LEN);
+					m_buffered = 0;
+				}
+				while (len > sizeof(m_buf))
+				{
+					consume(m_acc, m_stripes, in, sizeof(m_buf) / STRIPE_LEN);
+					memcpy(m_prev, in + sizeof(m_buf) - STRIPE_LEN, STRIPE_LEN);
+					in += sizeof(m_buf);
+					len -= sizeof(m_buf);
+				}
+				memcpy(m_buf, in, len);
+				m_buffered = len;
+			}
+			std::uint64_t digest64() const
+			{
+				if (m_total <= MIDSIZE_MAX)
+					return hash64_short(m_buf, (size_t)m_total);
+				alignas(16) std::uint64_t acc[8];
+				digest_long(acc);
+				return merge_accs(acc, kSecret + 11, m_total * P64_1);
+			}
+			void digest128(std::uint64_t out[2]) const
+			{
+				if (m_total <= MIDSIZE_MAX)
+				{
+					hash128_short(m_buf, (size_t)m_total, out);
+					return;
+				}
+				alignas(16) std::uint64_t acc[8];
+				digest_long(acc);
+				out[1] = merge_accs(acc, kSecret + 11, m_total * P64_1);
+				out[0] = merge_accs(acc, kSecret + SECRET_SIZE - sizeof(acc) - 11, ~(m_total * P64_2));
+			}
+		};
+	}
+
+	class xxh3_hasher : public elibstl::hash::hasher
+	{
+		xxh3::state m_state;
+		bool m_128;
+	public:
+		explicit xxh3_hasher(bool is128) : m_128(is128) {}
+		void update(const unsigned char* data, size_t size) override { m_state.update(data, size); }
+		std::vector<unsigned char> final() override
+		{
+			std::vector<unsigned char> ret(digest_size());
+			if (m_128)
+			{
+				std::uint64_t h[2];
+				m_state.digest128(h);
+				store_be64(ret.data(), h[0]);
+				store_be64(ret.data() + 8, h[1]);
+			}
+			else
+			{
+				store_be64(ret.data(), m_state.digest64());
+			}
+			return ret;
+		}
+		void reset() override { m_state.reset(); }
+		hasher* clone() const override { return new xxh3_hasher(*this); }
+		size_t digest_size() const override { return m_128 ? 16 : 8; }
+	};
+#pragma endregion
+}
+
+namespace elibstl {
+	namespace hash {
+		std::uint32_t crc32(std::uint32_t crc, const unsigned char* data, size_t size)
+		{
+			if (!data || size == 0)
+				return crc;
+			crc = ~crc;
+			if (size >= 64 && cpu().pclmul && cpu().sse41)
+			{
+				const size_t chunk = size & ~size_t(15);
+				crc = crc32_pclmul(crc, data, chunk);
+				data += chunk;
+				size -= chunk;
+			}
+			return ~crc32_table().update(crc, data, size);
+		}
+		std::uint32_t crc32c(std::uint32_t crc, const unsigned char* data, size_t size)
+		{
+			if (!data || size == 0)
+				return crc;
+			if (cpu().sse42)
+				return ~crc32c_sse42(~crc, data, size);
+			return ~crc32c_table().update(~crc, data, size);
+		}
+		bool is_valid_algorithm(int alg)
+		{
+			return alg >= static_cast<int>(algorithm::md5) && alg <= static_cast<int>(algorithm::xxh3_128);
+		}
+		hasher* create_hasher(algorithm alg)
+		{
+			switch (alg)
+			{
+			case algorithm::md5:
+				return create_md5_hasher();
+			case algorithm::sha1:
+				return new sha1_hasher;
+			case algorithm::sha256:
+				return new sha256_hasher;
+			case algorithm::crc32:
+				return new crc_hasher(false);
+			case algorithm::crc32c:
+				return new crc_hasher(true);
+			case algorithm::xxh3_64:
+				return new xxh3_hasher(false);
+			case algorithm::xxh3_128:
+				return new xxh3_hasher(true);
+			default:
+				return nullptr;
+			}
+		}
+		std::vector<unsigned char> hash_data(algorithm alg, const unsigned char* data, size_t size)
+		{
+			std::unique_ptr<hasher> h(create_hasher(alg));
+			if (!h)
+				return {};
+			h->update(data, size);
+			return h->final();
+		}
+		std::wstring to_hex(const std::vector<unsigned char>& digest)
+		{
+			static constexpr wchar_t hex[] = L"0123456789abcdef";
+			std::wstring ret;
+			ret.reserve(digest.size() * 2);
+			for (auto c : digest)
+			{
+				ret.push_back(hex[c >> 4]);
+				ret.push_back(hex[c & 0xf]);
+			}
+			return ret;
+		}
+	}
+}
+
+namespace {
+	elibstl::hash::algorithm arg_to_algorithm(const MDATA_INF& arg)
+	{
+		return elibstl::hash::is_valid_algorithm(arg.m_int) ? static_cast<elibstl::hash::algorithm>(arg.m_int) : elibstl::hash::algorithm::sha256;
+	}
+}
+
+#define ESTL_HASH_ALG_EXPLAIN "1MD52SHA13SHA2564CRC325CRC32C6XXH3_647XXH3_128ֵΪ3"
+
+static ARG_INFO Args_Hash[] =
+{
+	{
+		/*name*/    "",
+		/*explain*/ ("ϣֵ"),
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    DATA_TYPE::SDT_BIN,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_NONE
+	},
+	{
+		/*name*/    "㷨",
+		/*explain*/ (ESTL_HASH_ALG_EXPLAIN),
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    DATA_TYPE::SDT_INT,
+		/*default*/ 3,
+		/*state*/   ArgMark::AS_HAS_DEFAULT_VALUE
+	}
+};
+EXTERN_C void fn_eStl_GetHashW(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto data = elibstl::args_to_ebin(pArgInf, 0);
+	const auto digest = elibstl::hash::hash_data(arg_to_algorithm(pArgInf[1]), data ? data->m_data : nullptr, data ? data->m_size : 0);
+	pRetData->m_pBin = elibstl::clone_textw(elibstl::hash::to_hex(digest));
+}
+FucInfo Fn_eStl_GetHashW = { {
+		/*ccname*/  ("ȡݹϣW"),
+		/*egname*/  ("get_hash_str"),
+		/*explain*/ ("ָ㷨Ĺϣֵʮı(Сд,ֽ,볣ùһ)SHA1/SHA256֧SHAչָCPUϡCRC32֧PCLMULQDQCPUϡCRC32C֧SSE4.2CPUϻԶʹӲ١"),
+		/*category*/17,
+		/*state*/   NULL,
+		/*ret*/     DATA_TYPE::SDT_BIN,
+		/*reserved*/NULL,
+		/*level*/   LVL_HIGH,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+	ESTLARG(Args_Hash)
+	} ,ESTLFNAME(fn_eStl_GetHashW) };
+
+static ARG_INFO Args_HashArray[] =
+{
+	{
+		/*name*/    "",
+		/*explain*/ ("ϣֵֽڼ"),
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    DATA_TYPE::SDT_BIN,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_RECEIVE_ARRAY_DATA
+	},
+	{
+		/*name*/    "㷨",
+		/*explain*/ (ESTL_HASH_ALG_EXPLAIN),
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    DATA_TYPE::SDT_INT,
+		/*default*/ 3,
+		/*state*/   ArgMark::AS_HAS_DEFAULT_VALUE
+	}
+};
+EXTERN_C void fn_eStl_GetHashArrayW(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	size_t count = 0;
+	LPBYTE* pAryData = elibstl::get_array_element_inf<LPBYTE*>(pArgInf[0].m_pAryData, &count);
+	if (count == 0)
+	{
+		pRetData->m_pAryData = elibstl::empty_array();
+		return;
+	}
+	const auto alg = arg_to_algorithm(pArgInf[1]);
+	std::vector<std::wstring> ret(count);
+	auto work = [&](size_t begin, size_t end) {
+		std::unique_ptr<elibstl::hash::hasher> h(elibstl::hash::create_hasher(alg));
+		for (size_t i = begin; i < end; i++)
+		{
+			h->reset();
+			if (pAryData[i])
+				h->update(pAryData[i] + sizeof(INT) * 2, *reinterpret_cast<INT*>(pAryData[i] + sizeof(INT)));
+			ret[i] = elibstl::hash::to_hex(h->final());
+		}
+	};
+	/*Աʱ̵߳òʧ*/
+	size_t threads = (std::min)<size_t>((std::max)(1u, std::thread::hardware_concurrency()), count / 64 + 1);
+	if (threads <= 1)
+	{
+		work(0, count);
+	}
+	else
+	{
+		std::vector<std::thread> pool;
+		const size_t step = (count + threads - 1) / threads;
+		for (size_t begin = 0; begin < count; begin += step)
+			pool.emplace_back(work, begin, (std::min)(begin + step, count));
+		for (auto& t : pool)
+			t.join();
+	}
+	pRetData->m_pAryData = elibstl::create_text_array(ret);
+}
+FucInfo Fn_eStl_GetHashArrayW = { {
+		/*ccname*/  ("ȡݹϣW"),
+		/*egname*/  ("get_hash_str_array"),
+		/*explain*/ ("ֽڼÿԱĹϣֵı,˳һ¡Ա϶ʱ䵽߳ͬʱ㡣"),
+		/*category*/17,
+		/*state*/   CT_RETRUN_ARY_TYPE_DATA,
+		/*ret*/     DATA_TYPE::SDT_BIN,
+		/*reserved*/NULL,
+		/*level*/   LVL_HIGH,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+	ESTLARG(Args_HashArray)
+	} ,ESTLFNAME(fn_eStl_GetHashArrayW) };
+
+
+
+using elibstl::hash::hasher;
+/*δʼʱSHA256*/
+static hasher* get_hasher(PMDATA_INF pArgInf)
+{
+	auto& self = elibstl::args_to_obj<hasher>(pArgInf);
+	if (!self)
+		self = elibstl::hash::create_hasher(elibstl::hash::algorithm::sha256);
+	return self;
+}
+
+//
+EXTERN_C void fn_hasher_structure(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto& self = elibstl::args_to_obj<hasher>(pArgInf);
+	self = elibstl::hash::create_hasher(elibstl::hash::algorithm::sha256);
+}
+FucInfo Fn_hasher_structure = { {
+		/*ccname*/  "",
+		/*egname*/  "",
+		/*explain*/ NULL,
+		/*category*/ -1,
+		/*state*/  _CMD_OS(__OS_WIN) | CT_IS_HIDED | CT_IS_OBJ_CONSTURCT_CMD,
+		/*ret*/ _SDT_NULL,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*ArgCount*/0,
+		/*arg lp*/  NULL,
+	} ,ESTLFNAME(fn_hasher_structure) };
+
+static ARG_INFO s_CopyArgs[] =
+{
+	{
+		/*name*/    "",
+		/*explain*/ "",
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/	(DATA_TYPE)28,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_DEFAULT_VALUE_IS_EMPTY,
+	}
+};
+//
+EXTERN_C void fn_hasher_copy(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto& self = elibstl::classhelp::get_this<hasher>(pArgInf);
+	const auto& rht = elibstl::classhelp::get_other<hasher>(pArgInf);
+	self = rht ? rht->clone() : nullptr;
+}
+FucInfo Fn_hasher_copy = { {
+		/*ccname*/  "",
+		/*egname*/  "",
+		/*explain*/ NULL,
+		/*category*/ -1,
+		/*state*/   _CMD_OS(__OS_WIN) | CT_IS_HIDED | CT_IS_OBJ_COPY_CMD,
+		/*ret*/ _SDT_NULL,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*ArgCount*/1,
+		/*arg lp*/  s_CopyArgs,
+	} ,ESTLFNAME(fn_hasher_copy) };
+
+//
+EXTERN_C void fn_hasher_destruct(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto& self = elibstl::args_to_obj<hasher>(pArgInf);
+	delete self;
+	self = nullptr;
+}
+FucInfo Fn_hasher_destruct = { {
+		/*ccname*/  "",
+		/*egname*/  "",
+		/*explain*/ NULL,
+		/*category*/ -1,
+		/*state*/    _CMD_OS(__OS_WIN) | CT_IS_HIDED | CT_IS_OBJ_FREE_CMD,
+		/*ret*/ _SDT_NULL,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*ArgCount*/0,
+		/*arg lp*/  NULL,
+	} ,ESTLFNAME(fn_hasher_destruct) };
+
+static ARG_INFO Args_HasherInit[] =
+{
+	{
+		/*name*/    "㷨",
+		/*explain*/ ("1MD52SHA13SHA2564CRC325CRC32C6XXH3_647XXH3_128"),
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    DATA_TYPE::SDT_INT,
+		/*default*/ 3,
+		/*state*/   ArgMark::AS_HAS_DEFAULT_VALUE
+	}
+};
+EXTERN_C void fn_hasher_init(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto& self = elibstl::args_to_obj<hasher>(pArgInf);
+	if (!elibstl::hash::is_valid_algorithm(pArgInf[1].m_int))
+	{
+		pRetData->m_bool = FALSE;
+		return;
+	}
+	delete self;
+	self = elibstl::hash::create_hasher(static_cast<elibstl::hash::algorithm>(pArgInf[1].m_int));
+	pRetData->m_bool = TRUE;
+}
+FucInfo Fn_hasher_init = { {
+		/*ccname*/  "ʼ",
+		/*egname*/  "init",
+		/*explain*/ "ѡϣ㷨ѼݡδñʱĬʹSHA256㷨Чʱؼ,ԭ״̬䡣",
+		/*category*/ -1,
+		/*state*/    _CMD_OS(__OS_WIN) ,
+		/*ret*/ SDT_BOOL,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		ESTLARG(Args_HasherInit)
+	} ,ESTLFNAME(fn_hasher_init) };
+
+static ARG_INFO Args_HasherUpdate[] =
+{
+	{
+		/*name*/    "",
+		/*explain*/ ("׷Ӽ,һṩ"),
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    DATA_TYPE::SDT_BIN,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_NONE
+	}
+};
+EXTERN_C void fn_hasher_update(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto self = get_hasher(pArgInf);
+	for (INT i = 1; i < nArgCount; i++)
+	{
+		auto data = elibstl::args_to_ebin(pArgInf, i);
+		if (data)
+		{
+			self->update(data->m_data, data->m_size);
+		}
+	}
+}
+FucInfo Fn_hasher_update = { {
+		/*ccname*/  "",
+		/*egname*/  "update",
+		/*explain*/ "׷ӵϣ,ɷֶμ,һԼȫͬ",
+		/*category*/ -1,
+		/*state*/    CT_ALLOW_APPEND_NEW_ARG | _CMD_OS(__OS_WIN) ,
+		/*ret*/ _SDT_NULL,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		ESTLARG(Args_HasherUpdate)
+	} ,ESTLFNAME(fn_hasher_update) };
+
+EXTERN_C void fn_hasher_final(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto digest = get_hasher(pArgInf)->final();
+	pRetData->m_pBin = elibstl::clone_bin(digest.data(), digest.size());
+}
+FucInfo Fn_hasher_final = { {
+		/*ccname*/  "ȡժҪ",
+		/*egname*/  "final",
+		/*explain*/ "ĿǰΪֹȫݵԭʼϣֵ(ֽ)ȡӰڲ״̬,֮Կɼݡ",
+		/*category*/ -1,
+		/*state*/    _CMD_OS(__OS_WIN) ,
+		/*ret*/ SDT_BIN,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*ArgCount*/0,
+		/*arg lp*/  0,
+	} ,ESTLFNAME(fn_hasher_final) };
+
+EXTERN_C void fn_hasher_final_str(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	pRetData->m_pBin = elibstl::clone_textw(elibstl::hash::to_hex(get_hasher(pArgInf)->final()));
+}
+FucInfo Fn_hasher_final_str = { {
+		/*ccname*/  "ȡժҪı",
+		/*egname*/  "final_str",
+		/*explain*/ "ĿǰΪֹȫݵĹϣֵʮı",
+		/*category*/ -1,
+		/*state*/    _CMD_OS(__OS_WIN) ,
+		/*ret*/ SDT_BIN,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*ArgCount*/0,
+		/*arg lp*/  0,
+	} ,ESTLFNAME(fn_hasher_final_str) };
+
+EXTERN_C void fn_hasher_reset(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	get_hasher(pArgInf)->reset();
+}
+FucInfo Fn_hasher_reset = { {
+		/*ccname*/  "",
+		/*egname*/  "reset",
+		/*explain*/ "Ѽ,㷨ֲ䡣",
+		/*category*/ -1,
+		/*state*/    _CMD_OS(__OS_WIN) ,
+		/*ret*/ _SDT_NULL,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*ArgCount*/0,
+		/*arg lp*/  0,
+	} ,ESTLFNAME(fn_hasher_reset) };
+
+static INT s_dtCmdIndexcommobj_hasher[] = { 376,377,378,379,380,381,382,383 };
+namespace elibstl {
+
+
+	LIB_DATA_TYPE_INFO Obj_Hasher =
+	{
+		"ϣ",
+		"Hasher",
+		"ɷֶμݵͨùϣ,֧MD5SHA1SHA256CRC32CRC32CXXH3",
+		sizeof(s_dtCmdIndexcommobj_hasher) / sizeof(s_dtCmdIndexcommobj_hasher[0]),
+		 s_dtCmdIndexcommobj_hasher,
+		_DT_OS(__OS_WIN),
+		0,
+		NULL,
+		NULL,
+		NULL,
+		NULL,
+		NULL,
+		0,
+		0
+	};
+}
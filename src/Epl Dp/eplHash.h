@@ -0,0 +1,50 @@
+#pragma once
+#include<cstdint>
+#include<string>
+#include<vector>
+
+/*
+* ݴõĹϣ/Уӿ.
+* 㷨ʵͬһӿ:update׷,finalȡ(ıڲ״̬,ɼ׷),reset¿ʼ.
+* ͳһΪֽֽ,볣ʮıһ.
+*/
+namespace elibstl {
+	namespace hash {
+		enum class algorithm : int
+		{
+			md5 = 1,
+			sha1,
+			sha256,
+			crc32,
+			crc32c,
+			xxh3_64,
+			xxh3_128,
+		};
+
+		class hasher
+		{
+		public:
+			virtual ~hasher() = default;
+			virtual void update(const unsigned char* data, size_t size) = 0;
+			virtual std::vector<unsigned char> final() = 0;
+			virtual void reset() = 0;
+			virtual hasher* clone() const = 0;
+			virtual size_t digest_size() const = 0;
+		};
+
+		/*ָ㷨ļ,㷨Чʱnullptr,ɵdelete*/
+		hasher* create_hasher(algorithm alg);
+		/*MD5ʵeplMD5.cpp*/
+		hasher* create_md5_hasher();
+		bool is_valid_algorithm(int alg);
+
+		/*һԼ*/
+		std::vector<unsigned char> hash_data(algorithm alg, const unsigned char* data, size_t size);
+		std::wstring to_hex(const std::vector<unsigned char>& digest);
+
+		/*zlibcrc32(),crcһεĽ,״δ0*/
+		std::uint32_t crc32(std::uint32_t crc, const unsigned char* data, size_t size);
+		/*Castagnoliʽ,÷ͬ*/
+		std::uint32_t crc32c(std::uint32_t crc, const unsigned char* data, size_t size);
+	}
+}
@@ -0,0 +1,302 @@
+#include"ElibHelp.h"
+#include"eplHash.h"
+#include<thread>
+#include<mutex>
+#include<condition_variable>
+#include<atomic>
+#include<memory>
+#include<algorithm>
+
+namespace {
+	/*Сڴ˴Сļӳ,İȡ,32λ̵ַռ䲻*/
+	constexpr ULONGLONG kMapThreshold = 64ull << 20;
+	/*ļÿζȡĿС,ΪСԱʹ޻ȡ*/
+	constexpr DWORD kChunkSize = 1u << 20;
+	/*߳ͬʱռõӳ/ֽ*/
+	constexpr ULONGLONG kMaxInflight = 256ull << 20;
+
+	/*ֽ޶,ֹļͬʱӳڴ͵ַռռ*/
+	class inflight_budget
+	{
+		std::mutex m_lock;
+		std::condition_variable m_cv;
+		ULONGLONG m_used = 0;
+	public:
+		void acquire(ULONGLONG n)
+		{
+			std::unique_lock<std::mutex> lock(m_lock);
+			/*󳬹ʱֻҪûռþͷ*/
+			m_cv.wait(lock, [&] { return m_used == 0 || m_used + n <= kMaxInflight; });
+			m_used += n;
+		}
+		void release(ULONGLONG n)
+		{
+			{
+				std::lock_guard<std::mutex> lock(m_lock);
+				m_used -= n;
+			}
+			m_cv.notify_all();
+		}
+	};
+
+	class file_handle
+	{
+		HANDLE m_h;
+	public:
+		explicit file_handle(HANDLE h) : m_h(h) {}
+		~file_handle() { if (m_h != INVALID_HANDLE_VALUE && m_h != NULL) CloseHandle(m_h); }
+		file_handle(const file_handle&) = delete;
+		file_handle& operator=(const file_handle&) = delete;
+		HANDLE get() const { return m_h; }
+		bool valid() const { return m_h != INVALID_HANDLE_VALUE && m_h != NULL; }
+	};
+
+	/*ļӳڼ䱻ضϵᴥҳ,ȡʧܴ.__tryںҪĶ,ʵ*/
+	bool update_guarded(elibstl::hash::hasher& h, const unsigned char* data, size_t size)
+	{
+		__try
+		{
+			h.update(data, size);
+			return true;
+		}
+		__except (GetExceptionCode() == EXCEPTION_IN_PAGE_ERROR ? EXCEPTION_EXECUTE_HANDLER : EXCEPTION_CONTINUE_SEARCH)
+		{
+			return false;
+		}
+	}
+
+	bool hash_mapped(HANDLE hFile, ULONGLONG size, elibstl::hash::hasher& h)
+	{
+		if (size == 0)
+			return true;
+		file_handle mapping(CreateFileMappingW(hFile, NULL, PAGE_READONLY, 0, 0, NULL));
+		if (!mapping.valid())
+			return false;
+		const void* view = MapViewOfFile(mapping.get(), FILE_MAP_READ, 0, 0, static_cast<SIZE_T>(size));
+		if (!view)
+			return false;
+		const bool ok = update_guarded(h, static_cast<const unsigned char*>(view), static_cast<size_t>(size));
+		UnmapViewOfFile(view);
+		return ok;
+	}
+
+	bool hash_chunked(HANDLE hFile, unsigned char* buffer, elibstl::hash::hasher& h)
+	{
+		DWORD read = 0;
+		do
+		{
+			if (!ReadFile(hFile, buffer, kChunkSize, &read, NULL))
+				return false;
+			h.update(buffer, read);
+		} while (read == kChunkSize);
+		return true;
+	}
+
+	/*ʧܷؿı*/
+	std::wstring hash_file(const std::wstring& path, elibstl::hash::algorithm alg, unsigned char* buffer, inflight_budget& budget)
+	{
+		std::unique_ptr<elibstl::hash::hasher> h(elibstl::hash::create_hasher(alg));
+		file_handle file(CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, NULL, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL));
+		if (!file.valid())
+			return {};
+		LARGE_INTEGER size{};
+		if (!GetFileSizeEx(file.get(), &size))
+			return {};
+		const ULONGLONG total = static_cast<ULONGLONG>(size.QuadPart);
+		bool ok;
+		if (total < kMapThreshold)
+		{
+			budget.acquire(total);
+			ok = hash_mapped(file.get(), total, *h);
+			budget.release(total);
+		}
+		else
+		{
+			/*ļƹϵͳ,ɨļʱĻ漷;VirtualAlloc,*/
+			file_handle direct(CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, NULL, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN | FILE_FLAG_NO_BUFFERING, NULL));
+			budget.acquire(kChunkSize);
+			ok = hash_chunked(direct.valid() ? direct.get() : file.get(), buffer, *h);
+			budget.release(kChunkSize);
+		}
+		return ok ? elibstl::hash::to_hex(h->final()) : std::wstring();
+	}
+
+	std::vector<std::wstring> hash_files(const std::vector<std::wstring>& files, elibstl::hash::algorithm alg)
+	{
+		std::vector<std::wstring> ret(files.size());
+		if (files.empty())
+			return ret;
+		inflight_budget budget;
+		std::atomic<size_t> next{ 0 };
+		auto work = [&]() {
+			auto buffer = static_cast<unsigned char*>(VirtualAlloc(NULL, kChunkSize, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE));
+			if (!buffer)
+				return;
+			for (size_t i = next++; i < files.size(); i = next++)
+			{
+				ret[i] = hash_file(files[i], alg, buffer, budget);
+			}
+			VirtualFree(buffer, 0, MEM_RELEASE);
+		};
+		/*ʱ仨ڵȴ,߳ںöȡŶӸ*/
+		const size_t threads = (std::min)(files.size(), static_cast<size_t>((std::max)(2u, std::thread::hardware_concurrency() * 2)));
+		std::vector<std::thread> pool;
+		for (size_t i = 1; i < threads; i++)
+			pool.emplace_back(work);
+		work();
+		for (auto& t : pool)
+			t.join();
+		return ret;
+	}
+
+	void collect_files(const std::wstring& dir, bool recursive, std::vector<std::wstring>& out)
+	{
+		WIN32_FIND_DATAW findData;
+		HANDLE hFind = FindFirstFileExW((dir + L"\\*").c_str(), FindExInfoBasic, &findData, FindExSearchNameMatch, NULL, FIND_FIRST_EX_LARGE_FETCH);
+		if (hFind == INVALID_HANDLE_VALUE)
+			return;
+		do
+		{
+			if (!wcscmp(findData.cFileName, L".") || !wcscmp(findData.cFileName, L".."))
+				continue;
+			std::wstring path = dir + L"\\" + findData.cFileName;
+			if (findData.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY)
+			{
+				/*Ŀ¼,ѭ*/
+				if (recursive && !(findData.dwFileAttributes & FILE_ATTRIBUTE_REPARSE_POINT))
+					collect_files(path, recursive, out);
+			}
+			else
+			{
+				out.push_back(std::move(path));
+			}
+		} while (FindNextFileW(hFind, &findData));
+		FindClose(hFind);
+	}
+
+	elibstl::hash::algorithm arg_to_algorithm(const MDATA_INF& arg)
+	{
+		return elibstl::hash::is_valid_algorithm(arg.m_int) ? static_cast<elibstl::hash::algorithm>(arg.m_int) : elibstl::hash::algorithm::sha256;
+	}
+}
+
+static ARG_INFO Args_Dir[] =
+{
+	{
+		/*name*/    "Ŀ¼",
+		/*explain*/ ("Ŀ¼"),
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_BIN,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_NONE,
+	},
+	{
+		/*name*/    "㷨",
+		/*explain*/ ("1MD52SHA13SHA2564CRC325CRC32C6XXH3_647XXH3_128ֵΪ3"),
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_INT,
+		/*default*/ 3,
+		/*state*/   ArgMark::AS_HAS_DEFAULT_VALUE,
+	},
+	{
+		/*name*/    "Ŀ¼",
+		/*explain*/ ("ǷͬʱĿ¼еļ,Ŀ¼"),
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_BOOL,
+		/*default*/ TRUE,
+		/*state*/   ArgMark::AS_HAS_DEFAULT_VALUE,
+	},
+	{
+		/*name*/    "ļ",
+		/*explain*/ ("ڽÿϣֵӦļ,Ա˳뷵ֵһ"),
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_BIN,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_RECEIVE_VAR_ARRAY,
+	}
+};
+
+EXTERN_C void Fn_hash_dir_W(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	std::wstring dir(elibstl::args_to_wsdata(pArgInf, 0));
+	while (!dir.empty() && (dir.back() == L'\\' || dir.back() == L'/'))
+		dir.pop_back();
+	std::vector<std::wstring> files;
+	if (!dir.empty())
+		collect_files(dir, pArgInf[2].m_bool != FALSE, files);
+	/*·,ļϵͳö˳̵߳޹*/
+	std::sort(files.begin(), files.end());
+	const auto digests = hash_files(files, arg_to_algorithm(pArgInf[1]));
+	elibstl::free_text_array_var(pArgInf[3].m_ppAryData);
+	*pArgInf[3].m_ppAryData = elibstl::create_text_array(files);
+	pRetData->m_pAryData = elibstl::create_text_array(digests);
+}
+
+FucInfo hash_dir_W = { {
+		/*ccname*/  ("ȡĿ¼ļϣW"),
+		/*egname*/  (""),
+		/*explain*/ ("Ŀ¼ÿļĹϣֵ,عϣֵı,޷ȡļӦıļ·,εý˳һ¡ڲʹڴӳͶ̶߳ȡ,Զļ㡣"),
+		/*category*/4,
+		/*state*/   CT_RETRUN_ARY_TYPE_DATA,
+		/*ret*/     SDT_BIN,
+		/*reserved*/NULL,
+		/*level*/   LVL_HIGH,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*ArgCount*/sizeof(Args_Dir) / sizeof(Args_Dir[0]),
+		/*arg lp*/  &Args_Dir[0],
+	} ,Fn_hash_dir_W ,"Fn_hash_dir_W" };
+
+static ARG_INFO Args_Files[] =
+{
+	{
+		/*name*/    "ļ",
+		/*explain*/ ("ļ"),
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_BIN,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_RECEIVE_ARRAY_DATA,
+	},
+	{
+		/*name*/    "㷨",
+		/*explain*/ ("1MD52SHA13SHA2564CRC325CRC32C6XXH3_647XXH3_128ֵΪ3"),
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_INT,
+		/*default*/ 3,
+		/*state*/   ArgMark::AS_HAS_DEFAULT_VALUE,
+	}
+};
+
+EXTERN_C void Fn_hash_files_W(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	size_t count = 0;
+	LPBYTE* pAryData = elibstl::get_array_element_inf<LPBYTE*>(pArgInf[0].m_pAryData, &count);
+	std::vector<std::wstring> files(count);
+	for (size_t i = 0; i < count; i++)
+	{
+		if (pAryData[i] && *reinterpret_cast<INT*>(pAryData[i] + sizeof(INT)) >= static_cast<INT>(sizeof(wchar_t)))
+			files[i] = reinterpret_cast<const wchar_t*>(pAryData[i] + sizeof(INT) * 2);
+	}
+	pRetData->m_pAryData = elibstl::create_text_array(hash_files(files, arg_to_algorithm(pArgInf[1])));
+}
+
+FucInfo hash_files_W = { {
+		/*ccname*/  ("ȡļϣW"),
+		/*egname*/  (""),
+		/*explain*/ ("ļÿļĹϣֵ,عϣֵı,˳һ,޷ȡļӦı"),
+		/*category*/4,
+		/*state*/   CT_RETRUN_ARY_TYPE_DATA,
+		/*ret*/     SDT_BIN,
+		/*reserved*/NULL,
+		/*level*/   LVL_HIGH,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*ArgCount*/sizeof(Args_Files) / sizeof(Args_Files[0]),
+		/*arg lp*/  &Args_Files[0],
+	} ,Fn_hash_files_W ,"Fn_hash_files_W" };
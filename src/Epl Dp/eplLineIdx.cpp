@@ -0,0 +1,745 @@
+#include"ElibHelp.h"
+#include"eplLineIdx.h"
+#include"../Disk Processing/eplFileIO.h"
+#include<algorithm>
+#include<cstring>
+#include<functional>
+#include<climits>
+#include<thread>
+#if defined(_M_IX86) || defined(_M_X64)
+#include<intrin.h>
+#endif
+
+namespace {
+	using elibstl::mmap::mapped_file;
+
+	/*ļͷ,֮count8ֽƫ*/
+	struct sidecar_header
+	{
+		char magic[4];
+		std::uint32_t version;
+		std::uint64_t scanned;
+		std::uint64_t count;
+		std::uint64_t fingerprint;
+	};
+	constexpr char kSidecarMagic[4] = { 'E', 'L', 'I', 'X' };
+	constexpr std::uint32_t kSidecarVersion = 1;
+	/*Уʱȡͷĩβôֽ*/
+	constexpr size_t kFingerprintBytes = 4096;
+	/*ÿmapped_file󳤶,ʵʷصĳܴ*/
+	constexpr size_t kViewStep = 256 * 1024 * 1024;
+
+	/*p[0,n)ÿ\n֮ƫ(base+±+1)׷ӵout*/
+	void find_breaks(const unsigned char* p, size_t n, std::uint64_t base, std::vector<std::uint64_t>& out)
+	{
+		size_t i = 0;
+#if defined(_M_IX86) || defined(_M_X64)
+		const __m128i lf = _mm_set1_epi8('\n');
+		for (; i + 32 <= n; i += 32)
+		{
+			const __m128i lo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+			const __m128i hi = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i + 16));
+			unsigned long mask = static_cast<unsigned long>(_mm_movemask_epi8(_mm_cmpeq_epi8(lo, lf)))
+				| (static_cast<unsigned long>(_mm_movemask_epi8(_mm_cmpeq_epi8(hi, lf))) << 16);
+			while (mask != 0)
+			{
+				unsigned long bit;
+				_BitScanForward(&bit, mask);
+				out.push_back(base + i + bit + 1);
+				mask &= mask - 1;
+			}
+		}
+#endif
+		for (; i < n; i++)
+		{
+			if (p[i] == '\n')
+				out.push_back(base + i + 1);
+		}
+	}
+
+	bool scan_range(mapped_file& file, std::uint64_t from, std::uint64_t to, std::vector<std::uint64_t>& out)
+	{
+		while (from < to)
+		{
+			size_t length = static_cast<size_t>((std::min<std::uint64_t>)(to - from, kViewStep));
+			const unsigned char* p = file.view(from, length);
+			if (p == nullptr || length == 0)
+				return false;
+			find_breaks(p, length, from, out);
+			from += length;
+		}
+		return true;
+	}
+
+	/*FNV-1a*/
+	std::uint64_t hash_bytes(std::uint64_t hash, const unsigned char* p, size_t n)
+	{
+		for (size_t i = 0; i < n; i++)
+		{
+			hash ^= p[i];
+			hash *= 0x100000001b3ull;
+		}
+		return hash;
+	}
+}
+
+namespace elibstl {
+	namespace lineidx {
+		bool line_index::open(const path_type& path, const path_type& sidecar, unsigned threads)
+		{
+			close();
+			m_path = path;
+			m_sidecar = sidecar;
+			m_threads = threads != 0 ? threads : (std::max)(1u, std::thread::hardware_concurrency());
+			if (!map_file())
+				return false;
+			if (!sidecar.empty() && load(sidecar))
+			{
+				if (m_scanned < m_file.size())
+				{
+					if (!scan(m_scanned, m_file.size(), m_breaks))
+					{
+						close();
+						return false;
+					}
+					m_scanned = m_file.size();
+					m_fingerprint = fingerprint(m_scanned);
+					m_dirty = true;
+				}
+			}
+			else if (!rebuild())
+			{
+				close();
+				return false;
+			}
+			if (m_dirty && !m_sidecar.empty())
+				save(m_sidecar);
+			return true;
+		}
+
+		void line_index::close()
+		{
+			if (m_dirty && !m_sidecar.empty() && m_file.is_open())
+				save(m_sidecar);
+			m_file.close();
+			m_breaks.clear();
+			m_breaks.shrink_to_fit();
+			m_scanned = 0;
+			m_fingerprint = 0;
+			m_dirty = false;
+		}
+
+		bool line_index::refresh(std::uint64_t* grown)
+		{
+			if (grown)
+				*grown = 0;
+			if (!m_file.is_open())
+				return false;
+			const auto size = fileio::file_size(m_path);
+			if (size < 0)
+				return false;
+			if (static_cast<std::uint64_t>(size) == m_scanned)
+				return true;
+			const auto before = line_count();
+			/*ӳĳߴڴʱ̶,ӳܿ*/
+			if (!map_file())
+				return false;
+			if (m_file.size() < m_scanned || fingerprint(m_scanned) != m_fingerprint)
+			{
+				if (!rebuild())
+					return false;
+				if (grown)
+					*grown = line_count();
+				return true;
+			}
+			if (!scan(m_scanned, m_file.size(), m_breaks))
+				return false;
+			m_scanned = m_file.size();
+			m_fingerprint = fingerprint(m_scanned);
+			m_dirty = true;
+			if (grown)
+				*grown = line_count() - before;
+			return true;
+		}
+
+		std::uint64_t line_index::line_count() const
+		{
+			const std::uint64_t last = m_breaks.empty() ? 0 : m_breaks.back();
+			/*һûлзʱҲһ*/
+			return m_breaks.size() + (m_scanned > last ? 1 : 0);
+		}
+
+		bool line_index::line_range(std::uint64_t line, std::uint64_t& begin, std::uint64_t& end)
+		{
+			if (line >= line_count())
+				return false;
+			begin = line == 0 ? 0 : m_breaks[static_cast<size_t>(line - 1)];
+			if (line < m_breaks.size())
+			{
+				end = m_breaks[static_cast<size_t>(line)] - 1;
+				unsigned char prev;
+				if (end > begin && m_file.read(end - 1, prev) && prev == '\r')
+					end--;
+			}
+			else
+				end = m_scanned;
+			return true;
+		}
+
+		const unsigned char* line_index::line_view(std::uint64_t line, size_t& length)
+		{
+			static const unsigned char empty = 0;
+			length = 0;
+			std::uint64_t begin, end;
+			if (!line_range(line, begin, end) || end - begin > SIZE_MAX)
+				return nullptr;
+			if (begin == end)
+				return &empty;
+			size_t got = static_cast<size_t>(end - begin);
+			const unsigned char* p = m_file.view(begin, got);
+			if (p == nullptr || got != end - begin)
+				return nullptr;
+			length = got;
+			return p;
+		}
+
+		bool line_index::get_line(std::uint64_t line, std::string& out)
+		{
+			out.clear();
+			std::uint64_t begin, end;
+			if (!line_range(line, begin, end) || end - begin > out.max_size())
+				return false;
+			out.resize(static_cast<size_t>(end - begin));
+			return out.empty() || m_file.read(begin, &out[0], out.size());
+		}
+
+		bool line_index::get_lines(std::uint64_t first, std::uint64_t count, std::vector<std::string>& out)
+		{
+			out.clear();
+			const auto total = line_count();
+			if (first >= total || count == 0)
+				return first <= total;
+			const auto last = first + (std::min)(count, total - first) - 1;
+			std::uint64_t begin, end, unused;
+			if (!line_range(first, begin, unused) || !line_range(last, unused, end) || end - begin > SIZE_MAX)
+				return false;
+			/*һζ,ٰз*/
+			std::string block(static_cast<size_t>(end - begin), '\0');
+			if (!block.empty() && !m_file.read(begin, &block[0], block.size()))
+				return false;
+			out.reserve(static_cast<size_t>(last - first + 1));
+			for (auto line = first; line <= last; line++)
+			{
+				const std::uint64_t b = (line == 0 ? 0 : m_breaks[static_cast<size_t>(line - 1)]) - begin;
+				/*һе\rline_rangeȥ*/
+				std::uint64_t e = block.size();
+				if (line != last)
+				{
+					e = m_breaks[static_cast<size_t>(line)] - 1 - begin;
+					if (e > b && block[static_cast<size_t>(e - 1)] == '\r')
+						e--;
+				}
+				out.emplace_back(block, static_cast<size_t>(b), static_cast<size_t>(e - b));
+			}
+			return true;
+		}
+
+		bool line_index::save(const path_type& sidecar)
+		{
+			if (sidecar.empty() || !m_file.is_open())
+				return false;
+			std::vector<unsigned char> data(sizeof(sidecar_header) + m_breaks.size() * sizeof(std::uint64_t));
+			sidecar_header header;
+			std::memcpy(header.magic, kSidecarMagic, sizeof(header.magic));
+			header.version = kSidecarVersion;
+			header.scanned = m_scanned;
+			header.count = m_breaks.size();
+			header.fingerprint = m_fingerprint;
+			std::memcpy(data.data(), &header, sizeof(header));
+			if (!m_breaks.empty())
+				std::memcpy(data.data() + sizeof(header), m_breaks.data(), m_breaks.size() * sizeof(std::uint64_t));
+			if (!fileio::write_file(sidecar, data.data(), data.size(), fileio::write_mode::atomic))
+				return false;
+			if (sidecar == m_sidecar)
+				m_dirty = false;
+			return true;
+		}
+
+		path_type line_index::default_sidecar(const path_type& path)
+		{
+#ifdef _WIN32
+			return path + L".lidx";
+#else
+			return path + ".lidx";
+#endif
+		}
+
+		bool line_index::map_file()
+		{
+			return m_file.open(m_path, false, mmap::access_hint::random);
+		}
+
+		bool line_index::scan(std::uint64_t from, std::uint64_t to, std::vector<std::uint64_t>& breaks)
+		{
+			if (from >= to)
+				return true;
+			const auto parts = static_cast<unsigned>((std::min<std::uint64_t>)(m_threads, (std::max<std::uint64_t>)(1, (to - from) / kMinChunk)));
+			if (parts <= 1)
+				return scan_range(m_file, from, to, breaks);
+			/*mapped_filḛ߳ȫ,ÿ̸߳ӳһ*/
+			std::vector<std::vector<std::uint64_t>> results(parts);
+			std::vector<char> ok(parts, 0);
+			std::vector<std::thread> workers;
+			const std::uint64_t step = (to - from) / parts;
+			for (unsigned i = 0; i < parts; i++)
+			{
+				const std::uint64_t begin = from + step * i;
+				const std::uint64_t end = i + 1 == parts ? to : begin + step;
+				workers.emplace_back([this, begin, end, &results, &ok, i]() {
+					mapped_file file;
+					if (!file.open(m_path, false, mmap::access_hint::sequential) || file.size() < end)
+						return;
+					ok[i] = scan_range(file, begin, end, results[i]);
+				});
+			}
+			for (auto& worker : workers)
+				worker.join();
+			if (std::find(ok.begin(), ok.end(), 0) != ok.end())
+				return false;
+			size_t total = breaks.size();
+			for (const auto& part : results)
+				total += part.size();
+			breaks.reserve(total);
+			for (const auto& part : results)
+				breaks.insert(breaks.end(), part.begin(), part.end());
+			return true;
+		}
+
+		bool line_index::rebuild()
+		{
+			m_breaks.clear();
+			m_scanned = 0;
+			if (!scan(0, m_file.size(), m_breaks))
+			{
+				m_breaks.clear();
+				return false;
+			}
+			m_scanned = m_file.size();
+			m_fingerprint = fingerprint(m_scanned);
+			m_dirty = true;
+			return true;
+		}
+
+		bool line_index::load(const path_type& sidecar)
+		{
+			std::vector<unsigned char> data;
+			std::uint64_t got = 0;
+			if (!fileio::read_file(sidecar, SIZE_MAX, [&data](std::uint64_t size) {
+				data.resize(static_cast<size_t>(size));
+				return data.data();
+				}, got) || got != data.size() || got < sizeof(sidecar_header))
+				return false;
+			sidecar_header header;
+			std::memcpy(&header, data.data(), sizeof(header));
+			if (std::memcmp(header.magic, kSidecarMagic, sizeof(header.magic)) != 0 || header.version != kSidecarVersion
+				|| header.count > (got - sizeof(header)) / sizeof(std::uint64_t)
+				|| got != sizeof(header) + header.count * sizeof(std::uint64_t)
+				|| header.scanned > m_file.size() || header.count > header.scanned)
+				return false;
+			std::vector<std::uint64_t> breaks(static_cast<size_t>(header.count));
+			if (!breaks.empty())
+				std::memcpy(breaks.data(), data.data() + sizeof(header), breaks.size() * sizeof(std::uint64_t));
+			/*λñϸҲɨķΧ,Ϊ,÷ؽ*/
+			if (std::adjacent_find(breaks.begin(), breaks.end(), std::greater_equal<std::uint64_t>()) != breaks.end()
+				|| (!breaks.empty() && breaks.back() > header.scanned))
+				return false;
+			/*ļڱ֮󱻸д*/
+			if (fingerprint(header.scanned) != header.fingerprint)
+				return false;
+			m_breaks.swap(breaks);
+			m_scanned = header.scanned;
+			m_fingerprint = header.fingerprint;
+			return true;
+		}
+
+		std::uint64_t line_index::fingerprint(std::uint64_t size)
+		{
+			unsigned char buffer[kFingerprintBytes];
+			const auto n = static_cast<size_t>((std::min<std::uint64_t>)(size, kFingerprintBytes));
+			std::uint64_t hash = 0xcbf29ce484222325ull ^ size;
+			if (n == 0)
+				return hash;
+			if (!m_file.read(0, buffer, n))
+				return 0;
+			hash = hash_bytes(hash, buffer, n);
+			if (!m_file.read(size - n, buffer, n))
+				return 0;
+			return hash_bytes(hash, buffer, n);
+		}
+	}
+}
+
+using elibstl::lineidx::line_index;
+
+//
+EXTERN_C void fn_lidx_structure(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto& self = elibstl::args_to_obj<line_index>(pArgInf);
+	self = new line_index;
+}
+FucInfo Fn_lidx_structure = { {
+		/*ccname*/  "",
+		/*egname*/  "",
+		/*explain*/ NULL,
+		/*category*/ -1,
+		/*state*/  _CMD_OS(__OS_WIN) | CT_IS_HIDED | CT_IS_OBJ_CONSTURCT_CMD,
+		/*ret*/ _SDT_NULL,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*ArgCount*/0,
+		/*arg lp*/  NULL,
+	} ,ESTLFNAME(fn_lidx_structure) };
+
+static ARG_INFO s_LidxCopyArgs[] =
+{
+	{
+		/*name*/    "",
+		/*explain*/ "",
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/	(DATA_TYPE)34,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_DEFAULT_VALUE_IS_EMPTY,
+	}
+};
+//
+EXTERN_C void fn_lidx_copy(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto& self = elibstl::classhelp::get_this<line_index>(pArgInf);
+	self = new line_index;
+	put_errmsg(L"ļӳ,ܸ,Ƶõδ򿪵¶!");
+}
+FucInfo Fn_lidx_copy = { {
+		/*ccname*/  "",
+		/*egname*/  "",
+		/*explain*/ NULL,
+		/*category*/ -1,
+		/*state*/   _CMD_OS(__OS_WIN) | CT_IS_HIDED | CT_IS_OBJ_COPY_CMD,
+		/*ret*/ _SDT_NULL,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*ArgCount*/1,
+		/*arg lp*/  s_LidxCopyArgs,
+	} ,ESTLFNAME(fn_lidx_copy) };
+
+//
+EXTERN_C void fn_lidx_destruct(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto& self = elibstl::args_to_obj<line_index>(pArgInf);
+	if (self)
+		delete self;
+	self = nullptr;
+}
+FucInfo Fn_lidx_destruct = { {
+		/*ccname*/  "",
+		/*egname*/  "",
+		/*explain*/ NULL,
+		/*category*/ -1,
+		/*state*/    _CMD_OS(__OS_WIN) | CT_IS_HIDED | CT_IS_OBJ_FREE_CMD,
+		/*ret*/ _SDT_NULL,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*ArgCount*/0,
+		/*arg lp*/  NULL,
+	} ,ESTLFNAME(fn_lidx_destruct) };
+
+static ARG_INFO Args_LidxOpen[] =
+{
+	{
+		/*name*/    "ļ",
+		/*explain*/ "",
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_BIN,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_NONE,
+	},
+	{
+		/*name*/    "ʹļ",
+		/*explain*/ "ΪʱͬĿ¼ġļ.lidx,´δʱļֻ׷ӹֱ벢ֻɨ֡ĬΪ",
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_BOOL,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_DEFAULT_VALUE_IS_EMPTY,
+	},
+	{
+		/*name*/    "߳",
+		/*explain*/ "ɨļʹõ߳,С8MBĲֻһ̡߳Ϊ0ʡʱʹCPU",
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_INT,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_DEFAULT_VALUE_IS_EMPTY,
+	}
+};
+EXTERN_C void fn_lidx_open(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto& self = elibstl::args_to_obj<line_index>(pArgInf);
+	const std::wstring path(elibstl::args_to_wsdata(pArgInf, 1));
+	const auto sidecar = elibstl::args_to_data<BOOL>(pArgInf, 2).value_or(FALSE);
+	const auto threads = elibstl::args_to_data<INT>(pArgInf, 3).value_or(0);
+	pRetData->m_bool = self->open(path, sidecar ? line_index::default_sidecar(path) : std::wstring(), threads > 0 ? static_cast<unsigned>(threads) : 0);
+}
+FucInfo Fn_lidx_open = { {
+		/*ccname*/  "",
+		/*egname*/  "open",
+		/*explain*/ "ıļ,֮кȡвҪɨļԻз(\\n),βĻسһȥɹ档",
+		/*category*/ -1,
+		/*state*/    _CMD_OS(__OS_WIN) ,
+		/*ret*/ SDT_BOOL,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		ESTLARG(Args_LidxOpen)
+	} ,ESTLFNAME(fn_lidx_open) };
+
+EXTERN_C void fn_lidx_close(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto& self = elibstl::args_to_obj<line_index>(pArgInf);
+	self->close();
+}
+FucInfo Fn_lidx_close = { {
+		/*ccname*/  "ر",
+		/*egname*/  "close",
+		/*explain*/ "رļ,ʹļʱȱδд",
+		/*category*/ -1,
+		/*state*/    _CMD_OS(__OS_WIN) ,
+		/*ret*/ _SDT_NULL,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*ArgCount*/0,
+		/*arg lp*/  0,
+	} ,ESTLFNAME(fn_lidx_close) };
+
+EXTERN_C void fn_lidx_refresh(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto& self = elibstl::args_to_obj<line_index>(pArgInf);
+	std::uint64_t grown = 0;
+	pRetData->m_int64 = self->refresh(&grown) ? static_cast<INT64>(grown) : -1;
+}
+FucInfo Fn_lidx_refresh = { {
+		/*ccname*/  "ˢ",
+		/*egname*/  "refresh",
+		/*explain*/ "ļǷб仯ļ׷ʱֻɨĲ;ļ̻ݱдʱؽӵ,ؽʱΪȫ,ʧܷ-1",
+		/*category*/ -1,
+		/*state*/    _CMD_OS(__OS_WIN) ,
+		/*ret*/ SDT_INT64,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*ArgCount*/0,
+		/*arg lp*/  0,
+	} ,ESTLFNAME(fn_lidx_refresh) };
+
+EXTERN_C void fn_lidx_count(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto& self = elibstl::args_to_obj<line_index>(pArgInf);
+	pRetData->m_int64 = static_cast<INT64>(self->line_count());
+}
+FucInfo Fn_lidx_count = { {
+		/*ccname*/  "ȡ",
+		/*egname*/  "count",
+		/*explain*/ ",һûлзʱҲڡ",
+		/*category*/ -1,
+		/*state*/    _CMD_OS(__OS_WIN) ,
+		/*ret*/ SDT_INT64,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*ArgCount*/0,
+		/*arg lp*/  0,
+	} ,ESTLFNAME(fn_lidx_count) };
+
+static ARG_INFO Args_LidxLine[] =
+{
+	{
+		/*name*/    "к",
+		/*explain*/ "0ʼ",
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_INT64,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_NONE,
+	}
+};
+EXTERN_C void fn_lidx_line(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto& self = elibstl::args_to_obj<line_index>(pArgInf);
+	std::string line;
+	if (pArgInf[1].m_int64 < 0 || !self->get_line(static_cast<std::uint64_t>(pArgInf[1].m_int64), line)
+		|| line.size() > static_cast<size_t>(INT_MAX) - 2 * sizeof(INT))
+		return;
+	pRetData->m_pBin = elibstl::clone_bin(reinterpret_cast<LPBYTE>(&line[0]), static_cast<INT>(line.size()));
+}
+FucInfo Fn_lidx_line = { {
+		/*ccname*/  "ȡ",
+		/*egname*/  "line",
+		/*explain*/ "ָеԭʼ,βĻسз,ļͬкųΧʱؿֽڼ",
+		/*category*/ -1,
+		/*state*/    _CMD_OS(__OS_WIN) ,
+		/*ret*/ SDT_BIN,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		ESTLARG(Args_LidxLine)
+	} ,ESTLFNAME(fn_lidx_line) };
+
+static ARG_INFO Args_LidxLines[] =
+{
+	{
+		/*name*/    "ʼк",
+		/*explain*/ "0ʼ",
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_INT64,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_NONE,
+	},
+	{
+		/*name*/    "",
+		/*explain*/ "ļβĲֱ",
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_INT,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_NONE,
+	}
+};
+EXTERN_C void fn_lidx_lines(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto& self = elibstl::args_to_obj<line_index>(pArgInf);
+	std::vector<std::string> lines;
+	if (pArgInf[1].m_int64 < 0 || pArgInf[2].m_int <= 0
+		|| !self->get_lines(static_cast<std::uint64_t>(pArgInf[1].m_int64), static_cast<std::uint64_t>(pArgInf[2].m_int), lines)
+		|| lines.empty())
+	{
+		pRetData->m_pAryData = elibstl::empty_array();
+		return;
+	}
+	const auto p = elibstl::malloc_array<LPBYTE>(static_cast<int>(lines.size()));
+	auto items = reinterpret_cast<LPBYTE*>(p + 2 * sizeof(INT));
+	for (size_t i = 0; i < lines.size(); i++)
+	{
+		if (!lines[i].empty() && lines[i].size() <= static_cast<size_t>(INT_MAX) - 2 * sizeof(INT))
+			items[i] = elibstl::clone_bin(reinterpret_cast<LPBYTE>(&lines[i][0]), static_cast<INT>(lines[i].size()));
+	}
+	pRetData->m_pAryData = p;
+}
+FucInfo Fn_lidx_lines = { {
+		/*ccname*/  "ȡ",
+		/*egname*/  "lines",
+		/*explain*/ "һζĶ,ÿһԱ,βĻسзʺϷҳʾ,еáȡСٺܶļʡʼкųΧʱؿ顣",
+		/*category*/ -1,
+		/*state*/    _CMD_OS(__OS_WIN) | CT_RETRUN_ARY_TYPE_DATA,
+		/*ret*/ SDT_BIN,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		ESTLARG(Args_LidxLines)
+	} ,ESTLFNAME(fn_lidx_lines) };
+
+EXTERN_C void fn_lidx_offset(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto& self = elibstl::args_to_obj<line_index>(pArgInf);
+	std::uint64_t begin, end;
+	if (pArgInf[1].m_int64 < 0 || !self->line_range(static_cast<std::uint64_t>(pArgInf[1].m_int64), begin, end))
+		pRetData->m_int64 = -1;
+	else
+		pRetData->m_int64 = static_cast<INT64>(begin);
+}
+FucInfo Fn_lidx_offset = { {
+		/*ccname*/  "ȡλ",
+		/*egname*/  "offset",
+		/*explain*/ "ָļеʼƫ,кųΧʱ-1",
+		/*category*/ -1,
+		/*state*/    _CMD_OS(__OS_WIN) ,
+		/*ret*/ SDT_INT64,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		ESTLARG(Args_LidxLine)
+	} ,ESTLFNAME(fn_lidx_offset) };
+
+static ARG_INFO Args_LidxSave[] =
+{
+	{
+		/*name*/    "ļ",
+		/*explain*/ "ʡʱ浽ʱʹõļ,ʱûʹļ򱣴浽ļ.lidx",
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_BIN,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_DEFAULT_VALUE_IS_EMPTY,
+	}
+};
+EXTERN_C void fn_lidx_save(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto& self = elibstl::args_to_obj<line_index>(pArgInf);
+	std::wstring sidecar;
+	if (pArgInf[1].m_dtDataType != _SDT_NULL)
+		sidecar = elibstl::args_to_wsdata(pArgInf, 1);
+	if (sidecar.empty())
+		sidecar = self->sidecar_path();
+	pRetData->m_bool = self->save(sidecar);
+}
+FucInfo Fn_lidx_save = { {
+		/*ccname*/  "",
+		/*egname*/  "save",
+		/*explain*/ "ѵǰдļ,дʱдʱļ滻,;ʧܲԭļɹ档",
+		/*category*/ -1,
+		/*state*/    _CMD_OS(__OS_WIN) ,
+		/*ret*/ SDT_BOOL,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		ESTLARG(Args_LidxSave)
+	} ,ESTLFNAME(fn_lidx_save) };
+
+static INT s_dtCmdIndexcommobj_lidx[] = { 454,455,456,457,458,459,460,461,462,463,464 };
+namespace elibstl {
+
+
+	LIB_DATA_TYPE_INFO Obj_LineIndex =
+	{
+		"",
+		"LineIndex",
+		"¼ıļÿһеλ,кȡ,ʺͷҳʾܴ־ļļ׷Ӻˢֻɨ",
+		sizeof(s_dtCmdIndexcommobj_lidx) / sizeof(s_dtCmdIndexcommobj_lidx[0]),
+		 s_dtCmdIndexcommobj_lidx,
+		_DT_OS(__OS_WIN),
+		0,
+		NULL,
+		NULL,
+		NULL,
+		NULL,
+		NULL,
+		0,
+		0
+	};
+}
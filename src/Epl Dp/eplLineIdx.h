@@ -0,0 +1,83 @@
+#pragma once
+#include"eplMmap.h"
+#include<cstddef>
+#include<cstdint>
+#include<string>
+#include<vector>
+
+/*
+* ıļ,¼ÿһеʼƫ,úкȡвҪɨļ.
+* \n,β\rһȥ;\r㻻.
+* ʱ߳SIMDһз;ļ׷ӺrefreshֻɨĲ.
+* Ա浽ļԵļ(ĬΪԭļ.lidx),´δʱУֱͨ.
+*/
+namespace elibstl {
+	namespace lineidx {
+		using path_type = mmap::path_type;
+
+		class line_index
+		{
+		public:
+			/*ÿ߳ɨֽ,Сļ߳*/
+			static constexpr std::uint64_t kMinChunk = 8ull * 1024 * 1024;
+
+			line_index() = default;
+			line_index(const line_index&) = delete;
+			line_index& operator=(const line_index&) = delete;
+			~line_index() { close(); }
+
+			/*
+			* ļ.sidecarΪʱʹļ.
+			* threadsΪ0ʱʹCPU.
+			*/
+			bool open(const path_type& path, const path_type& sidecar = path_type(), unsigned threads = 0);
+			/*δʱдļ*/
+			void close();
+			bool is_open() const { return m_file.is_open(); }
+
+			/*
+			* ļǷ仯:׷ʱֻɨ,̻ͷֵĩβдʱؽ.
+			* grown֮ǰӵ,ؽʱΪȫ.
+			*/
+			bool refresh(std::uint64_t* grown = nullptr);
+
+			std::uint64_t line_count() const;
+			/*ѽļߴ*/
+			std::uint64_t indexed_size() const { return m_scanned; }
+
+			/*ȡline(0ʼ)ķΧ,endβ\r\n*/
+			bool line_range(std::uint64_t line, std::uint64_t& begin, std::uint64_t& end);
+			/*
+			* ݵָ,,ָЧͬmapped_file::view.зطǿָlengthΪ0.
+			* пԽӳ䴰ʱ(ֻ32λг)nullptr,ʱget_line.
+			*/
+			const unsigned char* line_view(std::uint64_t line, size_t& length);
+			bool get_line(std::uint64_t line, std::string& out);
+			/*ȡfirstʼcount,Ĳֺ*/
+			bool get_lines(std::uint64_t first, std::uint64_t count, std::vector<std::string>& out);
+
+			/*ѵǰдļ,дðȫ滻*/
+			bool save(const path_type& sidecar);
+			/*ʱʹõļ,ûʹʱΪĬϵļ*/
+			path_type sidecar_path() const { return m_sidecar.empty() ? default_sidecar(m_path) : m_sidecar; }
+			static path_type default_sidecar(const path_type& path);
+
+		private:
+			bool map_file();
+			bool scan(std::uint64_t from, std::uint64_t to, std::vector<std::uint64_t>& breaks);
+			bool rebuild();
+			bool load(const path_type& sidecar);
+			std::uint64_t fingerprint(std::uint64_t size);
+
+			mmap::mapped_file m_file;
+			path_type m_path;
+			path_type m_sidecar;
+			/*ÿ\n֮ƫ,һеʼƫ*/
+			std::vector<std::uint64_t> m_breaks;
+			std::uint64_t m_scanned = 0;
+			std::uint64_t m_fingerprint = 0;
+			unsigned m_threads = 0;
+			bool m_dirty = false;
+		};
+	}
+}
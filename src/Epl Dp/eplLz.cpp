@@ -0,0 +1,948 @@
+#include"ElibHelp.h"
+#include"eplLz.h"
+#include<cstring>
+#include<climits>
+
+namespace {
+	using namespace elibstl::lz;
+
+	constexpr int kMinMatch = 4;
+	/*һƥڿβ12ֽ֮ǰʼ,5ֽڱ,LZ4ʽԼ,ѹ*/
+	constexpr int kMfLimit = 12;
+	constexpr int kLastLiterals = 5;
+	constexpr int kMaxDistance = 65535;
+	constexpr int kHashLog = 12;
+	/*ÿʧ64β,1,ѹ*/
+	constexpr int kSkipTrigger = 6;
+
+	inline std::uint32_t read32(const unsigned char* p)
+	{
+		std::uint32_t v;
+		memcpy(&v, p, sizeof(v));
+		return v;
+	}
+	inline std::uint64_t read64(const unsigned char* p)
+	{
+		std::uint64_t v;
+		memcpy(&v, p, sizeof(v));
+		return v;
+	}
+	inline void write32(unsigned char* p, std::uint32_t v)
+	{
+		memcpy(p, &v, sizeof(v));
+	}
+	inline void write64(unsigned char* p, std::uint64_t v)
+	{
+		memcpy(p, &v, sizeof(v));
+	}
+	/*64λȡ5ֽϣ,ͻ,ѹʸ;32λ64λ˷,ֻȡ4ֽ*/
+	inline std::uint32_t hash_position(const unsigned char* p)
+	{
+#if defined(_M_X64) || defined(__x86_64__)
+		return static_cast<std::uint32_t>(((read64(p) << 24) * 889523592379ULL) >> (64 - kHashLog));
+#else
+		return (read32(p) * 2654435761U) >> (32 - kHashLog);
+#endif
+	}
+
+	inline unsigned count_trailing_zero(std::uint64_t v)
+	{
+#if defined(_MSC_VER)
+#if defined(_M_X64)
+		unsigned long r;
+		_BitScanForward64(&r, v);
+		return r;
+#else
+		unsigned long r;
+		if (static_cast<std::uint32_t>(v))
+		{
+			_BitScanForward(&r, static_cast<std::uint32_t>(v));
+			return r;
+		}
+		_BitScanForward(&r, static_cast<std::uint32_t>(v >> 32));
+		return r + 32;
+#endif
+#else
+		return static_cast<unsigned>(__builtin_ctzll(v));
+#endif
+	}
+
+	/*ipmatchֽͬ,limit*/
+	inline size_t count_match(const unsigned char* ip, const unsigned char* match, const unsigned char* limit)
+	{
+		const unsigned char* const start = ip;
+		while (ip + 8 <= limit)
+		{
+			const std::uint64_t diff = read64(ip) ^ read64(match);
+			if (diff)
+				return ip - start + (count_trailing_zero(diff) >> 3);
+			ip += 8;
+			match += 8;
+		}
+		while (ip < limit && *ip == *match)
+		{
+			ip++;
+			match++;
+		}
+		return ip - start;
+	}
+
+	inline unsigned char* write_length(unsigned char* op, size_t len)
+	{
+		for (; len >= 255; len -= 255)
+			*op++ = 255;
+		*op++ = static_cast<unsigned char>(len);
+		return op;
+	}
+
+	/*ÿθ8ֽ,ԽdstEnd7ֽ,֤߱*/
+	inline void wild_copy8(unsigned char* dst, const unsigned char* src, unsigned char* dstEnd)
+	{
+		do
+		{
+			memcpy(dst, src, 8);
+			dst += 8;
+			src += 8;
+		} while (dst < dstEnd);
+	}
+	inline void wild_copy16(unsigned char* dst, const unsigned char* src, unsigned char* dstEnd)
+	{
+		do
+		{
+			memcpy(dst, src, 16);
+			dst += 16;
+			src += 16;
+		} while (dst < dstEnd);
+	}
+
+	/*
+	* ѹһ.lowLimitΪƥõλ,Ϊdst,
+	* (֡ǰ)֮ǰѽ.
+	*/
+	int decode_block(const unsigned char* src, size_t size, unsigned char* dst, size_t capacity, const unsigned char* lowLimit)
+	{
+		const unsigned char* ip = src;
+		const unsigned char* const iend = src + size;
+		unsigned char* op = dst;
+		unsigned char* const oend = dst + capacity;
+		for (;;)
+		{
+			/*һֻ,ƥ֮𻵵*/
+			if (ip >= iend)
+				return -1;
+			const unsigned token = *ip++;
+			size_t length = token >> 4;
+			/*
+			* 14ֽڡƥ䲻18ֽ.ʱֱӸ16ֽ,
+			* ƥֱӸ18ֽ,ʡгж.ʱһ,һƫ
+			*/
+			if (length != 15 && iend - ip >= 17 && oend - op >= 32)
+			{
+				memcpy(op, ip, 16);
+				op += length;
+				ip += length;
+				const size_t offset = ip[0] | (ip[1] << 8);
+				const size_t matchLength = token & 15;
+				if (matchLength != 15 && offset >= 8 && offset <= static_cast<size_t>(op - lowLimit))
+				{
+					const unsigned char* const match = op - offset;
+					memcpy(op, match, 8);
+					memcpy(op + 8, match + 8, 8);
+					memcpy(op + 16, match + 16, 2);
+					op += matchLength + kMinMatch;
+					ip += 2;
+					continue;
+				}
+			}
+			else
+			{
+				if (length == 15)
+				{
+					unsigned s;
+					do
+					{
+						if (ip >= iend)
+							return -1;
+						s = *ip++;
+						length += s;
+					} while (s == 255);
+				}
+				if (length > static_cast<size_t>(iend - ip) || length > static_cast<size_t>(oend - op))
+					return -1;
+				if (static_cast<size_t>(iend - ip) >= length + 16 && static_cast<size_t>(oend - op) >= length + 16)
+					wild_copy16(op, ip, op + length);
+				else
+					memmove(op, ip, length);
+				ip += length;
+				op += length;
+				if (ip == iend)
+					break;
+			}
+
+			if (iend - ip < 2)
+				return -1;
+			const size_t offset = ip[0] | (ip[1] << 8);
+			ip += 2;
+			if (offset == 0 || offset > static_cast<size_t>(op - lowLimit))
+				return -1;
+			length = token & 15;
+			if (length == 15)
+			{
+				unsigned s;
+				do
+				{
+					if (ip >= iend)
+						return -1;
+					s = *ip++;
+					length += s;
+				} while (s == 255);
+			}
+			length += kMinMatch;
+			if (length > static_cast<size_t>(oend - op))
+				return -1;
+			const unsigned char* match = op - offset;
+			unsigned char* const cpy = op + length;
+			if (static_cast<size_t>(oend - cpy) >= 16)
+			{
+				if (offset >= 16)
+					wild_copy16(op, match, cpy);
+				else if (offset >= 8)
+					wild_copy8(op, match, cpy);
+				else if (offset == 1)
+					memset(op, *match, length);
+				else
+				{
+					/*صܽظ,ֽ̿dist(offsetС8),֮dist8ֽڸƲ໥*/
+					const size_t dist = (8 + offset - 1) / offset * offset;
+					unsigned char* const seed = op + dist < cpy ? op + dist : cpy;
+					while (op < seed)
+						*op++ = *match++;
+					if (op < cpy)
+						wild_copy8(op, op - dist, cpy);
+				}
+			}
+			else
+			{
+				for (unsigned char* p = op; p < cpy; p++)
+					*p = *match++;
+			}
+			op = cpy;
+		}
+		return static_cast<int>(op - dst);
+	}
+
+	/*XXH32*/
+	constexpr std::uint32_t kPrime32_1 = 0x9E3779B1U;
+	constexpr std::uint32_t kPrime32_2 = 0x85EBCA77U;
+	constexpr std::uint32_t kPrime32_3 = 0xC2B2AE3DU;
+	constexpr std::uint32_t kPrime32_4 = 0x27D4EB2FU;
+	constexpr std::uint32_t kPrime32_5 = 0x165667B1U;
+
+	inline std::uint32_t rotl32(std::uint32_t v, int r)
+	{
+		return (v << r) | (v >> (32 - r));
+	}
+	inline std::uint32_t xxh32_round(std::uint32_t acc, std::uint32_t input)
+	{
+		acc += input * kPrime32_2;
+		acc = rotl32(acc, 13);
+		return acc * kPrime32_1;
+	}
+
+	/*֡ʽ*/
+	constexpr std::uint32_t kFrameMagic = 0x184D2204U;
+	constexpr std::uint32_t kSkippableMagic = 0x184D2A50U;
+	constexpr std::uint32_t kSkippableMask = 0xFFFFFFF0U;
+	constexpr std::uint32_t kUncompressedFlag = 0x80000000U;
+	constexpr unsigned char kFlgVersion = 0x40;
+	constexpr unsigned char kFlgBlockIndependent = 0x20;
+	constexpr unsigned char kFlgBlockChecksum = 0x10;
+	constexpr unsigned char kFlgContentSize = 0x08;
+	constexpr unsigned char kFlgContentChecksum = 0x04;
+	constexpr unsigned char kFlgDictId = 0x01;
+
+	inline size_t block_max_size(int id)
+	{
+		return static_cast<size_t>(1) << (8 + 2 * id);
+	}
+
+	struct frame_header
+	{
+		unsigned char flags = 0;
+		size_t block_max = 0;
+		std::int64_t content_size = -1;
+		size_t header_size = 0;
+	};
+
+	/*֡ͷ,ݲЧʱfalse*/
+	bool parse_frame_header(const unsigned char* src, size_t size, frame_header& header)
+	{
+		if (size < 7 || read32(src) != kFrameMagic)
+			return false;
+		const unsigned char flg = src[4], bd = src[5];
+		if ((flg & 0xC0) != kFlgVersion || (flg & 0x02) || (bd & 0x8F))
+			return false;
+		const int id = (bd >> 4) & 7;
+		if (id < 4)
+			return false;
+		/*ԤֵҪṩͬһֵ,ﲻ֧*/
+		if (flg & kFlgDictId)
+			return false;
+		size_t pos = 6;
+		if (flg & kFlgContentSize)
+		{
+			if (size < pos + 8 + 1)
+				return false;
+			const std::uint64_t cs = read64(src + pos);
+			if (cs > static_cast<std::uint64_t>(INT64_MAX))
+				return false;
+			header.content_size = static_cast<std::int64_t>(cs);
+			pos += 8;
+		}
+		const std::uint32_t hc = (xxh32(src + 4, pos - 4) >> 8) & 0xFF;
+		if (src[pos] != hc)
+			return false;
+		header.flags = flg;
+		header.block_max = block_max_size(id);
+		header.header_size = pos + 1;
+		return true;
+	}
+
+	/*ѹĿ:̶,MemBin.ֻͨƫƷ,MemBinݺָʧЧҲӰ*/
+	class fixed_output
+	{
+	public:
+		fixed_output(unsigned char* dst, size_t capacity) : m_dst(dst), m_capacity(capacity) {}
+		unsigned char* base() { return m_dst; }
+		size_t size() const { return m_size; }
+		/*׼дһ,ؿõĳ;remainingΪ֡δĳ,δ֪ʱΪ-1*/
+		size_t prepare(size_t, std::int64_t) { return m_capacity - m_size; }
+		void commit(size_t n) { m_size += n; }
+		void finish() {}
+	private:
+		unsigned char* m_dst;
+		size_t m_capacity;
+		size_t m_size = 0;
+	};
+
+	class membin_output
+	{
+	public:
+		explicit membin_output(epldatatype::MemBin& out) : m_out(out), m_size(out.size()) {}
+		unsigned char* base() { return m_out.data(); }
+		size_t size() const { return m_size; }
+		size_t prepare(size_t need, std::int64_t remaining)
+		{
+			/*֡ͷ¼ԭʼʱһη䵽λ,򰴿*/
+			if (remaining >= 0)
+				need = static_cast<size_t>(remaining);
+			if (m_out.size() - m_size < need)
+				m_out.resize(m_size + need);
+			return m_out.size() - m_size;
+		}
+		void commit(size_t n) { m_size += n; }
+		void finish() { m_out.resize(m_size); }
+	private:
+		epldatatype::MemBin& m_out;
+		size_t m_size;
+	};
+
+	/*ѹ֡,ɹtrue*/
+	template <class Output>
+	bool decode_frames(const unsigned char* src, size_t size, Output& out)
+	{
+		const unsigned char* ip = src;
+		const unsigned char* const iend = src + size;
+		if (size == 0)
+			return false;
+		while (ip < iend)
+		{
+			const size_t left = iend - ip;
+			if (left < 4)
+				return false;
+			const std::uint32_t magic = read32(ip);
+			if ((magic & kSkippableMask) == kSkippableMagic)
+			{
+				if (left < 8 || left - 8 < read32(ip + 4))
+					return false;
+				ip += 8 + static_cast<size_t>(read32(ip + 4));
+				continue;
+			}
+			frame_header header;
+			if (!parse_frame_header(ip, left, header))
+				return false;
+			ip += header.header_size;
+			/*LZ4Լ255ѹ,ԭʼȳΧ˵,ذڴ*/
+			if (header.content_size >= 0 && static_cast<std::uint64_t>(header.content_size) / 255 > static_cast<std::uint64_t>(iend - ip))
+				return false;
+			const size_t frameStart = out.size();
+			const bool independent = (header.flags & kFlgBlockIndependent) != 0;
+			const size_t checksumSize = (header.flags & kFlgBlockChecksum) ? 4 : 0;
+			for (;;)
+			{
+				if (iend - ip < 4)
+					return false;
+				const std::uint32_t word = read32(ip);
+				ip += 4;
+				if (word == 0)
+					break;
+				const size_t blockSize = word & ~kUncompressedFlag;
+				if (blockSize > header.block_max || static_cast<size_t>(iend - ip) < blockSize + checksumSize)
+					return false;
+				if (checksumSize && xxh32(ip, blockSize) != read32(ip + blockSize))
+					return false;
+				std::int64_t remaining = -1;
+				if (header.content_size >= 0)
+				{
+					const size_t produced = out.size() - frameStart;
+					if (static_cast<std::uint64_t>(header.content_size) < produced)
+						return false;
+					remaining = header.content_size - static_cast<std::int64_t>(produced);
+				}
+				const size_t avail = out.prepare((word & kUncompressedFlag) ? blockSize : header.block_max, remaining);
+				unsigned char* const op = out.base() + out.size();
+				if (word & kUncompressedFlag)
+				{
+					if (blockSize > avail)
+						return false;
+					if (blockSize)
+						memcpy(op, ip, blockSize);
+					out.commit(blockSize);
+				}
+				else
+				{
+					const int n = decode_block(ip, blockSize, op, avail < header.block_max ? avail : header.block_max,
+						independent ? op : out.base() + frameStart);
+					if (n < 0)
+						return false;
+					out.commit(static_cast<size_t>(n));
+				}
+				ip += blockSize + checksumSize;
+			}
+			const size_t produced = out.size() - frameStart;
+			if (header.content_size >= 0 && static_cast<std::uint64_t>(header.content_size) != produced)
+				return false;
+			if (header.flags & kFlgContentChecksum)
+			{
+				if (iend - ip < 4 || xxh32(out.base() + frameStart, produced) != read32(ip))
+					return false;
+				ip += 4;
+			}
+		}
+		out.finish();
+		return true;
+	}
+}
+
+namespace elibstl {
+	namespace lz {
+		int compress_bound(int size)
+		{
+			if (size < 0 || size > kMaxInputSize)
+				return 0;
+			return size + size / 255 + 16;
+		}
+
+		int compress_block(const unsigned char* src, int size, unsigned char* dst, int capacity, int acceleration)
+		{
+			if (size < 0 || size > kMaxInputSize || capacity <= 0 || (size && !src) || !dst)
+				return 0;
+			if (acceleration < 1)
+				acceleration = 1;
+			const unsigned char* ip = src;
+			const unsigned char* anchor = src;
+			const unsigned char* const iend = src + size;
+			const unsigned char* const mflimit = iend - kMfLimit;
+			const unsigned char* const matchlimit = iend - kLastLiterals;
+			unsigned char* op = dst;
+			unsigned char* const oend = dst + capacity;
+
+			/*ϣsrcƫ,16KBջ,ÿε,Ҫκȫ״̬*/
+			std::uint32_t table[1 << kHashLog];
+			if (size >= kMfLimit + 1)
+			{
+				memset(table, 0, sizeof(table));
+				table[hash_position(ip)] = 0;
+				ip++;
+				std::uint32_t forwardH = hash_position(ip);
+				for (;;)
+				{
+					/*ƥ*/
+					const unsigned char* match;
+					{
+						const unsigned char* forwardIp = ip;
+						unsigned step = 1;
+						unsigned searchMatchNb = acceleration << kSkipTrigger;
+						do
+						{
+							const std::uint32_t h = forwardH;
+							ip = forwardIp;
+							forwardIp += step;
+							step = searchMatchNb++ >> kSkipTrigger;
+							if (forwardIp > mflimit)
+								goto last_literals;
+							match = src + table[h];
+							forwardH = hash_position(forwardIp);
+							table[h] = static_cast<std::uint32_t>(ip - src);
+						} while (match + kMaxDistance < ip || read32(match) != read32(ip));
+					}
+					/*ǰչ*/
+					while (ip > anchor && match > src && ip[-1] == match[-1])
+					{
+						ip--;
+						match--;
+					}
+					unsigned char* token;
+					{
+						const size_t litLength = ip - anchor;
+						token = op++;
+						if (static_cast<size_t>(oend - op) < litLength + litLength / 255 + 2 + 1 + kLastLiterals)
+							return 0;
+						if (litLength >= 15)
+						{
+							*token = 15 << 4;
+							op = write_length(op, litLength - 15);
+						}
+						else
+							*token = static_cast<unsigned char>(litLength << 4);
+						memcpy(op, anchor, litLength);
+						op += litLength;
+					}
+					for (;;)
+					{
+						/*ƫ*/
+						const size_t offset = ip - match;
+						*op++ = static_cast<unsigned char>(offset);
+						*op++ = static_cast<unsigned char>(offset >> 8);
+						/*ƥ䳤*/
+						{
+							const size_t matchLength = count_match(ip + kMinMatch, match + kMinMatch, matchlimit);
+							ip += kMinMatch + matchLength;
+							if (static_cast<size_t>(oend - op) < matchLength / 255 + 1 + kLastLiterals)
+								return 0;
+							if (matchLength >= 15)
+							{
+								*token += 15;
+								op = write_length(op, matchLength - 15);
+							}
+							else
+								*token += static_cast<unsigned char>(matchLength);
+						}
+						anchor = ip;
+						if (ip > mflimit)
+							goto last_literals;
+						table[hash_position(ip - 2)] = static_cast<std::uint32_t>(ip - 2 - src);
+						/*ŵλֱƥ,ʡһյ*/
+						const std::uint32_t h = hash_position(ip);
+						match = src + table[h];
+						table[h] = static_cast<std::uint32_t>(ip - src);
+						if (match + kMaxDistance >= ip && read32(match) == read32(ip))
+						{
+							token = op++;
+							*token = 0;
+							continue;
+						}
+						break;
+					}
+					forwardH = hash_position(++ip);
+				}
+			}
+		last_literals:
+			{
+				const size_t lastRun = iend - anchor;
+				if (static_cast<size_t>(oend - op) < 1 + lastRun + (lastRun + 255 - 15) / 255)
+					return 0;
+				if (lastRun >= 15)
+				{
+					*op++ = 15 << 4;
+					op = write_length(op, lastRun - 15);
+				}
+				else
+					*op++ = static_cast<unsigned char>(lastRun << 4);
+				memcpy(op, anchor, lastRun);
+				op += lastRun;
+			}
+			return static_cast<int>(op - dst);
+		}
+
+		int decompress_block(const unsigned char* src, int size, unsigned char* dst, int capacity)
+		{
+			if (!src || size <= 0 || capacity < 0 || (capacity && !dst))
+				return -1;
+			return decode_block(src, static_cast<size_t>(size), dst, static_cast<size_t>(capacity), dst);
+		}
+
+		std::uint32_t xxh32(const void* data, size_t size, std::uint32_t seed)
+		{
+			const unsigned char* p = static_cast<const unsigned char*>(data);
+			const unsigned char* const end = p + size;
+			std::uint32_t h;
+			if (size >= 16)
+			{
+				const unsigned char* const limit = end - 16;
+				std::uint32_t v1 = seed + kPrime32_1 + kPrime32_2;
+				std::uint32_t v2 = seed + kPrime32_2;
+				std::uint32_t v3 = seed;
+				std::uint32_t v4 = seed - kPrime32_1;
+				do
+				{
+					v1 = xxh32_round(v1, read32(p));
+					v2 = xxh32_round(v2, read32(p + 4));
+					v3 = xxh32_round(v3, read32(p + 8));
+					v4 = xxh32_round(v4, read32(p + 12));
+					p += 16;
+				} while (p <= limit);
+				h = rotl32(v1, 1) + rotl32(v2, 7) + rotl32(v3, 12) + rotl32(v4, 18);
+			}
+			else
+				h = seed + kPrime32_5;
+			h += static_cast<std::uint32_t>(size);
+			for (; p + 4 <= end; p += 4)
+			{
+				h += read32(p) * kPrime32_3;
+				h = rotl32(h, 17) * kPrime32_4;
+			}
+			for (; p < end; p++)
+			{
+				h += *p * kPrime32_5;
+				h = rotl32(h, 11) * kPrime32_1;
+			}
+			h ^= h >> 15;
+			h *= kPrime32_2;
+			h ^= h >> 13;
+			h *= kPrime32_3;
+			h ^= h >> 16;
+			return h;
+		}
+
+		bool compress_frame(const unsigned char* src, size_t size, epldatatype::MemBin& out, const frame_options& options)
+		{
+			if (options.block_size_id < 4 || options.block_size_id > 7 || (size && !src))
+				return false;
+			const size_t blockMax = block_max_size(options.block_size_id);
+			const size_t blocks = size ? (size + blockMax - 1) / blockMax : 0;
+			const size_t checksumSize = options.block_checksum ? 4 : 0;
+			/*ÿѹԭ,ټӿͷУ顢֡ͷͽ*/
+			const size_t bound = size + blocks * (4 + checksumSize) + 19 + 4 + 4;
+			const size_t start = out.size();
+			out.resize(start + bound);
+			unsigned char* const base = out.data() + start;
+			unsigned char* op = base;
+
+			unsigned char flg = kFlgVersion | kFlgBlockIndependent | kFlgContentSize;
+			if (options.block_checksum)
+				flg |= kFlgBlockChecksum;
+			if (options.content_checksum)
+				flg |= kFlgContentChecksum;
+			write32(op, kFrameMagic);
+			op[4] = flg;
+			op[5] = static_cast<unsigned char>(options.block_size_id << 4);
+			write64(op + 6, static_cast<std::uint64_t>(size));
+			op[14] = static_cast<unsigned char>(xxh32(op + 4, 10) >> 8);
+			op += 15;
+
+			for (size_t pos = 0; pos < size; pos += blockMax)
+			{
+				const size_t n = size - pos < blockMax ? size - pos : blockMax;
+				unsigned char* const data = op + 4;
+				/*ѹ󲻱ԭСԭ,ֻдn-1ֽ*/
+				const int packed = n > 1 ? compress_block(src + pos, static_cast<int>(n), data, static_cast<int>(n - 1), options.acceleration) : 0;
+				std::uint32_t word;
+				if (packed > 0)
+					word = static_cast<std::uint32_t>(packed);
+				else
+				{
+					memcpy(data, src + pos, n);
+					word = static_cast<std::uint32_t>(n) | kUncompressedFlag;
+				}
+				write32(op, word);
+				const size_t stored = word & ~kUncompressedFlag;
+				op = data + stored;
+				if (options.block_checksum)
+				{
+					write32(op, xxh32(data, stored));
+					op += 4;
+				}
+			}
+			write32(op, 0);
+			op += 4;
+			if (options.content_checksum)
+			{
+				write32(op, xxh32(src, size));
+				op += 4;
+			}
+			out.resize(start + (op - base));
+			return true;
+		}
+
+		bool decompress_frame(const unsigned char* src, size_t size, epldatatype::MemBin& out)
+		{
+			if (!src)
+				return false;
+			const size_t start = out.size();
+			membin_output output(out);
+			if (decode_frames(src, size, output))
+				return true;
+			out.resize(start);
+			return false;
+		}
+
+		std::int64_t decompress_frame(const unsigned char* src, size_t size, unsigned char* dst, size_t capacity)
+		{
+			if (!src || (capacity && !dst))
+				return -1;
+			fixed_output output(dst, capacity);
+			if (!decode_frames(src, size, output))
+				return -1;
+			return static_cast<std::int64_t>(output.size());
+		}
+
+		bool compress_frame(const epldatatype::MemBin& src, epldatatype::MemBin& out, const frame_options& options)
+		{
+			return compress_frame(src.data(), src.size(), out, options);
+		}
+
+		bool decompress_frame(const epldatatype::MemBin& src, epldatatype::MemBin& out)
+		{
+			return decompress_frame(src.data(), src.size(), out);
+		}
+
+		std::int64_t frame_content_size(const unsigned char* src, size_t size)
+		{
+			frame_header header;
+			if (!src || !parse_frame_header(src, size, header))
+				return -1;
+			return header.content_size;
+		}
+	}
+}
+
+namespace {
+	/*ֽڼ,ɵд*/
+	LPBYTE alloc_ebin(size_t size)
+	{
+		if (size == 0 || size > static_cast<size_t>(INT_MAX) - sizeof(std::uint32_t) * 2)
+			return nullptr;
+		LPBYTE pd = static_cast<LPBYTE>(elibstl::ealloc(static_cast<int>(sizeof(std::uint32_t) * 2 + size)));
+		*reinterpret_cast<std::uint32_t*>(pd) = 1;
+		*reinterpret_cast<std::uint32_t*>(pd + sizeof(std::uint32_t)) = static_cast<std::uint32_t>(size);
+		return pd;
+	}
+}
+
+static ARG_INFO Args_LzCompress[] =
+{
+	{
+		/*name*/    "",
+		/*explain*/ ("ѹ"),
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_BIN,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_NONE,
+	},
+	{
+		/*name*/    "ٱ",
+		/*explain*/ ("1ΪĬ,ԽѹԽ,ѹԽ"),
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_INT,
+		/*default*/ 1,
+		/*state*/   ArgMark::AS_HAS_DEFAULT_VALUE,
+	},
+	{
+		/*name*/    "У",
+		/*explain*/ ("Ϊʱÿ¼XXH32У,ѹʱԸ緢.ݵУǻ¼"),
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_BOOL,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_HAS_DEFAULT_VALUE,
+	}
+};
+
+EXTERN_C void Fn_lz_compress(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto data = elibstl::args_to_ebin(pArgInf, 0);
+	elibstl::lz::frame_options options;
+	options.acceleration = pArgInf[1].m_int;
+	options.block_checksum = pArgInf[2].m_bool != FALSE;
+	epldatatype::MemBin out;
+	if (elibstl::lz::compress_frame(data ? data->m_data : nullptr, data ? data->m_size : 0, out, options))
+		pRetData->m_pBin = elibstl::clone_bin(out.data(), static_cast<INT>(out.size()));
+}
+
+FucInfo lz_compress = { {
+		/*ccname*/  ("ѹ"),
+		/*egname*/  (""),
+		/*explain*/ ("õLZ4㷨ѹ,ر׼LZ4֡,ԭʼȺУ.ѹʵzlib,ѹͽѹö,ʺڴ滺ȳϡʧܷؿֽڼ"),
+		/*category*/17,
+		/*state*/   NULL,
+		/*ret*/     SDT_BIN,
+		/*reserved*/NULL,
+		/*level*/   LVL_HIGH,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*ArgCount*/sizeof(Args_LzCompress) / sizeof(Args_LzCompress[0]),
+		/*arg lp*/  &Args_LzCompress[0],
+	} ,Fn_lz_compress ,"Fn_lz_compress" };
+
+static ARG_INFO Args_LzUncompress[] =
+{
+	{
+		/*name*/    "",
+		/*explain*/ ("ѹLZ4֡,Ƕ֡β"),
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_BIN,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_NONE,
+	}
+};
+
+EXTERN_C void Fn_lz_uncompress(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto data = elibstl::args_to_ebin(pArgInf, 0);
+	if (!data || data->m_size == 0)
+		return;
+	/*֡ͷ¼ԭʼʱֱӽѹصֽڼ,ʡһθ*/
+	const std::int64_t contentSize = elibstl::lz::frame_content_size(data->m_data, data->m_size);
+	/*ʽѹͬ,255ѹȵȲ,ѹ·ȥܾ*/
+	if (contentSize > 0 && static_cast<std::uint64_t>(contentSize) / 255 <= static_cast<std::uint64_t>(data->m_size))
+	{
+		LPBYTE pd = alloc_ebin(static_cast<size_t>(contentSize));
+		if (pd)
+		{
+			if (elibstl::lz::decompress_frame(data->m_data, data->m_size, pd + sizeof(std::uint32_t) * 2, static_cast<size_t>(contentSize)) == contentSize)
+			{
+				pRetData->m_pBin = pd;
+				return;
+			}
+			elibstl::efree(pd);
+		}
+	}
+	/*δ¼Ȼж֡*/
+	epldatatype::MemBin out;
+	if (elibstl::lz::decompress_frame(data->m_data, data->m_size, out))
+		pRetData->m_pBin = elibstl::clone_bin(out.data(), static_cast<INT>(out.size()));
+}
+
+FucInfo lz_uncompress = { {
+		/*ccname*/  ("ٽѹ"),
+		/*egname*/  (""),
+		/*explain*/ ("ѹѹݡLZ4ɵ֡,У顣𻵻Уʧܷؿֽڼ"),
+		/*category*/17,
+		/*state*/   NULL,
+		/*ret*/     SDT_BIN,
+		/*reserved*/NULL,
+		/*level*/   LVL_HIGH,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*ArgCount*/sizeof(Args_LzUncompress) / sizeof(Args_LzUncompress[0]),
+		/*arg lp*/  &Args_LzUncompress[0],
+	} ,Fn_lz_uncompress ,"Fn_lz_uncompress" };
+
+static ARG_INFO Args_LzCompressBlock[] =
+{
+	{
+		/*name*/    "",
+		/*explain*/ ("ѹ"),
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_BIN,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_NONE,
+	},
+	{
+		/*name*/    "ٱ",
+		/*explain*/ ("1ΪĬ,ԽѹԽ,ѹԽ"),
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_INT,
+		/*default*/ 1,
+		/*state*/   ArgMark::AS_HAS_DEFAULT_VALUE,
+	}
+};
+
+EXTERN_C void Fn_lz_compress_block(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto data = elibstl::args_to_ebin(pArgInf, 0);
+	if (!data || data->m_size == 0)
+		return;
+	std::vector<unsigned char> out(elibstl::lz::compress_bound(static_cast<int>(data->m_size)));
+	if (out.empty())
+		return;
+	const int size = elibstl::lz::compress_block(data->m_data, static_cast<int>(data->m_size), out.data(), static_cast<int>(out.size()), pArgInf[1].m_int);
+	if (size > 0)
+		pRetData->m_pBin = elibstl::clone_bin(out.data(), size);
+}
+
+FucInfo lz_compress_block = { {
+		/*ccname*/  ("ѹ"),
+		/*egname*/  (""),
+		/*explain*/ ("ѹΪLZ4ʽ,ֻѹݱ,ûгȺУ,СѹʱҪṩԭʼ,ʺϵм¼ȵĻ档ʧܷؿֽڼ"),
+		/*category*/17,
+		/*state*/   NULL,
+		/*ret*/     SDT_BIN,
+		/*reserved*/NULL,
+		/*level*/   LVL_HIGH,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*ArgCount*/sizeof(Args_LzCompressBlock) / sizeof(Args_LzCompressBlock[0]),
+		/*arg lp*/  &Args_LzCompressBlock[0],
+	} ,Fn_lz_compress_block ,"Fn_lz_compress_block" };
+
+static ARG_INFO Args_LzUncompressBlock[] =
+{
+	{
+		/*name*/    "",
+		/*explain*/ ("ѹ顱ص"),
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_BIN,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_NONE,
+	},
+	{
+		/*name*/    "ԭʼ",
+		/*explain*/ ("ѹǰֽ,ҲǲС"),
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_INT,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_NONE,
+	}
+};
+
+EXTERN_C void Fn_lz_uncompress_block(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto data = elibstl::args_to_ebin(pArgInf, 0);
+	if (!data || data->m_size == 0 || pArgInf[1].m_int <= 0)
+		return;
+	LPBYTE pd = alloc_ebin(static_cast<size_t>(pArgInf[1].m_int));
+	if (!pd)
+		return;
+	const int size = elibstl::lz::decompress_block(data->m_data, static_cast<int>(data->m_size), pd + sizeof(std::uint32_t) * 2, pArgInf[1].m_int);
+	if (size <= 0)
+	{
+		elibstl::efree(pd);
+		return;
+	}
+	*reinterpret_cast<std::uint32_t*>(pd + sizeof(std::uint32_t)) = static_cast<std::uint32_t>(size);
+	pRetData->m_pBin = pd;
+}
+
+FucInfo lz_uncompress_block = { {
+		/*ccname*/  ("ٽѹ"),
+		/*egname*/  (""),
+		/*explain*/ ("ѹѹ顱LZ4ɵĿݡ𻵻ԭʼȲʱؿֽڼ"),
+		/*category*/17,
+		/*state*/   NULL,
+		/*ret*/     SDT_BIN,
+		/*reserved*/NULL,
+		/*level*/   LVL_HIGH,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*ArgCount*/sizeof(Args_LzUncompressBlock) / sizeof(Args_LzUncompressBlock[0]),
+		/*arg lp*/  &Args_LzUncompressBlock[0],
+	} ,Fn_lz_uncompress_block ,"Fn_lz_uncompress_block" };
@@ -0,0 +1,51 @@
+#pragma once
+#include<cstddef>
+#include<cstdint>
+
+/*
+* õĿLZѹ,ʽ֡ʽLZ4,lz4мԵLZ4⻥ͨ.
+* ѹʲzlib,ѹɴÿGB,ʺڴ滺ƿٶȶĳ.
+* :ֻѹݱ,ѹʱҪ¼ԭʼ.
+* ֡:ħԭʼȺXXH32У,нѹǷ.
+*/
+namespace epldatatype {
+	class MemBin;
+}
+
+namespace elibstl {
+	namespace lz {
+		/**/
+		constexpr int kMaxInputSize = 0x7E000000;
+
+		/*ѹsizeֽҪռ,sizeЧʱ0*/
+		int compress_bound(int size);
+		/*ѹĳ,dstռ䲻Чʱ0.accelerationԽԽ,ѹԽ,1ΪĬ*/
+		int compress_block(const unsigned char* src, int size, unsigned char* dst, int capacity, int acceleration = 1);
+		/*ؽѹĳ,𻵻dstռ䲻ʱ-1.дsrc/dstΧڴ*/
+		int decompress_block(const unsigned char* src, int size, unsigned char* dst, int capacity);
+
+		/*֡ÿ󳤶,ȡֵͬLZ4:4Ϊ64KB,5Ϊ256KB,6Ϊ1MB,7Ϊ4MB*/
+		struct frame_options
+		{
+			int block_size_id = 7;
+			bool content_checksum = true;
+			bool block_checksum = false;
+			int acceleration = 1;
+		};
+
+		/*ѹΪһ֡,׷ӵoutĩβ*/
+		bool compress_frame(const unsigned char* src, size_t size, epldatatype::MemBin& out, const frame_options& options = {});
+		/*ѹһ֡(ɼд֡),׷ӵoutĩβ;𻵻Уʧܷfalse*/
+		bool decompress_frame(const unsigned char* src, size_t size, epldatatype::MemBin& out);
+		/*ѹ̶СĻ,ؽѹĳ,ʧܷ-1*/
+		std::int64_t decompress_frame(const unsigned char* src, size_t size, unsigned char* dst, size_t capacity);
+		/*ȡһ֡ͷ¼ԭʼ,֡ͷδ¼Чʱ-1*/
+		std::int64_t frame_content_size(const unsigned char* src, size_t size);
+
+		bool compress_frame(const epldatatype::MemBin& src, epldatatype::MemBin& out, const frame_options& options = {});
+		bool decompress_frame(const epldatatype::MemBin& src, epldatatype::MemBin& out);
+
+		/*XXH32,xxhashXXH32()һ,֡УʹseedΪ0*/
+		std::uint32_t xxh32(const void* data, size_t size, std::uint32_t seed = 0);
+	}
+}
@@ -1,5 +1,8 @@
 
 #include"ElibHelp.h"
+#include"eplHash.h"
+#include<intrin.h>
+#include<algorithm>
 
 namespace {
 	class MD5
@@ -47,45 +50,46 @@ namespace {
 		}
 
 	public:
+		MD5() = default;
 		template <typename CharType>
 		MD5(const std::basic_string<CharType>& message)
 		{
-			init(reinterpret_cast<const unsigned char*>(message.c_str()), message.length() * sizeof(CharType));
+			update(reinterpret_cast<const unsigned char*>(message.c_str()), message.length() * sizeof(CharType));
 		};
 		template <typename T>
 		MD5(const T& data)
 		{
 			/*if constexpr (__is_container_v<T>())
 			{
-				init(reinterpret_cast<const unsigned char*>(data.data()), data.size() * sizeof(data.back()));
+				update(reinterpret_cast<const unsigned char*>(data.data()), data.size() * sizeof(data.back()));
 			}
 			else {*/
-			init(reinterpret_cast<const unsigned char*>(&data), sizeof(T));
+			update(reinterpret_cast<const unsigned char*>(&data), sizeof(T));
 			//}
 		};
 		MD5(const unsigned char* data, const size_t size)
 		{
-			init(data, size);
+			update(data, size);
 		}
 		MD5(const std::vector<unsigned char>& data)
 		{
 
-			init(data.data(), data.size());
+			update(data.data(), data.size());
 		}
 		const unsigned char* GetMd5()
 		{
 			if (!finished)
 			{
-				finished = true;
-
 				unsigned char bits[8];
 				unsigned int oldState[4];
 				unsigned int oldCount[2];
+				unsigned char oldBuffer[64];
 				unsigned int index, padLen;
 
 				/* Save current state and count. */
 				memcpy(oldState, state, 16);
 				memcpy(oldCount, count, 8);
+				memcpy(oldBuffer, buffer, 64);
 
 				/* Save number of bits */
 				encode(count, bits, 8);
@@ -93,10 +97,10 @@ namespace {
 				/* Pad out to 56 mod 64. */
 				index = (unsigned int)((count[0] >> 3) & 0x3f);
 				padLen = (index < 56) ? (56 - index) : (120 - index);
-				init(PADDING, padLen);
+				update(PADDING, padLen);
 
 				/* Append length (before padding) */
-				init(bits, 8);
+				update(bits, 8);
 
 				/* Store state in digest */
 				encode(state, digest, 16);
@@ -104,9 +108,21 @@ namespace {
 				/* Restore current state and count. */
 				memcpy(state, oldState, 16);
 				memcpy(count, oldCount, 8);
+				memcpy(buffer, oldBuffer, 64);
+				finished = true;
 			}
 			return digest;
 		}
+		/*ָʼ״̬,¼*/
+		void reset()
+		{
+			finished = false;
+			state[0] = 0x67452301;
+			state[1] = 0xefcdab89;
+			state[2] = 0x98badcfe;
+			state[3] = 0x10325476;
+			count[0] = count[1] = 0;
+		}
 		template <typename CharType>
 		std::basic_string<CharType> GetMd5Str()
 		{
@@ -124,11 +140,12 @@ namespace {
 			return str;
 		};
 
-	private:
-		void init(const unsigned char* input, size_t len)
+		/*׷,ɶε,ȡԿɼ׷*/
+		void update(const unsigned char* input, size_t len)
 		{
 
-			unsigned int i, index, partLen;
+			size_t i;
+			unsigned int index, partLen;
 
 			finished = false;
 
@@ -165,6 +182,7 @@ namespace {
 			/* Buffer remaining input */
 			memcpy(&buffer[index], &input[i], len - i);
 		};
+	private:
 		void transform(const unsigned char block[64])
 		{
 
@@ -298,6 +316,350 @@ namespace {
 		std::reverse(md5Hash.begin(), md5Hash.end());
 		return md5Hash;
 	}
+
+	/*
+	* ·MD5:һͬʱ4(SSE2)8(AVX2)Ϣ,ÿϢռһ32λͨ.
+	* ʺϴС(ֽڼ)ժҪ,ֱʹMD5༴.
+	*/
+	namespace md5_mb
+	{
+		inline unsigned int load_u32(const unsigned char* p)
+		{
+			return ((unsigned int)p[0]) | (((unsigned int)p[1]) << 8) |
+				(((unsigned int)p[2]) << 16) | (((unsigned int)p[3]) << 24);
+		}
+
+		struct lanes_sse2
+		{
+			static constexpr size_t N = 4;
+			using V = __m128i;
+			static inline V set1(unsigned int k) { return _mm_set1_epi32((int)k); }
+			static inline V add(V a, V b) { return _mm_add_epi32(a, b); }
+			static inline V and_(V a, V b) { return _mm_and_si128(a, b); }
+			static inline V andnot(V a, V b) { return _mm_andnot_si128(a, b); }
+			static inline V or_(V a, V b) { return _mm_or_si128(a, b); }
+			static inline V xor_(V a, V b) { return _mm_xor_si128(a, b); }
+			static inline V not_(V a) { return _mm_xor_si128(a, _mm_set1_epi32(-1)); }
+			template <int S>
+			static inline V rotl(V a) { return _mm_or_si128(_mm_slli_epi32(a, S), _mm_srli_epi32(a, 32 - S)); }
+			static inline V gather(const unsigned char* const blk[N], size_t off)
+			{
+				return _mm_setr_epi32((int)load_u32(blk[0] + off), (int)load_u32(blk[1] + off),
+					(int)load_u32(blk[2] + off), (int)load_u32(blk[3] + off));
+			}
+			static inline void store(V v, unsigned int out[N]) { _mm_storeu_si128(reinterpret_cast<V*>(out), v); }
+		};
+
+		struct lanes_avx2
+		{
+			static constexpr size_t N = 8;
+			using V = __m256i;
+			static inline V set1(unsigned int k) { return _mm256_set1_epi32((int)k); }
+			static inline V add(V a, V b) { return _mm256_add_epi32(a, b); }
+			static inline V and_(V a, V b) { return _mm256_and_si256(a, b); }
+			static inline V andnot(V a, V b) { return _mm256_andnot_si256(a, b); }
+			static inline V or_(V a, V b) { return _mm256_or_si256(a, b); }
+			static inline V xor_(V a, V b) { return _mm256_xor_si256(a, b); }
+			static inline V not_(V a) { return _mm256_xor_si256(a, _mm256_set1_epi32(-1)); }
+			template <int S>
+			static inline V rotl(V a) { return _mm256_or_si256(_mm256_slli_epi32(a, S), _mm256_srli_epi32(a, 32 - S)); }
+			static inline V gather(const unsigned char* const blk[N], size_t off)
+			{
+				return _mm256_setr_epi32((int)load_u32(blk[0] + off), (int)load_u32(blk[1] + off),
+					(int)load_u32(blk[2] + off), (int)load_u32(blk[3] + off),
+					(int)load_u32(blk[4] + off), (int)load_u32(blk[5] + off),
+					(int)load_u32(blk[6] + off), (int)load_u32(blk[7] + off));
+			}
+			static inline void store(V v, unsigned int out[N]) { _mm256_storeu_si256(reinterpret_cast<V*>(out), v); }
+		};
+
+		template <class L, int S>
+		inline void FF(typename L::V& a, typename L::V b, typename L::V c, typename L::V d, typename L::V x, unsigned int ac)
+		{
+			a = L::add(a, L::add(L::add(L::or_(L::and_(b, c), L::andnot(b, d)), x), L::set1(ac)));
+			a = L::add(L::template rotl<S>(a), b);
+		}
+		template <class L, int S>
+		inline void GG(typename L::V& a, typename L::V b, typename L::V c, typename L::V d, typename L::V x, unsigned int ac)
+		{
+			a = L::add(a, L::add(L::add(L::or_(L::and_(b, d), L::andnot(d, c)), x), L::set1(ac)));
+			a = L::add(L::template rotl<S>(a), b);
+		}
+		template <class L, int S>
+		inline void HH(typename L::V& a, typename L::V b, typename L::V c, typename L::V d, typename L::V x, unsigned int ac)
+		{
+			a = L::add(a, L::add(L::add(L::xor_(L::xor_(b, c), d), x), L::set1(ac)));
+			a = L::add(L::template rotl<S>(a), b);
+		}
+		template <class L, int S>
+		inline void II(typename L::V& a, typename L::V b, typename L::V c, typename L::V d, typename L::V x, unsigned int ac)
+		{
+			a = L::add(a, L::add(L::add(L::xor_(c, L::or_(b, L::not_(d))), x), L::set1(ac)));
+			a = L::add(L::template rotl<S>(a), b);
+		}
+
+		/*MD5::transformͬ64,ֻÿͬʱNϢ*/
+		template <class L>
+		void transform(typename L::V st[4], const unsigned char* const blk[L::N])
+		{
+			typename L::V a = st[0], b = st[1], c = st[2], d = st[3], x[16];
+			for (size_t i = 0; i < 16; i++)
+			{
+				x[i] = L::gather(blk, i * 4);
+			}
+
+			/* Round 1 */
+			FF<L, 7>(a, b, c, d, x[0], 0xd76aa478);
+			FF<L, 12>(d, a, b, c, x[1], 0xe8c7b756);
+			FF<L, 17>(c, d, a, b, x[2], 0x242070db);
+			FF<L, 22>(b, c, d, a, x[3], 0xc1bdceee);
+			FF<L, 7>(a, b, c, d, x[4], 0xf57c0faf);
+			FF<L, 12>(d, a, b, c, x[5], 0x4787c62a);
+			FF<L, 17>(c, d, a, b, x[6], 0xa8304613);
+			FF<L, 22>(b, c, d, a, x[7], 0xfd469501);
+			FF<L, 7>(a, b, c, d, x[8], 0x698098d8);
+			FF<L, 12>(d, a, b, c, x[9], 0x8b44f7af);
+			FF<L, 17>(c, d, a, b, x[10], 0xffff5bb1);
+			FF<L, 22>(b, c, d, a, x[11], 0x895cd7be);
+			FF<L, 7>(a, b, c, d, x[12], 0x6b901122);
+			FF<L, 12>(d, a, b, c, x[13], 0xfd987193);
+			FF<L, 17>(c, d, a, b, x[14], 0xa679438e);
+			FF<L, 22>(b, c, d, a, x[15], 0x49b40821);
+
+			/* Round 2 */
+			GG<L, 5>(a, b, c, d, x[1], 0xf61e2562);
+			GG<L, 9>(d, a, b, c, x[6], 0xc040b340);
+			GG<L, 14>(c, d, a, b, x[11], 0x265e5a51);
+			GG<L, 20>(b, c, d, a, x[0], 0xe9b6c7aa);
+			GG<L, 5>(a, b, c, d, x[5], 0xd62f105d);
+			GG<L, 9>(d, a, b, c, x[10], 0x2441453);
+			GG<L, 14>(c, d, a, b, x[15], 0xd8a1e681);
+			GG<L, 20>(b, c, d, a, x[4], 0xe7d3fbc8);
+			GG<L, 5>(a, b, c, d, x[9], 0x21e1cde6);
+			GG<L, 9>(d, a, b, c, x[14], 0xc33707d6);
+			GG<L, 14>(c, d, a, b, x[3], 0xf4d50d87);
+			GG<L, 20>(b, c, d, a, x[8], 0x455a14ed);
+			GG<L, 5>(a, b, c, d, x[13], 0xa9e3e905);
+			GG<L, 9>(d, a, b, c, x[2], 0xfcefa3f8);
+			GG<L, 14>(c, d, a, b, x[7], 0x676f02d9);
+			GG<L, 20>(b, c, d, a, x[12], 0x8d2a4c8a);
+
+			/* Round 3 */
+			HH<L, 4>(a, b, c, d, x[5], 0xfffa3942);
+			HH<L, 11>(d, a, b, c, x[8], 0x8771f681);
+			HH<L, 16>(c, d, a, b, x[11], 0x6d9d6122);
+			HH<L, 23>(b, c, d, a, x[14], 0xfde5380c);
+			HH<L, 4>(a, b, c, d, x[1], 0xa4beea44);
+			HH<L, 11>(d, a, b, c, x[4], 0x4bdecfa9);
+			HH<L, 16>(c, d, a, b, x[7], 0xf6bb4b60);
+			HH<L, 23>(b, c, d, a, x[10], 0xbebfbc70);
+			HH<L, 4>(a, b, c, d, x[13], 0x289b7ec6);
+			HH<L, 11>(d, a, b, c, x[0], 0xeaa127fa);
+			HH<L, 16>(c, d, a, b, x[3], 0xd4ef3085);
+			HH<L, 23>(b, c, d, a, x[6], 0x4881d05);
+			HH<L, 4>(a, b, c, d, x[9], 0xd9d4d039);
+			HH<L, 11>(d, a, b, c, x[12], 0xe6db99e5);
+			HH<L, 16>(c, d, a, b, x[15], 0x1fa27cf8);
+			HH<L, 23>(b, c, d, a, x[2], 0xc4ac5665);
+
+			/* Round 4 */
+			II<L, 6>(a, b, c, d, x[0], 0xf4292244);
+			II<L, 10>(d, a, b, c, x[7], 0x432aff97);
+			II<L, 15>(c, d, a, b, x[14], 0xab9423a7);
+			II<L, 21>(b, c, d, a, x[5], 0xfc93a039);
+			II<L, 6>(a, b, c, d, x[12], 0x655b59c3);
+			II<L, 10>(d, a, b, c, x[3], 0x8f0ccc92);
+			II<L, 15>(c, d, a, b, x[10], 0xffeff47d);
+			II<L, 21>(b, c, d, a, x[1], 0x85845dd1);
+			II<L, 6>(a, b, c, d, x[8], 0x6fa87e4f);
+			II<L, 10>(d, a, b, c, x[15], 0xfe2ce6e0);
+			II<L, 15>(c, d, a, b, x[6], 0xa3014314);
+			II<L, 21>(b, c, d, a, x[13], 0x4e0811a1);
+			II<L, 6>(a, b, c, d, x[4], 0xf7537e82);
+			II<L, 10>(d, a, b, c, x[11], 0xbd3af235);
+			II<L, 15>(c, d, a, b, x[2], 0x2ad7d2bb);
+			II<L, 21>(b, c, d, a, x[9], 0xeb86d391);
+
+			st[0] = L::add(st[0], a);
+			st[1] = L::add(st[1], b);
+			st[2] = L::add(st[2], c);
+			st[3] = L::add(st[3], d);
+		}
+
+		/*
+		* һ(N)Ϣ.ͨͬƽ,Ȳͨι,
+		* ڸһ鴦ʱȡͨĽ.
+		*/
+		template <class L>
+		void hash_group(const unsigned char* const* data, const size_t* size, const size_t* index, size_t count, unsigned char* digest)
+		{
+			constexpr size_t N = L::N;
+			alignas(32) unsigned char tail[N][128];
+			static const unsigned char zero_block[64]{};
+			size_t full[N]{}, total[N]{}, max_total = 0;
+
+			for (size_t l = 0; l < count; l++)
+			{
+				const size_t len = size[index[l]];
+				const size_t rem = len & 63;
+				full[l] = len >> 6;
+				const size_t tail_blocks = rem < 56 ? 1 : 2;
+				memset(tail[l], 0, sizeof(tail[l]));
+				if (rem)
+				{
+					memcpy(tail[l], data[index[l]] + (full[l] << 6), rem);
+				}
+				tail[l][rem] = 0x80;
+				const unsigned long long bits = (unsigned long long)len << 3;
+				unsigned char* plen = tail[l] + tail_blocks * 64 - 8;
+				for (size_t i = 0; i < 8; i++)
+				{
+					plen[i] = (unsigned char)(bits >> (i * 8));
+				}
+				total[l] = full[l] + tail_blocks;
+				if (total[l] > max_total)
+				{
+					max_total = total[l];
+				}
+			}
+
+			typename L::V st[4] = { L::set1(0x67452301), L::set1(0xefcdab89), L::set1(0x98badcfe), L::set1(0x10325476) };
+			const unsigned char* blk[N];
+			alignas(32) unsigned int out[4][N];
+			for (size_t b = 0; b < max_total; b++)
+			{
+				bool any_done = false;
+				for (size_t l = 0; l < N; l++)
+				{
+					if (l >= count || b >= total[l])
+					{
+						blk[l] = zero_block;
+					}
+					else if (b < full[l])
+					{
+						blk[l] = data[index[l]] + (b << 6);
+					}
+					else
+					{
+						blk[l] = tail[l] + ((b - full[l]) << 6);
+					}
+					if (l < count && b + 1 == total[l])
+					{
+						any_done = true;
+					}
+				}
+				transform<L>(st, blk);
+				if (!any_done)
+				{
+					continue;
+				}
+				for (size_t i = 0; i < 4; i++)
+				{
+					L::store(st[i], out[i]);
+				}
+				for (size_t l = 0; l < count; l++)
+				{
+					if (b + 1 != total[l])
+					{
+						continue;
+					}
+					unsigned char* dst = digest + index[l] * 16;
+					for (size_t i = 0; i < 4; i++)
+					{
+						dst[i * 4] = (unsigned char)(out[i][l] & 0xff);
+						dst[i * 4 + 1] = (unsigned char)((out[i][l] >> 8) & 0xff);
+						dst[i * 4 + 2] = (unsigned char)((out[i][l] >> 16) & 0xff);
+						dst[i * 4 + 3] = (unsigned char)((out[i][l] >> 24) & 0xff);
+					}
+				}
+			}
+		}
+
+		inline bool cpu_has_avx2()
+		{
+			static const bool s_avx2 = []() {
+				int info[4]{};
+				__cpuid(info, 0);
+				if (info[0] < 7)
+				{
+					return false;
+				}
+				__cpuid(info, 1);
+				/*OSXSAVEAVX,ȷϵͳᱣYMMĴ*/
+				if ((info[2] & (1 << 27)) == 0 || (info[2] & (1 << 28)) == 0)
+				{
+					return false;
+				}
+				if ((_xgetbv(0) & 6) != 6)
+				{
+					return false;
+				}
+				__cpuidex(info, 7, 0);
+				return (info[1] & (1 << 5)) != 0;
+			}();
+			return s_avx2;
+		}
+
+		template <class L>
+		void hash_many(const unsigned char* const* data, const size_t* size, size_t count, unsigned char* digest)
+		{
+			/*,ʹͬڸͨĿӽ,ٿת*/
+			std::vector<size_t> order(count);
+			for (size_t i = 0; i < count; i++)
+			{
+				order[i] = i;
+			}
+			std::stable_sort(order.begin(), order.end(), [size](size_t a, size_t b) { return size[a] < size[b]; });
+			for (size_t i = 0; i < count; i += L::N)
+			{
+				hash_group<L>(data, size, order.data() + i, (std::min)(L::N, count - i), digest);
+			}
+		}
+
+		/*countϢMD5,i16ֽڽдdigest + i * 16*/
+		inline void md5_many(const unsigned char* const* data, const size_t* size, size_t count, unsigned char* digest)
+		{
+			if (count == 1)
+			{
+				memcpy(digest, MD5(data[0], size[0]).GetMd5(), 16);
+				return;
+			}
+			if (cpu_has_avx2())
+			{
+				hash_many<lanes_avx2>(data, size, count, digest);
+			}
+			else
+			{
+				hash_many<lanes_sse2>(data, size, count, digest);
+			}
+		}
+	}
+}
+
+
+namespace elibstl {
+	namespace hash {
+		namespace {
+			class md5_hasher : public hasher
+			{
+				MD5 m_md5;
+			public:
+				void update(const unsigned char* data, size_t size) override { m_md5.update(data, size); }
+				std::vector<unsigned char> final() override
+				{
+					const unsigned char* digest = m_md5.GetMd5();
+					return std::vector<unsigned char>(digest, digest + 16);
+				}
+				void reset() override { m_md5.reset(); }
+				hasher* clone() const override { return new md5_hasher(*this); }
+				size_t digest_size() const override { return 16; }
+			};
+		}
+		hasher* create_md5_hasher()
+		{
+			return new md5_hasher;
+		}
+	}
 }
 
 
@@ -354,3 +716,273 @@ FucInfo Fn_eStl_GetMd5A = { {
 	ESTLARG(Args)
 	} ,ESTLFNAME(fn_eStl_GetMd5) };
 
+
+static ARG_INFO Args_Array[] =
+{
+	{
+		/*name*/    "",
+		/*explain*/ ("ȡMD5ֽڼ,ÿԱ"),
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    DATA_TYPE::SDT_BIN,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_RECEIVE_ARRAY_DATA
+	}
+};
+EXTERN_C void fn_eStl_GetMd5ArrayW(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	size_t count = 0;
+	LPBYTE* pAryData = elibstl::get_array_element_inf<LPBYTE*>(pArgInf[0].m_pAryData, &count);
+	if (count == 0)
+	{
+		pRetData->m_pAryData = elibstl::empty_array();
+		return;
+	}
+	std::vector<const unsigned char*> data(count);
+	std::vector<size_t> size(count);
+	for (size_t i = 0; i < count; i++)
+	{
+		if (pAryData[i] == NULL)
+		{
+			data[i] = nullptr;
+			size[i] = 0;
+		}
+		else
+		{
+			data[i] = pAryData[i] + sizeof(INT) * 2;
+			size[i] = *reinterpret_cast<INT*>(pAryData[i] + sizeof(INT));
+		}
+	}
+	std::vector<unsigned char> digest(count * 16);
+	md5_mb::md5_many(data.data(), size.data(), count, digest.data());
+
+	static constexpr wchar_t hex[] = L"0123456789abcdef";
+	std::vector<std::wstring> ret(count);
+	for (size_t i = 0; i < count; i++)
+	{
+		ret[i].reserve(32);
+		for (size_t j = 0; j < 16; j++)
+		{
+			ret[i].push_back(hex[digest[i * 16 + j] >> 4]);
+			ret[i].push_back(hex[digest[i * 16 + j] & 0xf]);
+		}
+	}
+	pRetData->m_pAryData = elibstl::create_text_array(ret);
+}
+FucInfo Fn_eStl_GetMd5ArrayW = { {
+		/*ccname*/  ("ȡժҪW"),
+		/*egname*/  ("get_md5_str_array"),
+		/*explain*/ ("ֽڼÿԱMD5ժҪı,˳һ¡ڲͬʱԱ(֧AVX2ʱ8·,4·),СʱԶáȡժҪW"),
+		/*category*/17,
+		/*state*/   CT_RETRUN_ARY_TYPE_DATA,
+		/*ret*/     DATA_TYPE::SDT_BIN,
+		/*reserved*/NULL,
+		/*level*/   LVL_HIGH,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+	ESTLARG(Args_Array)
+	} ,ESTLFNAME(fn_eStl_GetMd5ArrayW) };
+
+
+
+/*MD5ϣelibstl::hash::hasher,ֻһMD5hasher*/
+using elibstl::hash::hasher;
+
+//
+EXTERN_C void fn_md5_structure(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto& self = elibstl::args_to_obj<hasher>(pArgInf);
+	self = elibstl::hash::create_md5_hasher();
+}
+FucInfo Fn_md5_structure = { {
+		/*ccname*/  "",
+		/*egname*/  "",
+		/*explain*/ NULL,
+		/*category*/ -1,
+		/*state*/  _CMD_OS(__OS_WIN) | CT_IS_HIDED | CT_IS_OBJ_CONSTURCT_CMD,
+		/*ret*/ _SDT_NULL,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*ArgCount*/0,
+		/*arg lp*/  NULL,
+	} ,ESTLFNAME(fn_md5_structure) };
+
+static ARG_INFO s_CopyArgs[] =
+{
+	{
+		/*name*/    "",
+		/*explain*/ "",
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/	(DATA_TYPE)27,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_DEFAULT_VALUE_IS_EMPTY,
+	}
+};
+//
+EXTERN_C void fn_md5_copy(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto& self = elibstl::classhelp::get_this<hasher>(pArgInf);
+	const auto& rht = elibstl::classhelp::get_other<hasher>(pArgInf);
+	self = rht ? rht->clone() : elibstl::hash::create_md5_hasher();
+}
+FucInfo Fn_md5_copy = { {
+		/*ccname*/  "",
+		/*egname*/  "",
+		/*explain*/ NULL,
+		/*category*/ -1,
+		/*state*/   _CMD_OS(__OS_WIN) | CT_IS_HIDED | CT_IS_OBJ_COPY_CMD,
+		/*ret*/ _SDT_NULL,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*ArgCount*/1,
+		/*arg lp*/  s_CopyArgs,
+	} ,ESTLFNAME(fn_md5_copy) };
+
+//
+EXTERN_C void fn_md5_destruct(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto& self = elibstl::args_to_obj<hasher>(pArgInf);
+	delete self;
+	self = nullptr;
+}
+FucInfo Fn_md5_destruct = { {
+		/*ccname*/  "",
+		/*egname*/  "",
+		/*explain*/ NULL,
+		/*category*/ -1,
+		/*state*/    _CMD_OS(__OS_WIN) | CT_IS_HIDED | CT_IS_OBJ_FREE_CMD,
+		/*ret*/ _SDT_NULL,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*ArgCount*/0,
+		/*arg lp*/  NULL,
+	} ,ESTLFNAME(fn_md5_destruct) };
+
+static ARG_INFO Args_Update[] =
+{
+	{
+		/*name*/    "",
+		/*explain*/ ("׷Ӽ,һṩ"),
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    DATA_TYPE::SDT_BIN,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_NONE
+	}
+};
+EXTERN_C void fn_md5_update(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto& self = elibstl::args_to_obj<hasher>(pArgInf);
+	for (INT i = 1; i < nArgCount; i++)
+	{
+		auto data = elibstl::args_to_ebin(pArgInf, i);
+		if (data)
+		{
+			self->update(data->m_data, data->m_size);
+		}
+	}
+}
+FucInfo Fn_md5_update = { {
+		/*ccname*/  "",
+		/*egname*/  "update",
+		/*explain*/ "׷ӵժҪ,ɷֶμ,һԼȫͬڴļֿȡ㡣",
+		/*category*/ -1,
+		/*state*/    CT_ALLOW_APPEND_NEW_ARG | _CMD_OS(__OS_WIN) ,
+		/*ret*/ _SDT_NULL,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		ESTLARG(Args_Update)
+	} ,ESTLFNAME(fn_md5_update) };
+
+EXTERN_C void fn_md5_final_str(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto& self = elibstl::args_to_obj<hasher>(pArgInf);
+	pRetData->m_pBin = elibstl::clone_textw(elibstl::hash::to_hex(self->final()));
+}
+FucInfo Fn_md5_final_str = { {
+		/*ccname*/  "ȡժҪı",
+		/*egname*/  "final_str",
+		/*explain*/ "ĿǰΪֹȫݵMD5ժҪıȡӰڲ״̬,֮Կɼݡ",
+		/*category*/ -1,
+		/*state*/    _CMD_OS(__OS_WIN) ,
+		/*ret*/ SDT_BIN,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*ArgCount*/0,
+		/*arg lp*/  0,
+	} ,ESTLFNAME(fn_md5_final_str) };
+
+EXTERN_C void fn_md5_final(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto& self = elibstl::args_to_obj<hasher>(pArgInf);
+	auto digest = self->final();
+	pRetData->m_pBin = elibstl::clone_bin(digest.data(), digest.size());
+}
+FucInfo Fn_md5_final = { {
+		/*ccname*/  "ȡժҪ",
+		/*egname*/  "final",
+		/*explain*/ "ĿǰΪֹȫݵ16ֽMD5ԭʼժҪ",
+		/*category*/ -1,
+		/*state*/    _CMD_OS(__OS_WIN) ,
+		/*ret*/ SDT_BIN,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*ArgCount*/0,
+		/*arg lp*/  0,
+	} ,ESTLFNAME(fn_md5_final) };
+
+EXTERN_C void fn_md5_reset(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto& self = elibstl::args_to_obj<hasher>(pArgInf);
+	self->reset();
+}
+FucInfo Fn_md5_reset = { {
+		/*ccname*/  "",
+		/*egname*/  "reset",
+		/*explain*/ "Ѽ,ԱµժҪ",
+		/*category*/ -1,
+		/*state*/    _CMD_OS(__OS_WIN) ,
+		/*ret*/ _SDT_NULL,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*ArgCount*/0,
+		/*arg lp*/  0,
+	} ,ESTLFNAME(fn_md5_reset) };
+
+static INT s_dtCmdIndexcommobj_md5[] = { 367,368,369,370,371,372,373 };
+namespace elibstl {
+
+
+	LIB_DATA_TYPE_INFO Obj_Md5 =
+	{
+		"MD5",
+		"Md5Hasher",
+		"ɷֶμݵMD5ժҪ,޷һڴĴ",
+		sizeof(s_dtCmdIndexcommobj_md5) / sizeof(s_dtCmdIndexcommobj_md5[0]),
+		 s_dtCmdIndexcommobj_md5,
+		_DT_OS(__OS_WIN),
+		0,
+		NULL,
+		NULL,
+		NULL,
+		NULL,
+		NULL,
+		0,
+		0
+	};
+}
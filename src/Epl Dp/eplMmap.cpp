@@ -0,0 +1,826 @@
+#include"ElibHelp.h"
+#include"eplMmap.h"
+#include<algorithm>
+#include<cstring>
+#include<climits>
+#ifndef _WIN32
+#include<fcntl.h>
+#include<sys/mman.h>
+#include<sys/stat.h>
+#include<unistd.h>
+#endif
+
+namespace {
+	constexpr std::uint64_t kDefaultWindow32 = 64ull * 1024 * 1024;
+
+#ifdef _WIN32
+	/*PrefetchVirtualMemoryWin8ʼ,̬ȡ*/
+	struct memory_range
+	{
+		PVOID address;
+		SIZE_T size;
+	};
+	using PrefetchVirtualMemory_t = BOOL(WINAPI*)(HANDLE, ULONG_PTR, memory_range*, ULONG);
+
+	PrefetchVirtualMemory_t get_prefetch()
+	{
+		static const auto fn = reinterpret_cast<PrefetchVirtualMemory_t>(
+			::GetProcAddress(::GetModuleHandleW(L"kernel32.dll"), "PrefetchVirtualMemory"));
+		return fn;
+	}
+#endif
+}
+
+namespace elibstl {
+	namespace mmap {
+		bool mapped_file::open(const path_type& path, bool writable, access_hint hint)
+		{
+			close();
+			if (path.empty())
+				return false;
+			m_writable = writable;
+			m_hint = hint;
+#ifdef _WIN32
+			DWORD flags = FILE_ATTRIBUTE_NORMAL;
+			if (hint == access_hint::sequential)
+				flags |= FILE_FLAG_SEQUENTIAL_SCAN;
+			else if (hint == access_hint::random)
+				flags |= FILE_FLAG_RANDOM_ACCESS;
+			m_file = ::CreateFileW(path.c_str(), GENERIC_READ | (writable ? GENERIC_WRITE : 0),
+				writable ? FILE_SHARE_READ : (FILE_SHARE_READ | FILE_SHARE_WRITE), NULL, OPEN_EXISTING, flags, NULL);
+			if (m_file == INVALID_HANDLE_VALUE)
+				return false;
+			LARGE_INTEGER size;
+			if (!::GetFileSizeEx(m_file, &size))
+			{
+				close();
+				return false;
+			}
+			m_size = static_cast<std::uint64_t>(size.QuadPart);
+			SYSTEM_INFO info;
+			::GetSystemInfo(&info);
+			m_granularity = info.dwAllocationGranularity;
+			/*ļܴӳ,ɹ,ֻûпɷʵ*/
+			if (m_size > 0)
+			{
+				m_mapping = ::CreateFileMappingW(m_file, NULL, writable ? PAGE_READWRITE : PAGE_READONLY, 0, 0, NULL);
+				if (m_mapping == NULL)
+				{
+					close();
+					return false;
+				}
+			}
+#else
+			m_fd = ::open(path.c_str(), writable ? O_RDWR : O_RDONLY);
+			if (m_fd < 0)
+				return false;
+			struct stat st;
+			if (::fstat(m_fd, &st) != 0)
+			{
+				close();
+				return false;
+			}
+			m_size = static_cast<std::uint64_t>(st.st_size);
+			m_granularity = static_cast<std::uint64_t>(::sysconf(_SC_PAGESIZE));
+			if (hint == access_hint::sequential)
+				::posix_fadvise(m_fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+			else if (hint == access_hint::random)
+				::posix_fadvise(m_fd, 0, 0, POSIX_FADV_RANDOM);
+#endif
+			return true;
+		}
+
+		void mapped_file::close()
+		{
+			for (auto& item : m_windows)
+				unmap(item);
+			m_windows.clear();
+#ifdef _WIN32
+			if (m_mapping != NULL)
+			{
+				::CloseHandle(m_mapping);
+				m_mapping = NULL;
+			}
+			if (m_file != INVALID_HANDLE_VALUE)
+			{
+				::CloseHandle(m_file);
+				m_file = INVALID_HANDLE_VALUE;
+			}
+#else
+			if (m_fd >= 0)
+			{
+				::close(m_fd);
+				m_fd = -1;
+			}
+#endif
+			m_size = 0;
+			m_writable = false;
+		}
+
+		bool mapped_file::is_open() const
+		{
+#ifdef _WIN32
+			return m_file != INVALID_HANDLE_VALUE;
+#else
+			return m_fd >= 0;
+#endif
+		}
+
+		void mapped_file::set_window_size(std::uint64_t bytes)
+		{
+			m_window_size = bytes;
+		}
+
+		std::uint64_t mapped_file::window_size() const
+		{
+			const auto granularity = (std::max<std::uint64_t>)(m_granularity, 1);
+			std::uint64_t bytes = m_window_size;
+			if (bytes == 0)
+				bytes = sizeof(void*) >= 8 ? (std::max)(m_size, granularity) : kDefaultWindow32;
+			return (bytes + granularity - 1) / granularity * granularity;
+		}
+
+		void mapped_file::unmap(window& item)
+		{
+			if (item.base == nullptr)
+				return;
+#ifdef _WIN32
+			::UnmapViewOfFile(item.base);
+#else
+			::munmap(item.base, item.size);
+#endif
+			item.base = nullptr;
+		}
+
+		void mapped_file::apply_hint(const window& item) const
+		{
+#ifndef _WIN32
+			if (m_hint == access_hint::sequential)
+				::madvise(item.base, item.size, MADV_SEQUENTIAL);
+			else if (m_hint == access_hint::random)
+				::madvise(item.base, item.size, MADV_RANDOM);
+#else
+			(void)item;
+#endif
+		}
+
+		mapped_file::window* mapped_file::map_window(std::uint64_t offset, size_t length)
+		{
+			const auto start = offset - offset % m_granularity;
+			const auto need = offset - start + length;
+			const auto bytes = (std::min)((std::max)(window_size(), need), m_size - start);
+			if (bytes > static_cast<std::uint64_t>(SIZE_MAX))
+				return nullptr;
+
+			window item;
+			item.offset = start;
+			item.size = static_cast<size_t>(bytes);
+#ifdef _WIN32
+			item.base = static_cast<unsigned char*>(::MapViewOfFile(m_mapping, m_writable ? FILE_MAP_WRITE : FILE_MAP_READ,
+				static_cast<DWORD>(start >> 32), static_cast<DWORD>(start), item.size));
+#else
+			void* base = ::mmap(nullptr, item.size, PROT_READ | (m_writable ? PROT_WRITE : 0), MAP_SHARED, m_fd, static_cast<off_t>(start));
+			item.base = base == MAP_FAILED ? nullptr : static_cast<unsigned char*>(base);
+#endif
+			if (item.base == nullptr)
+				return nullptr;
+			apply_hint(item);
+
+			/*ʱ滻δõһ*/
+			if (m_windows.size() < kMaxWindows)
+			{
+				m_windows.push_back(item);
+				return &m_windows.back();
+			}
+			auto oldest = std::min_element(m_windows.begin(), m_windows.end(),
+				[](const window& a, const window& b) { return a.tick < b.tick; });
+			unmap(*oldest);
+			*oldest = item;
+			return &*oldest;
+		}
+
+		const unsigned char* mapped_file::view(std::uint64_t offset, size_t& length)
+		{
+			if (!is_open() || offset >= m_size)
+			{
+				length = 0;
+				return nullptr;
+			}
+			if (length > m_size - offset)
+				length = static_cast<size_t>(m_size - offset);
+			const auto end = offset + (std::max<size_t>)(length, 1);
+
+			window* hit = nullptr;
+			for (auto& item : m_windows)
+			{
+				if (item.offset <= offset && end <= item.offset + item.size)
+				{
+					hit = &item;
+					break;
+				}
+			}
+			if (hit == nullptr)
+				hit = map_window(offset, length);
+			if (hit == nullptr)
+			{
+				length = 0;
+				return nullptr;
+			}
+			hit->tick = ++m_tick;
+			return hit->base + (offset - hit->offset);
+		}
+
+		unsigned char* mapped_file::view_writable(std::uint64_t offset, size_t& length)
+		{
+			if (!m_writable)
+			{
+				length = 0;
+				return nullptr;
+			}
+			return const_cast<unsigned char*>(view(offset, length));
+		}
+
+		bool mapped_file::read(std::uint64_t offset, void* out, size_t size)
+		{
+			if (offset > m_size || size > m_size - offset)
+				return false;
+			auto dest = static_cast<unsigned char*>(out);
+			const auto chunk_max = window_size();
+			while (size > 0)
+			{
+				size_t chunk = static_cast<size_t>((std::min<std::uint64_t>)(size, chunk_max));
+				const size_t want = chunk;
+				const auto src = view(offset, chunk);
+				if (src == nullptr || chunk < want)
+					return false;
+				std::memcpy(dest, src, chunk);
+				dest += chunk;
+				offset += chunk;
+				size -= chunk;
+			}
+			return true;
+		}
+
+		bool mapped_file::read_to(epldatatype::MemBin& out, std::uint64_t offset, size_t size)
+		{
+			const auto old = out.size();
+			out.resize(old + size);
+			if (read(offset, out.data() + old, size))
+				return true;
+			out.resize(old);
+			return false;
+		}
+
+		bool mapped_file::write(std::uint64_t offset, const void* data, size_t size)
+		{
+			if (!m_writable || offset > m_size || size > m_size - offset)
+				return false;
+			auto src = static_cast<const unsigned char*>(data);
+			const auto chunk_max = window_size();
+			while (size > 0)
+			{
+				size_t chunk = static_cast<size_t>((std::min<std::uint64_t>)(size, chunk_max));
+				const size_t want = chunk;
+				const auto dest = view_writable(offset, chunk);
+				if (dest == nullptr || chunk < want)
+					return false;
+				std::memcpy(dest, src, chunk);
+				src += chunk;
+				offset += chunk;
+				size -= chunk;
+			}
+			return true;
+		}
+
+		bool mapped_file::prefetch(std::uint64_t offset, std::uint64_t length)
+		{
+			if (!is_open() || offset >= m_size)
+				return false;
+			length = (std::min)(length, m_size - offset);
+#ifdef _WIN32
+			/*ֻܶӳĵַԤ,Χһ*/
+			const auto fn = get_prefetch();
+			if (fn == nullptr)
+				return false;
+			size_t bytes = static_cast<size_t>((std::min)(length, window_size()));
+			const auto p = view(offset, bytes);
+			if (p == nullptr)
+				return false;
+			memory_range range{ const_cast<unsigned char*>(p), bytes };
+			return fn(::GetCurrentProcess(), 1, &range, 0) != FALSE;
+#else
+			/*ļԤ,Ҫӳ*/
+			return ::posix_fadvise(m_fd, static_cast<off_t>(offset), static_cast<off_t>(length), POSIX_FADV_WILLNEED) == 0;
+#endif
+		}
+
+		bool mapped_file::flush()
+		{
+			if (!m_writable)
+				return false;
+			bool ok = true;
+			for (const auto& item : m_windows)
+			{
+#ifdef _WIN32
+				ok = ::FlushViewOfFile(item.base, item.size) != FALSE && ok;
+#else
+				ok = ::msync(item.base, item.size, MS_SYNC) == 0 && ok;
+#endif
+			}
+#ifdef _WIN32
+			ok = ::FlushFileBuffers(m_file) != FALSE && ok;
+#endif
+			return ok;
+		}
+	}
+}
+
+using elibstl::mmap::mapped_file;
+
+//
+EXTERN_C void fn_mmap_structure(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto& self = elibstl::args_to_obj<mapped_file>(pArgInf);
+	self = new mapped_file;
+}
+FucInfo Fn_mmap_structure = { {
+		/*ccname*/  "",
+		/*egname*/  "",
+		/*explain*/ NULL,
+		/*category*/ -1,
+		/*state*/  _CMD_OS(__OS_WIN) | CT_IS_HIDED | CT_IS_OBJ_CONSTURCT_CMD,
+		/*ret*/ _SDT_NULL,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*ArgCount*/0,
+		/*arg lp*/  NULL,
+	} ,ESTLFNAME(fn_mmap_structure) };
+
+static ARG_INFO s_MmapCopyArgs[] =
+{
+	{
+		/*name*/    "",
+		/*explain*/ "",
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/	(DATA_TYPE)32,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_DEFAULT_VALUE_IS_EMPTY,
+	}
+};
+//
+EXTERN_C void fn_mmap_copy(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto& self = elibstl::classhelp::get_this<mapped_file>(pArgInf);
+	self = new mapped_file;
+	put_errmsg(L"ڴӳļռӳͼ,ܸ,Ƶõδ򿪵¶!");
+}
+FucInfo Fn_mmap_copy = { {
+		/*ccname*/  "",
+		/*egname*/  "",
+		/*explain*/ NULL,
+		/*category*/ -1,
+		/*state*/   _CMD_OS(__OS_WIN) | CT_IS_HIDED | CT_IS_OBJ_COPY_CMD,
+		/*ret*/ _SDT_NULL,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*ArgCount*/1,
+		/*arg lp*/  s_MmapCopyArgs,
+	} ,ESTLFNAME(fn_mmap_copy) };
+
+//
+EXTERN_C void fn_mmap_destruct(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto& self = elibstl::args_to_obj<mapped_file>(pArgInf);
+	if (self)
+		delete self;
+	self = nullptr;
+}
+FucInfo Fn_mmap_destruct = { {
+		/*ccname*/  "",
+		/*egname*/  "",
+		/*explain*/ NULL,
+		/*category*/ -1,
+		/*state*/    _CMD_OS(__OS_WIN) | CT_IS_HIDED | CT_IS_OBJ_FREE_CMD,
+		/*ret*/ _SDT_NULL,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*ArgCount*/0,
+		/*arg lp*/  NULL,
+	} ,ESTLFNAME(fn_mmap_destruct) };
+
+static ARG_INFO Args_MmapOpen[] =
+{
+	{
+		/*name*/    "ļ",
+		/*explain*/ "",
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_BIN,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_NONE,
+	},
+	{
+		/*name*/    "Ƿд",
+		/*explain*/ "Ϊʱͨдֽڼ޸ļ,ܸıļߴ硣ĬΪ",
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_BOOL,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_DEFAULT_VALUE_IS_EMPTY,
+	},
+	{
+		/*name*/    "ʷʽ",
+		/*explain*/ "ʾϵͳηļ:0ͨ;1˳ɨ,Ԥ;2,ԤĬΪ0",
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_INT,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_DEFAULT_VALUE_IS_EMPTY,
+	}
+};
+EXTERN_C void fn_mmap_open(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto& self = elibstl::args_to_obj<mapped_file>(pArgInf);
+	const auto writable = elibstl::args_to_data<BOOL>(pArgInf, 2).value_or(FALSE);
+	auto hint = elibstl::mmap::access_hint::normal;
+	switch (elibstl::args_to_data<INT>(pArgInf, 3).value_or(0))
+	{
+	case 1: hint = elibstl::mmap::access_hint::sequential; break;
+	case 2: hint = elibstl::mmap::access_hint::random; break;
+	}
+	pRetData->m_bool = self->open(std::wstring(elibstl::args_to_wsdata(pArgInf, 1)), writable != FALSE, hint);
+}
+FucInfo Fn_mmap_open = { {
+		/*ccname*/  "",
+		/*egname*/  "open",
+		/*explain*/ "ӳһѴڵļ,֮ƫֱӷļ,Ҫƶдλáɹ档",
+		/*category*/ -1,
+		/*state*/    _CMD_OS(__OS_WIN) ,
+		/*ret*/ SDT_BOOL,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		ESTLARG(Args_MmapOpen)
+	} ,ESTLFNAME(fn_mmap_open) };
+
+EXTERN_C void fn_mmap_close(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto& self = elibstl::args_to_obj<mapped_file>(pArgInf);
+	self->close();
+}
+FucInfo Fn_mmap_close = { {
+		/*ccname*/  "ر",
+		/*egname*/  "close",
+		/*explain*/ "ӳ䲢رļ,֮ǰȡָ롱õָȫʧЧ",
+		/*category*/ -1,
+		/*state*/    _CMD_OS(__OS_WIN) ,
+		/*ret*/ _SDT_NULL,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*ArgCount*/0,
+		/*arg lp*/  0,
+	} ,ESTLFNAME(fn_mmap_close) };
+
+EXTERN_C void fn_mmap_size(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto& self = elibstl::args_to_obj<mapped_file>(pArgInf);
+	pRetData->m_int64 = static_cast<INT64>(self->size());
+}
+FucInfo Fn_mmap_size = { {
+		/*ccname*/  "ȡߴ",
+		/*egname*/  "size",
+		/*explain*/ "ļߴ,δʱ0",
+		/*category*/ -1,
+		/*state*/    _CMD_OS(__OS_WIN) ,
+		/*ret*/ SDT_INT64,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*ArgCount*/0,
+		/*arg lp*/  0,
+	} ,ESTLFNAME(fn_mmap_size) };
+
+static ARG_INFO Args_MmapWindow[] =
+{
+	{
+		/*name*/    "ڳߴ",
+		/*explain*/ "λΪֽ,ȡ64KBΪ0ʱʹĬֵ:64MB",
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_INT64,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_NONE,
+	}
+};
+EXTERN_C void fn_mmap_set_window(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto& self = elibstl::args_to_obj<mapped_file>(pArgInf);
+	self->set_window_size(pArgInf[1].m_int64 > 0 ? static_cast<std::uint64_t>(pArgInf[1].m_int64) : 0);
+}
+FucInfo Fn_mmap_set_window = { {
+		/*ccname*/  "ôڳߴ",
+		/*egname*/  "setWindowSize",
+		/*explain*/ "ļڷֶӳ,ͬʱ4ڡʼʱСЩԽʡַռ,˳ɨʱЩԼӳ䡣ֻӰ֮ӳĴڡ",
+		/*category*/ -1,
+		/*state*/    _CMD_OS(__OS_WIN) ,
+		/*ret*/ _SDT_NULL,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		ESTLARG(Args_MmapWindow)
+	} ,ESTLFNAME(fn_mmap_set_window) };
+
+static ARG_INFO Args_MmapRange[] =
+{
+	{
+		/*name*/    "ƫ",
+		/*explain*/ "0ʼ",
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_INT64,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_NONE,
+	},
+	{
+		/*name*/    "",
+		/*explain*/ "",
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_INT,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_NONE,
+	}
+};
+EXTERN_C void fn_mmap_pointer(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto& self = elibstl::args_to_obj<mapped_file>(pArgInf);
+	if (pArgInf[1].m_int64 < 0 || pArgInf[2].m_int < 0)
+		return;
+	size_t length = static_cast<size_t>(pArgInf[2].m_int);
+	const auto p = self->writable() ? self->view_writable(static_cast<std::uint64_t>(pArgInf[1].m_int64), length)
+		: const_cast<unsigned char*>(self->view(static_cast<std::uint64_t>(pArgInf[1].m_int64), length));
+	if (p != nullptr && length == static_cast<size_t>(pArgInf[2].m_int))
+		pRetData->m_int = (int)p;
+}
+FucInfo Fn_mmap_pointer = { {
+		/*ccname*/  "ȡָ",
+		/*egname*/  "pointer",
+		/*explain*/ "ָΧڴеĵַ,ݡΧļβӳʧʱ0ָڡرա֮ǰԼ֮ӳ4´֮ǰЧ;ֻʽʱдõַ",
+		/*category*/ -1,
+		/*state*/    _CMD_OS(__OS_WIN) ,
+		/*ret*/ SDT_INT,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		ESTLARG(Args_MmapRange)
+	} ,ESTLFNAME(fn_mmap_pointer) };
+
+EXTERN_C void fn_mmap_read_bin(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto& self = elibstl::args_to_obj<mapped_file>(pArgInf);
+	if (pArgInf[1].m_int64 < 0 || pArgInf[2].m_int <= 0 || static_cast<std::uint64_t>(pArgInf[1].m_int64) >= self->size())
+		return;
+	const auto offset = static_cast<std::uint64_t>(pArgInf[1].m_int64);
+	const auto length = static_cast<size_t>((std::min<std::uint64_t>)(static_cast<std::uint64_t>(pArgInf[2].m_int), self->size() - offset));
+	if (length > static_cast<size_t>(INT_MAX) - 2 * sizeof(INT))
+		return;
+	auto bin = static_cast<LPBYTE>(elibstl::ealloc(static_cast<int>(length + 2 * sizeof(INT))));
+	reinterpret_cast<INT*>(bin)[0] = 1;
+	reinterpret_cast<INT*>(bin)[1] = static_cast<INT>(length);
+	if (self->read(offset, bin + 2 * sizeof(INT), length))
+		pRetData->m_pBin = bin;
+	else
+		elibstl::efree(bin);
+}
+FucInfo Fn_mmap_read_bin = { {
+		/*ccname*/  "ֽڼ",
+		/*egname*/  "read",
+		/*explain*/ "ָΧ,ļβĲֱض,ʧܷؿֽڼ",
+		/*category*/ -1,
+		/*state*/    _CMD_OS(__OS_WIN) ,
+		/*ret*/ SDT_BIN,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		ESTLARG(Args_MmapRange)
+	} ,ESTLFNAME(fn_mmap_read_bin) };
+
+static ARG_INFO Args_MmapOffset[] =
+{
+	{
+		/*name*/    "ƫ",
+		/*explain*/ "0ʼ",
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_INT64,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_NONE,
+	}
+};
+namespace {
+	/*ƫƶȡֵ,Խʱ0*/
+	template<typename T>
+	T read_value(PMDATA_INF pArgInf)
+	{
+		auto& self = elibstl::args_to_obj<mapped_file>(pArgInf);
+		T value{};
+		if (pArgInf[1].m_int64 < 0 || !self->read(static_cast<std::uint64_t>(pArgInf[1].m_int64), value))
+			return T{};
+		return value;
+	}
+}
+EXTERN_C void fn_mmap_read_int(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	pRetData->m_int = read_value<INT>(pArgInf);
+}
+FucInfo Fn_mmap_read_int = { {
+		/*ccname*/  "",
+		/*egname*/  "readInt",
+		/*explain*/ "ȡƫƴ4ֽ,Խʱ0",
+		/*category*/ -1,
+		/*state*/    _CMD_OS(__OS_WIN) ,
+		/*ret*/ SDT_INT,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		ESTLARG(Args_MmapOffset)
+	} ,ESTLFNAME(fn_mmap_read_int) };
+
+EXTERN_C void fn_mmap_read_int64(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	pRetData->m_int64 = read_value<INT64>(pArgInf);
+}
+FucInfo Fn_mmap_read_int64 = { {
+		/*ccname*/  "",
+		/*egname*/  "readInt64",
+		/*explain*/ "ȡƫƴ8ֽ,Խʱ0",
+		/*category*/ -1,
+		/*state*/    _CMD_OS(__OS_WIN) ,
+		/*ret*/ SDT_INT64,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		ESTLARG(Args_MmapOffset)
+	} ,ESTLFNAME(fn_mmap_read_int64) };
+
+EXTERN_C void fn_mmap_read_double(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	pRetData->m_double = read_value<DOUBLE>(pArgInf);
+}
+FucInfo Fn_mmap_read_double = { {
+		/*ccname*/  "˫С",
+		/*egname*/  "readDouble",
+		/*explain*/ "ȡƫƴ8ֽ˫С,Խʱ0",
+		/*category*/ -1,
+		/*state*/    _CMD_OS(__OS_WIN) ,
+		/*ret*/ SDT_DOUBLE,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		ESTLARG(Args_MmapOffset)
+	} ,ESTLFNAME(fn_mmap_read_double) };
+
+static ARG_INFO Args_MmapWrite[] =
+{
+	{
+		/*name*/    "ƫ",
+		/*explain*/ "0ʼ",
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_INT64,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_NONE,
+	},
+	{
+		/*name*/    "",
+		/*explain*/ "",
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_BIN,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_NONE,
+	}
+};
+EXTERN_C void fn_mmap_write(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto& self = elibstl::args_to_obj<mapped_file>(pArgInf);
+	const auto data = elibstl::args_to_ebin(pArgInf, 2);
+	if (pArgInf[1].m_int64 < 0 || data == nullptr || data->m_size == 0)
+		return;
+	pRetData->m_bool = self->write(static_cast<std::uint64_t>(pArgInf[1].m_int64), data->m_data, data->m_size);
+}
+FucInfo Fn_mmap_write = { {
+		/*ccname*/  "дֽڼ",
+		/*egname*/  "write",
+		/*explain*/ "дƫƴ,Կдʽ,Ҳܳļβ޸ڡˢ¡򡰹رաϵͳдش̡ɹ档",
+		/*category*/ -1,
+		/*state*/    _CMD_OS(__OS_WIN) ,
+		/*ret*/ SDT_BOOL,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		ESTLARG(Args_MmapWrite)
+	} ,ESTLFNAME(fn_mmap_write) };
+
+static ARG_INFO Args_MmapPrefetch[] =
+{
+	{
+		/*name*/    "ƫ",
+		/*explain*/ "0ʼ",
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_INT64,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_NONE,
+	},
+	{
+		/*name*/    "",
+		/*explain*/ "ڳߴĲֻᱻ",
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_INT64,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_NONE,
+	}
+};
+EXTERN_C void fn_mmap_prefetch(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto& self = elibstl::args_to_obj<mapped_file>(pArgInf);
+	if (pArgInf[1].m_int64 < 0 || pArgInf[2].m_int64 <= 0)
+		return;
+	pRetData->m_bool = self->prefetch(static_cast<std::uint64_t>(pArgInf[1].m_int64), static_cast<std::uint64_t>(pArgInf[2].m_int64));
+}
+FucInfo Fn_mmap_prefetch = { {
+		/*ccname*/  "Ԥ",
+		/*egname*/  "prefetch",
+		/*explain*/ "ʾϵͳں̨һݶڴ,ȴ,֮ʱȱҳҪWindows 8,ϵͳؼ١",
+		/*category*/ -1,
+		/*state*/    _CMD_OS(__OS_WIN) ,
+		/*ret*/ SDT_BOOL,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		ESTLARG(Args_MmapPrefetch)
+	} ,ESTLFNAME(fn_mmap_prefetch) };
+
+EXTERN_C void fn_mmap_flush(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto& self = elibstl::args_to_obj<mapped_file>(pArgInf);
+	pRetData->m_bool = self->flush();
+}
+FucInfo Fn_mmap_flush = { {
+		/*ccname*/  "ˢ",
+		/*egname*/  "flush",
+		/*explain*/ "޸ĵдش̲ȴ,ֻʱؼ١",
+		/*category*/ -1,
+		/*state*/    _CMD_OS(__OS_WIN) ,
+		/*ret*/ SDT_BOOL,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*ArgCount*/0,
+		/*arg lp*/  0,
+	} ,ESTLFNAME(fn_mmap_flush) };
+
+static INT s_dtCmdIndexcommobj_mmap[] = { 429,430,431,432,433,434,435,436,437,438,439,440,441,442,443 };
+namespace elibstl {
+
+
+	LIB_DATA_TYPE_INFO Obj_MappedFile =
+	{
+		"ڴӳļ",
+		"MappedFile",
+		"ļӳ䵽ڴƫֱӷ,ʺ϶Դļȡַռļڷֶӳ",
+		sizeof(s_dtCmdIndexcommobj_mmap) / sizeof(s_dtCmdIndexcommobj_mmap[0]),
+		 s_dtCmdIndexcommobj_mmap,
+		_DT_OS(__OS_WIN),
+		0,
+		NULL,
+		NULL,
+		NULL,
+		NULL,
+		NULL,
+		0,
+		0
+	};
+}
@@ -0,0 +1,109 @@
+#pragma once
+#ifdef _WIN32
+#include<windows.h>
+#endif
+#include<cstddef>
+#include<cstdint>
+#include<string>
+#include<vector>
+#include<type_traits>
+
+/*
+* ڴӳļ,WindowsʹCreateFileMapping/MapViewOfFile,ƽ̨ʹmmap.
+* ļӳ,ַռļ(32λе20GBļ)Ҳ,
+* ʹõɸڱӳ,ӳ䴰ʱϵͳ.
+* ӳĳߴڴʱȷ,д벻ܳļβ.
+*/
+namespace epldatatype {
+	class MemBin;
+}
+
+namespace elibstl {
+	namespace mmap {
+		enum class access_hint
+		{
+			normal,
+			sequential, /*˳ɨ,ϵͳԤѶҳ*/
+			random,     /*,رԤ*/
+		};
+
+#ifdef _WIN32
+		using path_type = std::wstring;
+#else
+		using path_type = std::string;
+#endif
+
+		class mapped_file
+		{
+		public:
+			/*ͬʱӳĴ*/
+			static constexpr size_t kMaxWindows = 4;
+
+			mapped_file() = default;
+			mapped_file(const mapped_file&) = delete;
+			mapped_file& operator=(const mapped_file&) = delete;
+			~mapped_file() { close(); }
+
+			bool open(const path_type& path, bool writable = false, access_hint hint = access_hint::normal);
+			void close();
+			bool is_open() const;
+			bool writable() const { return m_writable; }
+			std::uint64_t size() const { return m_size; }
+
+			/*֮ӳĴڳߴ,ȡ.0ΪĬ:64λӳļ,32λ64MB*/
+			void set_window_size(std::uint64_t bytes);
+			std::uint64_t window_size() const;
+
+			/*
+			* offsetݵָ,.lengthϣʵĳ,ʵʿõĳ(ļβض).
+			* ָclose֮kMaxWindowsӳ´ǰһֱЧ;ʧܷnullptr.
+			*/
+			const unsigned char* view(std::uint64_t offset, size_t& length);
+			/*ͬview,ҪԿдʽ*/
+			unsigned char* view_writable(std::uint64_t offset, size_t& length);
+
+			/*Ƶout,ԿԽ,ļβʱʧҲ*/
+			bool read(std::uint64_t offset, void* out, size_t size);
+			template<typename T>
+			bool read(std::uint64_t offset, T& value)
+			{
+				static_assert(std::is_trivially_copyable<T>::value, "T must be trivially copyable");
+				return read(offset, &value, sizeof(T));
+			}
+			/*һ׷ӵMemBinβ*/
+			bool read_to(epldatatype::MemBin& out, std::uint64_t offset, size_t size);
+			bool write(std::uint64_t offset, const void* data, size_t size);
+
+			/*ʾϵͳԤȰһݶڴ,ȴ*/
+			bool prefetch(std::uint64_t offset, std::uint64_t length);
+			/*޸ĵҳдļ*/
+			bool flush();
+
+		private:
+			struct window
+			{
+				std::uint64_t offset = 0;
+				size_t size = 0;
+				unsigned char* base = nullptr;
+				std::uint64_t tick = 0;
+			};
+			window* map_window(std::uint64_t offset, size_t length);
+			void unmap(window& item);
+			void apply_hint(const window& item) const;
+
+			std::vector<window> m_windows;
+			std::uint64_t m_tick = 0;
+			std::uint64_t m_size = 0;
+			std::uint64_t m_window_size = 0;
+			std::uint64_t m_granularity = 0;
+			bool m_writable = false;
+			access_hint m_hint = access_hint::normal;
+#ifdef _WIN32
+			HANDLE m_file = INVALID_HANDLE_VALUE;
+			HANDLE m_mapping = NULL;
+#else
+			int m_fd = -1;
+#endif
+		};
+	}
+}
@@ -0,0 +1,1577 @@
+#include"ElibHelp.h"
+#include"eplZip.h"
+#include"eplHash.h"
+#include"../../zlib/zlib.h"
+#include<thread>
+#include<atomic>
+#include<algorithm>
+
+namespace {
+	constexpr std::uint32_t kLocalHeaderSig = 0x04034b50;
+	constexpr std::uint32_t kCentralHeaderSig = 0x02014b50;
+	constexpr std::uint32_t kEndSig = 0x06054b50;
+	constexpr std::uint32_t kZip64EndSig = 0x06064b50;
+	constexpr std::uint32_t kZip64LocatorSig = 0x07064b50;
+	constexpr std::uint16_t kZip64ExtraId = 0x0001;
+	/*Info-ZIPUnicode·չ,ɹδUTF-8־ʱһUTF-8ļ*/
+	constexpr std::uint16_t kUnicodePathExtraId = 0x7075;
+	constexpr std::uint16_t kFlagEncrypted = 1;
+	constexpr std::uint16_t kFlagUtf8 = 1 << 11;
+	constexpr std::uint16_t kMethodStore = 0;
+	constexpr std::uint16_t kMethodDeflate = 8;
+	constexpr std::uint16_t kVersionDefault = 20;
+	constexpr std::uint16_t kVersionZip64 = 45;
+	constexpr std::uint32_t kMax32 = 0xFFFFFFFF;
+	constexpr std::uint16_t kMax16 = 0xFFFF;
+	constexpr size_t kLocalHeaderSize = 30;
+	constexpr size_t kCentralHeaderSize = 46;
+	constexpr size_t kEndSize = 22;
+	constexpr size_t kZip64EndSize = 56;
+	constexpr size_t kZip64LocatorSize = 20;
+	/*ÿζдĿС,ڴռļС޹*/
+	constexpr DWORD kChunk = 256 * 1024;
+
+	inline std::uint16_t get16(const unsigned char* p)
+	{
+		return static_cast<std::uint16_t>(p[0] | (p[1] << 8));
+	}
+	inline std::uint32_t get32(const unsigned char* p)
+	{
+		return get16(p) | (static_cast<std::uint32_t>(get16(p + 2)) << 16);
+	}
+	inline std::uint64_t get64(const unsigned char* p)
+	{
+		return get32(p) | (static_cast<std::uint64_t>(get32(p + 4)) << 32);
+	}
+	inline void put16(std::string& s, std::uint16_t v)
+	{
+		s.push_back(static_cast<char>(v & 0xFF));
+		s.push_back(static_cast<char>(v >> 8));
+	}
+	inline void put32(std::string& s, std::uint32_t v)
+	{
+		put16(s, static_cast<std::uint16_t>(v));
+		put16(s, static_cast<std::uint16_t>(v >> 16));
+	}
+	inline void put64(std::string& s, std::uint64_t v)
+	{
+		put32(s, static_cast<std::uint32_t>(v));
+		put32(s, static_cast<std::uint32_t>(v >> 32));
+	}
+
+	/*ƫƶȡ,ļָ,λýȡʱƶ*/
+	bool read_at(HANDLE file, std::uint64_t offset, void* buffer, DWORD size)
+	{
+		OVERLAPPED ov{};
+		ov.Offset = static_cast<DWORD>(offset);
+		ov.OffsetHigh = static_cast<DWORD>(offset >> 32);
+		DWORD read = 0;
+		return ReadFile(file, buffer, size, &read, &ov) && read == size;
+	}
+
+	bool write_all(HANDLE file, const void* data, size_t size)
+	{
+		const unsigned char* p = static_cast<const unsigned char*>(data);
+		while (size)
+		{
+			const DWORD n = size > (1u << 30) ? (1u << 30) : static_cast<DWORD>(size);
+			DWORD written = 0;
+			if (!WriteFile(file, p, n, &written, NULL) || written != n)
+				return false;
+			p += n;
+			size -= n;
+		}
+		return true;
+	}
+
+	bool seek(HANDLE file, std::uint64_t offset)
+	{
+		LARGE_INTEGER pos;
+		pos.QuadPart = static_cast<LONGLONG>(offset);
+		return SetFilePointerEx(file, pos, NULL, FILE_BEGIN) != FALSE;
+	}
+
+	std::wstring decode_name(const unsigned char* p, size_t size, UINT codePage)
+	{
+		if (size == 0)
+			return {};
+		const int n = MultiByteToWideChar(codePage, 0, reinterpret_cast<LPCCH>(p), static_cast<int>(size), NULL, 0);
+		std::wstring name(n, L'\0');
+		MultiByteToWideChar(codePage, 0, reinterpret_cast<LPCCH>(p), static_cast<int>(size), &name[0], n);
+		return name;
+	}
+
+	std::string to_utf8(std::wstring_view s)
+	{
+		if (s.empty())
+			return {};
+		const int n = WideCharToMultiByte(CP_UTF8, 0, s.data(), static_cast<int>(s.size()), NULL, 0, NULL, NULL);
+		std::string out(n, '\0');
+		WideCharToMultiByte(CP_UTF8, 0, s.data(), static_cast<int>(s.size()), &out[0], n, NULL, NULL);
+		return out;
+	}
+
+	/*ͳһ'/'ָ,ȥͷķָ*/
+	std::wstring normalize_name(std::wstring_view name)
+	{
+		std::wstring out(name);
+		std::replace(out.begin(), out.end(), L'\\', L'/');
+		const size_t start = out.find_first_not_of(L'/');
+		return start == std::wstring::npos ? std::wstring() : out.substr(start);
+	}
+
+	/*ѰתΪ·,".."̷ƵΪȫ,ؿ*/
+	std::wstring safe_relative_path(const std::wstring& name)
+	{
+		std::wstring out;
+		size_t pos = 0;
+		while (pos <= name.size())
+		{
+			size_t end = name.find_first_of(L"/\\", pos);
+			if (end == std::wstring::npos)
+				end = name.size();
+			const std::wstring_view part(name.data() + pos, end - pos);
+			pos = end + 1;
+			if (part.empty() || part == L".")
+				continue;
+			if (part == L".." || part.find(L':') != std::wstring_view::npos)
+				return {};
+			if (!out.empty())
+				out.push_back(L'\\');
+			out.append(part);
+		}
+		return out;
+	}
+
+	bool create_directories(const std::wstring& path)
+	{
+		for (size_t pos = path.find(L'\\', 1); pos != std::wstring::npos; pos = path.find(L'\\', pos + 1))
+		{
+			/*̷ѴڵϼĿ¼ᴴʧ,Լ,ֻĿ걾*/
+			if (path[pos - 1] == L':')
+				continue;
+			CreateDirectoryW(path.substr(0, pos).c_str(), NULL);
+		}
+		CreateDirectoryW(path.c_str(), NULL);
+		const DWORD attributes = GetFileAttributesW(path.c_str());
+		return attributes != INVALID_FILE_ATTRIBUTES && (attributes & FILE_ATTRIBUTE_DIRECTORY);
+	}
+
+	void to_dos_time(const FILETIME* time, std::uint16_t& dosTime, std::uint16_t& dosDate)
+	{
+		SYSTEMTIME st;
+		FILETIME local;
+		if (!time || !FileTimeToLocalFileTime(time, &local) || !FileTimeToSystemTime(&local, &st))
+			GetLocalTime(&st);
+		if (st.wYear < 1980)
+		{
+			dosTime = 0;
+			dosDate = (1 << 5) | 1;
+			return;
+		}
+		dosTime = static_cast<std::uint16_t>((st.wHour << 11) | (st.wMinute << 5) | (st.wSecond / 2));
+		dosDate = static_cast<std::uint16_t>(((st.wYear - 1980) << 9) | (st.wMonth << 5) | st.wDay);
+	}
+
+	std::wstring full_path(const std::wstring& path)
+	{
+		const DWORD n = GetFullPathNameW(path.c_str(), 0, NULL, NULL);
+		if (n == 0)
+			return path;
+		std::wstring out(n, L'\0');
+		out.resize(GetFullPathNameW(path.c_str(), n, &out[0], NULL));
+		return out;
+	}
+
+	/*ѹļ޸ʱ,ʧʱɾļ.runݽsink*/
+	bool extract_file(const std::function<bool(const elibstl::zip::sink&)>& run, const elibstl::zip::entry& item, const std::wstring& path)
+	{
+		HANDLE file = CreateFileW(path.c_str(), GENERIC_WRITE, 0, NULL, CREATE_ALWAYS, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+		if (file == INVALID_HANDLE_VALUE)
+			return false;
+		const bool ok = run([file](const unsigned char* data, size_t size) { return write_all(file, data, size); });
+		if (ok)
+		{
+			SYSTEMTIME st = item.time();
+			FILETIME local, utc;
+			if (SystemTimeToFileTime(&st, &local) && LocalFileTimeToFileTime(&local, &utc))
+				SetFileTime(file, NULL, NULL, &utc);
+		}
+		CloseHandle(file);
+		if (!ok)
+			DeleteFileW(path.c_str());
+		return ok;
+	}
+}
+
+namespace elibstl {
+	namespace zip {
+		SYSTEMTIME entry::time() const
+		{
+			SYSTEMTIME st{};
+			st.wYear = static_cast<WORD>((dos_date >> 9) + 1980);
+			st.wMonth = static_cast<WORD>((dos_date >> 5) & 15);
+			st.wDay = static_cast<WORD>(dos_date & 31);
+			st.wHour = static_cast<WORD>(dos_time >> 11);
+			st.wMinute = static_cast<WORD>((dos_time >> 5) & 63);
+			st.wSecond = static_cast<WORD>((dos_time & 31) * 2);
+			return st;
+		}
+
+		bool reader::open(const std::wstring& path)
+		{
+			close();
+			m_file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+			if (m_file == INVALID_HANDLE_VALUE)
+				return false;
+			LARGE_INTEGER size;
+			if (!GetFileSizeEx(m_file, &size))
+			{
+				close();
+				return false;
+			}
+			m_file_size = static_cast<std::uint64_t>(size.QuadPart);
+			m_path = full_path(path);
+			if (!read_central_directory())
+			{
+				close();
+				return false;
+			}
+			return true;
+		}
+
+		void reader::close()
+		{
+			if (m_file != INVALID_HANDLE_VALUE)
+				CloseHandle(m_file);
+			m_file = INVALID_HANDLE_VALUE;
+			m_file_size = 0;
+			m_base = 0;
+			m_path.clear();
+			m_entries.clear();
+		}
+
+		bool reader::read_central_directory()
+		{
+			if (m_file_size < kEndSize)
+				return false;
+			/*¼ļβ,65535ֽڵע*/
+			const DWORD tailSize = static_cast<DWORD>(std::min<std::uint64_t>(m_file_size, kEndSize + 0xFFFF));
+			std::vector<unsigned char> tail(tailSize);
+			const std::uint64_t tailStart = m_file_size - tailSize;
+			if (!read_at(m_file, tailStart, tail.data(), tailSize))
+				return false;
+			size_t endPos = tailSize - kEndSize + 1;
+			do
+			{
+				endPos--;
+				if (get32(&tail[endPos]) == kEndSig && endPos + kEndSize + get16(&tail[endPos + 20]) <= tailSize)
+					break;
+			} while (endPos);
+			const unsigned char* end = &tail[endPos];
+			if (get32(end) != kEndSig)
+				return false;
+			std::uint64_t entries = get16(end + 10);
+			std::uint64_t cdSize = get32(end + 12);
+			std::uint64_t cdOffset = get32(end + 16);
+			std::uint64_t cdEnd = tailStart + endPos;
+
+			/*zip64:¼֮ǰǶλ,ָzip64¼*/
+			unsigned char locator[kZip64LocatorSize];
+			if (cdEnd >= kZip64LocatorSize + kZip64EndSize && read_at(m_file, cdEnd - kZip64LocatorSize, locator, kZip64LocatorSize)
+				&& get32(locator) == kZip64LocatorSig)
+			{
+				unsigned char record[kZip64EndSize];
+				std::uint64_t recordPos = get64(locator + 8);
+				if (!read_at(m_file, recordPos, record, kZip64EndSize) || get32(record) != kZip64EndSig)
+				{
+					/*ѹǰʱλƫƲ׼,Ϊλ֮ǰ*/
+					recordPos = cdEnd - kZip64LocatorSize - kZip64EndSize;
+					if (!read_at(m_file, recordPos, record, kZip64EndSize) || get32(record) != kZip64EndSig)
+						return false;
+				}
+				entries = get64(record + 32);
+				cdSize = get64(record + 40);
+				cdOffset = get64(record + 48);
+				cdEnd = recordPos;
+			}
+			else if (entries == kMax16 || cdSize == kMax32 || cdOffset == kMax32)
+				return false;
+
+			if (cdSize > cdEnd || cdEnd - cdSize < cdOffset || cdSize >= kMax32)
+				return false;
+			m_base = cdEnd - cdSize - cdOffset;
+			std::vector<unsigned char> cd(static_cast<size_t>(cdSize));
+			if (cdSize && !read_at(m_file, m_base + cdOffset, cd.data(), static_cast<DWORD>(cdSize)))
+				return false;
+
+			m_entries.reserve(static_cast<size_t>(std::min<std::uint64_t>(entries, cdSize / kCentralHeaderSize)));
+			size_t pos = 0;
+			while (pos + kCentralHeaderSize <= cd.size() && get32(&cd[pos]) == kCentralHeaderSig)
+			{
+				const unsigned char* h = &cd[pos];
+				const size_t nameSize = get16(h + 28), extraSize = get16(h + 30), commentSize = get16(h + 32);
+				if (pos + kCentralHeaderSize + nameSize + extraSize + commentSize > cd.size())
+					return false;
+				entry item;
+				item.flags = get16(h + 8);
+				item.method = get16(h + 10);
+				item.dos_time = get16(h + 12);
+				item.dos_date = get16(h + 14);
+				item.crc = get32(h + 16);
+				item.compressed_size = get32(h + 20);
+				item.size = get32(h + 24);
+				item.local_offset = get32(h + 42);
+				const unsigned char* rawName = h + kCentralHeaderSize;
+				/*δUTF-8ļϵͳҳ,ԴWindowsһ*/
+				item.name = decode_name(rawName, nameSize, (item.flags & kFlagUtf8) ? CP_UTF8 : CP_ACP);
+
+				const unsigned char* extra = rawName + nameSize;
+				const unsigned char* const extraEnd = extra + extraSize;
+				while (extra + 4 <= extraEnd)
+				{
+					const std::uint16_t id = get16(extra), size = get16(extra + 2);
+					const unsigned char* data = extra + 4;
+					if (data + size > extraEnd)
+						break;
+					if (id == kZip64ExtraId)
+					{
+						/*ֻ32λֶΪ0xFFFFFFFFĲųչ,˳̶*/
+						const unsigned char* field = data;
+						const unsigned char* const fieldEnd = data + size;
+						for (std::uint64_t* value : { &item.size, &item.compressed_size, &item.local_offset })
+						{
+							if (*value != kMax32)
+								continue;
+							if (field + 8 > fieldEnd)
+								return false;
+							*value = get64(field);
+							field += 8;
+						}
+					}
+					else if (id == kUnicodePathExtraId && size > 5 && data[0] == 1
+						&& get32(data + 1) == elibstl::hash::crc32(0, rawName, nameSize))
+					{
+						item.name = decode_name(data + 5, size - 5, CP_UTF8);
+					}
+					extra = data + size;
+				}
+				std::replace(item.name.begin(), item.name.end(), L'\\', L'/');
+				m_entries.push_back(std::move(item));
+				pos += kCentralHeaderSize + nameSize + extraSize + commentSize;
+			}
+			return true;
+		}
+
+		int reader::find(std::wstring_view name) const
+		{
+			const std::wstring target = normalize_name(name);
+			for (size_t i = 0; i < m_entries.size(); i++)
+			{
+				const std::wstring& item = m_entries[i].name;
+				if (item.size() == target.size() && CompareStringOrdinal(item.c_str(), static_cast<int>(item.size()),
+					target.c_str(), static_cast<int>(target.size()), TRUE) == CSTR_EQUAL)
+					return static_cast<int>(i);
+			}
+			return -1;
+		}
+
+		bool reader::extract_from(HANDLE file, const entry& item, const sink& out) const
+		{
+			if ((item.flags & kFlagEncrypted) || (item.method != kMethodStore && item.method != kMethodDeflate))
+				return false;
+			unsigned char local[kLocalHeaderSize];
+			const std::uint64_t headerPos = m_base + item.local_offset;
+			if (!read_at(file, headerPos, local, kLocalHeaderSize) || get32(local) != kLocalHeaderSig)
+				return false;
+			/*ͷĳʹʱΪ0,Ŀ¼Ϊ׼*/
+			std::uint64_t offset = headerPos + kLocalHeaderSize + get16(local + 26) + get16(local + 28);
+			if (offset > m_file_size || m_file_size - offset < item.compressed_size)
+				return false;
+
+			std::vector<unsigned char> in(kChunk), buffer(item.method == kMethodDeflate ? kChunk : 0);
+			z_stream strm{};
+			if (item.method == kMethodDeflate && inflateInit2(&strm, -MAX_WBITS) != Z_OK)
+				return false;
+			std::uint32_t crc = 0;
+			std::uint64_t produced = 0, remaining = item.compressed_size;
+			bool ok = true, finished = item.method == kMethodStore;
+			while (ok && remaining)
+			{
+				const DWORD n = static_cast<DWORD>(std::min<std::uint64_t>(remaining, kChunk));
+				if (!read_at(file, offset, in.data(), n))
+				{
+					ok = false;
+					break;
+				}
+				offset += n;
+				remaining -= n;
+				if (item.method == kMethodStore)
+				{
+					crc = elibstl::hash::crc32(crc, in.data(), n);
+					produced += n;
+					ok = out(in.data(), n);
+					continue;
+				}
+				strm.next_in = in.data();
+				strm.avail_in = n;
+				/*ÿֻһ,ѹȵҲռôڴ*/
+				do
+				{
+					strm.next_out = buffer.data();
+					strm.avail_out = kChunk;
+					const int err = inflate(&strm, Z_NO_FLUSH);
+					if (err != Z_OK && err != Z_STREAM_END && err != Z_BUF_ERROR)
+					{
+						ok = false;
+						break;
+					}
+					const size_t have = kChunk - strm.avail_out;
+					if (have)
+					{
+						crc = elibstl::hash::crc32(crc, buffer.data(), have);
+						produced += have;
+						if (!out(buffer.data(), have))
+						{
+							ok = false;
+							break;
+						}
+					}
+					if (err == Z_STREAM_END)
+					{
+						finished = true;
+						break;
+					}
+				} while (strm.avail_out == 0 || strm.avail_in != 0);
+				if (finished)
+					break;
+			}
+			if (item.method == kMethodDeflate)
+				inflateEnd(&strm);
+			return ok && finished && produced == item.size && crc == item.crc;
+		}
+
+		bool reader::extract(size_t index, const sink& out) const
+		{
+			if (!is_open() || index >= m_entries.size())
+				return false;
+			return extract_from(m_file, m_entries[index], out);
+		}
+
+		bool reader::extract_to_file(size_t index, const std::wstring& path) const
+		{
+			if (!is_open() || index >= m_entries.size() || m_entries[index].is_directory())
+				return false;
+			const entry& item = m_entries[index];
+			return extract_file([&](const sink& out) { return extract_from(m_file, item, out); }, item, path);
+		}
+
+		bool reader::extract_all(const std::wstring& dir, unsigned threads) const
+		{
+			if (!is_open() || dir.empty())
+				return false;
+			std::wstring root = dir;
+			while (root.size() > 1 && (root.back() == L'\\' || root.back() == L'/'))
+				root.pop_back();
+			if (!create_directories(root))
+				return false;
+
+			/*Ȱ˳򽨺Ŀ¼,ļ֮û,Բнѹ*/
+			bool ok = true;
+			std::vector<std::pair<size_t, std::wstring>> files;
+			for (size_t i = 0; i < m_entries.size(); i++)
+			{
+				const std::wstring relative = safe_relative_path(m_entries[i].name);
+				if (relative.empty())
+				{
+					ok = false;
+					continue;
+				}
+				std::wstring path = root + L"\\" + relative;
+				if (m_entries[i].is_directory())
+				{
+					ok = create_directories(path) && ok;
+					continue;
+				}
+				const size_t slash = path.rfind(L'\\');
+				if (slash > root.size())
+					ok = create_directories(path.substr(0, slash)) && ok;
+				files.emplace_back(i, std::move(path));
+			}
+			/*ļȿʼ,ֻʣһ߳ڽѹļ*/
+			std::stable_sort(files.begin(), files.end(), [this](const auto& a, const auto& b) {
+				return m_entries[a.first].size > m_entries[b.first].size;
+				});
+
+			if (threads == 0)
+				threads = std::max(1u, std::thread::hardware_concurrency());
+			threads = static_cast<unsigned>(std::min<size_t>(threads, files.size()));
+			std::atomic<size_t> next{ 0 };
+			std::atomic<bool> allOk{ true };
+			auto worker = [&](HANDLE file) {
+				for (size_t i = next++; i < files.size(); i = next++)
+				{
+					const entry& item = m_entries[files[i].first];
+					if (!extract_file([&](const sink& out) { return extract_from(file, item, out); }, item, files[i].second))
+						allOk = false;
+				}
+			};
+			if (threads <= 1)
+				worker(m_file);
+			else
+			{
+				/*ÿ̵߳ѹ,ͬϵĶȡᱻϵͳл*/
+				std::vector<std::thread> pool;
+				std::vector<HANDLE> handles;
+				for (unsigned i = 0; i < threads; i++)
+				{
+					HANDLE file = i == 0 ? m_file : CreateFileW(m_path.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_FLAG_RANDOM_ACCESS, NULL);
+					if (file == INVALID_HANDLE_VALUE)
+						break;
+					if (i)
+						handles.push_back(file);
+					pool.emplace_back(worker, file);
+				}
+				for (auto& t : pool)
+					t.join();
+				for (HANDLE h : handles)
+					CloseHandle(h);
+			}
+			return ok && allOk;
+		}
+
+		/*ѹݵԴ:ڴļ*/
+		struct writer::source
+		{
+			const unsigned char* data = nullptr;
+			HANDLE file = INVALID_HANDLE_VALUE;
+			std::uint64_t size = 0;
+			std::uint64_t pos = 0;
+
+			bool read(unsigned char* buffer, DWORD capacity, DWORD& got)
+			{
+				if (data)
+				{
+					got = static_cast<DWORD>(std::min<std::uint64_t>(capacity, size - pos));
+					memcpy(buffer, data + pos, got);
+				}
+				else if (!ReadFile(file, buffer, capacity, &got, NULL))
+					return false;
+				pos += got;
+				return true;
+			}
+			bool rewind()
+			{
+				pos = 0;
+				return data || seek(file, 0);
+			}
+		};
+
+		writer::~writer()
+		{
+			if (is_open())
+				discard();
+		}
+
+		void writer::discard()
+		{
+			CloseHandle(m_file);
+			m_file = INVALID_HANDLE_VALUE;
+			DeleteFileW(m_path.c_str());
+			m_records.clear();
+		}
+
+		bool writer::create(const std::wstring& path)
+		{
+			if (is_open())
+				close();
+			m_file = CreateFileW(path.c_str(), GENERIC_WRITE, 0, NULL, CREATE_ALWAYS, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+			if (m_file == INVALID_HANDLE_VALUE)
+				return false;
+			m_path = full_path(path);
+			m_offset = 0;
+			m_records.clear();
+			return true;
+		}
+
+		bool writer::write(const void* data, size_t size)
+		{
+			if (!write_all(m_file, data, size))
+				return false;
+			m_offset += size;
+			return true;
+		}
+
+		bool writer::write_at(std::uint64_t offset, const void* data, size_t size)
+		{
+			return seek(m_file, offset) && write_all(m_file, data, size) && seek(m_file, m_offset);
+		}
+
+		bool writer::add_entry(source& src, std::wstring_view name, int level, const FILETIME* time, DWORD attributes)
+		{
+			if (!is_open())
+				return false;
+			record r{};
+			r.name = to_utf8(normalize_name(name));
+			if (r.name.empty() || r.name.size() > kMax16 || r.name.back() == '/')
+				return false;
+			r.size = src.size;
+			r.local_offset = m_offset;
+			r.attributes = attributes;
+			r.method = (level == 0 || src.size == 0) ? kMethodStore : kMethodDeflate;
+			to_dos_time(time, r.dos_time, r.dos_date);
+			/*ԭʼдǰ֪,ѹ󲻻(Ϊ洢),ݴ˾ͷǷҪzip64չ*/
+			const bool zip64 = src.size >= kMax32;
+
+			std::string header;
+			put32(header, kLocalHeaderSig);
+			put16(header, zip64 ? kVersionZip64 : kVersionDefault);
+			put16(header, kFlagUtf8);
+			put16(header, r.method);
+			put16(header, r.dos_time);
+			put16(header, r.dos_date);
+			put32(header, 0);
+			put32(header, zip64 ? kMax32 : 0);
+			put32(header, zip64 ? kMax32 : 0);
+			put16(header, static_cast<std::uint16_t>(r.name.size()));
+			put16(header, zip64 ? 20 : 0);
+			header += r.name;
+			if (zip64)
+			{
+				put16(header, kZip64ExtraId);
+				put16(header, 16);
+				put64(header, 0);
+				put64(header, 0);
+			}
+			const std::uint64_t dataStart = r.local_offset + header.size();
+			std::vector<unsigned char> in(kChunk), out;
+			bool ok = write(header.data(), header.size());
+
+			if (ok && r.method == kMethodDeflate)
+			{
+				out.resize(kChunk);
+				z_stream strm{};
+				ok = deflateInit2(&strm, level < 0 || level > 9 ? Z_DEFAULT_COMPRESSION : level, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY) == Z_OK;
+				bool compressible = true;
+				for (int flush = Z_NO_FLUSH; ok && flush != Z_FINISH;)
+				{
+					DWORD got = 0;
+					if (!src.read(in.data(), kChunk, got))
+					{
+						ok = false;
+						break;
+					}
+					r.crc = elibstl::hash::crc32(r.crc, in.data(), got);
+					flush = src.pos >= src.size || got == 0 ? Z_FINISH : Z_NO_FLUSH;
+					strm.next_in = in.data();
+					strm.avail_in = got;
+					do
+					{
+						strm.next_out = out.data();
+						strm.avail_out = kChunk;
+						deflate(&strm, flush);
+						ok = write(out.data(), kChunk - strm.avail_out);
+					} while (ok && strm.avail_out == 0);
+					/*ѾԭС,ѹȥ*/
+					if (m_offset - dataStart >= src.size)
+					{
+						compressible = false;
+						break;
+					}
+				}
+				deflateEnd(&strm);
+				if (ok && (!compressible || m_offset - dataStart >= src.size))
+				{
+					m_offset = dataStart;
+					ok = seek(m_file, dataStart) && SetEndOfFile(m_file) && src.rewind();
+					r.method = kMethodStore;
+					r.crc = 0;
+				}
+			}
+			if (ok && r.method == kMethodStore)
+			{
+				while (ok && src.pos < src.size)
+				{
+					DWORD got = 0;
+					ok = src.read(in.data(), kChunk, got) && got != 0;
+					if (ok)
+					{
+						r.crc = elibstl::hash::crc32(r.crc, in.data(), got);
+						ok = write(in.data(), got);
+					}
+				}
+			}
+			/*ȡڼļȸı*/
+			ok = ok && src.pos == src.size;
+			r.compressed_size = m_offset - dataStart;
+
+			if (ok)
+			{
+				std::string patch;
+				put16(patch, r.method);
+				ok = write_at(r.local_offset + 8, patch.data(), patch.size());
+				patch.clear();
+				put32(patch, r.crc);
+				if (!zip64)
+				{
+					put32(patch, static_cast<std::uint32_t>(r.compressed_size));
+					put32(patch, static_cast<std::uint32_t>(r.size));
+				}
+				ok = ok && write_at(r.local_offset + 14, patch.data(), patch.size());
+				if (ok && zip64)
+				{
+					patch.clear();
+					put64(patch, r.size);
+					put64(patch, r.compressed_size);
+					ok = write_at(r.local_offset + kLocalHeaderSize + r.name.size() + 4, patch.data(), patch.size());
+				}
+			}
+			if (!ok)
+			{
+				/*صдһ,֮ǰӵݲӰ*/
+				m_offset = r.local_offset;
+				seek(m_file, m_offset);
+				SetEndOfFile(m_file);
+				return false;
+			}
+			m_records.push_back(std::move(r));
+			return true;
+		}
+
+		bool writer::add_directory_entry(std::wstring_view name, const FILETIME* time)
+		{
+			if (!is_open())
+				return false;
+			record r{};
+			r.name = to_utf8(normalize_name(name));
+			if (r.name.empty() || r.name.size() >= kMax16)
+				return false;
+			if (r.name.back() != '/')
+				r.name.push_back('/');
+			r.local_offset = m_offset;
+			r.attributes = FILE_ATTRIBUTE_DIRECTORY;
+			r.method = kMethodStore;
+			to_dos_time(time, r.dos_time, r.dos_date);
+			std::string header;
+			put32(header, kLocalHeaderSig);
+			put16(header, kVersionDefault);
+			put16(header, kFlagUtf8);
+			put16(header, r.method);
+			put16(header, r.dos_time);
+			put16(header, r.dos_date);
+			put32(header, 0);
+			put32(header, 0);
+			put32(header, 0);
+			put16(header, static_cast<std::uint16_t>(r.name.size()));
+			put16(header, 0);
+			header += r.name;
+			if (!write(header.data(), header.size()))
+				return false;
+			m_records.push_back(std::move(r));
+			return true;
+		}
+
+		bool writer::add_data(const unsigned char* data, size_t size, std::wstring_view name, int level)
+		{
+			source src;
+			src.data = data ? data : reinterpret_cast<const unsigned char*>("");
+			src.size = data ? size : 0;
+			return add_entry(src, name, level, nullptr, FILE_ATTRIBUTE_ARCHIVE);
+		}
+
+		bool writer::add_file(const std::wstring& path, std::wstring_view name, int level)
+		{
+			source src;
+			src.file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+			if (src.file == INVALID_HANDLE_VALUE)
+				return false;
+			LARGE_INTEGER size;
+			FILETIME time;
+			BY_HANDLE_FILE_INFORMATION info;
+			bool ok = GetFileSizeEx(src.file, &size) && GetFileTime(src.file, NULL, NULL, &time) && GetFileInformationByHandle(src.file, &info);
+			if (ok)
+			{
+				src.size = static_cast<std::uint64_t>(size.QuadPart);
+				ok = add_entry(src, name, level, &time, info.dwFileAttributes & 0xFF);
+			}
+			CloseHandle(src.file);
+			return ok;
+		}
+
+		bool writer::add_directory(const std::wstring& dir, std::wstring_view prefix, int level)
+		{
+			if (!is_open())
+				return false;
+			std::wstring base = normalize_name(prefix);
+			if (!base.empty() && base.back() != L'/')
+				base.push_back(L'/');
+			bool ok = true;
+			WIN32_FIND_DATAW findData;
+			HANDLE hFind = FindFirstFileExW((dir + L"\\*").c_str(), FindExInfoBasic, &findData, FindExSearchNameMatch, NULL, FIND_FIRST_EX_LARGE_FETCH);
+			if (hFind == INVALID_HANDLE_VALUE)
+				return false;
+			do
+			{
+				if (!wcscmp(findData.cFileName, L".") || !wcscmp(findData.cFileName, L".."))
+					continue;
+				const std::wstring path = dir + L"\\" + findData.cFileName;
+				const std::wstring name = base + findData.cFileName;
+				if (findData.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY)
+				{
+					/*Ŀ¼,ѭ*/
+					if (findData.dwFileAttributes & FILE_ATTRIBUTE_REPARSE_POINT)
+						continue;
+					ok = add_directory_entry(name, &findData.ftLastWriteTime) && ok;
+					ok = add_directory(path, name, level) && ok;
+				}
+				else if (CompareStringOrdinal(full_path(path).c_str(), -1, m_path.c_str(), -1, TRUE) != CSTR_EQUAL)
+				{
+					/*ѹĿ¼ʱ*/
+					ok = add_file(path, name, level) && ok;
+				}
+			} while (FindNextFileW(hFind, &findData));
+			FindClose(hFind);
+			return ok;
+		}
+
+		bool writer::close()
+		{
+			if (!is_open())
+				return false;
+			const std::uint64_t cdOffset = m_offset;
+			std::string cd;
+			bool ok = true;
+			for (const record& r : m_records)
+			{
+				std::string extra;
+				if (r.size >= kMax32)
+					put64(extra, r.size);
+				if (r.compressed_size >= kMax32)
+					put64(extra, r.compressed_size);
+				if (r.local_offset >= kMax32)
+					put64(extra, r.local_offset);
+				const bool zip64 = !extra.empty();
+				put32(cd, kCentralHeaderSig);
+				put16(cd, kVersionZip64);
+				put16(cd, zip64 ? kVersionZip64 : kVersionDefault);
+				put16(cd, kFlagUtf8);
+				put16(cd, r.method);
+				put16(cd, r.dos_time);
+				put16(cd, r.dos_date);
+				put32(cd, r.crc);
+				put32(cd, static_cast<std::uint32_t>(std::min<std::uint64_t>(r.compressed_size, kMax32)));
+				put32(cd, static_cast<std::uint32_t>(std::min<std::uint64_t>(r.size, kMax32)));
+				put16(cd, static_cast<std::uint16_t>(r.name.size()));
+				put16(cd, static_cast<std::uint16_t>(zip64 ? extra.size() + 4 : 0));
+				put16(cd, 0);
+				put16(cd, 0);
+				put16(cd, 0);
+				put32(cd, r.attributes);
+				put32(cd, static_cast<std::uint32_t>(std::min<std::uint64_t>(r.local_offset, kMax32)));
+				cd += r.name;
+				if (zip64)
+				{
+					put16(cd, kZip64ExtraId);
+					put16(cd, static_cast<std::uint16_t>(extra.size()));
+					cd += extra;
+				}
+				if (cd.size() >= kChunk)
+				{
+					ok = ok && write(cd.data(), cd.size());
+					cd.clear();
+				}
+			}
+			ok = ok && write(cd.data(), cd.size());
+			const std::uint64_t cdSize = m_offset - cdOffset;
+			const std::uint64_t count = m_records.size();
+			std::string end;
+			if (count >= kMax16 || cdSize >= kMax32 || cdOffset >= kMax32)
+			{
+				const std::uint64_t recordPos = m_offset;
+				put32(end, kZip64EndSig);
+				put64(end, kZip64EndSize - 12);
+				put16(end, kVersionZip64);
+				put16(end, kVersionZip64);
+				put32(end, 0);
+				put32(end, 0);
+				put64(end, count);
+				put64(end, count);
+				put64(end, cdSize);
+				put64(end, cdOffset);
+				put32(end, kZip64LocatorSig);
+				put32(end, 0);
+				put64(end, recordPos);
+				put32(end, 1);
+			}
+			put32(end, kEndSig);
+			put16(end, 0);
+			put16(end, 0);
+			put16(end, static_cast<std::uint16_t>(std::min<std::uint64_t>(count, kMax16)));
+			put16(end, static_cast<std::uint16_t>(std::min<std::uint64_t>(count, kMax16)));
+			put32(end, static_cast<std::uint32_t>(std::min<std::uint64_t>(cdSize, kMax32)));
+			put32(end, static_cast<std::uint32_t>(std::min<std::uint64_t>(cdOffset, kMax32)));
+			put16(end, 0);
+			ok = ok && write(end.data(), end.size());
+			if (!ok)
+			{
+				discard();
+				return false;
+			}
+			CloseHandle(m_file);
+			m_file = INVALID_HANDLE_VALUE;
+			m_records.clear();
+			return true;
+		}
+	}
+}
+
+namespace {
+	/*ͬһȿԶҲд,򿪻򴴽ʱȽһ*/
+	struct zip_archive
+	{
+		elibstl::zip::reader reader;
+		elibstl::zip::writer writer;
+	};
+
+	/*ԵŴ1ʼ,Чʱnullptr*/
+	const elibstl::zip::entry* arg_to_entry(zip_archive* self, const MDATA_INF& arg)
+	{
+		const auto& entries = self->reader.entries();
+		if (arg.m_int < 1 || static_cast<size_t>(arg.m_int) > entries.size())
+			return nullptr;
+		return &entries[arg.m_int - 1];
+	}
+}
+
+//
+EXTERN_C void fn_zip_structure(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto& self = elibstl::args_to_obj<zip_archive>(pArgInf);
+	self = new zip_archive;
+}
+FucInfo Fn_zip_structure = { {
+		/*ccname*/  "",
+		/*egname*/  "",
+		/*explain*/ NULL,
+		/*category*/ -1,
+		/*state*/  _CMD_OS(__OS_WIN) | CT_IS_HIDED | CT_IS_OBJ_CONSTURCT_CMD,
+		/*ret*/ _SDT_NULL,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*ArgCount*/0,
+		/*arg lp*/  NULL,
+	} ,ESTLFNAME(fn_zip_structure) };
+
+static ARG_INFO s_ZipCopyArgs[] =
+{
+	{
+		/*name*/    "",
+		/*explain*/ "",
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/	(DATA_TYPE)31,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_DEFAULT_VALUE_IS_EMPTY,
+	}
+};
+//
+EXTERN_C void fn_zip_copy(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto& self = elibstl::classhelp::get_this<zip_archive>(pArgInf);
+	self = new zip_archive;
+	put_errmsg(L"ѹռ򿪵ļ,ܸ,Ƶõδ򿪵¶!");
+}
+FucInfo Fn_zip_copy = { {
+		/*ccname*/  "",
+		/*egname*/  "",
+		/*explain*/ NULL,
+		/*category*/ -1,
+		/*state*/   _CMD_OS(__OS_WIN) | CT_IS_HIDED | CT_IS_OBJ_COPY_CMD,
+		/*ret*/ _SDT_NULL,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*ArgCount*/1,
+		/*arg lp*/  s_ZipCopyArgs,
+	} ,ESTLFNAME(fn_zip_copy) };
+
+//
+EXTERN_C void fn_zip_destruct(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto& self = elibstl::args_to_obj<zip_archive>(pArgInf);
+	if (self)
+	{
+		/*ǹرʱҲдĿ¼,ӵ*/
+		self->writer.close();
+		delete self;
+	}
+	self = nullptr;
+}
+FucInfo Fn_zip_destruct = { {
+		/*ccname*/  "",
+		/*egname*/  "",
+		/*explain*/ NULL,
+		/*category*/ -1,
+		/*state*/    _CMD_OS(__OS_WIN) | CT_IS_HIDED | CT_IS_OBJ_FREE_CMD,
+		/*ret*/ _SDT_NULL,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*ArgCount*/0,
+		/*arg lp*/  NULL,
+	} ,ESTLFNAME(fn_zip_destruct) };
+
+static ARG_INFO Args_ZipPath[] =
+{
+	{
+		/*name*/    "ļ",
+		/*explain*/ ("ѹļ"),
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_BIN,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_NONE,
+	}
+};
+EXTERN_C void fn_zip_open(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto& self = elibstl::args_to_obj<zip_archive>(pArgInf);
+	self->writer.close();
+	pRetData->m_bool = self->reader.open(std::wstring(elibstl::args_to_wsdata(pArgInf, 1)));
+}
+FucInfo Fn_zip_open = { {
+		/*ccname*/  "",
+		/*egname*/  "open",
+		/*explain*/ "еѹԶȡеļ֧zip64,ּ֧ܵ",
+		/*category*/ -1,
+		/*state*/    _CMD_OS(__OS_WIN) ,
+		/*ret*/ SDT_BOOL,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		ESTLARG(Args_ZipPath)
+	} ,ESTLFNAME(fn_zip_open) };
+
+EXTERN_C void fn_zip_create(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto& self = elibstl::args_to_obj<zip_archive>(pArgInf);
+	self->reader.close();
+	pRetData->m_bool = self->writer.create(std::wstring(elibstl::args_to_wsdata(pArgInf, 1)));
+}
+FucInfo Fn_zip_create = { {
+		/*ccname*/  "",
+		/*egname*/  "create",
+		/*explain*/ "µѹ,ļѴʱᱻǡݺáرա,ѹ",
+		/*category*/ -1,
+		/*state*/    _CMD_OS(__OS_WIN) ,
+		/*ret*/ SDT_BOOL,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		ESTLARG(Args_ZipPath)
+	} ,ESTLFNAME(fn_zip_create) };
+
+EXTERN_C void fn_zip_close(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto& self = elibstl::args_to_obj<zip_archive>(pArgInf);
+	const bool wasReading = self->reader.is_open();
+	self->reader.close();
+	pRetData->m_bool = self->writer.close() || wasReading;
+}
+FucInfo Fn_zip_close = { {
+		/*ccname*/  "ر",
+		/*egname*/  "close",
+		/*explain*/ "رѹѹڴʱдļĿ¼,ؼ˵дʧ,ļѱɾ",
+		/*category*/ -1,
+		/*state*/    _CMD_OS(__OS_WIN) ,
+		/*ret*/ SDT_BOOL,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*ArgCount*/0,
+		/*arg lp*/  0,
+	} ,ESTLFNAME(fn_zip_close) };
+
+EXTERN_C void fn_zip_count(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto& self = elibstl::args_to_obj<zip_archive>(pArgInf);
+	pRetData->m_int = static_cast<INT>(self->reader.entries().size());
+}
+FucInfo Fn_zip_count = { {
+		/*ccname*/  "ȡļ",
+		/*egname*/  "count",
+		/*explain*/ "ش򿪵ѹе,Ŀ¼",
+		/*category*/ -1,
+		/*state*/    _CMD_OS(__OS_WIN) ,
+		/*ret*/ SDT_INT,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*ArgCount*/0,
+		/*arg lp*/  0,
+	} ,ESTLFNAME(fn_zip_count) };
+
+EXTERN_C void fn_zip_list(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto& self = elibstl::args_to_obj<zip_archive>(pArgInf);
+	std::vector<std::wstring> names;
+	names.reserve(self->reader.entries().size());
+	for (const auto& item : self->reader.entries())
+		names.push_back(item.name);
+	pRetData->m_pAryData = elibstl::create_text_array(names);
+}
+FucInfo Fn_zip_list = { {
+		/*ccname*/  "ȡļб",
+		/*egname*/  "list",
+		/*explain*/ "˳򷵻,Ŀ¼ԡ/βԱλüΪʹõš",
+		/*category*/ -1,
+		/*state*/    _CMD_OS(__OS_WIN) | CT_RETRUN_ARY_TYPE_DATA,
+		/*ret*/ SDT_BIN,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*ArgCount*/0,
+		/*arg lp*/  0,
+	} ,ESTLFNAME(fn_zip_list) };
+
+static ARG_INFO Args_ZipFind[] =
+{
+	{
+		/*name*/    "",
+		/*explain*/ ("ڵ,硰dir/a.txt,ִСд,\\롰/Ϊͬ"),
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_BIN,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_NONE,
+	}
+};
+EXTERN_C void fn_zip_find(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto& self = elibstl::args_to_obj<zip_archive>(pArgInf);
+	pRetData->m_int = self->reader.find(elibstl::args_to_wsdata(pArgInf, 1)) + 1;
+}
+FucInfo Fn_zip_find = { {
+		/*ccname*/  "ļ",
+		/*egname*/  "find",
+		/*explain*/ "ָƵ,Ҳ0",
+		/*category*/ -1,
+		/*state*/    _CMD_OS(__OS_WIN) ,
+		/*ret*/ SDT_INT,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		ESTLARG(Args_ZipFind)
+	} ,ESTLFNAME(fn_zip_find) };
+
+static ARG_INFO Args_ZipIndex[] =
+{
+	{
+		/*name*/    "",
+		/*explain*/ ("1ʼ,롰ȡļбصλһ"),
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_INT,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_NONE,
+	}
+};
+EXTERN_C void fn_zip_name(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto& self = elibstl::args_to_obj<zip_archive>(pArgInf);
+	if (auto item = arg_to_entry(self, pArgInf[1]))
+		pRetData->m_pBin = elibstl::clone_textw(item->name);
+}
+FucInfo Fn_zip_name = { {
+		/*ccname*/  "ȡļ",
+		/*egname*/  "name",
+		/*explain*/ "ڰڵ,Чʱؿı",
+		/*category*/ -1,
+		/*state*/    _CMD_OS(__OS_WIN) ,
+		/*ret*/ SDT_BIN,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		ESTLARG(Args_ZipIndex)
+	} ,ESTLFNAME(fn_zip_name) };
+
+EXTERN_C void fn_zip_size(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto& self = elibstl::args_to_obj<zip_archive>(pArgInf);
+	auto item = arg_to_entry(self, pArgInf[1]);
+	pRetData->m_int64 = item ? static_cast<INT64>(item->size) : -1;
+}
+FucInfo Fn_zip_size = { {
+		/*ccname*/  "ȡļߴ",
+		/*egname*/  "size",
+		/*explain*/ "ѹֽ,Чʱ-1",
+		/*category*/ -1,
+		/*state*/    _CMD_OS(__OS_WIN) ,
+		/*ret*/ SDT_INT64,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		ESTLARG(Args_ZipIndex)
+	} ,ESTLFNAME(fn_zip_size) };
+
+EXTERN_C void fn_zip_time(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto& self = elibstl::args_to_obj<zip_archive>(pArgInf);
+	pRetData->m_date = 0;
+	if (auto item = arg_to_entry(self, pArgInf[1]))
+	{
+		SYSTEMTIME st = item->time();
+		SystemTimeToVariantTime(&st, &pRetData->m_date);
+	}
+}
+FucInfo Fn_zip_time = { {
+		/*ccname*/  "ȡ޸ʱ",
+		/*egname*/  "time",
+		/*explain*/ "¼޸ʱ(ʱ,ȷ2)",
+		/*category*/ -1,
+		/*state*/    _CMD_OS(__OS_WIN) ,
+		/*ret*/ SDT_DATE_TIME,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		ESTLARG(Args_ZipIndex)
+	} ,ESTLFNAME(fn_zip_time) };
+
+EXTERN_C void fn_zip_is_dir(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto& self = elibstl::args_to_obj<zip_archive>(pArgInf);
+	auto item = arg_to_entry(self, pArgInf[1]);
+	pRetData->m_bool = item && item->is_directory();
+}
+FucInfo Fn_zip_is_dir = { {
+		/*ccname*/  "ǷΪĿ¼",
+		/*egname*/  "isDirectory",
+		/*explain*/ "ǷΪĿ¼",
+		/*category*/ -1,
+		/*state*/    _CMD_OS(__OS_WIN) ,
+		/*ret*/ SDT_BOOL,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		ESTLARG(Args_ZipIndex)
+	} ,ESTLFNAME(fn_zip_is_dir) };
+
+EXTERN_C void fn_zip_extract_bin(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto& self = elibstl::args_to_obj<zip_archive>(pArgInf);
+	auto item = arg_to_entry(self, pArgInf[1]);
+	if (!item || item->size == 0 || item->size > static_cast<std::uint64_t>(INT_MAX) - sizeof(std::uint32_t) * 2)
+		return;
+	/*Ŀ¼ĳȿα,ѹѹ(deflateԼ1032,洢Ϊ1)˶ԺŰ*/
+	const std::uint64_t max_ratio = item->method == kMethodDeflate ? 1032 : 1;
+	if (item->size / max_ratio > item->compressed_size)
+		return;
+	/*ѹ֪,ֱд뷵صֽڼ*/
+	const size_t size = static_cast<size_t>(item->size);
+	LPBYTE pd = static_cast<LPBYTE>(elibstl::ealloc(static_cast<int>(sizeof(std::uint32_t) * 2 + size)));
+	*reinterpret_cast<std::uint32_t*>(pd) = 1;
+	*reinterpret_cast<std::uint32_t*>(pd + sizeof(std::uint32_t)) = static_cast<std::uint32_t>(size);
+	size_t pos = 0;
+	const bool ok = self->reader.extract(pArgInf[1].m_int - 1, [&](const unsigned char* data, size_t n) {
+		if (n > size - pos)
+			return false;
+		memcpy(pd + sizeof(std::uint32_t) * 2 + pos, data, n);
+		pos += n;
+		return true;
+		});
+	if (ok)
+		pRetData->m_pBin = pd;
+	else
+		elibstl::efree(pd);
+}
+FucInfo Fn_zip_extract_bin = { {
+		/*ccname*/  "ѹֽڼ",
+		/*egname*/  "extract",
+		/*explain*/ "ѹָ,ͬʱУCRCʧܷؿֽڼ",
+		/*category*/ -1,
+		/*state*/    _CMD_OS(__OS_WIN) ,
+		/*ret*/ SDT_BIN,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		ESTLARG(Args_ZipIndex)
+	} ,ESTLFNAME(fn_zip_extract_bin) };
+
+static ARG_INFO Args_ZipExtractFile[] =
+{
+	{
+		/*name*/    "",
+		/*explain*/ ("1ʼ,롰ȡļбصλһ"),
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_INT,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_NONE,
+	},
+	{
+		/*name*/    "ļ",
+		/*explain*/ ("ѹļ,Ѵʱ,Ŀ¼Ѵ"),
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_BIN,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_NONE,
+	}
+};
+EXTERN_C void fn_zip_extract_file(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto& self = elibstl::args_to_obj<zip_archive>(pArgInf);
+	pRetData->m_bool = arg_to_entry(self, pArgInf[1])
+		&& self->reader.extract_to_file(pArgInf[1].m_int - 1, std::wstring(elibstl::args_to_wsdata(pArgInf, 2)));
+}
+FucInfo Fn_zip_extract_file = { {
+		/*ccname*/  "ѹļ",
+		/*egname*/  "extractToFile",
+		/*explain*/ "߽ѹдļ,ڴռļС޹,ָ޸ʱ䡣ʧʱ²ļ",
+		/*category*/ -1,
+		/*state*/    _CMD_OS(__OS_WIN) ,
+		/*ret*/ SDT_BOOL,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		ESTLARG(Args_ZipExtractFile)
+	} ,ESTLFNAME(fn_zip_extract_file) };
+
+static ARG_INFO Args_ZipExtractAll[] =
+{
+	{
+		/*name*/    "Ŀ¼",
+		/*explain*/ ("ѹĿ¼,ʱԶ"),
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_BIN,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_NONE,
+	},
+	{
+		/*name*/    "߳",
+		/*explain*/ ("ͬʱѹļ,0ΪCPU"),
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_INT,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_HAS_DEFAULT_VALUE,
+	}
+};
+EXTERN_C void fn_zip_extract_all(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto& self = elibstl::args_to_obj<zip_archive>(pArgInf);
+	pRetData->m_bool = pArgInf[2].m_int >= 0
+		&& self->reader.extract_all(std::wstring(elibstl::args_to_wsdata(pArgInf, 1)), static_cast<unsigned>(pArgInf[2].m_int));
+}
+FucInfo Fn_zip_extract_all = { {
+		/*ccname*/  "ȫѹ",
+		/*egname*/  "extractAll",
+		/*explain*/ "·ѹȫĿ¼,ļͬʱѹ..ȻдĿ¼֮ᱻ,ʱؼ,Իѹ",
+		/*category*/ -1,
+		/*state*/    _CMD_OS(__OS_WIN) ,
+		/*ret*/ SDT_BOOL,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		ESTLARG(Args_ZipExtractAll)
+	} ,ESTLFNAME(fn_zip_extract_all) };
+
+static ARG_INFO Args_ZipAddFile[] =
+{
+	{
+		/*name*/    "ļ",
+		/*explain*/ ("ӵļ"),
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_BIN,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_NONE,
+	},
+	{
+		/*name*/    "",
+		/*explain*/ ("硰dir/a.txt,Ϊʱʹļв·Ĳ"),
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_BIN,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_DEFAULT_VALUE_IS_EMPTY,
+	},
+	{
+		/*name*/    "ѹ",
+		/*explain*/ ("0Ϊ洢,19ԽѹԽ,-1ΪĬϼ6"),
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_INT,
+		/*default*/ -1,
+		/*state*/   ArgMark::AS_HAS_DEFAULT_VALUE,
+	}
+};
+EXTERN_C void fn_zip_add_file(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto& self = elibstl::args_to_obj<zip_archive>(pArgInf);
+	const std::wstring path(elibstl::args_to_wsdata(pArgInf, 1));
+	std::wstring_view name = elibstl::args_to_wsdata(pArgInf, 2);
+	if (name.empty())
+	{
+		const size_t slash = path.find_last_of(L"\\/");
+		name = slash == std::wstring::npos ? std::wstring_view(path) : std::wstring_view(path).substr(slash + 1);
+	}
+	pRetData->m_bool = self->writer.add_file(path, name, pArgInf[3].m_int);
+}
+FucInfo Fn_zip_add_file = { {
+		/*ccname*/  "ļ",
+		/*egname*/  "addFile",
+		/*explain*/ "߶ѹ,ڴռļС޹ءѹ󲻱ԭļСʱԶΪ洢ȵá",
+		/*category*/ -1,
+		/*state*/    _CMD_OS(__OS_WIN) ,
+		/*ret*/ SDT_BOOL,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		ESTLARG(Args_ZipAddFile)
+	} ,ESTLFNAME(fn_zip_add_file) };
+
+static ARG_INFO Args_ZipAddData[] =
+{
+	{
+		/*name*/    "",
+		/*explain*/ ("ӵ"),
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_BIN,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_NONE,
+	},
+	{
+		/*name*/    "",
+		/*explain*/ ("硰dir/a.txt"),
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_BIN,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_NONE,
+	},
+	{
+		/*name*/    "ѹ",
+		/*explain*/ ("0Ϊ洢,19ԽѹԽ,-1ΪĬϼ6"),
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_INT,
+		/*default*/ -1,
+		/*state*/   ArgMark::AS_HAS_DEFAULT_VALUE,
+	}
+};
+EXTERN_C void fn_zip_add_data(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto& self = elibstl::args_to_obj<zip_archive>(pArgInf);
+	auto data = elibstl::args_to_ebin(pArgInf, 1);
+	pRetData->m_bool = self->writer.add_data(data ? data->m_data : nullptr, data ? data->m_size : 0,
+		elibstl::args_to_wsdata(pArgInf, 2), pArgInf[3].m_int);
+}
+FucInfo Fn_zip_add_data = { {
+		/*ccname*/  "",
+		/*egname*/  "addData",
+		/*explain*/ "ֽڼΪһļӵѹ,޸ʱΪǰʱ䡣ȵá",
+		/*category*/ -1,
+		/*state*/    _CMD_OS(__OS_WIN) ,
+		/*ret*/ SDT_BOOL,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		ESTLARG(Args_ZipAddData)
+	} ,ESTLFNAME(fn_zip_add_data) };
+
+static ARG_INFO Args_ZipAddDir[] =
+{
+	{
+		/*name*/    "Ŀ¼",
+		/*explain*/ ("ӵĿ¼,еļĿ¼ᱻ,Ŀ¼"),
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_BIN,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_NONE,
+	},
+	{
+		/*name*/    "·",
+		/*explain*/ ("ӵڵĸĿ¼,ΪʱӵĿ¼"),
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_BIN,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_DEFAULT_VALUE_IS_EMPTY,
+	},
+	{
+		/*name*/    "ѹ",
+		/*explain*/ ("0Ϊ洢,19ԽѹԽ,-1ΪĬϼ6"),
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_INT,
+		/*default*/ -1,
+		/*state*/   ArgMark::AS_HAS_DEFAULT_VALUE,
+	}
+};
+EXTERN_C void fn_zip_add_dir(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto& self = elibstl::args_to_obj<zip_archive>(pArgInf);
+	std::wstring dir(elibstl::args_to_wsdata(pArgInf, 1));
+	while (dir.size() > 1 && (dir.back() == L'\\' || dir.back() == L'/'))
+		dir.pop_back();
+	pRetData->m_bool = !dir.empty() && self->writer.add_directory(dir, elibstl::args_to_wsdata(pArgInf, 2), pArgInf[3].m_int);
+}
+FucInfo Fn_zip_add_dir = { {
+		/*ccname*/  "Ŀ¼",
+		/*egname*/  "addDirectory",
+		/*explain*/ "ݹĿ¼µȫļĿ¼(Ŀ¼),Ŀ¼ӡļʧʱؼ,ļԻӡȵá",
+		/*category*/ -1,
+		/*state*/    _CMD_OS(__OS_WIN) ,
+		/*ret*/ SDT_BOOL,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		ESTLARG(Args_ZipAddDir)
+	} ,ESTLFNAME(fn_zip_add_dir) };
+
+static INT s_dtCmdIndexcommobj_zip[] = { 408,409,410,411,412,413,414,415,416,417,418,419,420,421,422,423,424,425,426 };
+namespace elibstl {
+
+
+	LIB_DATA_TYPE_INFO Obj_Zip =
+	{
+		"ѹ",
+		"ZipArchive",
+		"дZIPѹ,ʹõzlibִ֧洢deflatezip64ļ,ɶ߳̽ѹ,ּ֧",
+		sizeof(s_dtCmdIndexcommobj_zip) / sizeof(s_dtCmdIndexcommobj_zip[0]),
+		 s_dtCmdIndexcommobj_zip,
+		_DT_OS(__OS_WIN),
+		0,
+		NULL,
+		NULL,
+		NULL,
+		NULL,
+		NULL,
+		0,
+		0
+	};
+}
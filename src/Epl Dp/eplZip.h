@@ -0,0 +1,115 @@
+#pragma once
+#include<windows.h>
+#include<cstdint>
+#include<string>
+#include<string_view>
+#include<vector>
+#include<functional>
+
+/*
+* ZIPѹд,ѹ/ѹʹõzlib.
+* ִ֧洢(0)deflate(8)ַ,4GBļͳ65535ļʱԶʹzip64.
+* ּ֧ܺͷ־.
+*/
+namespace elibstl {
+	namespace zip {
+		struct entry
+		{
+			std::wstring name;              /*,Ŀ¼'/'β*/
+			std::uint64_t compressed_size = 0;
+			std::uint64_t size = 0;
+			std::uint64_t local_offset = 0; /*ļͷڰڵƫ*/
+			std::uint32_t crc = 0;
+			std::uint16_t method = 0;
+			std::uint16_t flags = 0;
+			std::uint16_t dos_time = 0;
+			std::uint16_t dos_date = 0;
+			bool is_directory() const { return !name.empty() && name.back() == L'/'; }
+			/*ʱ*/
+			SYSTEMTIME time() const;
+		};
+
+		/*ѹνsink,falseʱֹ*/
+		using sink = std::function<bool(const unsigned char* data, size_t size)>;
+
+		class reader
+		{
+		public:
+			reader() = default;
+			reader(const reader&) = delete;
+			reader& operator=(const reader&) = delete;
+			~reader() { close(); }
+
+			bool open(const std::wstring& path);
+			void close();
+			bool is_open() const { return m_file != INVALID_HANDLE_VALUE; }
+
+			const std::vector<entry>& entries() const { return m_entries; }
+			/*Ʋ,'\''/'Ϊͬ,ִСд,Ҳ-1*/
+			int find(std::wstring_view name) const;
+
+			/*ʽѹһ,ͬʱУCRCͳ*/
+			bool extract(size_t index, const sink& out) const;
+			bool extract_to_file(size_t index, const std::wstring& path) const;
+			/*ѹȫĿ¼,ļ,threadsΪ0ʱʹCPU.".."·ᱻܾ*/
+			bool extract_all(const std::wstring& dir, unsigned threads = 0) const;
+
+		private:
+			bool read_central_directory();
+			bool extract_from(HANDLE file, const entry& item, const sink& out) const;
+
+			std::wstring m_path;
+			HANDLE m_file = INVALID_HANDLE_VALUE;
+			std::uint64_t m_file_size = 0;
+			/*Խѹѹǰʱ,ƫҪֵ*/
+			std::uint64_t m_base = 0;
+			std::vector<entry> m_entries;
+		};
+
+		class writer
+		{
+		public:
+			writer() = default;
+			writer(const writer&) = delete;
+			writer& operator=(const writer&) = delete;
+			/*δclose()ʱѹ*/
+			~writer();
+
+			bool create(const std::wstring& path);
+			/*дĿ¼رļ,֮ǰӵݲŹЧѹ*/
+			bool close();
+			bool is_open() const { return m_file != INVALID_HANDLE_VALUE; }
+
+			/*levelΪ0ʱ洢,19-1ʱdeflate;ѹ󲻱ԭСĻΪ洢*/
+			bool add_data(const unsigned char* data, size_t size, std::wstring_view name, int level = -1);
+			bool add_file(const std::wstring& path, std::wstring_view name, int level = -1);
+			/*ݹĿ¼µȫļĿ¼,prefixΪڵϼ·,Ϊ*/
+			bool add_directory(const std::wstring& dir, std::wstring_view prefix, int level = -1);
+
+		private:
+			struct source;
+			bool add_entry(source& src, std::wstring_view name, int level, const FILETIME* time, DWORD attributes);
+			bool add_directory_entry(std::wstring_view name, const FILETIME* time);
+			bool write(const void* data, size_t size);
+			bool write_at(std::uint64_t offset, const void* data, size_t size);
+			void discard();
+
+			struct record
+			{
+				std::string name;           /*UTF-8*/
+				std::uint64_t compressed_size;
+				std::uint64_t size;
+				std::uint64_t local_offset;
+				std::uint32_t crc;
+				std::uint32_t attributes;
+				std::uint16_t method;
+				std::uint16_t dos_time;
+				std::uint16_t dos_date;
+			};
+			std::wstring m_path;
+			HANDLE m_file = INVALID_HANDLE_VALUE;
+			std::uint64_t m_offset = 0;
+			std::vector<record> m_records;
+		};
+	}
+}
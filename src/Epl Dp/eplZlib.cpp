@@ -0,0 +1,782 @@
+#include"ElibHelp.h"
+#include"../../zlib/Czlib.h"
+
+namespace {
+	/*ļѹ/ѹʱÿζȡĴС,ڴռļС޹*/
+	constexpr DWORD kFileChunk = 256 * 1024;
+
+	/*ȡȫ,ֱдֽڼ,һθ*/
+	LPBYTE pull_to_ebin(CzlibOutput& stream)
+	{
+		const uLong size = stream.pending();
+		if (size == 0)
+			return nullptr;
+		LPBYTE pd = static_cast<LPBYTE>(elibstl::ealloc(sizeof(std::uint32_t) * 2 + size));
+		*reinterpret_cast<std::uint32_t*>(pd) = 1;
+		*reinterpret_cast<std::uint32_t*>(pd + sizeof(std::uint32_t)) = size;
+		stream.pull(pd + sizeof(std::uint32_t) * 2, size);
+		return pd;
+	}
+
+	bool write_pending(HANDLE hFile, CzlibOutput& stream, std::vector<BYTE>& buffer)
+	{
+		for (;;)
+		{
+			const uLong size = stream.pull(buffer.data(), static_cast<uLong>(buffer.size()));
+			if (size == 0)
+				return true;
+			DWORD written = 0;
+			if (!WriteFile(hFile, buffer.data(), size, &written, NULL) || written != size)
+				return false;
+		}
+	}
+
+	/*Դļȡ,streamдĿļ;pushΪһ,endΪβ*/
+	template <class Stream, class Push, class End>
+	bool transform_file(const std::wstring& src, const std::wstring& dst, Stream& stream, Push push, End end)
+	{
+		HANDLE hSrc = CreateFileW(src.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+		if (hSrc == INVALID_HANDLE_VALUE)
+			return false;
+		HANDLE hDst = CreateFileW(dst.c_str(), GENERIC_WRITE, 0, NULL, CREATE_ALWAYS, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+		if (hDst == INVALID_HANDLE_VALUE)
+		{
+			CloseHandle(hSrc);
+			return false;
+		}
+		std::vector<BYTE> in(kFileChunk), out(kFileChunk);
+		bool ok = true;
+		for (;;)
+		{
+			DWORD read = 0;
+			if (!ReadFile(hSrc, in.data(), kFileChunk, &read, NULL))
+			{
+				ok = false;
+				break;
+			}
+			if (read == 0)
+				break;
+			if (!push(stream, in.data(), read) || !write_pending(hDst, stream, out))
+			{
+				ok = false;
+				break;
+			}
+		}
+		ok = ok && end(stream) && write_pending(hDst, stream, out);
+		CloseHandle(hSrc);
+		CloseHandle(hDst);
+		/*ʧʱ²Ŀļ*/
+		if (!ok)
+			DeleteFileW(dst.c_str());
+		return ok;
+	}
+}
+
+static ARG_INFO Args_CompressFile[] =
+{
+	{
+		/*name*/    "Դļ",
+		/*explain*/ ("ѹļ"),
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_BIN,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_NONE,
+	},
+	{
+		/*name*/    "Ŀļ",
+		/*explain*/ ("ѹдļ,Ѵʱᱻ"),
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_BIN,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_NONE,
+	},
+	{
+		/*name*/    "ʽ",
+		/*explain*/ ("1ԭʼdeflate2zlib3gzip(.gzļ)"),
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_INT,
+		/*default*/ 3,
+		/*state*/   ArgMark::AS_HAS_DEFAULT_VALUE,
+	},
+	{
+		/*name*/    "ѹ",
+		/*explain*/ ("09,0Ϊѹ,9Ϊѹ,-1ΪĬϼ6"),
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_INT,
+		/*default*/ -1,
+		/*state*/   ArgMark::AS_HAS_DEFAULT_VALUE,
+	},
+	{
+		/*name*/    "߳",
+		/*explain*/ ("1ʱ128Kֿ߳ѹ,Ǳ׼ʽ,ѹ½;0ΪCPU"),
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_INT,
+		/*default*/ 1,
+		/*state*/   ArgMark::AS_HAS_DEFAULT_VALUE,
+	}
+};
+
+EXTERN_C void Fn_compress_file_W(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	if (pArgInf[4].m_int != 1)
+	{
+		CzlibParallelDeflate stream;
+		if (pArgInf[4].m_int < 0 || !stream.init(pArgInf[3].m_int, pArgInf[2].m_int, pArgInf[4].m_int))
+		{
+			pRetData->m_bool = FALSE;
+			return;
+		}
+		pRetData->m_bool = transform_file(std::wstring(elibstl::args_to_wsdata(pArgInf, 0)), std::wstring(elibstl::args_to_wsdata(pArgInf, 1)), stream,
+			[](CzlibParallelDeflate& s, const BYTE* data, DWORD size) { return s.push(data, size); },
+			[](CzlibParallelDeflate& s) { return s.finish(); });
+		return;
+	}
+	CzlibDeflate stream;
+	if (!stream.init(pArgInf[3].m_int, pArgInf[2].m_int))
+	{
+		pRetData->m_bool = FALSE;
+		return;
+	}
+	pRetData->m_bool = transform_file(std::wstring(elibstl::args_to_wsdata(pArgInf, 0)), std::wstring(elibstl::args_to_wsdata(pArgInf, 1)), stream,
+		[](CzlibDeflate& s, const BYTE* data, DWORD size) { return s.push(data, size); },
+		[](CzlibDeflate& s) { return s.finish(); });
+}
+
+FucInfo compress_file_W = { {
+		/*ccname*/  ("ѹļW"),
+		/*egname*/  (""),
+		/*explain*/ ("߶ѹ,ڴռù̶,GBĴļɹ,ʧʱĿļ"),
+		/*category*/17,
+		/*state*/   NULL,
+		/*ret*/     SDT_BOOL,
+		/*reserved*/NULL,
+		/*level*/   LVL_HIGH,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*ArgCount*/sizeof(Args_CompressFile) / sizeof(Args_CompressFile[0]),
+		/*arg lp*/  &Args_CompressFile[0],
+	} ,Fn_compress_file_W ,"Fn_compress_file_W" };
+
+static ARG_INFO Args_UncompressFile[] =
+{
+	{
+		/*name*/    "Դļ",
+		/*explain*/ ("ѹļ"),
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_BIN,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_NONE,
+	},
+	{
+		/*name*/    "Ŀļ",
+		/*explain*/ ("ѹдļ,Ѵʱᱻ"),
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_BIN,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_NONE,
+	},
+	{
+		/*name*/    "ʽ",
+		/*explain*/ ("0Զʶzlibgzip1ԭʼdeflate2zlib3gzip"),
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_INT,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_HAS_DEFAULT_VALUE,
+	}
+};
+
+EXTERN_C void Fn_uncompress_file_W(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	CzlibInflate stream;
+	if (!stream.init(pArgInf[2].m_int))
+	{
+		pRetData->m_bool = FALSE;
+		return;
+	}
+	/*ݲʱѹ,ͬΪʧ*/
+	pRetData->m_bool = transform_file(std::wstring(elibstl::args_to_wsdata(pArgInf, 0)), std::wstring(elibstl::args_to_wsdata(pArgInf, 1)), stream,
+		[](CzlibInflate& s, const BYTE* data, DWORD size) { return s.push(data, size); },
+		[](CzlibInflate& s) { return s.isFinished(); });
+}
+
+FucInfo uncompress_file_W = { {
+		/*ccname*/  ("ѹļW"),
+		/*egname*/  (""),
+		/*explain*/ ("߶߽ѹ,ڴռù̶gzipʽֶ֧Աβӵļɹ,𻵻ʱؼҲĿļ"),
+		/*category*/17,
+		/*state*/   NULL,
+		/*ret*/     SDT_BOOL,
+		/*reserved*/NULL,
+		/*level*/   LVL_HIGH,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*ArgCount*/sizeof(Args_UncompressFile) / sizeof(Args_UncompressFile[0]),
+		/*arg lp*/  &Args_UncompressFile[0],
+	} ,Fn_uncompress_file_W ,"Fn_uncompress_file_W" };
+
+static ARG_INFO Args_ParallelCompress[] =
+{
+	{
+		/*name*/    "",
+		/*explain*/ ("ѹ"),
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_BIN,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_NONE,
+	},
+	{
+		/*name*/    "ʽ",
+		/*explain*/ ("1ԭʼdeflate2zlib3gzip"),
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_INT,
+		/*default*/ 3,
+		/*state*/   ArgMark::AS_HAS_DEFAULT_VALUE,
+	},
+	{
+		/*name*/    "ѹ",
+		/*explain*/ ("09,0Ϊѹ,9Ϊѹ,-1ΪĬϼ6"),
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_INT,
+		/*default*/ -1,
+		/*state*/   ArgMark::AS_HAS_DEFAULT_VALUE,
+	},
+	{
+		/*name*/    "߳",
+		/*explain*/ ("0ΪCPU"),
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_INT,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_HAS_DEFAULT_VALUE,
+	},
+	{
+		/*name*/    "С",
+		/*explain*/ ("ÿֽ,С32768ԽСжԽ,ѹԽ"),
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_INT,
+		/*default*/ 131072,
+		/*state*/   ArgMark::AS_HAS_DEFAULT_VALUE,
+	}
+};
+
+EXTERN_C void Fn_parallel_compress(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	if (pArgInf[3].m_int < 0 || pArgInf[4].m_int <= 0)
+		return;
+	CzlibParallelDeflate stream;
+	if (!stream.init(pArgInf[2].m_int, pArgInf[1].m_int, pArgInf[3].m_int, pArgInf[4].m_int))
+		return;
+	auto data = elibstl::args_to_ebin(pArgInf, 0);
+	if (stream.finish(data ? data->m_data : nullptr, data ? data->m_size : 0))
+		pRetData->m_pBin = pull_to_ebin(stream);
+}
+
+FucInfo parallel_compress = { {
+		/*ccname*/  ("ѹ"),
+		/*egname*/  (""),
+		/*explain*/ ("ݷֿö߳ͬʱѹ,ص׼deflate/zlib/gzip,κzlibѹֻСй,߳޹ءʧܷؿֽڼ"),
+		/*category*/17,
+		/*state*/   NULL,
+		/*ret*/     SDT_BIN,
+		/*reserved*/NULL,
+		/*level*/   LVL_HIGH,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*ArgCount*/sizeof(Args_ParallelCompress) / sizeof(Args_ParallelCompress[0]),
+		/*arg lp*/  &Args_ParallelCompress[0],
+	} ,Fn_parallel_compress ,"Fn_parallel_compress" };
+
+
+
+//
+EXTERN_C void fn_deflate_structure(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto& self = elibstl::args_to_obj<CzlibDeflate>(pArgInf);
+	self = new CzlibDeflate;
+	self->init();
+}
+FucInfo Fn_deflate_structure = { {
+		/*ccname*/  "",
+		/*egname*/  "",
+		/*explain*/ NULL,
+		/*category*/ -1,
+		/*state*/  _CMD_OS(__OS_WIN) | CT_IS_HIDED | CT_IS_OBJ_CONSTURCT_CMD,
+		/*ret*/ _SDT_NULL,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*ArgCount*/0,
+		/*arg lp*/  NULL,
+	} ,ESTLFNAME(fn_deflate_structure) };
+
+static ARG_INFO s_DeflateCopyArgs[] =
+{
+	{
+		/*name*/    "",
+		/*explain*/ "",
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/	(DATA_TYPE)29,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_DEFAULT_VALUE_IS_EMPTY,
+	}
+};
+//
+EXTERN_C void fn_deflate_copy(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto& self = elibstl::classhelp::get_this<CzlibDeflate>(pArgInf);
+	const auto& rht = elibstl::classhelp::get_other<CzlibDeflate>(pArgInf);
+	//Դ󲻴ʱһδʼĶ,֮Ĳʧ
+	self = rht ? new CzlibDeflate{ *rht } : new CzlibDeflate;
+}
+FucInfo Fn_deflate_copy = { {
+		/*ccname*/  "",
+		/*egname*/  "",
+		/*explain*/ NULL,
+		/*category*/ -1,
+		/*state*/   _CMD_OS(__OS_WIN) | CT_IS_HIDED | CT_IS_OBJ_COPY_CMD,
+		/*ret*/ _SDT_NULL,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*ArgCount*/1,
+		/*arg lp*/  s_DeflateCopyArgs,
+	} ,ESTLFNAME(fn_deflate_copy) };
+
+//
+EXTERN_C void fn_deflate_destruct(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto& self = elibstl::args_to_obj<CzlibDeflate>(pArgInf);
+	if (self)
+	{
+		self->~CzlibDeflate();
+		operator delete(self);
+	}
+	self = nullptr;
+}
+FucInfo Fn_deflate_destruct = { {
+		/*ccname*/  "",
+		/*egname*/  "",
+		/*explain*/ NULL,
+		/*category*/ -1,
+		/*state*/    _CMD_OS(__OS_WIN) | CT_IS_HIDED | CT_IS_OBJ_FREE_CMD,
+		/*ret*/ _SDT_NULL,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*ArgCount*/0,
+		/*arg lp*/  NULL,
+	} ,ESTLFNAME(fn_deflate_destruct) };
+
+static ARG_INFO Args_DeflateInit[] =
+{
+	{
+		/*name*/    "ʽ",
+		/*explain*/ ("1ԭʼdeflate2zlib3gzip"),
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_INT,
+		/*default*/ 2,
+		/*state*/   ArgMark::AS_HAS_DEFAULT_VALUE,
+	},
+	{
+		/*name*/    "ѹ",
+		/*explain*/ ("09,0Ϊѹ,9Ϊѹ,-1ΪĬϼ6"),
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_INT,
+		/*default*/ -1,
+		/*state*/   ArgMark::AS_HAS_DEFAULT_VALUE,
+	},
+	{
+		/*name*/    "λ",
+		/*explain*/ ("915,Ϊ2ĸôηֽڡԽѹԽ,ѹʱʹòСڴֵĴλ"),
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_INT,
+		/*default*/ 15,
+		/*state*/   ArgMark::AS_HAS_DEFAULT_VALUE,
+	}
+};
+EXTERN_C void fn_deflate_init(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto& self = elibstl::args_to_obj<CzlibDeflate>(pArgInf);
+	pRetData->m_bool = self->init(pArgInf[2].m_int, pArgInf[1].m_int, pArgInf[3].m_int);
+}
+FucInfo Fn_deflate_init = { {
+		/*ccname*/  "ʼ",
+		/*egname*/  "init",
+		/*explain*/ "ѹݡδñʱΪzlibʽĬϼ15λڡϴͬʱḴѷڲ״̬",
+		/*category*/ -1,
+		/*state*/    _CMD_OS(__OS_WIN) ,
+		/*ret*/ SDT_BOOL,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		ESTLARG(Args_DeflateInit)
+	} ,ESTLFNAME(fn_deflate_init) };
+
+static ARG_INFO Args_DeflatePush[] =
+{
+	{
+		/*name*/    "",
+		/*explain*/ ("ѹ"),
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_BIN,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_DEFAULT_VALUE_IS_EMPTY,
+	},
+	{
+		/*name*/    "Ƿ",
+		/*explain*/ ("ΪʱΪһ,ֵѹȫʣ,֮衰áܿʼµѹ"),
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_BOOL,
+		/*default*/ FALSE,
+		/*state*/   ArgMark::AS_HAS_DEFAULT_VALUE,
+	}
+};
+EXTERN_C void fn_deflate_push(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto& self = elibstl::args_to_obj<CzlibDeflate>(pArgInf);
+	auto data = elibstl::args_to_ebin(pArgInf, 1);
+	const bool ok = pArgInf[2].m_bool ? self->finish(data ? data->m_data : nullptr, data ? data->m_size : 0)
+		: self->push(data ? data->m_data : nullptr, data ? data->m_size : 0);
+	if (ok)
+		pRetData->m_pBin = pull_to_ebin(*self);
+}
+FucInfo Fn_deflate_push = { {
+		/*ccname*/  "",
+		/*egname*/  "push",
+		/*explain*/ "ѹ,ĿǰѲѹ(Ϊ),ÿεķֵƴӼΪѹʧܷؿֽڼ",
+		/*category*/ -1,
+		/*state*/    _CMD_OS(__OS_WIN) ,
+		/*ret*/ SDT_BIN,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		ESTLARG(Args_DeflatePush)
+	} ,ESTLFNAME(fn_deflate_push) };
+
+EXTERN_C void fn_deflate_flush(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto& self = elibstl::args_to_obj<CzlibDeflate>(pArgInf);
+	if (self->flush())
+		pRetData->m_pBin = pull_to_ebin(*self);
+}
+FucInfo Fn_deflate_flush = { {
+		/*ccname*/  "ˢ",
+		/*egname*/  "flush",
+		/*explain*/ "Ѽݵȫѹ,ʹշѹĿǰΪֹ,ڱѹ߷͡Ƶûήѹʡ",
+		/*category*/ -1,
+		/*state*/    _CMD_OS(__OS_WIN) ,
+		/*ret*/ SDT_BIN,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*ArgCount*/0,
+		/*arg lp*/  0,
+	} ,ESTLFNAME(fn_deflate_flush) };
+
+EXTERN_C void fn_deflate_reset(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto& self = elibstl::args_to_obj<CzlibDeflate>(pArgInf);
+	self->reset();
+}
+FucInfo Fn_deflate_reset = { {
+		/*ccname*/  "",
+		/*egname*/  "reset",
+		/*explain*/ "ѼԿʼµѹ,ֲ䡣",
+		/*category*/ -1,
+		/*state*/    _CMD_OS(__OS_WIN) ,
+		/*ret*/ _SDT_NULL,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*ArgCount*/0,
+		/*arg lp*/  0,
+	} ,ESTLFNAME(fn_deflate_reset) };
+
+static INT s_dtCmdIndexcommobj_deflate[] = { 388,389,390,391,392,393,394 };
+namespace elibstl {
+
+
+	LIB_DATA_TYPE_INFO Obj_Deflate =
+	{
+		"ѹ",
+		"Deflater",
+		"ʽdeflateѹ,֧ԭʼdeflatezlibgzipʽ,ݿɷֶμ",
+		sizeof(s_dtCmdIndexcommobj_deflate) / sizeof(s_dtCmdIndexcommobj_deflate[0]),
+		 s_dtCmdIndexcommobj_deflate,
+		_DT_OS(__OS_WIN),
+		0,
+		NULL,
+		NULL,
+		NULL,
+		NULL,
+		NULL,
+		0,
+		0
+	};
+}
+
+
+
+//
+EXTERN_C void fn_inflate_structure(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto& self = elibstl::args_to_obj<CzlibInflate>(pArgInf);
+	self = new CzlibInflate;
+	self->init();
+}
+FucInfo Fn_inflate_structure = { {
+		/*ccname*/  "",
+		/*egname*/  "",
+		/*explain*/ NULL,
+		/*category*/ -1,
+		/*state*/  _CMD_OS(__OS_WIN) | CT_IS_HIDED | CT_IS_OBJ_CONSTURCT_CMD,
+		/*ret*/ _SDT_NULL,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*ArgCount*/0,
+		/*arg lp*/  NULL,
+	} ,ESTLFNAME(fn_inflate_structure) };
+
+static ARG_INFO s_InflateCopyArgs[] =
+{
+	{
+		/*name*/    "",
+		/*explain*/ "",
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/	(DATA_TYPE)30,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_DEFAULT_VALUE_IS_EMPTY,
+	}
+};
+//
+EXTERN_C void fn_inflate_copy(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto& self = elibstl::classhelp::get_this<CzlibInflate>(pArgInf);
+	const auto& rht = elibstl::classhelp::get_other<CzlibInflate>(pArgInf);
+	//Դ󲻴ʱһδʼĶ,֮Ĳʧ
+	self = rht ? new CzlibInflate{ *rht } : new CzlibInflate;
+}
+FucInfo Fn_inflate_copy = { {
+		/*ccname*/  "",
+		/*egname*/  "",
+		/*explain*/ NULL,
+		/*category*/ -1,
+		/*state*/   _CMD_OS(__OS_WIN) | CT_IS_HIDED | CT_IS_OBJ_COPY_CMD,
+		/*ret*/ _SDT_NULL,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*ArgCount*/1,
+		/*arg lp*/  s_InflateCopyArgs,
+	} ,ESTLFNAME(fn_inflate_copy) };
+
+//
+EXTERN_C void fn_inflate_destruct(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto& self = elibstl::args_to_obj<CzlibInflate>(pArgInf);
+	if (self)
+	{
+		self->~CzlibInflate();
+		operator delete(self);
+	}
+	self = nullptr;
+}
+FucInfo Fn_inflate_destruct = { {
+		/*ccname*/  "",
+		/*egname*/  "",
+		/*explain*/ NULL,
+		/*category*/ -1,
+		/*state*/    _CMD_OS(__OS_WIN) | CT_IS_HIDED | CT_IS_OBJ_FREE_CMD,
+		/*ret*/ _SDT_NULL,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*ArgCount*/0,
+		/*arg lp*/  NULL,
+	} ,ESTLFNAME(fn_inflate_destruct) };
+
+static ARG_INFO Args_InflateInit[] =
+{
+	{
+		/*name*/    "ʽ",
+		/*explain*/ ("0Զʶzlibgzip1ԭʼdeflate2zlib3gzip"),
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_INT,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_HAS_DEFAULT_VALUE,
+	},
+	{
+		/*name*/    "λ",
+		/*explain*/ ("815,費СѹʱʹõĴλ"),
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_INT,
+		/*default*/ 15,
+		/*state*/   ArgMark::AS_HAS_DEFAULT_VALUE,
+	}
+};
+EXTERN_C void fn_inflate_init(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto& self = elibstl::args_to_obj<CzlibInflate>(pArgInf);
+	pRetData->m_bool = self->init(pArgInf[1].m_int, pArgInf[2].m_int);
+}
+FucInfo Fn_inflate_init = { {
+		/*ccname*/  "ʼ",
+		/*egname*/  "init",
+		/*explain*/ "ýѹݡδñʱΪԶʶʽ15λڡ",
+		/*category*/ -1,
+		/*state*/    _CMD_OS(__OS_WIN) ,
+		/*ret*/ SDT_BOOL,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		ESTLARG(Args_InflateInit)
+	} ,ESTLFNAME(fn_inflate_init) };
+
+static ARG_INFO Args_InflatePush[] =
+{
+	{
+		/*name*/    "",
+		/*explain*/ ("ѹ"),
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_BIN,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_NONE,
+	}
+};
+EXTERN_C void fn_inflate_push(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto& self = elibstl::args_to_obj<CzlibInflate>(pArgInf);
+	auto data = elibstl::args_to_ebin(pArgInf, 1);
+	if (self->push(data ? data->m_data : nullptr, data ? data->m_size : 0))
+		pRetData->m_pBin = pull_to_ebin(*self);
+}
+FucInfo Fn_inflate_push = { {
+		/*ccname*/  "",
+		/*egname*/  "push",
+		/*explain*/ "ѹ,Ŀǰܽѹ(Ϊ),ÿεķֵƴӼΪĽѹʱؿֽڼ,áȡ롱жϡ",
+		/*category*/ -1,
+		/*state*/    _CMD_OS(__OS_WIN) ,
+		/*ret*/ SDT_BIN,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		ESTLARG(Args_InflatePush)
+	} ,ESTLFNAME(fn_inflate_push) };
+
+EXTERN_C void fn_inflate_finished(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto& self = elibstl::args_to_obj<CzlibInflate>(pArgInf);
+	pRetData->m_bool = self->isFinished();
+}
+FucInfo Fn_inflate_finished = { {
+		/*ccname*/  "Ƿ",
+		/*egname*/  "finished",
+		/*explain*/ "ѹǷȫݼΪ˵ݲ",
+		/*category*/ -1,
+		/*state*/    _CMD_OS(__OS_WIN) ,
+		/*ret*/ SDT_BOOL,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*ArgCount*/0,
+		/*arg lp*/  0,
+	} ,ESTLFNAME(fn_inflate_finished) };
+
+EXTERN_C void fn_inflate_error(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto& self = elibstl::args_to_obj<CzlibInflate>(pArgInf);
+	pRetData->m_int = self->GetError();
+}
+FucInfo Fn_inflate_error = { {
+		/*ccname*/  "ȡ",
+		/*egname*/  "error",
+		/*explain*/ "һβzlib,0Ϊ,-3Ϊ,-4Ϊڴ治㡣",
+		/*category*/ -1,
+		/*state*/    _CMD_OS(__OS_WIN) ,
+		/*ret*/ SDT_INT,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*ArgCount*/0,
+		/*arg lp*/  0,
+	} ,ESTLFNAME(fn_inflate_error) };
+
+EXTERN_C void fn_inflate_reset(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto& self = elibstl::args_to_obj<CzlibInflate>(pArgInf);
+	self->reset();
+}
+FucInfo Fn_inflate_reset = { {
+		/*ccname*/  "",
+		/*egname*/  "reset",
+		/*explain*/ "ѼԿʼµĽѹ,ֲ䡣",
+		/*category*/ -1,
+		/*state*/    _CMD_OS(__OS_WIN) ,
+		/*ret*/ _SDT_NULL,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*ArgCount*/0,
+		/*arg lp*/  0,
+	} ,ESTLFNAME(fn_inflate_reset) };
+
+static INT s_dtCmdIndexcommobj_inflate[] = { 395,396,397,398,399,400,401,402 };
+namespace elibstl {
+
+
+	LIB_DATA_TYPE_INFO Obj_Inflate =
+	{
+		"ѹ",
+		"Inflater",
+		"ʽdeflateѹ,֧ԭʼdeflatezlibgzipʽ,ݿɷֶμ",
+		sizeof(s_dtCmdIndexcommobj_inflate) / sizeof(s_dtCmdIndexcommobj_inflate[0]),
+		 s_dtCmdIndexcommobj_inflate,
+		_DT_OS(__OS_WIN),
+		0,
+		NULL,
+		NULL,
+		NULL,
+		NULL,
+		NULL,
+		0,
+		0
+	};
+}
@@ -5,6 +5,9 @@
 #include <cstdlib>
 
 #include"EcontrolHelp.h"
+#if defined(_M_IX86) || defined(_M_X64)
+#include<intrin.h>
+#endif
 
 
 #ifdef _WIN32
@@ -14,6 +17,10 @@ namespace elibstl {
 
 	class CFile{
 		HANDLE m_hFile{ INVALID_HANDLE_VALUE };
+		/*:ϵͳļָλڻβ,߼дλΪ ϵͳλ-(m_rlen-m_rpos)*/
+		static constexpr size_t kReadBufSize = 64 * 1024;
+		std::vector<unsigned char> m_rbuf;
+		size_t m_rpos{ 0 }, m_rlen{ 0 };
 	public:
 		~CFile() {
 			Close();
@@ -53,6 +60,7 @@ namespace elibstl {
 			 return TRUE;
 		}
 		void Close() {
+			m_rpos = m_rlen = 0;
 			if (m_hFile != INVALID_HANDLE_VALUE )
 			{
 				::CloseHandle(m_hFile);
@@ -93,6 +101,7 @@ namespace elibstl {
 			default://#ļ
 				dwMoveMethod = FILE_BEGIN;
 			}
+			DropReadBuffer();
 			LARGE_INTEGER dis;
 			dis.QuadPart = (ULONGLONG)pArgInf[2].m_int64;
 			bRet = ::SetFilePointerEx(m_hFile, dis, NULL, (DWORD)dwMoveMethod);
@@ -100,14 +109,17 @@ namespace elibstl {
 
 		}
 		BOOL SeekToBegin() {
+			m_rpos = m_rlen = 0;
 			return (::SetFilePointer(m_hFile, 0, NULL, FILE_BEGIN) != INVALID_SET_FILE_POINTER);
 		}
 		BOOL SeekToEnd() {
+			m_rpos = m_rlen = 0;
 			return (::SetFilePointer(m_hFile, 0, NULL, FILE_END) != INVALID_SET_FILE_POINTER);
 		}
 		BOOL WriteBin(INT nArgCount, PMDATA_INF pArgInf) {
 			DWORD dwNumOfByteRead;
 			auto bRet = TRUE;
+			DropReadBuffer();
 			for (INT i = 1; i < nArgCount; i++)
 			{
 				LPBYTE pData = pArgInf[i].m_pBin + 2 * sizeof(INT);
@@ -121,29 +133,58 @@ namespace elibstl {
 			return bRet;
 		}
 		BOOL  MoveWrOff(int ׼ƶλ, INT64 ƶ) {
-
+			DropReadBuffer();
 			LARGE_INTEGER dis;
 			dis.QuadPart = (ULONGLONG)ƶ;
 			return ::SetFilePointerEx(m_hFile, dis, NULL, (DWORD)׼ƶλ);
 		}
 		BOOL MoveToBegin() {
+			m_rpos = m_rlen = 0;
 			return (::SetFilePointer(m_hFile, 0, NULL, FILE_BEGIN) != INVALID_SET_FILE_POINTER);
 		}
 		BOOL MoveToEnd() {
+			m_rpos = m_rlen = 0;
 			return (::SetFilePointer(m_hFile, 0, NULL, FILE_END) != INVALID_SET_FILE_POINTER);
 		}
 		LPBYTE ReadBin(size_t ݵĳߴ) {
 			std::vector<unsigned char> mem;
-			const HANDLE hFile = GetFileHandle();
 			if (m_hFile != INVALID_HANDLE_VALUE && ݵĳߴ > 0)
 			{
-				DWORD dwRead = 0;
-
 				mem.resize(ݵĳߴ);
-				if (::ReadFile(hFile, mem.data(), ݵĳߴ, &dwRead, NULL))
-					mem.resize(dwRead);
-				else
-					::SetFilePointer(hFile, 0, NULL, FILE_END);
+				size_t got = 0;
+				while (got < ݵĳߴ)
+				{
+					const size_t avail = m_rlen - m_rpos;
+					if (avail > 0)
+					{
+						const size_t n = (std::min)(avail, ݵĳߴ - got);
+						memcpy(mem.data() + got, m_rbuf.data() + m_rpos, n);
+						m_rpos += n;
+						got += n;
+						continue;
+					}
+					/*ȡƹֱӶ*/
+					if (ݵĳߴ - got >= kReadBufSize)
+					{
+						DWORD dwRead = 0;
+						if (!::ReadFile(m_hFile, mem.data() + got, (DWORD)(ݵĳߴ - got), &dwRead, NULL))
+						{
+							ReadFailed();
+							got = 0;
+							break;
+						}
+						got += dwRead;
+						if (dwRead == 0)
+							break;
+						continue;
+					}
+					const auto nRet = FillReadBuffer();
+					if (nRet < 0)
+						got = 0;
+					if (nRet <= 0)
+						break;
+				}
+				mem.resize(got);
 			}
 			return elibstl::clone_bin(mem.data(), mem.size());
 		}
@@ -151,11 +192,12 @@ namespace elibstl {
 			return WriteData(дֽڼ.data(), дֽڼ.size());
 		}
 		auto GetOffst() {
-			return (m_hFile == INVALID_HANDLE_VALUE) ? -1 : MoveAndGetFilePos(FILE_CURRENT);
+			return (m_hFile == INVALID_HANDLE_VALUE) ? -1 : GetCurrentPos();
 		}
 
 		INT64 GetCurrentPos()const {
-			return MoveAndGetFilePos(FILE_CURRENT);
+			const auto pos = MoveAndGetFilePos(FILE_CURRENT);
+			return pos < 0 ? pos : pos - (INT64)(m_rlen - m_rpos);
 		}
 		auto GetCurrent()const {
 			return (m_hFile == INVALID_HANDLE_VALUE ? -1 : GetCurrentPos());
@@ -165,6 +207,7 @@ namespace elibstl {
 		{
 			if (m_hFile == INVALID_HANDLE_VALUE)
 				return FALSE;
+			m_rpos = m_rlen = 0;
 			LARGE_INTEGER pos;
 			pos.QuadPart = (ULONGLONG)n64CurrentPos;
 			return ::SetFilePointerEx(m_hFile, pos, NULL, FILE_BEGIN);
@@ -183,54 +226,68 @@ namespace elibstl {
 			std::wstring ret;
 			if (m_hFile != INVALID_HANDLE_VALUE && wannasize != 0)
 			{
-				BOOL blpSuceeded = FALSE;
-				do
+				const INT64 n64CurrentPos = GetCurrentPos();
+				if (n64CurrentPos < 0)
 				{
-					const INT64 n64CurrentPos = GetCurrentPos();
-					if (n64CurrentPos < 0)
-						break;
-					INT npReadSize;
-					if (wannasize < 0)
+					ReadFailed();
+					return clone_textw(ret);
+				}
+				INT64 remain = -1;/*ʣɶַ,С0ʾļβ*/
+				if (wannasize > 0)
+					remain = wannasize;
+				bool first = n64CurrentPos == 0;
+				while (remain != 0)
+				{
+					if (m_rlen - m_rpos < sizeof(WCHAR))
 					{
-						const INT64 n64FileSize = MoveAndGetFilePos(FILE_END);
-						if (n64FileSize < 0)
+						const auto nRet = FillReadBuffer();
+						if (nRet < 0)
+						{
+							ret.clear();
+							break;
+						}
+						if (m_rlen - m_rpos < sizeof(WCHAR))
+						{
+							m_rpos = m_rlen;/*ļβɶԵֽ*/
 							break;
-						npReadSize = (INT)(n64FileSize - n64CurrentPos);
-						SetCurrentPos( n64CurrentPos);
+						}
 					}
-					else
+					const auto* p = m_rbuf.data() + m_rpos;
+					size_t n = (m_rlen - m_rpos) / sizeof(WCHAR);
+					if (remain > 0 && (INT64)n > remain)
+						n = (size_t)remain;
+					size_t i = 0;
+					if (first)
 					{
-						npReadSize = wannasize * sizeof(WCHAR);
+						first = false;
+						if (load_wchar(p) == 0xFEFF)  // ΪļײMSUnicodeıļʼ־?
+							i = 1;  // 
 					}
-
-					std::vector<unsigned char> mem;
-					DWORD dwRead = 0;
-					mem.resize(npReadSize);
-					if (::ReadFile(m_hFile, mem.data(), (DWORD)npReadSize, &dwRead, NULL) == FALSE)
+					const size_t skip = i;
+					bool stop = false;
+					for (; i < n; i++)
+					{
+						const auto ch = load_wchar(p + i * sizeof(WCHAR));
+						if (ch == L'\0' || ch == 0x1A)
+						{
+							stop = true;
+							break;
+						}
+					}
+					append_wchars(ret, p + skip * sizeof(WCHAR), i - skip);
+					m_rpos += (stop ? i + 1 : i) * sizeof(WCHAR);
+					if (stop)
 						break;
-					mem.resize(dwRead);
-					mem.push_back(0);
-					mem.push_back(0);
-
-					const WCHAR* psBegin = (const WCHAR*)mem.data();
-					if (n64CurrentPos == 0 && (WORD)*psBegin == 0xFEFF)  // ΪļײMSUnicodeıļʼ־?
-						psBegin++;  // 
-					const WCHAR* ps = psBegin;
-					while (*ps != '\0' && *ps != 0x1A)
-						ps++;
-					ret = std::wstring(psBegin, ps - psBegin);
-					const DWORD dwOffset = (DWORD)((const BYTE*)(ps + 1) - mem.data());
-					blpSuceeded = SetCurrentPos(n64CurrentPos + (INT64)min(dwOffset, dwRead));
-				} while (FALSE);
-
-				if (blpSuceeded == FALSE)
-					::SetFilePointer(m_hFile, 0, NULL, FILE_END);
+					if (remain > 0)
+						remain -= (INT64)i;
+				}
 			}
 			return clone_textw(ret);
 
 		}
 		BOOL WriteText(INT nArgCount, PMDATA_INF pArgInf) {
 			auto bRet = TRUE;
+			DropReadBuffer();
 			for (INT i = 1; i < nArgCount; i++)
 			{
 				auto pData = elibstl::arg_to_wstring(pArgInf, i);
@@ -257,101 +314,63 @@ namespace elibstl {
 		}
 
 		INT64 MoveToEndAndGetFileSize() {
+			m_rpos = m_rlen = 0;
 			return MoveAndGetFilePos(FILE_END); 
 		}
 		auto ReadLineW()->std::wstring {
-			LARGE_INTEGER 
-				orgLoc{ 0 }, /*ԭʼλ*/
-				newLoc{ 0 }, /*ڴλ*/
-				nTLen{ 0 };/*ڼ¼ȡܳ*/
-			if (SetFilePointerEx(m_hFile, orgLoc, &newLoc, FILE_CURRENT) == 0) {
-				// ļָλûȡʧܣƶļĩβؿַ
-				SetFilePointerEx(m_hFile, orgLoc, &newLoc, FILE_END);
-				return {};
-			}
-			auto nLen = GetSize() - orgLoc.QuadPart;/*ʣ೤*/
-			constexpr auto once_max = 4096;/*嵥ζȡ*/
-			constexpr auto once_wchar_max = once_max / sizeof(wchar_t);/*嵥ʶȡwchar_tַ*/
-			
 			std::wstring line;
-			DWORD dwNumOfByteRead;
-			BOOL bFoundNewline = FALSE;
-
-		
-			for (long long i = 0; i < nLen; i += once_max)
+			ReadLineW(line);
+			return line;
+		}
+		/*һеline,βΪ\r\n\n\rַ0,гܻߴ.ļβʱfalse*/
+		bool ReadLineW(std::wstring& line) {
+			line.clear();
+			if (m_hFile == INVALID_HANDLE_VALUE)
+				return false;
+			bool any = false;
+			while (true)
 			{
-				std::wstring tmp(once_wchar_max, L'\0');
-				const auto needsize = static_cast<DWORD>(min(nLen - i, static_cast<long long>(4096)));
-				auto nRet = ReadFile(m_hFile, tmp.data(), needsize, &dwNumOfByteRead, 0);/*һ4096,ԿReadFile*/;
-				if (nRet == FALSE)
+				if (m_rlen - m_rpos < sizeof(wchar_t))
 				{
-					SetFilePointer(m_hFile, 0, NULL, FILE_END);
-					break;
-				}
-				bool bFind{ false };/*ڼ¼Ƿƥ䵽з*/
-				DWORD j = 0;/*ڼ¼ַеλ*/
-				for (const auto& ch : tmp )/*ַ*/
-				{
-					if (ch == L'\0')
+					const auto nRet = FillReadBuffer();
+					if (nRet < 0)
+						return any;
+					if (m_rlen - m_rpos < sizeof(wchar_t))
 					{
-						bFind = true;/*ƥ䵽*/
-						dwNumOfByteRead = j * sizeof(wchar_t);
-						newLoc.QuadPart = orgLoc.QuadPart + nTLen.QuadPart + j * sizeof(wchar_t);	/*λ:λ+ǰ+ַ*/;
-						SetFilePointerEx(m_hFile, newLoc, nullptr, FILE_BEGIN);/*λ*/
-						break;
+						m_rpos = m_rlen;/*ļβɶԵֽ*/
+						return any;
 					}
-					else if (ch == L'\n')
-					{
-						
-						bFind = true;/*ƥ䵽з*/
-						dwNumOfByteRead = j;
-						newLoc.QuadPart = orgLoc.QuadPart + nTLen.QuadPart + (j + 1) * sizeof(wchar_t);/*ڽ,δҪһ+1ַ*/
-						SetFilePointerEx(m_hFile, newLoc, nullptr, FILE_BEGIN); /*λ*/
-						break;
-					}
-					else if (ch == L'\r') {
-						
-						bFind = true;/*ƥ䵽س*/
-						if (j + 1 == dwNumOfByteRead)/*سһַ*/
-						{
-							wchar_t szNewline{ L'\0' };
-							
-							nRet = ReadFile(m_hFile, &szNewline, sizeof(szNewline), &dwNumOfByteRead, 0);//ٶֽڣǲ\r\n
-							if (nRet == FALSE || szNewline != L'\n')
-							{
-								//\r\nϣѶдλ÷ŵ\r
-								newLoc.QuadPart = orgLoc.QuadPart + nTLen.QuadPart + (j + 1) * sizeof(wchar_t);
-								SetFilePointerEx(m_hFile, newLoc, nullptr, FILE_BEGIN); /*λ*/
-							}
-						}
-						else if (tmp[j + 1] == L'\n')/*һַ,һسΪ,λòatΪһԽ*/
-						{
-							
-							newLoc.QuadPart = orgLoc.QuadPart + nTLen.QuadPart + (j + 2) * sizeof(wchar_t);
-							SetFilePointerEx(m_hFile, newLoc, nullptr, FILE_BEGIN); /*λ*/
-						}
-						else/*һַ,һسΪ*/
-						{
-							// ҵ '\r' 治 '\n'ضϵǰвļָλ
-							newLoc.QuadPart = orgLoc.QuadPart + nTLen.QuadPart + (j + 1) * sizeof(wchar_t);
-							SetFilePointerEx(m_hFile, newLoc, nullptr, FILE_BEGIN); /*λ*/
-						}
-						dwNumOfByteRead = j;
-						break;
-					}
-					j++;
-					
 				}
-				
-				tmp.resize(dwNumOfByteRead);
-				nTLen.QuadPart += dwNumOfByteRead;
-				line += tmp;
-				if (bFind || dwNumOfByteRead != 4096)//ҵ˻з߶ȡĳȲ4096ʵʳȲҲıdwNumOfByteRead,ѭ
-					break;
-
+				any = true;
+				const auto* p = m_rbuf.data() + m_rpos;
+				const size_t n = (m_rlen - m_rpos) / sizeof(wchar_t);
+				const size_t k = find_line_break(p, n);
+				append_wchars(line, p, k);
+				if (k == n)
+				{
+					m_rpos += n * sizeof(wchar_t);
+					continue;
+				}
+				const auto ch = load_wchar(p + k * sizeof(wchar_t));
+				m_rpos += (k + 1) * sizeof(wchar_t);
+				if (ch == L'\r')
+				{
+					/*\rǡڻβ,貹жǷΪ\r\n*/
+					if (m_rlen - m_rpos < sizeof(wchar_t))
+						FillReadBuffer();
+					if (m_rlen - m_rpos >= sizeof(wchar_t) && load_wchar(m_rbuf.data() + m_rpos) == L'\n')
+						m_rpos += sizeof(wchar_t);
+				}
+				return true;
 			}
-
-			return line;
+		}
+		/*,nMaxLines<=0ʱļβ*/
+		std::vector<std::wstring> ReadLinesW(INT nMaxLines) {
+			std::vector<std::wstring> lines;
+			std::wstring line;
+			while ((nMaxLines <= 0 || lines.size() < (size_t)nMaxLines) && ReadLineW(line))
+				lines.emplace_back(std::move(line));
+			return lines;
 		}
 
 		BOOL isOpen() const{
@@ -361,6 +380,7 @@ namespace elibstl {
 			BOOL bRet = FALSE;
 			DWORD dwNumOfByteRead;
 			bRet = TRUE;
+			DropReadBuffer();
 			for (INT i = 1; i < nArgCount; i++)
 			{
 				auto pData = elibstl::arg_to_wstring(pArgInf, i);
@@ -386,6 +406,7 @@ namespace elibstl {
 		BOOL RemoveData(INT64 size) {
 			if (m_hFile == INVALID_HANDLE_VALUE || size <= 0)
 				return FALSE;
+			DropReadBuffer();
 			LARGE_INTEGER orgLoc, newLoc;
 			orgLoc.QuadPart = 0;
 			newLoc.QuadPart = 0;
@@ -441,6 +462,7 @@ namespace elibstl {
 				// ļЧ
 				return FALSE;
 			}
+			DropReadBuffer();
 
 			LARGE_INTEGER orgLoc, newLoc;
 			orgLoc.QuadPart = 0;
@@ -542,9 +564,88 @@ namespace elibstl {
 				return FALSE;
 			if (m_hFile == INVALID_HANDLE_VALUE)
 				return FALSE;
+			DropReadBuffer();
 			DWORD dwWritten = 0;
 			return (npDataSize == 0 || (::WriteFile(m_hFile, pData, (DWORD)npDataSize, &dwWritten, NULL) && dwWritten == (DWORD)npDataSize));
 		}
+		/*δѵ,ϵͳļָ˻߼дλ,д붨λǰ*/
+		void DropReadBuffer()
+		{
+			if (m_rpos < m_rlen && m_hFile != INVALID_HANDLE_VALUE)
+			{
+				LARGE_INTEGER dis;
+				dis.QuadPart = -(LONGLONG)(m_rlen - m_rpos);
+				::SetFilePointerEx(m_hFile, dis, NULL, FILE_CURRENT);
+			}
+			m_rpos = m_rlen = 0;
+		}
+		/*ʧʱԭΪһ:ջ岢Ƶļβ*/
+		void ReadFailed()
+		{
+			m_rpos = m_rlen = 0;
+			::SetFilePointer(m_hFile, 0, NULL, FILE_END);
+		}
+		/*δѵβƵײ,رζֽ,ʧܷ-1*/
+		INT FillReadBuffer()
+		{
+			if (m_rbuf.size() != kReadBufSize)
+				m_rbuf.resize(kReadBufSize);
+			const size_t left = m_rlen - m_rpos;
+			if (left > 0 && m_rpos > 0)
+				memmove(m_rbuf.data(), m_rbuf.data() + m_rpos, left);
+			m_rpos = 0;
+			m_rlen = left;
+			DWORD dwRead = 0;
+			if (!::ReadFile(m_hFile, m_rbuf.data() + left, (DWORD)(kReadBufSize - left), &dwRead, NULL))
+			{
+				ReadFailed();
+				return -1;
+			}
+			m_rlen += dwRead;
+			return (INT)dwRead;
+		}
+		/*еλò֤2ֽڶ,ͳһֽڶȡ*/
+		static wchar_t load_wchar(const unsigned char* p)
+		{
+			wchar_t ch;
+			memcpy(&ch, p, sizeof(ch));
+			return ch;
+		}
+		static void append_wchars(std::wstring& str, const unsigned char* p, size_t count)
+		{
+			if (count == 0)
+				return;
+			const auto old = str.size();
+			str.resize(old + count);
+			memcpy(str.data() + old, p, count * sizeof(wchar_t));
+		}
+		/*׸\r\nַ0,ַ,δҵcount*/
+		static size_t find_line_break(const unsigned char* p, size_t count)
+		{
+			size_t i = 0;
+#if defined(_M_IX86) || defined(_M_X64)
+			const __m128i cr = _mm_set1_epi16(L'\r'), lf = _mm_set1_epi16(L'\n'), zero = _mm_setzero_si128();
+			for (; i + 8 <= count; i += 8)
+			{
+				const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i * sizeof(wchar_t)));
+				const __m128i hit = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi16(v, cr), _mm_cmpeq_epi16(v, lf)), _mm_cmpeq_epi16(v, zero));
+				const int mask = _mm_movemask_epi8(hit);
+				if (mask != 0)
+				{
+					unsigned long bit;
+					_BitScanForward(&bit, (unsigned long)mask);
+					return i + bit / 2;
+				}
+			}
+#endif
+			for (; i < count; i++)
+			{
+				const auto ch = load_wchar(p + i * sizeof(wchar_t));
+				if (ch == L'\r' || ch == L'\n' || ch == L'\0')
+					break;
+			}
+			return i;
+		}
 	
 
 	};
@@ -1043,6 +1144,40 @@ FucInfo Fn_CFile_ReadLine = { {
 		/*arg lp*/ nullptr,
 	} ,ESTLFNAME(fn_CFile_ReadLine) };
 
+static ARG_INFO s_ReadLinesArgs[] =
+{
+	{
+		/*name*/    "",
+		/*explain*/ "ʡԻСڵ0һֱļβ",
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_INT,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_DEFAULT_VALUE_IS_EMPTY,
+	}
+};
+EXTERN_C void fn_CFile_ReadLines(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto& self = elibstl::classhelp::get_this<elibstl::CFile>(pArgInf);
+	const auto count = elibstl::args_to_data<INT>(pArgInf, 1).value_or(0);
+	pRetData->m_pAryData = elibstl::create_text_array(self->ReadLinesW(count));
+}
+
+FucInfo Fn_CFile_ReadLines = { {
+		/*ccname*/  "W",
+		/*egname*/  "ReadLines",
+		/*explain*/ "ļеǰдλȡıݲ鷵أĩĻسзļβʱؿ顣ע: ıļıʽΪUnicode(UTF - 16).",
+		/*category*/ -1,
+		/*state*/   _CMD_OS(__OS_WIN) | CT_RETRUN_ARY_TYPE_DATA,
+		/*ret*/ SDT_BIN,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*ArgCount*/1,
+		/*arg lp*/ s_ReadLinesArgs,
+	} ,ESTLFNAME(fn_CFile_ReadLines) };
+
 
 static ARG_INFO s_WriteLineArgs[] =
 {
@@ -1199,7 +1334,7 @@ FucInfo Fn_CFile_InsertStr = { {
 		/*arg lp*/ s_InsertStrArgs,
 	} ,ESTLFNAME(fn_CFile_InsertStr) };
 
-static INT s_dtCmdIndexcommobj_memfile_ex[] = { 318,319 ,320 ,321,322,323,324,326,327,328,329,330,331,332,333,334,335,336,337,338,339};
+static INT s_dtCmdIndexcommobj_memfile_ex[] = { 318,319 ,320 ,321,322,323,324,326,327,328,329,330,331,332,333,334,335,336,337,338,339,428};
 
 namespace elibstl {
 
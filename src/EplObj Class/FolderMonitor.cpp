@@ -1,415 +1,443 @@
-//#include"EcontrolHelp.h"
-//namespace elibstl {
-//	/*Ŀ¼*/
-//	class FolderMonitor {
-//		// ص¼
-//		using DirectoryChangeCallback = void(__stdcall*)(int eventType, const char* oldFileName, const char* newFileName);
-//		// ʾ÷
-//		static void DirectoryChangeEventHandler(int eventType, const char* oldFileName, const char* newFileName) {
-//			// ﴦص¼
-//			// eventType ʾ¼ (1: , 2: ɾ, 3: ޸, 4: )
-//			// oldFileName ԭļnewFileName ļ
-//		}
-//		static  DWORD CALLBACK
-//			Monitoring_Thread(LPVOID m_hDir) {
-//			for (size_t i = 0; i < 1024; i++)
-//			{
-//				if (m_hDir == INVALID_HANDLE_VALUE || m_hDir == NULL) {
-//					return 0;
-//				}
-//				ReadDirectoryChangesW(Ŀ¼, _Ϣ[i], 1024, , #FILE_NOTIFY_CHANGE_FILE_NAME  #FILE_NOTIFY_CHANGE_DIR_NAME  #FILE_NOTIFY_CHANGE_ATTRIBUTES  #FILE_NOTIFY_CHANGE_SIZE  #FILE_NOTIFY_CHANGE_LAST_WRITE  #FILE_NOTIFY_CHANGE_LAST_ACCESS  #FILE_NOTIFY_CHANGE_CREATION  #FILE_NOTIFY_CHANGE_SECURITY, 0, _ص, 0)
-//			}
-//		}
-//		HANDLE m_hDir{ INVALID_HANDLE_VALUE };
-//		std::string m_dir;
-//	public:
-//		FolderMonitor() = default;
-//		~FolderMonitor() = default;
-//		
-//		auto Over() {
-//		
-//		}
-//		auto StartMonitoring(std::string_view dir) {
-//			Over();//Ŀ¼
-//			if (dir.empty())
-//			{
-//				return false;
-//			}
-//			m_dir = dir;
-//			if (dir.back() != '\\') {
-//				m_dir += '\\';
-//			}
-//
-//			m_hDir = CreateFileA(m_dir.data(), GENERIC_READ| GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, NULL, OPEN_EXISTING, FILE_FLAG_BACKUP_SEMANTICS, NULL);
-//			if (m_hDir == INVALID_HANDLE_VALUE)
-//			{
-//				return false;
-//			}
-//			CloseHandle(CreateThread(0, 0, &Monitoring_Thread, m_hDir, 0, 0));
-//		}
-//	};
-//}
-//
-//static HBITMAP g_hbmp_FolderMonitor = NULL;
-//
-//static LRESULT CALLBACK WndProc(HWND hWnd, UINT uMsg, WPARAM wParam, LPARAM lParam)
-//{
-//
-//	switch (uMsg)
-//	{
-//#ifndef __E_STATIC_LIB
-//	case WM_PAINT:
-//	{
-//		PAINTSTRUCT ps;
-//		BeginPaint(hWnd, &ps);
-//		HDC hCDC = CreateCompatibleDC(ps.hdc);
-//		SelectObject(hCDC, g_hbmp_FolderMonitor);
-//		RECT rc;
-//		GetClientRect(hWnd, &rc);
-//		FillRect(ps.hdc, &rc, (HBRUSH)GetStockObject(WHITE_BRUSH));
-//		FrameRect(ps.hdc, &rc, (HBRUSH)GetStockObject(DKGRAY_BRUSH));
-//		BitBlt(ps.hdc, (rc.right - 24) / 2, (rc.bottom - 24) / 2, 24, 24, hCDC, 0, 0, SRCCOPY);
-//		DeleteDC(hCDC);
-//		EndPaint(hWnd, &ps);
-//		break;
-//	}
-//#endif
-//	}
-//
-//	return DefWindowProcW(hWnd, uMsg, wParam, lParam);
-//}
-//
-//////ļ
-////static void clinet_callback_con(const char* newFileName) {
-////
-////	EVENT_NOTIFY2 event(pClinet->m_dwWinFormID, pClinet->m_dwUnitID, 1);
-////	elibstl::NotifySys(NRS_EVENT_NOTIFY2, (DWORD) & event, 0);
-////}
-//////ݵ
-////static void clinet_callback_get_data(eClinet* pClinet) {
-////
-////	EVENT_NOTIFY2 event(pClinet->m_dwWinFormID, pClinet->m_dwUnitID, 0);
-////	elibstl::NotifySys(NRS_EVENT_NOTIFY2, (DWORD) & event, 0);
-////}
-//////Ͽ
-////static void clinet_callback_out(eClinet* pClinet) {
-////	pClinet->backoff();
-////	EVENT_NOTIFY2 event(pClinet->m_dwWinFormID, pClinet->m_dwUnitID, 2);
-////	elibstl::NotifySys(NRS_EVENT_NOTIFY2, (DWORD) & event, 0);
-////}
-//static HUNIT WINAPI CreateEplWindow(
-//	LPBYTE pAllPropertyData,            //   ָ򱾴ڵԪ, ɱڵԪITF_GET_PROPERTY_DATAӿڲ, ûΪNULL
-//	INT nAllPropertyDataSize,           //   ṩpAllPropertyDataָݵĳߴ, ûΪ0
-//	DWORD dwStyle,                      //   ԤõĴڷ
-//	HWND hParentWnd,                    //   ھ
-//	UINT uID,                           //   ڸеID
-//	HMENU hMenu,                        //   δʹ
-//	INT x, INT y, INT cx, INT cy,       //   ָλüߴ
-//	DWORD dwWinFormID, DWORD dwUnitID,  //   ڵԪڴڼID, ֪ͨϵͳ
-//	HWND hDesignWnd,                    //   blInDesignModeΪ, hDesignWndṩƴڵĴھ
-//	BOOL blInDesignMode                 //   ˵ǷIDEԽпӻ, ʱΪ
-//)
-//{
-//#define FOLDERMONITOR L"my_e_FolderMonitor"
-//	static INT s_FolderMonitor_cmd[] = { 46,47,48,49 };
-//
-//
-//	static ATOM g_atom_FolderMonitor = NULL;
-//	auto Clinet_RegWndClass = []()
-//		{
-//#ifndef __E_STATIC_LIB
-//			g_hbmp_FolderMonitor = (HBITMAP)LoadImageW(g_elibstl_hModule, MAKEINTRESOURCEW(IDB_CLINET_EX), IMAGE_BITMAP, 0, 0, 0);
-//#endif
-//			WNDCLASSW wc = { sizeof(WNDCLASSW) };
-//			wc.lpszClassName = FOLDERMONITOR;
-//			wc.hCursor = LoadCursorW(NULL, (PWSTR)IDC_ARROW);
-//			wc.lpfnWndProc = WndProc;
-//			wc.style = CS_HREDRAW | CS_VREDRAW;
-//			wc.cbWndExtra = sizeof(void*);
-//			g_atom_FolderMonitor = RegisterClassW(&wc);
-//		};
-//
-//
-//
-//
-//	if (!g_atom_FolderMonitor)
-//	{
-//		Clinet_RegWndClass();
-//	}
-//
-//	if (!blInDesignMode)
-//		dwStyle &= (~WS_VISIBLE);
-//	HWND hWnd = CreateWindowExW(
-//		0,
-//		FOLDERMONITOR,
-//		NULL,
-//		dwStyle | WS_CHILD | WS_CLIPSIBLINGS,
-//		x,
-//		y,
-//		cx,
-//		cy,
-//		hParentWnd,
-//		hMenu,
-//		NULL,
-//		NULL
-//	);
-//	if (!hWnd)
-//	{
-//		return NULL;
-//	}
-//
-//	//eClinet* pClinet = new eClinet;
-//	//pClinet->m_connect_cb = clinet_callback_con;
-//	//pClinet->m_backoff_cb = clinet_callback_out;
-//	//pClinet->m_data_get_cb = clinet_callback_get_data;
-//	/*SetWindowLongPtrW(hWnd, GWL_USERDATA, (LONG_PTR)pClinet);
-//	pClinet->m_dwUnitID = dwUnitID;
-//	pClinet->m_dwWinFormID = dwWinFormID;*/
-//	return elibstl::make_cwnd(hWnd);
-//}
-//static  BOOL WINAPI NotifyPropertyChanged(HUNIT hUnit, INT nPropertyIndex,
-//	PUNIT_PROPERTY_VALUE pValue, PSTR* ppszTipText)    //Ŀǰδʹ
-//{
-//	return FALSE;//´
-//}
-//static  HGLOBAL WINAPI GetAllPropertyData(HUNIT hUnit)
-//{
-//
-//	return nullptr;
-//}
-//static  BOOL WINAPI GetPropertyData(HUNIT hUnit, INT nPropertyIndex,
-//	PUNIT_PROPERTY_VALUE pValue)
-//{
-//	return FALSE;
-//}
-//extern "C" PFN_INTERFACE WINAPI libstl_GetInterface_FolderMonitor(INT nInterfaceNO)
-//{
-//
-//	return nInterfaceNO == ITF_CREATE_UNIT ? (PFN_INTERFACE)CreateEplWindow :
-//		nInterfaceNO == ITF_NOTIFY_PROPERTY_CHANGED ? (PFN_INTERFACE)NotifyPropertyChanged :
-//		nInterfaceNO == ITF_GET_ALL_PROPERTY_DATA ? (PFN_INTERFACE)GetAllPropertyData :
-//		nInterfaceNO == ITF_GET_PROPERTY_DATA ? (PFN_INTERFACE)GetPropertyData :
-//		NULL;
-//}
-//
-//
-//
-//
-//
-//
-//
-//
-//
-///*¼*/
-//static
-//EVENT_INFO2 s_event[] =
-//{
-//	/*000*/ {"ݵ", "˽ݷ͹󣬻¼ڱ¼Ĵӳеáȡݡȡرյݡ", _EVENT_OS(OS_ALL) | EV_IS_VER2, 0, 0, _SDT_NULL},
-//	/*001*/ {"ӳɹ", "ӷ˳ɹ󣬻¼", _EVENT_OS(OS_ALL) | EV_IS_VER2, 0, 0, _SDT_NULL},
-//	/*002*/ {"ӶϿ", "ӱ˶Ͽ󣬻¼", _EVENT_OS(OS_ALL) | EV_IS_VER2, 0, 0, _SDT_NULL},
-//};
-//
-///**/
-//static
-//UNIT_PROPERTY s_member[] =
-//{
-//	// FIXED_WIN_UNIT_PROPERTY,    // ϴ˺, ֱչ, չ
-//	//1=, 2=Ӣ, 3=Խ, 4=ԵUD_,5=Եı־, 6=˳¼еıѡıUW_(UD_FILE_NAME), һմ
-//
-//	/*000*/ {"", "left", NULL, UD_INT, _PROP_OS(OS_ALL), NULL},
-//	/*001*/ {"", "top", NULL, UD_INT, _PROP_OS(OS_ALL), NULL},
-//	/*002*/ {"", "width", NULL, UD_INT, _PROP_OS(OS_ALL), NULL},
-//	/*003*/ {"߶", "height", NULL, UD_INT, _PROP_OS(OS_ALL), NULL},
-//	/*004*/ {"", "tag", NULL, UD_TEXT, _PROP_OS(OS_ALL), NULL},
-//	/*005*/ {"", "visible", NULL, UD_BOOL, _PROP_OS(OS_ALL), NULL},
-//	/*006*/ {"ֹ", "disable", NULL, UD_BOOL, _PROP_OS(OS_ALL), NULL},
-//	/*007*/ {"ָ", "MousePointer", NULL, UD_CURSOR, _PROP_OS(OS_ALL), NULL},
-//};
-//
-//namespace elibstl {
-//	LIB_DATA_TYPE_INFO Obj_FolderMonitor = {
-//		/*m_szName*/			"Ŀ¼",
-//		/*m_szEgName*/			"FolderMonitor",
-//		/*m_szExplain*/			"ָĿ¼ԼĿ¼ļĴ޸ɾȲ.",
-//		/*m_nCmdCount*/			sizeof(s_cmd) / sizeof(s_cmd[0]),
-//		/*m_pnCmdsIndex*/		s_cmd,
-//		/*m_dwState*/			_DT_OS(__OS_WIN) | LDT_WIN_UNIT | LDT_IS_FUNCTION_PROVIDER ,
-//		/*m_dwUnitBmpID*/		IDB_CLINET_EX,
-//		/*m_nEventCount*/		3,
-//		/*m_pEventBegin*/		s_event,
-//		/*m_nPropertyCount*/	sizeof(s_member) / sizeof(s_member[0]),
-//		/*m_pPropertyBegin*/	s_member,
-//		/*m_pfnGetInterface*/	 libstl_GetInterface_FolderMonitor,
-//		/*m_nElementCount*/		0,
-//		/*m_pElementBegin*/		NULL,
-//	};
-//}
-//
-//
-//
-//
-//
-//
-////#pragma region clinetcmd
-////static ARG_INFO connectArgs[] =
-////{
-////	{
-////		/*name*/    "ipַ",
-////		/*explain*/ ("ipַ"),
-////		/*bmp inx*/ 0,
-////		/*bmp num*/ 0,
-////		/*type*/    SDT_TEXT,
-////		/*default*/ 0,
-////		/*state*/  ArgMark::AS_NONE,
-////	},
-////	{
-////		/*name*/    "˿ں",
-////		/*explain*/ ("Ӧ˿ں"),
-////		/*bmp inx*/ 0,
-////		/*bmp num*/ 0,
-////		/*type*/    SDT_SHORT,
-////		/*default*/ 0,
-////		/*state*/   ArgMark::AS_NONE,
-////	}
-////};
-////inline string get_ip_this_a() {
-////	WORD wVersionRequested = MAKEWORD(2, 2);
-////	WSADATA wsaData;
-////	if (WSAStartup(wVersionRequested, &wsaData) != 0)
-////		return "";
-////	char local[255] = { 0 };
-////	gethostname(local, sizeof(local));
-////	hostent* ph = gethostbyname(local);
-////	if (ph == NULL)
-////		return "";
-////	in_addr addr;
-////	memcpy(&addr, ph->h_addr_list[0], sizeof(in_addr));
-////	std::string localIP;
-////	localIP.assign(inet_ntoa(addr));
-////	WSACleanup();
-////	return localIP;
-////}
-////EXTERN_C void Fn_Clinet_connect(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
-////{
-////	HWND hWnd = elibstl::get_hwnd_from_arg(pArgInf);
-////	eClinet* pClinet = (eClinet*)GetWindowLongPtrW(hWnd, GWL_USERDATA);
-////	string ip = string(elibstl::args_to_sdata(pArgInf, 1));
-////	if (ip.empty())
-////	{
-////		return;
-////	}
-////
-////	pRetData->m_bool = pClinet->connect(ip, pArgInf[2].m_short);
-////}
-////
-////FucInfo Clinet_connect = { {
-////		/*ccname*/  (""),
-////		/*egname*/  ("connect"),
-////		/*explain*/ ("ӵָϵָ˿ڣϵĸö˿ڱѾĳһɹ棬ʧܷؼ١"),
-////		/*category*/-1,
-////		/*state*/   NULL,
-////		/*ret*/     SDT_BOOL,
-////		/*reserved*/NULL,
-////		/*level*/   LVL_HIGH,
-////		/*bmp inx*/ 0,
-////		/*bmp num*/ 0,
-////		/*ArgCount*/2,
-////		/*arg lp*/  connectArgs,
-////	} ,Fn_Clinet_connect ,"Fn_Clinet_connect" };
-////EXTERN_C void Fn_Clinet_close(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
-////{
-////	HWND hWnd = elibstl::get_hwnd_from_arg(pArgInf);
-////	eClinet* pClinet = (eClinet*)GetWindowLongPtrW(hWnd, GWL_USERDATA);
-////	pRetData->m_bool = pClinet->backoff();
-////}
-////
-////FucInfo Clinet_close = { {
-////		/*ccname*/  ("Ͽ"),
-////		/*egname*/  ("close"),
-////		/*explain*/ (" Ͽӡ"),
-////		/*category*/-1,
-////		/*state*/   NULL,
-////		/*ret*/     SDT_BOOL,
-////		/*reserved*/NULL,
-////		/*level*/   LVL_HIGH,
-////		/*bmp inx*/ 0,
-////		/*bmp num*/ 0,
-////		/*ArgCount*/0,
-////		/*arg lp*/  0,
-////	} ,Fn_Clinet_close ,"Fn_Clinet_close" };
-////
-////
-////
-////EXTERN_C void Fn_Clinet_GetData(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
-////{
-////	HWND hWnd = elibstl::get_hwnd_from_arg(pArgInf);
-////	eClinet* pClinet = (eClinet*)GetWindowLongPtrW(hWnd, GWL_USERDATA);
-////	size_t size = 0;
-////	auto tempdata = pClinet->get_data(&size);
-////	pRetData->m_pBin = elibstl::clone_bin(tempdata, size);
-////}
-////
-////FucInfo Clinet_GetData = { {
-////		/*ccname*/  ("ȡ"),
-////		/*egname*/  ("GetData"),
-////		/*explain*/ ("ȡյݡڡݵ¼Ĵӳʹá"),
-////		/*category*/-1,
-////		/*state*/   NULL,
-////		/*ret*/     SDT_BIN,
-////		/*reserved*/NULL,
-////		/*level*/   LVL_HIGH,
-////		/*bmp inx*/ 0,
-////		/*bmp num*/ 0,
-////		/*ArgCount*/0,
-////		/*arg lp*/  0,
-////	} ,Fn_Clinet_GetData ,"Fn_Clinet_GetData" };
-////
-////static ARG_INFO Args[] =
-////{
-////
-////	{
-////		/*name*/    "",
-////		/*explain*/ ("͵"),
-////		/*bmp inx*/ 0,
-////		/*bmp num*/ 0,
-////		/*type*/    SDT_BIN,
-////		/*default*/ 0,
-////		/*state*/  ArgMark::AS_NONE,
-////	},
-////	{
-////		/*name*/    "Ƿ񷵻",
-////		/*explain*/ ("Ƿ񷵻أĬΪ"),
-////		/*bmp inx*/ 0,
-////		/*bmp num*/ 0,
-////		/*type*/    SDT_BOOL,
-////		/*default*/ 0,
-////		/*state*/   ArgMark::AS_DEFAULT_VALUE_IS_EMPTY,
-////	}
-////};
-////
-////EXTERN_C void Fn_Clinet_Send(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
-////{
-////	HWND hWnd = elibstl::get_hwnd_from_arg(pArgInf);
-////	eClinet* pClinet = (eClinet*)GetWindowLongPtrW(hWnd, GWL_USERDATA);
-////	auto bnow = elibstl::args_to_data<BOOL>(pArgInf, 2);
-////
-////	pRetData->m_bool = pClinet->send(elibstl::arg_to_vdata(pArgInf[1].m_pBin), bnow.has_value() ? bnow.value() : FALSE);
-////}
-////
-////FucInfo  Clinet_Send = { {
-////		/*ccname*/  (""),
-////		/*egname*/  ("send"),
-////		/*explain*/ ("ָѾӽĿͻݡɹ棬ʧܷؼ١"),
-////		/*category*/-1,
-////		/*state*/   NULL,
-////		/*ret*/     SDT_BOOL,
-////		/*reserved*/NULL,
-////		/*level*/   LVL_HIGH,
-////		/*bmp inx*/ 0,
-////		/*bmp num*/ 0,
-////		/*ArgCount*/2,
-////		/*arg lp*/  Args,
-////	} ,Fn_Clinet_Send ,"Fn_Clinet_Send" };
-////
-////
-////#pragma endregion
+#include"ElibHelp.h"
+#include"Disk Processing/eplDirWatch.h"
+#include<atomic>
+
+namespace {
+	using elibstl::dirwatch::change;
+	using elibstl::dirwatch::event;
+	using elibstl::dirwatch::monitor;
+
+	/*¼,¼·,ǰ·;·ΪUnicodeıָ,ֻڻصڼЧ*/
+	typedef BOOL(__stdcall* MONITORPROC)(INT kind, const wchar_t* path, const wchar_t* old_path);
+
+	constexpr UINT WM_FOLDER_MONITOR = WM_APP + 0x4D;
+	constexpr PCWSTR kWndClass = L"eLibStl.FolderMonitor";
+
+	/*
+	* лصӳʱڵáʼ߳ϽһֻϢĴ,߳¼ͶϢ,
+	* ɴڹ߳ȡ¼ӳ,ӳֱӲ.
+	*/
+	class folder_monitor
+	{
+	public:
+		folder_monitor() = default;
+		folder_monitor(const folder_monitor&) = delete;
+		folder_monitor& operator=(const folder_monitor&) = delete;
+		~folder_monitor() { stop(); }
+
+		bool start(const std::wstring& dir, const elibstl::dirwatch::options& opt, MONITORPROC proc)
+		{
+			stop();
+			if (proc)
+			{
+				m_hwnd = create_window();
+				if (!m_hwnd)
+					return false;
+				m_proc = proc;
+				m_monitor.set_notify([this] {
+					/*һϢûʱظͶ,ڹ̻һȡ*/
+					if (!m_posted.exchange(true))
+						::PostMessageW(m_hwnd, WM_FOLDER_MONITOR, 0, 0);
+				});
+			}
+			else
+				m_monitor.set_notify(nullptr);
+			if (!m_monitor.start(dir, opt))
+			{
+				stop();
+				return false;
+			}
+			return true;
+		}
+
+		void stop()
+		{
+			/*ͣ߳,֮󲻻ϢͶݵ*/
+			m_monitor.stop();
+			if (m_hwnd)
+			{
+				::DestroyWindow(m_hwnd);
+				m_hwnd = NULL;
+			}
+			m_proc = nullptr;
+			m_posted = false;
+		}
+
+		monitor& get() { return m_monitor; }
+
+	private:
+		HWND create_window()
+		{
+			static ATOM s_atom = 0;
+			if (!s_atom)
+			{
+				WNDCLASSEXW wc = { sizeof(wc) };
+				wc.lpfnWndProc = wnd_proc;
+				wc.hInstance = ::GetModuleHandleW(NULL);
+				wc.lpszClassName = kWndClass;
+				s_atom = ::RegisterClassExW(&wc);
+				if (!s_atom && ::GetLastError() != ERROR_CLASS_ALREADY_EXISTS)
+					return NULL;
+			}
+			HWND hwnd = ::CreateWindowExW(0, kWndClass, NULL, 0, 0, 0, 0, 0, HWND_MESSAGE, NULL, ::GetModuleHandleW(NULL), NULL);
+			if (hwnd)
+				::SetWindowLongPtrW(hwnd, GWLP_USERDATA, reinterpret_cast<LONG_PTR>(this));
+			return hwnd;
+		}
+
+		void dispatch()
+		{
+			m_posted = false;
+			event e;
+			/*ӳпܵáֹͣ,ÿζ¼*/
+			while (m_proc && m_monitor.pop(e))
+				m_proc(static_cast<INT>(e.kind), e.path.c_str(), e.old_path.c_str());
+		}
+
+		static LRESULT CALLBACK wnd_proc(HWND hwnd, UINT msg, WPARAM wParam, LPARAM lParam)
+		{
+			if (msg == WM_FOLDER_MONITOR)
+			{
+				auto self = reinterpret_cast<folder_monitor*>(::GetWindowLongPtrW(hwnd, GWLP_USERDATA));
+				if (self && self->m_hwnd == hwnd)
+					self->dispatch();
+				return 0;
+			}
+			return ::DefWindowProcW(hwnd, msg, wParam, lParam);
+		}
+
+		monitor m_monitor;
+		HWND m_hwnd = NULL;
+		MONITORPROC m_proc = nullptr;
+		std::atomic<bool> m_posted{ false };
+	};
+}
+
+//
+EXTERN_C void fn_folder_monitor_structure(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto& self = elibstl::args_to_obj<folder_monitor>(pArgInf);
+	self = new folder_monitor;
+}
+FucInfo Fn_folder_monitor_structure = { {
+		/*ccname*/  "",
+		/*egname*/  "",
+		/*explain*/ NULL,
+		/*category*/ -1,
+		/*state*/  _CMD_OS(__OS_WIN) | CT_IS_HIDED | CT_IS_OBJ_CONSTURCT_CMD,
+		/*ret*/ _SDT_NULL,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*ArgCount*/0,
+		/*arg lp*/  NULL,
+	} ,ESTLFNAME(fn_folder_monitor_structure) };
+
+static ARG_INFO s_FolderMonitorCopyArgs[] =
+{
+	{
+		/*name*/    "",
+		/*explain*/ "",
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/	(DATA_TYPE)37,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_DEFAULT_VALUE_IS_EMPTY,
+	}
+};
+//
+EXTERN_C void fn_folder_monitor_copy(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto& self = elibstl::classhelp::get_this<folder_monitor>(pArgInf);
+	self = new folder_monitor;
+	put_errmsg(L"Ŀ¼к̨߳,ܸ,Ƶõδʼӵ¶!");
+}
+FucInfo Fn_folder_monitor_copy = { {
+		/*ccname*/  "",
+		/*egname*/  "",
+		/*explain*/ NULL,
+		/*category*/ -1,
+		/*state*/   _CMD_OS(__OS_WIN) | CT_IS_HIDED | CT_IS_OBJ_COPY_CMD,
+		/*ret*/ _SDT_NULL,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*ArgCount*/1,
+		/*arg lp*/  s_FolderMonitorCopyArgs,
+	} ,ESTLFNAME(fn_folder_monitor_copy) };
+
+//
+EXTERN_C void fn_folder_monitor_destruct(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto& self = elibstl::args_to_obj<folder_monitor>(pArgInf);
+	if (self)
+		delete self;
+	self = nullptr;
+}
+FucInfo Fn_folder_monitor_destruct = { {
+		/*ccname*/  "",
+		/*egname*/  "",
+		/*explain*/ NULL,
+		/*category*/ -1,
+		/*state*/    _CMD_OS(__OS_WIN) | CT_IS_HIDED | CT_IS_OBJ_FREE_CMD,
+		/*ret*/ _SDT_NULL,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*ArgCount*/0,
+		/*arg lp*/  NULL,
+	} ,ESTLFNAME(fn_folder_monitor_destruct) };
+
+static ARG_INFO Args_FolderMonitorStart[] =
+{
+	{
+		/*name*/    "Ŀ¼",
+		/*explain*/ "",
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_BIN,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_NONE,
+	},
+	{
+		/*name*/    "Ŀ¼",
+		/*explain*/ "ԱʡԡĬΪ",
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_BOOL,
+		/*default*/ TRUE,
+		/*state*/   ArgMark::AS_HAS_DEFAULT_VALUE,
+	},
+	{
+		/*name*/    "ϲ",
+		/*explain*/ "Աʡԡͬһ·һα仯ôû±仯ű,ڼĶα仯ϲΪһ¼,紴дֻ洴Ϊ0ʱȴĬΪ50",
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_INT,
+		/*default*/ 50,
+		/*state*/   ArgMark::AS_HAS_DEFAULT_VALUE,
+	},
+	{
+		/*name*/    "صӳ",
+		/*explain*/ "Աʡԡ¼ʱڵñ߳е,߳ϢѭӳͲ:¼͡·ǰ·,·Unicodeıָ,ֻӳЧ;ֵԡʡʱáȡ¼ȡ",
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    _SDT_ALL,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_DEFAULT_VALUE_IS_EMPTY,
+	}
+};
+EXTERN_C void fn_folder_monitor_start(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto& self = elibstl::args_to_obj<folder_monitor>(pArgInf);
+	elibstl::dirwatch::options opt;
+	opt.recursive = pArgInf[2].m_bool != FALSE;
+	const auto delay = elibstl::args_to_data<INT>(pArgInf, 3).value_or(50);
+	opt.debounce_ms = delay > 0 ? static_cast<unsigned>(delay) : 0;
+	MONITORPROC proc = nullptr;
+	if (pArgInf[4].m_dtDataType == SDT_SUB_PTR)
+		proc = (MONITORPROC)pArgInf[4].m_dwSubCodeAdr;
+	else if (pArgInf[4].m_dtDataType == SDT_INT)
+		proc = (MONITORPROC)pArgInf[4].m_int;
+	pRetData->m_bool = self->start(std::wstring(elibstl::args_to_wsdata(pArgInf, 1)), opt, proc);
+}
+FucInfo Fn_folder_monitor_start = { {
+		/*ccname*/  "ʼ",
+		/*egname*/  "start",
+		/*explain*/ "ֹͣһμ,ʼĿ¼ļĿ¼ı仯¼:1;2ɾ;3޸;4;5,б仯ûм,ӦɨĿ¼,·ΪӵĿ¼Ŀ¼ڻ޷ʱؼ١",
+		/*category*/ -1,
+		/*state*/    _CMD_OS(__OS_WIN) ,
+		/*ret*/ SDT_BOOL,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		ESTLARG(Args_FolderMonitorStart)
+	} ,ESTLFNAME(fn_folder_monitor_start) };
+
+static ARG_INFO Args_FolderMonitorPoll[] =
+{
+	{
+		/*name*/    "·",
+		/*explain*/ "ڽÿ¼Unicode·,Ա˳뷵ֵһ",
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_BIN,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_RECEIVE_VAR_ARRAY,
+	},
+	{
+		/*name*/    "ԭ·",
+		/*explain*/ "Աʡԡڽոǰ·,Ǹ¼ĳԱΪ",
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_BIN,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_RECEIVE_VAR_ARRAY | ArgMark::AS_DEFAULT_VALUE_IS_EMPTY,
+	},
+	{
+		/*name*/    "",
+		/*explain*/ "Աʡԡȡ¼,ĬΪ1000",
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_INT,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_DEFAULT_VALUE_IS_EMPTY,
+	}
+};
+EXTERN_C void fn_folder_monitor_poll(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto& self = elibstl::args_to_obj<folder_monitor>(pArgInf);
+	const auto max_count = elibstl::args_to_data<INT>(pArgInf, 3).value_or(1000);
+	std::vector<event> events;
+	self->get().poll(events, max_count > 0 ? static_cast<size_t>(max_count) : 1000);
+	std::vector<INT> kinds;
+	std::vector<std::wstring> paths, old_paths;
+	kinds.reserve(events.size());
+	paths.reserve(events.size());
+	old_paths.reserve(events.size());
+	for (auto& e : events)
+	{
+		kinds.push_back(static_cast<INT>(e.kind));
+		paths.push_back(std::move(e.path));
+		old_paths.push_back(std::move(e.old_path));
+	}
+	elibstl::free_text_array_var(pArgInf[1].m_ppAryData);
+	*pArgInf[1].m_ppAryData = elibstl::create_text_array(paths);
+	if (pArgInf[2].m_dtDataType != _SDT_NULL)
+	{
+		elibstl::free_text_array_var(pArgInf[2].m_ppAryData);
+		*pArgInf[2].m_ppAryData = elibstl::create_text_array(old_paths);
+	}
+	pRetData->m_pAryData = elibstl::create_array<INT>(kinds);
+}
+FucInfo Fn_folder_monitor_poll = { {
+		/*ccname*/  "ȡ¼",
+		/*egname*/  "poll",
+		/*explain*/ "ȡѷ¼,¼,·ڲСû¼ʱؿ,ȴҪڻصӳȡ¼ʱá",
+		/*category*/ -1,
+		/*state*/    _CMD_OS(__OS_WIN) | CT_RETRUN_ARY_TYPE_DATA,
+		/*ret*/ SDT_INT,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		ESTLARG(Args_FolderMonitorPoll)
+	} ,ESTLFNAME(fn_folder_monitor_poll) };
+
+static ARG_INFO Args_FolderMonitorWait[] =
+{
+	{
+		/*name*/    "ȴʱ",
+		/*explain*/ "Աʡԡȴĺ,-1Ϊһֱȵ¼ӽĬΪ-1",
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_INT,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_DEFAULT_VALUE_IS_EMPTY,
+	}
+};
+EXTERN_C void fn_folder_monitor_wait(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto& self = elibstl::args_to_obj<folder_monitor>(pArgInf);
+	pRetData->m_bool = self->get().wait(elibstl::args_to_data<INT>(pArgInf, 1).value_or(-1));
+}
+FucInfo Fn_folder_monitor_wait = { {
+		/*ccname*/  "ȴ",
+		/*egname*/  "wait",
+		/*explain*/ "ȴ¼ȡӽʱ,¼ȡʱ档ȴڼ䲻Ϣ,߳Ӧʹûصӳ",
+		/*category*/ -1,
+		/*state*/    _CMD_OS(__OS_WIN) ,
+		/*ret*/ SDT_BOOL,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		ESTLARG(Args_FolderMonitorWait)
+	} ,ESTLFNAME(fn_folder_monitor_wait) };
+
+EXTERN_C void fn_folder_monitor_stop(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto& self = elibstl::args_to_obj<folder_monitor>(pArgInf);
+	self->stop();
+}
+FucInfo Fn_folder_monitor_stop = { {
+		/*ccname*/  "ֹͣ",
+		/*egname*/  "stop",
+		/*explain*/ "ֹͣӲδȡ¼,ȴ߳˳󷵻ء",
+		/*category*/ -1,
+		/*state*/    _CMD_OS(__OS_WIN) ,
+		/*ret*/ _SDT_NULL,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*ArgCount*/0,
+		/*arg lp*/  0,
+	} ,ESTLFNAME(fn_folder_monitor_stop) };
+
+EXTERN_C void fn_folder_monitor_running(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto& self = elibstl::args_to_obj<folder_monitor>(pArgInf);
+	pRetData->m_bool = self->get().running();
+}
+FucInfo Fn_folder_monitor_running = { {
+		/*ccname*/  "Ƿڼ",
+		/*egname*/  "running",
+		/*explain*/ "ӵĿ¼ɾʱӻн,ʱؼ,һ¼Ϊ",
+		/*category*/ -1,
+		/*state*/    _CMD_OS(__OS_WIN) ,
+		/*ret*/ SDT_BOOL,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*ArgCount*/0,
+		/*arg lp*/  0,
+	} ,ESTLFNAME(fn_folder_monitor_running) };
+
+EXTERN_C void fn_folder_monitor_overflows(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto& self = elibstl::args_to_obj<folder_monitor>(pArgInf);
+	pRetData->m_int64 = static_cast<INT64>(self->get().overflows());
+}
+FucInfo Fn_folder_monitor_overflows = { {
+		/*ccname*/  "ȡ",
+		/*egname*/  "overflows",
+		/*explain*/ "رμбĴ϶˵仯̫Ƶȡ¼̫,ԼӴϲ",
+		/*category*/ -1,
+		/*state*/    _CMD_OS(__OS_WIN) ,
+		/*ret*/ SDT_INT64,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*ArgCount*/0,
+		/*arg lp*/  0,
+	} ,ESTLFNAME(fn_folder_monitor_overflows) };
+
+static INT s_dtCmdIndexcommobj_folder_monitor[] = { 488,489,490,491,492,493,494,495,496 };
+namespace elibstl {
+
+
+	LIB_DATA_TYPE_INFO Obj_FolderMonitor =
+	{
+		"Ŀ¼",
+		"FolderMonitor",
+		"Ŀ¼ļĿ¼Ĵɾ޸ĺ͸,ʱڵ仯ϲΪһ¼",
+		sizeof(s_dtCmdIndexcommobj_folder_monitor) / sizeof(s_dtCmdIndexcommobj_folder_monitor[0]),
+		 s_dtCmdIndexcommobj_folder_monitor,
+		_DT_OS(__OS_WIN),
+		0,
+		NULL,
+		NULL,
+		NULL,
+		NULL,
+		NULL,
+		0,
+		0
+	};
+}
@@ -1,5 +1,7 @@
 #include<string>
 #include <vector>
+#include <memory>
+#include <algorithm>
 #include <cstring>
 #include <cstdlib>
 
@@ -20,24 +22,62 @@ enum class file_off_set
 };
 
 
-
+/*
+* ݰҳ,ÿҳkPageSizeֽ.д롢롢ı䳤ֻӰ漰ļҳ,·ƶȫ.
+* ڴʱ,޺δõҳдʱļ,õʱٶ.
+*/
 class  EMemFile
 {
+public:
+	static constexpr size_t kPageSize = 64 * 1024;
+
 private:
-	std::vector<unsigned char> m_pData; // ļ
+	struct page
+	{
+		std::unique_ptr<unsigned char[]> data; // ҳ,ѻʱļʱΪ
+		size_t size = 0; // ҳЧ
+		long long slot = -1; // ʱļеλ(ҳΪλ),δΪ-1
+		unsigned long long tick = 0; // ʹõʱ,ʱȻС
+	};
+
+	std::vector<page> m_pages;
 	size_t m_offset; // ǰдλ
 	size_t m_filesize; // ļ
-	// ı仺
-	void change_pbuffer_size(size_t newlenth);
+	// ϴζλҳʼƫ,˳дʱشͷ
+	size_t m_hint_page;
+	size_t m_hint_start;
+
+	size_t m_memory_limit; // ڴ,0Ϊ
+	size_t m_resident; // ڴеҳ
+	unsigned long long m_tick;
+	HANDLE m_spill; // ʱļ,һλʱ
+	long long m_spill_slots; // ʱļʹõҳ
+	std::vector<long long> m_free_slots; // ʱļпõλ
+
+	// offsetڵҳ,ҳźҳƫ;offsetļʱһҳĩβ
+	void locate(size_t offset, size_t& index, size_t& in_page);
+	// ȡҳ,ѻȶ
+	unsigned char* page_data(size_t index);
+	// indexһҳ
+	unsigned char* insert_page(size_t index);
+	void remove_pages(size_t first, size_t last);
+	void release_page(page& pg);
+	// 롢ɾҳ֮ҳʼƫƶ
+	void reset_hint();
+	void spill_if_needed();
+	bool spill_page(page& pg);
+	bool load_page(page& pg) const;
 
 public:
-	// ʼڴļָ vector ĳʼ
-	EMemFile(size_t grow_bytes = 1024);
+	EMemFile();
+	EMemFile(const EMemFile& other);
+	EMemFile& operator=(const EMemFile&) = delete;
 
 	~EMemFile();
 	//
 	void close();
-	void read(size_t conut, std::vector<unsigned char>& ret);
+	// ӵǰλöȡ,ʵʶȡֽ
+	size_t read(unsigned char* buffer, size_t size);
 
 	//д
 
@@ -45,7 +85,7 @@ public:
 
 
 	//
-	bool insert(std::vector<unsigned char> data);
+	bool insert(const unsigned char* data, size_t size);
 
 	// ƶдλ
 	bool seek(long offset, file_off_set origin = file_off_set::current);
@@ -64,6 +104,9 @@ public:
 	// ȡǰдλ
 	size_t get_off_set() const;
 
+	// ڴ,ֻʱļ,0Ϊ
+	void set_memory_limit(size_t bytes);
+
 
 };
 
@@ -71,55 +114,226 @@ public:
 
 
 
-EMemFile::EMemFile(size_t grow_bytes) : m_pData(grow_bytes), m_offset(0), m_filesize(0) {}
-void EMemFile::change_pbuffer_size(size_t new_lenth)
+EMemFile::EMemFile() : m_offset(0), m_filesize(0), m_hint_page(0), m_hint_start(0),
+m_memory_limit(0), m_resident(0), m_tick(0), m_spill(INVALID_HANDLE_VALUE), m_spill_slots(0) {}
+
+EMemFile::EMemFile(const EMemFile& other) : EMemFile()
 {
-	if (new_lenth > m_pData.size())
+	m_memory_limit = other.m_memory_limit;
+	m_pages.reserve(other.m_pages.size());
+	for (const page& src : other.m_pages)
 	{
-		m_pData.resize(new_lenth);
+		unsigned char* data = insert_page(m_pages.size());
+		page& dst = m_pages.back();
+		if (src.data)
+			memcpy(data, src.data.get(), src.size);
+		else
+		{
+			/*ԷҳֱӴʱļҳ*/
+			page tmp;
+			tmp.size = src.size;
+			tmp.slot = src.slot;
+			tmp.data.reset(data);
+			if (!other.load_page(tmp))
+				memset(data, 0, src.size);
+			tmp.data.release();
+		}
+		dst.size = src.size;
+		spill_if_needed();
 	}
+	m_filesize = other.m_filesize;
+	m_offset = other.m_offset;
 }
-// ʼڴļָ vector ĳʼ
 
 EMemFile::~EMemFile() { close(); }
 //
 void EMemFile::close()
 {
-
-	m_pData.resize(0);
+	m_pages.clear();
+	m_pages.shrink_to_fit();
+	m_free_slots.clear();
+	if (m_spill != INVALID_HANDLE_VALUE)
+		CloseHandle(m_spill);
+	m_spill = INVALID_HANDLE_VALUE;
+	m_spill_slots = 0;
+	m_resident = 0;
 	m_offset = 0;
 	m_filesize = 0;
+	reset_hint();
+}
 
+void EMemFile::reset_hint()
+{
+	m_hint_page = 0;
+	m_hint_start = 0;
 }
-// ȡ
-void EMemFile::read(size_t wanna_lenth, std::vector<unsigned char>& ret_data)
+
+void EMemFile::locate(size_t offset, size_t& index, size_t& in_page)
 {
-	ret_data.clear();
-	// 볤Ϊ0򷵻һյ vector
-	if (wanna_lenth == 0)
+	size_t i = m_hint_page, start = m_hint_start;
+	if (i >= m_pages.size() || offset < start)
 	{
-		return;
+		i = 0;
+		start = 0;
 	}
-	// ǰλѾļȣ򷵻һյ vector
-	if (m_offset > m_filesize)
+	/*ͣڰoffsetҳ;offsetҳβʱ,һҳȡһҳĿͷ*/
+	while (i + 1 < m_pages.size() && offset >= start + m_pages[i].size)
 	{
-		return;
+		start += m_pages[i].size;
+		i++;
 	}
+	m_hint_page = i;
+	m_hint_start = start;
+	index = i;
+	in_page = offset - start;
+}
 
-	// ʵʶֽ
-	size_t real_size;
-	if (m_offset + wanna_lenth > m_filesize)
+unsigned char* EMemFile::page_data(size_t index)
+{
+	page& pg = m_pages[index];
+	pg.tick = ++m_tick;
+	if (!pg.data)
+	{
+		pg.data.reset(new unsigned char[kPageSize]);
+		if (!load_page(pg))
+			memset(pg.data.get(), 0, pg.size);
+		m_free_slots.push_back(pg.slot);
+		pg.slot = -1;
+		m_resident++;
+		spill_if_needed();
+	}
+	return pg.data.get();
+}
+
+unsigned char* EMemFile::insert_page(size_t index)
+{
+	page pg;
+	pg.data.reset(new unsigned char[kPageSize]);
+	pg.tick = ++m_tick;
+	unsigned char* data = pg.data.get();
+	m_pages.insert(m_pages.begin() + index, std::move(pg));
+	m_resident++;
+	return data;
+}
+
+void EMemFile::release_page(page& pg)
+{
+	if (pg.data)
+		m_resident--;
+	else if (pg.slot >= 0)
+		m_free_slots.push_back(pg.slot);
+	pg.data.reset();
+	pg.slot = -1;
+}
+
+void EMemFile::remove_pages(size_t first, size_t last)
+{
+	for (size_t i = first; i < last; i++)
+		release_page(m_pages[i]);
+	m_pages.erase(m_pages.begin() + first, m_pages.begin() + last);
+}
+
+bool EMemFile::load_page(page& pg) const
+{
+	OVERLAPPED ov{};
+	const unsigned long long pos = static_cast<unsigned long long>(pg.slot) * kPageSize;
+	ov.Offset = static_cast<DWORD>(pos);
+	ov.OffsetHigh = static_cast<DWORD>(pos >> 32);
+	DWORD read = 0;
+	return m_spill != INVALID_HANDLE_VALUE && ReadFile(m_spill, pg.data.get(), static_cast<DWORD>(pg.size), &read, &ov) && read == pg.size;
+}
+
+bool EMemFile::spill_page(page& pg)
+{
+	if (m_spill == INVALID_HANDLE_VALUE)
 	{
-		real_size = m_filesize - m_offset;
+		wchar_t dir[MAX_PATH], file[MAX_PATH];
+		if (!GetTempPathW(MAX_PATH, dir) || !GetTempFileNameW(dir, L"emf", 0, file))
+			return false;
+		/*رվʱϵͳԶɾ,쳣˳Ҳ*/
+		m_spill = CreateFileW(file, GENERIC_READ | GENERIC_WRITE, 0, NULL, CREATE_ALWAYS,
+			FILE_ATTRIBUTE_TEMPORARY | FILE_FLAG_DELETE_ON_CLOSE, NULL);
+		if (m_spill == INVALID_HANDLE_VALUE)
+		{
+			DeleteFileW(file);
+			return false;
+		}
 	}
+	long long slot;
+	if (m_free_slots.empty())
+		slot = m_spill_slots++;
 	else
 	{
-		real_size = wanna_lenth;
+		slot = m_free_slots.back();
+		m_free_slots.pop_back();
+	}
+	OVERLAPPED ov{};
+	const unsigned long long pos = static_cast<unsigned long long>(slot) * kPageSize;
+	ov.Offset = static_cast<DWORD>(pos);
+	ov.OffsetHigh = static_cast<DWORD>(pos >> 32);
+	DWORD written = 0;
+	if (!WriteFile(m_spill, pg.data.get(), static_cast<DWORD>(pg.size), &written, &ov) || written != pg.size)
+	{
+		m_free_slots.push_back(slot);
+		return false;
+	}
+	pg.data.reset();
+	pg.slot = slot;
+	m_resident--;
+	return true;
+}
+
+void EMemFile::spill_if_needed()
+{
+	if (m_memory_limit == 0)
+		return;
+	/*ٱ4ҳ,һβͬʱõҳ,ùҳᱻ*/
+	const size_t limit = (std::max)(m_memory_limit / kPageSize, static_cast<size_t>(4));
+	if (m_resident <= limit)
+		return;
+	/*һζ໻һЩ,ÿ½ҳҪɨȫҳ*/
+	const size_t target = limit - limit / 8;
+	std::vector<std::pair<unsigned long long, size_t>> resident;
+	resident.reserve(m_resident);
+	for (size_t i = 0; i < m_pages.size(); i++)
+	{
+		if (m_pages[i].data)
+			resident.emplace_back(m_pages[i].tick, i);
+	}
+	const size_t count = resident.size() - target;
+	std::nth_element(resident.begin(), resident.begin() + count, resident.end());
+	for (size_t i = 0; i < count; i++)
+	{
+		/*ʱļдʧܾͼڴ*/
+		if (!spill_page(m_pages[resident[i].second]))
+			break;
 	}
-	// ȡҪݣǰλƶλõĺ
-	debug_put(L"", wanna_lenth);
-	ret_data.insert(ret_data.end(), m_pData.begin() + m_offset, m_pData.begin() + m_offset + real_size);
-	m_offset += real_size;
+}
+
+size_t EMemFile::read(unsigned char* buffer, size_t size)
+{
+	// ǰλѾļȣʲôҲ
+	if (size == 0 || m_offset >= m_filesize)
+	{
+		return 0;
+	}
+	// ʵʶֽ
+	size = (std::min)(size, m_filesize - m_offset);
+	size_t index, in_page;
+	locate(m_offset, index, in_page);
+	size_t done = 0;
+	while (done < size)
+	{
+		const size_t n = (std::min)(size - done, m_pages[index].size - in_page);
+		memcpy(buffer + done, page_data(index) + in_page, n);
+		done += n;
+		m_offset += n;
+		if (done < size)
+		{
+			locate(m_offset, index, in_page);
+		}
+	}
+	return done;
 }
 
 void EMemFile::write(const unsigned char* data, const size_t size)
@@ -130,77 +344,140 @@ void EMemFile::write(const unsigned char* data, const size_t size)
 	{
 		return;
 	}
-	// ĳȲı仺ĳ
-	if (m_offset + size > m_pData.size())
+	size_t done = 0;
+	// ȸе
+	if (m_offset < m_filesize)
 	{
-		change_pbuffer_size(m_offset + size);
+		size_t index, in_page;
+		locate(m_offset, index, in_page);
+		while (done < size && m_offset < m_filesize)
+		{
+			const size_t n = (std::min)(size - done, m_pages[index].size - in_page);
+			memcpy(page_data(index) + in_page, data + done, n);
+			done += n;
+			m_offset += n;
+			index++;
+			in_page = 0;
+		}
 	}
-
-	//  data 
-	std::copy(data, data + size, m_pData.begin() + m_offset);
-	m_offset += size;
-
-	// ļС
-	if (m_offset > m_filesize)
+	// ʣµ׷ӵļĩβ,һҳ
+	while (done < size)
 	{
-		m_filesize = m_offset;
+		if (m_pages.empty() || m_pages.back().size == kPageSize)
+		{
+			insert_page(m_pages.size());
+		}
+		page& last = m_pages.back();
+		const size_t n = (std::min)(size - done, kPageSize - last.size);
+		memcpy(page_data(m_pages.size() - 1) + last.size, data + done, n);
+		last.size += n;
+		done += n;
+		m_offset += n;
+		m_filesize += n;
+		spill_if_needed();
 	}
 }
 
 
 //
-bool EMemFile::insert(std::vector<unsigned char> data)
+bool EMemFile::insert(const unsigned char* data, size_t size)
 {
 	// ҪΪգ򷵻 false
-	if (data.empty())
+	if (!data || size == 0)
 	{
 		return false;
 	}
-
-	// ڵǰλò
-	m_pData.insert(m_pData.begin() + m_offset, data.begin(), data.end());
-	// ǰλƶλ
-	m_offset += data.size();
-	// ļС
-	if (m_offset > m_filesize)
+	if (m_offset >= m_filesize)
 	{
-		m_filesize = m_offset;
+		write(data, size);
+		return true;
 	}
-
+	size_t index, in_page;
+	locate(m_offset, index, in_page);
+	page* pg = &m_pages[index];
+	if (pg->size + size <= kPageSize)
+	{
+		// ҳŵ,ֻƶҳ
+		unsigned char* p = page_data(index);
+		memmove(p + in_page + size, p + in_page, pg->size - in_page);
+		memcpy(p + in_page, data, size);
+		pg->size += size;
+	}
+	else
+	{
+		// ڲҳ,벿Ƶҳ,ݷ֮ҳ
+		size_t next = index + 1;
+		if (in_page < pg->size)
+		{
+			const unsigned char* src = page_data(index) + in_page;
+			unsigned char* tail = insert_page(next);
+			pg = &m_pages[index];
+			memcpy(tail, src, pg->size - in_page);
+			m_pages[next].size = pg->size - in_page;
+			pg->size = in_page;
+		}
+		size_t done = 0;
+		// ҳʣĿռ
+		if (pg->size < kPageSize)
+		{
+			const size_t n = (std::min)(size, kPageSize - pg->size);
+			memcpy(page_data(index) + pg->size, data, n);
+			pg->size += n;
+			done = n;
+		}
+		while (done < size)
+		{
+			const size_t n = (std::min)(size - done, kPageSize);
+			memcpy(insert_page(next), data + done, n);
+			m_pages[next].size = n;
+			done += n;
+			next++;
+			spill_if_needed();
+		}
+		// һĺ벿ַŵýһҳͺϲ
+		if (next < m_pages.size() && next > index + 1 && m_pages[next - 1].size + m_pages[next].size <= kPageSize)
+		{
+			memcpy(page_data(next - 1) + m_pages[next - 1].size, page_data(next), m_pages[next].size);
+			m_pages[next - 1].size += m_pages[next].size;
+			remove_pages(next, next + 1);
+		}
+		reset_hint();
+		spill_if_needed();
+	}
+	// ǰλƶλ
+	m_offset += size;
+	m_filesize += size;
 	return true;
 }
 
 // ƶдλ
 bool EMemFile::seek(long offset, file_off_set origin)
 {
-	bool success = false;
-	size_t new_off_set;
+	long long new_off_set;
 	switch (origin)
 	{
 	case file_off_set::begin:
 		new_off_set = offset;
 		break;
 	case file_off_set::current:
-		new_off_set = m_offset + offset;
+		new_off_set = static_cast<long long>(m_offset) + offset;
 		break;
 	case file_off_set::end:
-		new_off_set = m_filesize + offset;
+		new_off_set = static_cast<long long>(m_filesize) + offset;
 		break;
 	default:
-		return success;
+		return false;
 	}
-	if (new_off_set > m_filesize)
+	if (new_off_set < 0)
 	{
-
-		new_off_set = m_filesize;
+		new_off_set = 0;
 	}
-	else if (new_off_set < 0)
+	else if (static_cast<size_t>(new_off_set) > m_filesize)
 	{
-		new_off_set = 0;
+		new_off_set = m_filesize;
 	}
-	m_offset = new_off_set;
-	success = true;
-	return success;
+	m_offset = static_cast<size_t>(new_off_set);
+	return true;
 }
 
 // ƶļͷ
@@ -218,11 +495,42 @@ void EMemFile::seek_end()
 // ļ
 void EMemFile::set_file_size(size_t new_lenth)
 {
-	if (new_lenth > m_pData.size())
-	{//ݻ
-		m_pData.resize(new_lenth);
+	if (new_lenth < m_filesize)
+	{
+		// ض:ȥҳ,һҳֻĳ
+		size_t index, in_page;
+		locate(new_lenth, index, in_page);
+		if (in_page == 0 && index > 0)
+		{
+			index--;
+			in_page = m_pages[index].size;
+		}
+		m_pages[index].size = in_page;
+		remove_pages(index + 1, m_pages.size());
+		if (new_lenth == 0)
+		{
+			remove_pages(0, m_pages.size());
+		}
+		reset_hint();
+		m_filesize = new_lenth;
+	}
+	else
+	{
+		// չĲ0
+		while (m_filesize < new_lenth)
+		{
+			if (m_pages.empty() || m_pages.back().size == kPageSize)
+			{
+				insert_page(m_pages.size());
+			}
+			page& last = m_pages.back();
+			const size_t n = (std::min)(new_lenth - m_filesize, kPageSize - last.size);
+			memset(page_data(m_pages.size() - 1) + last.size, 0, n);
+			last.size += n;
+			m_filesize += n;
+			spill_if_needed();
+		}
 	}
-	m_filesize = new_lenth;
 	if (m_offset > m_filesize)
 	{
 		m_offset = m_filesize;
@@ -241,6 +549,12 @@ size_t EMemFile::get_off_set() const
 	return m_offset;
 }
 
+void EMemFile::set_memory_limit(size_t bytes)
+{
+	m_memory_limit = bytes;
+	spill_if_needed();
+}
+
 
 
 
@@ -607,9 +921,17 @@ static ARG_INFO args_read[] =
 EXTERN_C void elibstl_memfile_read(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
 {
 	auto& pMemFile = elibstl::args_to_obj<EMemFile>(pArgInf);
-	std::vector<unsigned char> pData;
-	pMemFile->read(pArgInf[1].m_int, pData);
-	pRetData->m_pBin = elibstl::clone_bin(pData.data(), pData.size());
+	if (pArgInf[1].m_int <= 0 || pMemFile->get_off_set() >= pMemFile->get_size())
+	{
+		return;
+	}
+	// ֱӶصֽڼ,м仺
+	const size_t size = (std::min)(static_cast<size_t>(pArgInf[1].m_int), pMemFile->get_size() - pMemFile->get_off_set());
+	LPBYTE pd = static_cast<LPBYTE>(elibstl::ealloc(static_cast<int>(sizeof(INT) * 2 + size)));
+	*reinterpret_cast<INT*>(pd) = 1;
+	*reinterpret_cast<INT*>(pd + sizeof(INT)) = static_cast<INT>(size);
+	pMemFile->read(pd + sizeof(INT) * 2, size);
+	pRetData->m_pBin = pd;
 }
 
 FucInfo Fn_memfile_read = { {
@@ -695,7 +1017,40 @@ FucInfo Fn_memfile_get_off_set = { {
 		/*ArgCount*/0,
 		/*arg lp*/  0,
 	} ,ESTLFNAME(elibstl_memfile_get_off_set) };
-static INT s_dtCmdIndexcommobj_memfile_ex[] = { 226,227,228,229 ,230,231,232 ,233 ,234 ,235 ,236 };
+static ARG_INFO args_memory_limit[] =
+{
+		{
+		/*name*/	"ڴ",
+		/*explain*/	"λΪֽڡݳ˳ȺδʵĲֻݴ浽ʱļʱԶأΪ0ʾơ",
+		/*bmp inx*/	0,
+		/*bmp num*/	0,
+		/*type*/	SDT_INT64,
+		/*default*/	0,
+		/*state*/	ArgMark::AS_NONE,
+			}
+};
+EXTERN_C void elibstl_memfile_set_memory_limit(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto& pMemFile = elibstl::args_to_obj<EMemFile>(pArgInf);
+	const INT64 limit = pArgInf[1].m_int64;
+	pMemFile->set_memory_limit(limit > 0 ? static_cast<size_t>((std::min)(static_cast<unsigned long long>(limit), static_cast<unsigned long long>(SIZE_MAX))) : 0);
+}
+
+FucInfo Fn_memfile_set_memory_limit = { {
+		/*ccname*/  "ڴ",
+		/*egname*/ NULL,
+		/*explain*/  "ڴļռõڴ棬ʺɺܴڴļʱļڴļرջʱԶɾ",
+		/*category*/ -1,
+		/*state*/     _CMD_OS(__OS_WIN) ,
+		/*ret*/_SDT_NULL,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*ArgCount*/ARRAYSIZE(args_memory_limit),
+		/*arg lp*/  args_memory_limit,
+	} ,ESTLFNAME(elibstl_memfile_set_memory_limit) };
+static INT s_dtCmdIndexcommobj_memfile_ex[] = { 226,227,228,229 ,230,231,232 ,233 ,234 ,235 ,236 ,427 };
 namespace elibstl {
 
 
@@ -4,7 +4,7 @@
 
 
 #define SKINSHARP L"my_e_sever_ex"
-static INT s_server_cmd[] = { 39 , 40 , 41 , 42 , 43 , 44 ,45 };
+static INT s_server_cmd[] = { 39 , 40 , 41 , 42 , 43 , 44 ,45 ,505 ,507 ,508 };
 
 static HBITMAP g_hbmp_epl_skinsharp = NULL;
 
@@ -471,5 +471,157 @@ FucInfo Server_Send = { {
 		/*arg lp*/  Args2,
 	} ,Fn_Server_Send ,"Fn_Server_Send" };
 
+static ARG_INFO Args_SendBatch[] =
+{
+	{
+		/*name*/    "ͻSOCKET",
+		/*explain*/ ("ͨȡؿͻȡSOKET"),
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_INT,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_NONE,
+	},
+	{
+		/*name*/    "",
+		/*explain*/ ("͵ֽڼ,ÿԱΪһη͵"),
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_BIN,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_RECEIVE_ARRAY_DATA,
+	}
+};
+
+EXTERN_C void Fn_Server_SendBatch(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	HWND hWnd = elibstl::get_hwnd_from_arg(pArgInf);
+	eServer* pServer = (eServer*)GetWindowLongPtrW(hWnd, GWL_USERDATA);
+	size_t count = 0;
+	LPBYTE* pAryData = elibstl::get_array_element_inf<LPBYTE*>(pArgInf[2].m_pAryData, &count);
+	std::vector<std::pair<const void*, size_t>> datas(count);
+	for (size_t i = 0; i < count; i++)
+	{
+		if (pAryData[i])
+		{
+			datas[i].first = pAryData[i] + sizeof(INT) * 2;
+			datas[i].second = *reinterpret_cast<INT*>(pAryData[i] + sizeof(INT));
+		}
+	}
+	pRetData->m_bool = pServer->send_batch(pArgInf[1].m_int, datas);
+}
+
+FucInfo Server_SendBatch = { {
+		/*ccname*/  (""),
+		/*egname*/  ("SendBatch"),
+		/*explain*/ ("ָѾӽĿͻηеÿԱ,ԷԱֱյݺϲύ,áݡСɹ棬ʧܷؼ١"),
+		/*category*/-1,
+		/*state*/   NULL,
+		/*ret*/     SDT_BOOL,
+		/*reserved*/NULL,
+		/*level*/   LVL_HIGH,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*ArgCount*/2,
+		/*arg lp*/  Args_SendBatch,
+	} ,Fn_Server_SendBatch ,"Fn_Server_SendBatch" };
+
+static ARG_INFO Args_SetSendLimits[] =
+{
+	{
+		/*name*/    "ˮλ",
+		/*explain*/ ("Ͷδֽﵽֵ,ݷؼҲݡΪ0ʱ"),
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_INT,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_NONE,
+	},
+	{
+		/*name*/    "ˮλ",
+		/*explain*/ ("ﵽˮλ,нֵ²½ݡڸˮλʱˮλ"),
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_INT,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_NONE,
+	}
+};
+
+EXTERN_C void Fn_Server_SetSendLimits(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	HWND hWnd = elibstl::get_hwnd_from_arg(pArgInf);
+	eServer* pServer = (eServer*)GetWindowLongPtrW(hWnd, GWL_USERDATA);
+	pRetData->m_bool = pServer->set_send_limits(pArgInf[1].m_int < 0 ? 0 : pArgInf[1].m_int, pArgInf[2].m_int < 0 ? 0 : pArgInf[2].m_int);
+}
+
+FucInfo Server_SetSendLimits = { {
+		/*ccname*/  ("÷ˮλ"),
+		/*egname*/  ("SetSendLimits"),
+		/*explain*/ ("ÿͻͶеĸߵˮλ(ֽ)Էʱڶлѹ,ﵽˮλ󡰷ݡ롰͡ؼ,áȡͶС鿴ѹ,ˮλָĬϸˮλ16MBˮλ4MB,ɹ档"),
+		/*category*/-1,
+		/*state*/   NULL,
+		/*ret*/     SDT_BOOL,
+		/*reserved*/NULL,
+		/*level*/   LVL_HIGH,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*ArgCount*/2,
+		/*arg lp*/  Args_SetSendLimits,
+	} ,Fn_Server_SetSendLimits ,"Fn_Server_SetSendLimits" };
+
+static ARG_INFO Args_GetSendQueue[] =
+{
+	{
+		/*name*/    "ͻSOCKET",
+		/*explain*/ ("ͨȡؿͻȡSOKET"),
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_INT,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_NONE,
+	},
+	{
+		/*name*/    "Ŷӿ",
+		/*explain*/ ("Աʡԡṩʱ,ضδϵͳݿ"),
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_INT,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_RECEIVE_VAR | ArgMark::AS_DEFAULT_VALUE_IS_EMPTY,
+	}
+};
+
+EXTERN_C void Fn_Server_GetSendQueue(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	HWND hWnd = elibstl::get_hwnd_from_arg(pArgInf);
+	eServer* pServer = (eServer*)GetWindowLongPtrW(hWnd, GWL_USERDATA);
+	int depth = 0;
+	long long bytes = 0;
+	if (!pServer->get_send_queue(pArgInf[1].m_int, &depth, &bytes))
+	{
+		pRetData->m_int64 = -1;
+		return;
+	}
+	if (pArgInf[2].m_pInt)
+		*pArgInf[2].m_pInt = depth;
+	pRetData->m_int64 = bytes;
+}
+
+FucInfo Server_GetSendQueue = { {
+		/*ccname*/  ("ȡͶ"),
+		/*egname*/  ("GetSendQueue"),
+		/*explain*/ ("طָͻύԷδµֽ,ڷ͵ĺŶӵġͻڻδʱ-1"),
+		/*category*/-1,
+		/*state*/   NULL,
+		/*ret*/     SDT_INT64,
+		/*reserved*/NULL,
+		/*level*/   LVL_HIGH,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*ArgCount*/2,
+		/*arg lp*/  Args_GetSendQueue,
+	} ,Fn_Server_GetSendQueue ,"Fn_Server_GetSendQueue" };
+
 
 #pragma endregion
@@ -0,0 +1,1224 @@
+#include"ElibHelp.h"
+#include"eplCharset.h"
+#include<algorithm>
+#include<climits>
+#include<vector>
+
+namespace elibstl {
+	namespace charset {
+		namespace tables {
+			extern const std::uint16_t gb18030_2byte[23940];
+			extern const std::uint32_t gb18030_ranges[206][2];
+			extern const std::uint16_t big5_2byte[19782];
+			extern const std::uint16_t big5_encode_extra[11][2];
+		}
+	}
+}
+
+namespace {
+	using elibstl::charset::encoding;
+	namespace tables = elibstl::charset::tables;
+
+	constexpr char32_t kReplacement = 0xFFFD;
+	constexpr char32_t kBom = 0xFEFF;
+	/*GB18030ֽ:BMPֵŸ,Լ0x90308130(U+10000)*/
+	constexpr std::uint32_t kGbBmpLinear = 39420;
+	constexpr std::uint32_t kGbSupplementaryLinear = 189000;
+	constexpr size_t kGbRangeCount = sizeof(tables::gb18030_ranges) / sizeof(tables::gb18030_ranges[0]);
+
+	inline int gb_trail_index(unsigned char b)
+	{
+		if (b >= 0x40 && b <= 0x7E)
+			return b - 0x40;
+		if (b >= 0x80 && b <= 0xFE)
+			return b - 0x41;
+		return -1;
+	}
+
+	inline int big5_trail_index(unsigned char b)
+	{
+		if (b >= 0x40 && b <= 0x7E)
+			return b - 0x40;
+		if (b >= 0xA1 && b <= 0xFE)
+			return b - 0x62;
+		return -1;
+	}
+
+	/*Unicode˫ֽڱķ,״ʹʱ.ͬһλжʱȡСһ*/
+	std::vector<std::uint16_t> build_reverse(const std::uint16_t* table, size_t count, int trails, int (*trail_byte)(int))
+	{
+		std::vector<std::uint16_t> reverse(0x10000, 0);
+		for (size_t i = 0; i < count; i++)
+		{
+			const auto cp = table[i];
+			if (cp == 0 || reverse[cp] != 0)
+				continue;
+			const int lead = 0x81 + static_cast<int>(i) / trails;
+			reverse[cp] = static_cast<std::uint16_t>((lead << 8) | trail_byte(static_cast<int>(i) % trails));
+		}
+		return reverse;
+	}
+
+	const std::vector<std::uint16_t>& gb_reverse()
+	{
+		static const auto reverse = build_reverse(tables::gb18030_2byte, 23940, 190,
+			[](int t) { return t < 0x3F ? t + 0x40 : t + 0x41; });
+		return reverse;
+	}
+
+	const std::vector<std::uint16_t>& big5_reverse()
+	{
+		static const auto reverse = [] {
+			auto table = build_reverse(tables::big5_2byte, 19782, 157,
+				[](int t) { return t < 0x3F ? t + 0x40 : t + 0x62; });
+			for (const auto& item : tables::big5_encode_extra)
+				table[item[0]] = item[1];
+			return table;
+		}();
+		return reverse;
+	}
+
+	char32_t gb_linear_to_bmp(std::uint32_t linear)
+	{
+		/*ʼŲlinearһ*/
+		size_t lo = 0, hi = kGbRangeCount;
+		while (hi - lo > 1)
+		{
+			const size_t mid = (lo + hi) / 2;
+			if (tables::gb18030_ranges[mid][0] <= linear)
+				lo = mid;
+			else
+				hi = mid;
+		}
+		return static_cast<char32_t>(tables::gb18030_ranges[lo][1] + (linear - tables::gb18030_ranges[lo][0]));
+	}
+
+	std::uint32_t gb_bmp_to_linear(char32_t cp)
+	{
+		size_t lo = 0, hi = kGbRangeCount;
+		while (hi - lo > 1)
+		{
+			const size_t mid = (lo + hi) / 2;
+			if (tables::gb18030_ranges[mid][1] <= cp)
+				lo = mid;
+			else
+				hi = mid;
+		}
+		return tables::gb18030_ranges[lo][0] + (static_cast<std::uint32_t>(cp) - tables::gb18030_ranges[lo][1]);
+	}
+
+	/*UTF-8еĳ,ЧʱظӦֽ,0*/
+	int utf8_decode(const unsigned char* p, size_t n, bool last, char32_t& cp)
+	{
+		const unsigned char b = p[0];
+		if (b < 0x80)
+		{
+			cp = b;
+			return 1;
+		}
+		int len;
+		char32_t min;
+		if (b >= 0xC2 && b <= 0xDF)
+		{
+			len = 2;
+			cp = b & 0x1F;
+			min = 0x80;
+		}
+		else if (b >= 0xE0 && b <= 0xEF)
+		{
+			len = 3;
+			cp = b & 0x0F;
+			min = 0x800;
+		}
+		else if (b >= 0xF0 && b <= 0xF4)
+		{
+			len = 4;
+			cp = b & 0x07;
+			min = 0x10000;
+		}
+		else
+			return -1;
+		for (int i = 1; i < len; i++)
+		{
+			if (static_cast<size_t>(i) >= n)
+				return last ? -i : 0;
+			if ((p[i] & 0xC0) != 0x80)
+				return -i;
+			cp = (cp << 6) | (p[i] & 0x3F);
+			/*ܾ롢ͳU+10FFFF,Чǰ׺*/
+			if (i == 1 && ((len == 3 && b == 0xE0 && p[1] < 0xA0) || (len == 3 && b == 0xED && p[1] >= 0xA0)
+				|| (len == 4 && b == 0xF0 && p[1] < 0x90) || (len == 4 && b == 0xF4 && p[1] >= 0x90)))
+				return -1;
+		}
+		if (cp < min)
+			return -len;
+		return len;
+	}
+
+	int utf16_decode(const unsigned char* p, size_t n, bool last, bool big, char32_t& cp)
+	{
+		if (n < 2)
+			return last ? -static_cast<int>(n) : 0;
+		const auto unit = [p, big](size_t i) -> char32_t {
+			return big ? static_cast<char32_t>((p[i] << 8) | p[i + 1]) : static_cast<char32_t>(p[i] | (p[i + 1] << 8));
+		};
+		const char32_t u = unit(0);
+		if (u < 0xD800 || u > 0xDFFF)
+		{
+			cp = u;
+			return 2;
+		}
+		if (u >= 0xDC00)
+			return -2;
+		if (n < 4)
+			return last ? -2 : 0;
+		const char32_t low = unit(2);
+		if (low < 0xDC00 || low > 0xDFFF)
+			return -2;
+		cp = 0x10000 + ((u - 0xD800) << 10) + (low - 0xDC00);
+		return 4;
+	}
+
+	int gb_decode(const unsigned char* p, size_t n, bool last, char32_t& cp)
+	{
+		const unsigned char b = p[0];
+		if (b < 0x80)
+		{
+			cp = b;
+			return 1;
+		}
+		if (b == 0x80 || b == 0xFF)
+			return -1;
+		if (n < 2)
+			return last ? -1 : 0;
+		if (p[1] >= 0x30 && p[1] <= 0x39)
+		{
+			if (n < 4)
+			{
+				if (n == 3 && (p[2] < 0x81 || p[2] > 0xFE))
+					return -1;
+				return last ? -1 : 0;
+			}
+			if (p[2] < 0x81 || p[2] > 0xFE || p[3] < 0x30 || p[3] > 0x39)
+				return -1;
+			const std::uint32_t linear = (((static_cast<std::uint32_t>(b) - 0x81) * 10 + (p[1] - 0x30)) * 126 + (p[2] - 0x81)) * 10 + (p[3] - 0x30);
+			if (linear < kGbBmpLinear)
+				cp = gb_linear_to_bmp(linear);
+			else if (linear >= kGbSupplementaryLinear && linear - kGbSupplementaryLinear <= 0x10FFFF - 0x10000)
+				cp = 0x10000 + (linear - kGbSupplementaryLinear);
+			else
+				return -4;
+			return 4;
+		}
+		const int trail = gb_trail_index(p[1]);
+		if (trail < 0)
+			return -1;
+		cp = tables::gb18030_2byte[(b - 0x81) * 190 + trail];
+		return 2;
+	}
+
+	int big5_decode(const unsigned char* p, size_t n, bool last, char32_t& cp)
+	{
+		const unsigned char b = p[0];
+		if (b < 0x80)
+		{
+			cp = b;
+			return 1;
+		}
+		if (b == 0x80 || b == 0xFF)
+			return -1;
+		if (n < 2)
+			return last ? -1 : 0;
+		const int trail = big5_trail_index(p[1]);
+		if (trail < 0)
+			return -1;
+		cp = tables::big5_2byte[(b - 0x81) * 157 + trail];
+		/*βֽںϷδ,βֽڵASCII*/
+		return cp == 0 ? -2 : 2;
+	}
+
+	/*֡ͷڵ,UTF-16ıͶ*/
+	bool is_common_text(char32_t cp)
+	{
+		static const char32_t ranges[][2] =
+		{
+			{ 0x0020, 0x007E }, { 0x00A0, 0x024F }, { 0x0370, 0x052F }, { 0x0590, 0x06FF }, { 0x0900, 0x0E7F },
+			{ 0x2000, 0x206F }, { 0x20A0, 0x20CF }, { 0x2100, 0x22FF }, { 0x2460, 0x27BF }, { 0x3000, 0x9FFF },
+			{ 0xAC00, 0xD7A3 }, { 0xF900, 0xFAFF }, { 0xFE30, 0xFE4F }, { 0xFF00, 0xFFEF },
+		};
+		if (cp == '\t' || cp == '\r' || cp == '\n' || cp >= 0x10000)
+			return true;
+		for (const auto& range : ranges)
+		{
+			if (cp >= range[0] && cp <= range[1])
+				return true;
+		}
+		return false;
+	}
+
+	/*UTF-16пıԪ*/
+	double utf16_plausibility(const unsigned char* p, size_t n, bool big)
+	{
+		const size_t units = n / 2;
+		if (units == 0)
+			return 0;
+		size_t good = 0;
+		for (size_t i = 0; i + 1 < n;)
+		{
+			char32_t cp;
+			const int r = utf16_decode(p + i, n - i, false, big, cp);
+			if (r == 0)
+				break;
+			if (r < 0)
+			{
+				i += static_cast<size_t>(-r);
+				continue;
+			}
+			i += static_cast<size_t>(r);
+			if (is_common_text(cp))
+				good += static_cast<size_t>(r) / 2;
+		}
+		return static_cast<double>(good) / static_cast<double>(units);
+	}
+
+	bool utf16_big_endian(const unsigned char* p, size_t n, double le, double be)
+	{
+		if (le != be)
+			return be > le;
+		/*ֽʱ("\0H\0i"LE),0ֽ:ַ0ֽBEλżλ,LEλλ*/
+		size_t even = 0, odd = 0;
+		for (size_t i = 0; i + 1 < n; i += 2)
+		{
+			even += p[i] == 0;
+			odd += p[i + 1] == 0;
+		}
+		if (even != odd)
+			return even > odd;
+		/*û0ֽʱֵĸλֽ(0x4E-0x9F)һ*/
+		even = odd = 0;
+		for (size_t i = 0; i + 1 < n; i += 2)
+		{
+			even += p[i] >= 0x4E && p[i] <= 0x9F;
+			odd += p[i + 1] >= 0x4E && p[i + 1] <= 0x9F;
+		}
+		return even > odd;
+	}
+
+	struct dbcs_stats
+	{
+		size_t chars = 0;    /*ASCIIַ*/
+		size_t invalid = 0;
+		size_t low_trail = 0;/*βֽС0xA1ֽС0xA1˫ַֽ,GB2312ıв*/
+		size_t four_byte = 0;
+	};
+
+	dbcs_stats scan_dbcs(const unsigned char* p, size_t n, bool complete, bool big5)
+	{
+		dbcs_stats stats;
+		for (size_t i = 0; i < n;)
+		{
+			if (p[i] < 0x80)
+			{
+				i++;
+				continue;
+			}
+			char32_t cp;
+			const int r = big5 ? big5_decode(p + i, n - i, complete, cp) : gb_decode(p + i, n - i, complete, cp);
+			if (r == 0)
+				break;
+			stats.chars++;
+			if (r < 0)
+			{
+				stats.invalid++;
+				i += static_cast<size_t>(-r);
+				continue;
+			}
+			if (r == 4)
+				stats.four_byte++;
+			else if (p[i] < 0xA1 || p[i + 1] < 0xA1)
+				stats.low_trail++;
+			i += static_cast<size_t>(r);
+		}
+		return stats;
+	}
+
+	int sample_confidence(size_t chars, double bad_rate)
+	{
+		/*ַԽԽ,ʰ10۷*/
+		const double base = chars >= 32 ? 95.0 : 50.0 + static_cast<double>(chars) * 45.0 / 32.0;
+		const double score = base * (1.0 - (std::min)(1.0, bad_rate * 10.0));
+		return static_cast<int>(score);
+	}
+}
+
+namespace elibstl {
+	namespace charset {
+		detect_result detect(const void* data, size_t size, bool complete)
+		{
+			detect_result result;
+			const auto p = static_cast<const unsigned char*>(data);
+			if (p == nullptr || size == 0)
+				return result;
+			if (size >= 3 && p[0] == 0xEF && p[1] == 0xBB && p[2] == 0xBF)
+				return { encoding::utf8, 3, 100 };
+			if (size >= 4 && p[0] == 0x84 && p[1] == 0x31 && p[2] == 0x95 && p[3] == 0x33)
+				return { encoding::gb18030, 4, 100 };
+			if (size >= 2 && p[0] == 0xFF && p[1] == 0xFE)
+				return { encoding::utf16le, 2, 100 };
+			if (size >= 2 && p[0] == 0xFE && p[1] == 0xFF)
+				return { encoding::utf16be, 2, 100 };
+
+			size_t zeros = 0, high = 0;
+			for (size_t i = 0; i < size; i++)
+			{
+				zeros += p[i] == 0;
+				high += p[i] >= 0x80;
+			}
+			if (zeros > 0)
+			{
+				/*ıв0ֽ,0ֽʱֻUTF-16,򰴶ݴ*/
+				const double le = utf16_plausibility(p, size, false), be = utf16_plausibility(p, size, true);
+				const bool big = utf16_big_endian(p, size, le, be);
+				const double best = big ? be : le;
+				if (best >= 0.8)
+					return { big ? encoding::utf16be : encoding::utf16le, 0, static_cast<int>(best * 100) };
+				return result;
+			}
+			if (high == 0)
+				return { encoding::ascii, 0, 100 };
+
+			size_t multibyte = 0, invalid = 0;
+			for (size_t i = 0; i < size;)
+			{
+				char32_t cp;
+				const int r = utf8_decode(p + i, size - i, complete, cp);
+				if (r == 0)
+					break;
+				if (r < 0)
+				{
+					invalid++;
+					i += static_cast<size_t>(-r);
+					continue;
+				}
+				multibyte += r > 1;
+				i += static_cast<size_t>(r);
+			}
+			if (invalid == 0)
+				return { encoding::utf8, 0, (std::min)(100, 70 + static_cast<int>(multibyte) * 8) };
+
+			const auto gb = scan_dbcs(p, size, complete, false);
+			const auto b5 = scan_dbcs(p, size, complete, true);
+			const double gb_bad = gb.chars ? static_cast<double>(gb.invalid) / gb.chars : 1.0;
+			const double b5_bad = b5.chars ? static_cast<double>(b5.invalid) / b5.chars : 1.0;
+			/*ֶЧʱβֽڷֲ:Big5Լĳβֽ0x40-0x7E,GB2312ַβֽڶС0xA1*/
+			const bool prefer_big5 = b5_bad < gb_bad
+				|| (b5_bad == gb_bad && gb.four_byte == 0 && gb.chars > 0 && static_cast<double>(gb.low_trail) / gb.chars > 0.15);
+			const double best_bad = prefer_big5 ? b5_bad : gb_bad;
+			if (best_bad < 0.05)
+				return { prefer_big5 ? encoding::big5 : encoding::gb18030, 0, sample_confidence(prefer_big5 ? b5.chars : gb.chars, best_bad) };
+
+			/*û0ֽڵUTF-16,ȫǺֵı*/
+			if (size % 2 == 0 || !complete)
+			{
+				const double le = utf16_plausibility(p, size, false), be = utf16_plausibility(p, size, true);
+				const bool big = utf16_big_endian(p, size, le, be);
+				const double best = big ? be : le;
+				if (best >= 0.95)
+					return { big ? encoding::utf16be : encoding::utf16le, 0, static_cast<int>(best * 80) };
+			}
+			/*ʱٵĶֽڱ,ŶȺܵ*/
+			if (best_bad < 0.3)
+				return { prefer_big5 ? encoding::big5 : encoding::gb18030, 0, sample_confidence(prefer_big5 ? b5.chars : gb.chars, best_bad) };
+			return result;
+		}
+
+		const char* encoding_name(encoding enc)
+		{
+			switch (enc)
+			{
+			case encoding::ascii: return "ASCII";
+			case encoding::utf8: return "UTF-8";
+			case encoding::utf16le: return "UTF-16LE";
+			case encoding::utf16be: return "UTF-16BE";
+			case encoding::gb18030: return "GB18030";
+			case encoding::big5: return "Big5";
+			default: return "";
+			}
+		}
+
+		converter::converter(encoding from, encoding to, error_policy policy, bool write_bom)
+		{
+			reset(from, to, policy, write_bom);
+		}
+
+		void converter::reset(encoding from, encoding to, error_policy policy, bool write_bom)
+		{
+			*this = converter();
+			m_from = from;
+			m_to = to == encoding::unknown ? encoding::utf8 : to;
+			m_policy = policy;
+			m_write_bom = write_bom;
+		}
+
+		int converter::decode_one(const unsigned char* p, size_t n, bool last, char32_t& cp) const
+		{
+			switch (m_from)
+			{
+			case encoding::ascii:
+				cp = p[0];
+				return p[0] < 0x80 ? 1 : -1;
+			case encoding::utf16le:
+				return utf16_decode(p, n, last, false, cp);
+			case encoding::utf16be:
+				return utf16_decode(p, n, last, true, cp);
+			case encoding::gb18030:
+				return gb_decode(p, n, last, cp);
+			case encoding::big5:
+				return big5_decode(p, n, last, cp);
+			default:
+				return utf8_decode(p, n, last, cp);
+			}
+		}
+
+		bool converter::encode_one(char32_t cp, std::string& out) const
+		{
+			if (cp > 0x10FFFF || (cp >= 0xD800 && cp <= 0xDFFF))
+				return false;
+			switch (m_to)
+			{
+			case encoding::ascii:
+				if (cp >= 0x80)
+					return false;
+				out.push_back(static_cast<char>(cp));
+				return true;
+			case encoding::utf16le:
+			case encoding::utf16be:
+			{
+				const auto put = [&out, this](char32_t unit) {
+					if (m_to == encoding::utf16le)
+					{
+						out.push_back(static_cast<char>(unit & 0xFF));
+						out.push_back(static_cast<char>(unit >> 8));
+					}
+					else
+					{
+						out.push_back(static_cast<char>(unit >> 8));
+						out.push_back(static_cast<char>(unit & 0xFF));
+					}
+				};
+				if (cp >= 0x10000)
+				{
+					put(0xD800 + ((cp - 0x10000) >> 10));
+					put(0xDC00 + ((cp - 0x10000) & 0x3FF));
+				}
+				else
+					put(cp);
+				return true;
+			}
+			case encoding::gb18030:
+			{
+				if (cp < 0x80)
+				{
+					out.push_back(static_cast<char>(cp));
+					return true;
+				}
+				if (cp <= 0xFFFF)
+				{
+					const auto code = gb_reverse()[cp];
+					if (code != 0)
+					{
+						out.push_back(static_cast<char>(code >> 8));
+						out.push_back(static_cast<char>(code & 0xFF));
+						return true;
+					}
+				}
+				std::uint32_t linear = cp <= 0xFFFF ? gb_bmp_to_linear(cp) : kGbSupplementaryLinear + (cp - 0x10000);
+				char bytes[4];
+				bytes[3] = static_cast<char>(0x30 + linear % 10);
+				linear /= 10;
+				bytes[2] = static_cast<char>(0x81 + linear % 126);
+				linear /= 126;
+				bytes[1] = static_cast<char>(0x30 + linear % 10);
+				bytes[0] = static_cast<char>(0x81 + linear / 10);
+				out.append(bytes, 4);
+				return true;
+			}
+			case encoding::big5:
+			{
+				if (cp < 0x80)
+				{
+					out.push_back(static_cast<char>(cp));
+					return true;
+				}
+				if (cp > 0xFFFF)
+					return false;
+				const auto code = big5_reverse()[cp];
+				if (code == 0)
+					return false;
+				out.push_back(static_cast<char>(code >> 8));
+				out.push_back(static_cast<char>(code & 0xFF));
+				return true;
+			}
+			default:
+				if (cp < 0x80)
+					out.push_back(static_cast<char>(cp));
+				else if (cp < 0x800)
+				{
+					out.push_back(static_cast<char>(0xC0 | (cp >> 6)));
+					out.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+				}
+				else if (cp < 0x10000)
+				{
+					out.push_back(static_cast<char>(0xE0 | (cp >> 12)));
+					out.push_back(static_cast<char>(0x80 | ((cp >> 6) & 0x3F)));
+					out.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+				}
+				else
+				{
+					out.push_back(static_cast<char>(0xF0 | (cp >> 18)));
+					out.push_back(static_cast<char>(0x80 | ((cp >> 12) & 0x3F)));
+					out.push_back(static_cast<char>(0x80 | ((cp >> 6) & 0x3F)));
+					out.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+				}
+				return true;
+			}
+		}
+
+		bool converter::error(std::uint64_t offset, std::string& out)
+		{
+			m_errors++;
+			if (m_error_offset < 0)
+				m_error_offset = static_cast<std::int64_t>(offset);
+			switch (m_policy)
+			{
+			case error_policy::skip:
+				return true;
+			case error_policy::stop:
+				m_failed = true;
+				return false;
+			default:
+				if (!encode_one(kReplacement, out))
+					out.push_back('?');
+				return true;
+			}
+		}
+
+		bool converter::emit(char32_t cp, std::string& out)
+		{
+			return encode_one(cp, out) || error(m_consumed, out);
+		}
+
+		size_t converter::process(const unsigned char* p, size_t n, bool last, std::string& out)
+		{
+			size_t i = 0;
+			while (i < n && !m_failed)
+			{
+				char32_t cp;
+				const int r = decode_one(p + i, n - i, last, cp);
+				if (r == 0)
+					break;
+				if (r < 0)
+				{
+					error(m_consumed, out);
+					i += static_cast<size_t>(-r);
+					m_consumed += static_cast<size_t>(-r);
+					continue;
+				}
+				/*뿪ͷBOM*/
+				if (!(cp == kBom && m_consumed == 0 && m_from != encoding::ascii && m_from != encoding::big5))
+					emit(cp, out);
+				i += static_cast<size_t>(r);
+				m_consumed += static_cast<size_t>(r);
+			}
+			return i;
+		}
+
+		bool converter::feed(const void* data, size_t size, std::string& out)
+		{
+			if (m_failed)
+				return false;
+			auto p = static_cast<const unsigned char*>(data);
+			if (m_from == encoding::unknown && size > 0)
+			{
+				/*޷жʱUTF-8,ЧֽڰԴ*/
+				const auto detected = detect(p, size, false).enc;
+				m_from = detected == encoding::unknown ? encoding::utf8 : detected;
+			}
+			if (!m_started)
+			{
+				m_started = true;
+				if (m_write_bom && m_to != encoding::ascii && m_to != encoding::big5)
+					encode_one(kBom, out);
+			}
+			/*ȰһµĲַ*/
+			while (m_pending_size > 0 && size > 0 && !m_failed)
+			{
+				unsigned char buffer[8];
+				const size_t take = (std::min)(size, sizeof(buffer) - m_pending_size);
+				std::copy(m_pending, m_pending + m_pending_size, buffer);
+				std::copy(p, p + take, buffer + m_pending_size);
+				const size_t used = process(buffer, m_pending_size + take, false, out);
+				if (used == 0)
+				{
+					/*Բ,һѾȫŽbuffer*/
+					std::copy(p, p + take, m_pending + m_pending_size);
+					m_pending_size += take;
+					return !m_failed;
+				}
+				if (used >= m_pending_size)
+				{
+					p += used - m_pending_size;
+					size -= used - m_pending_size;
+					m_pending_size = 0;
+				}
+				else
+				{
+					std::copy(m_pending + used, m_pending + m_pending_size, m_pending);
+					m_pending_size -= used;
+				}
+			}
+			if (m_failed)
+				return false;
+			if (m_pending_size > 0)
+				return true;
+			const size_t used = process(p, size, false, out);
+			if (m_failed)
+				return false;
+			m_pending_size = size - used;
+			std::copy(p + used, p + size, m_pending);
+			return true;
+		}
+
+		bool converter::finish(std::string& out)
+		{
+			if (m_failed)
+				return false;
+			if (!m_started)
+				feed(nullptr, 0, out);
+			if (m_pending_size > 0)
+			{
+				unsigned char buffer[4];
+				const size_t size = m_pending_size;
+				std::copy(m_pending, m_pending + size, buffer);
+				m_pending_size = 0;
+				process(buffer, size, true, out);
+			}
+			return !m_failed;
+		}
+
+		bool convert(const void* data, size_t size, encoding from, encoding to, std::string& out,
+			error_policy policy, bool write_bom, size_t* errors)
+		{
+			if (from == encoding::unknown)
+				from = detect(data, size, true).enc;
+			converter conv(from, to, policy, write_bom);
+			const bool ok = conv.feed(data, size, out) && conv.finish(out);
+			if (errors)
+				*errors = conv.errors();
+			return ok;
+		}
+	}
+}
+
+namespace {
+	using elibstl::charset::encoding;
+	using elibstl::charset::error_policy;
+
+	bool to_encoding(INT value, bool allow_unknown, encoding& enc)
+	{
+		if (value < (allow_unknown ? 0 : 1) || value >= elibstl::charset::kEncodingCount)
+			return false;
+		enc = static_cast<encoding>(value);
+		return true;
+	}
+
+	LPBYTE string_to_bin(const std::string& data)
+	{
+		if (data.empty() || data.size() > static_cast<size_t>(INT_MAX) - 2 * sizeof(INT))
+			return nullptr;
+		return elibstl::clone_bin(reinterpret_cast<LPBYTE>(const_cast<char*>(data.data())), static_cast<INT>(data.size()));
+	}
+}
+
+static ARG_INFO Args_DetectEncoding[] =
+{
+	{
+		/*name*/    "",
+		/*explain*/ (""),
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_BIN,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_NONE,
+	},
+	{
+		/*name*/    "Ŷ",
+		/*explain*/ ("Աʡԡṩʱд0100֮Ŀų̶,ԽԽ"),
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_INT,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_RECEIVE_VAR | ArgMark::AS_DEFAULT_VALUE_IS_EMPTY,
+	}
+};
+EXTERN_C void fn_DetectEncoding(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	const auto data = elibstl::args_to_ebin(pArgInf, 0);
+	elibstl::charset::detect_result result;
+	if (data != nullptr && data->m_size > 0)
+		result = elibstl::charset::detect(data->m_data, data->m_size);
+	if (pArgInf[1].m_dtDataType != _SDT_NULL)
+		*pArgInf[1].m_pInt = result.confidence;
+	pRetData->m_int = static_cast<INT>(result.enc);
+}
+FucInfo Fn_DetectEncoding = { {
+		/*ccname*/  (""),
+		/*egname*/  ("detect_encoding"),
+		/*explain*/ ("жܵı,:0޷ж();1ASCII;2UTF-8;3UTF-16LE;4UTF-16BE;5GB18030(GBK/GB2312);6Big5ȿBOM,УUTF-8,ֽڷֲȽGB18030Big5,ʹϵͳҳ,ϵͳ޹ء"),
+		/*category*/2,
+		/*state*/   NULL,
+		/*ret*/     SDT_INT,
+		/*reserved*/NULL,
+		/*level*/   LVL_HIGH,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+	ESTLARG(Args_DetectEncoding)
+	} ,ESTLFNAME(fn_DetectEncoding) };
+
+static ARG_INFO Args_DetectFileEncoding[] =
+{
+	{
+		/*name*/    "ļ",
+		/*explain*/ (""),
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_BIN,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_NONE,
+	},
+	{
+		/*name*/    "ⳤ",
+		/*explain*/ ("Աʡԡֻȡļͷôֽڽм,ĬΪ65536"),
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_INT,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_DEFAULT_VALUE_IS_EMPTY,
+	},
+	{
+		/*name*/    "Ŷ",
+		/*explain*/ ("Աʡԡṩʱд0100֮Ŀų̶"),
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_INT,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_RECEIVE_VAR | ArgMark::AS_DEFAULT_VALUE_IS_EMPTY,
+	}
+};
+EXTERN_C void fn_DetectFileEncoding(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	const std::wstring path(elibstl::args_to_wsdata(pArgInf, 0));
+	INT limit = elibstl::args_to_data<INT>(pArgInf, 1).value_or(65536);
+	if (limit <= 0)
+		limit = 65536;
+	elibstl::charset::detect_result result;
+	const HANDLE file = ::CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+		NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (file != INVALID_HANDLE_VALUE)
+	{
+		std::vector<unsigned char> buffer(static_cast<size_t>(limit));
+		DWORD got = 0;
+		LARGE_INTEGER size;
+		if (::ReadFile(file, buffer.data(), static_cast<DWORD>(buffer.size()), &got, NULL) && ::GetFileSizeEx(file, &size))
+			result = elibstl::charset::detect(buffer.data(), got, static_cast<std::uint64_t>(size.QuadPart) <= got);
+		::CloseHandle(file);
+	}
+	if (pArgInf[2].m_dtDataType != _SDT_NULL)
+		*pArgInf[2].m_pInt = result.confidence;
+	pRetData->m_int = static_cast<INT>(result.enc);
+}
+FucInfo Fn_DetectFileEncoding = { {
+		/*ccname*/  ("ļ"),
+		/*egname*/  ("detect_file_encoding"),
+		/*explain*/ ("ȡļͷһжı,ֵͬ롱ļ򲻿ʱ0"),
+		/*category*/2,
+		/*state*/   NULL,
+		/*ret*/     SDT_INT,
+		/*reserved*/NULL,
+		/*level*/   LVL_HIGH,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+	ESTLARG(Args_DetectFileEncoding)
+	} ,ESTLFNAME(fn_DetectFileEncoding) };
+
+static ARG_INFO Args_ConvertEncoding[] =
+{
+	{
+		/*name*/    "",
+		/*explain*/ (""),
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_BIN,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_NONE,
+	},
+	{
+		/*name*/    "Դ",
+		/*explain*/ ("ֵͬ롱ķֵ,Ϊ0ʱԶ"),
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_INT,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_NONE,
+	},
+	{
+		/*name*/    "Ŀ",
+		/*explain*/ ("ֵͬ롱ķֵ,Ϊ0"),
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_INT,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_NONE,
+	},
+	{
+		/*name*/    "",
+		/*explain*/ ("ԱʡԡЧĿ޷ʾַʱ:0滻ΪU+FFFD,Ŀ벻ܱʾʱ滻Ϊ?;1;2תʧ,ؿֽڼĬΪ0"),
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_INT,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_DEFAULT_VALUE_IS_EMPTY,
+	},
+	{
+		/*name*/    "дBOM",
+		/*explain*/ ("ԱʡԡΪʱڽͷдĿBOM,ASCIIBig5ûBOMԴݿͷBOMǱȥĬΪ"),
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_BOOL,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_DEFAULT_VALUE_IS_EMPTY,
+	}
+};
+EXTERN_C void fn_ConvertEncoding(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	const auto data = elibstl::args_to_ebin(pArgInf, 0);
+	encoding from, to;
+	const auto policy = elibstl::args_to_data<INT>(pArgInf, 3).value_or(0);
+	if (data == nullptr || data->m_size == 0 || !to_encoding(pArgInf[1].m_int, true, from) || !to_encoding(pArgInf[2].m_int, false, to)
+		|| policy < 0 || policy > 2)
+		return;
+	std::string out;
+	if (elibstl::charset::convert(data->m_data, data->m_size, from, to, out, static_cast<error_policy>(policy),
+		elibstl::args_to_data<BOOL>(pArgInf, 4).value_or(FALSE) != FALSE))
+		pRetData->m_pBin = string_to_bin(out);
+}
+FucInfo Fn_ConvertEncoding = { {
+		/*ccname*/  ("ת"),
+		/*egname*/  ("convert_encoding"),
+		/*explain*/ ("UTF-8UTF-16LE/BEGB18030Big5ASCII֮תı,ʹ,ϵͳҳתUnicodeı(UTF-16LE)ʱַʧܷؿֽڼ"),
+		/*category*/2,
+		/*state*/   NULL,
+		/*ret*/     SDT_BIN,
+		/*reserved*/NULL,
+		/*level*/   LVL_HIGH,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+	ESTLARG(Args_ConvertEncoding)
+	} ,ESTLFNAME(fn_ConvertEncoding) };
+
+static ARG_INFO Args_EncodingName[] =
+{
+	{
+		/*name*/    "",
+		/*explain*/ ("ֵͬ롱ķֵ"),
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_INT,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_NONE,
+	}
+};
+EXTERN_C void fn_EncodingName(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	encoding enc;
+	if (to_encoding(pArgInf[0].m_int, false, enc))
+		pRetData->m_pText = elibstl::clone_text(std::string(elibstl::charset::encoding_name(enc)));
+}
+FucInfo Fn_EncodingName = { {
+		/*ccname*/  ("ȡ"),
+		/*egname*/  ("encoding_name"),
+		/*explain*/ ("ر,硰UTF-8GB18030,Чı뷵ؿı"),
+		/*category*/2,
+		/*state*/   NULL,
+		/*ret*/     SDT_TEXT,
+		/*reserved*/NULL,
+		/*level*/   LVL_HIGH,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+	ESTLARG(Args_EncodingName)
+	} ,ESTLFNAME(fn_EncodingName) };
+
+using elibstl::charset::converter;
+
+//
+EXTERN_C void fn_charconv_structure(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto& self = elibstl::args_to_obj<converter>(pArgInf);
+	self = new converter(encoding::unknown, encoding::utf8);
+}
+FucInfo Fn_charconv_structure = { {
+		/*ccname*/  "",
+		/*egname*/  "",
+		/*explain*/ NULL,
+		/*category*/ -1,
+		/*state*/  _CMD_OS(__OS_WIN) | CT_IS_HIDED | CT_IS_OBJ_CONSTURCT_CMD,
+		/*ret*/ _SDT_NULL,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*ArgCount*/0,
+		/*arg lp*/  NULL,
+	} ,ESTLFNAME(fn_charconv_structure) };
+
+static ARG_INFO s_CharconvCopyArgs[] =
+{
+	{
+		/*name*/    "",
+		/*explain*/ "",
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/	(DATA_TYPE)35,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_DEFAULT_VALUE_IS_EMPTY,
+	}
+};
+//
+EXTERN_C void fn_charconv_copy(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto& self = elibstl::classhelp::get_this<converter>(pArgInf);
+	const auto& rht = elibstl::classhelp::get_other<converter>(pArgInf);
+	self = new converter{ *rht };
+}
+FucInfo Fn_charconv_copy = { {
+		/*ccname*/  "",
+		/*egname*/  "",
+		/*explain*/ NULL,
+		/*category*/ -1,
+		/*state*/   _CMD_OS(__OS_WIN) | CT_IS_HIDED | CT_IS_OBJ_COPY_CMD,
+		/*ret*/ _SDT_NULL,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*ArgCount*/1,
+		/*arg lp*/  s_CharconvCopyArgs,
+	} ,ESTLFNAME(fn_charconv_copy) };
+
+//
+EXTERN_C void fn_charconv_destruct(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto& self = elibstl::args_to_obj<converter>(pArgInf);
+	if (self)
+		delete self;
+	self = nullptr;
+}
+FucInfo Fn_charconv_destruct = { {
+		/*ccname*/  "",
+		/*egname*/  "",
+		/*explain*/ NULL,
+		/*category*/ -1,
+		/*state*/    _CMD_OS(__OS_WIN) | CT_IS_HIDED | CT_IS_OBJ_FREE_CMD,
+		/*ret*/ _SDT_NULL,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*ArgCount*/0,
+		/*arg lp*/  NULL,
+	} ,ESTLFNAME(fn_charconv_destruct) };
+
+static ARG_INFO Args_CharconvInit[] =
+{
+	{
+		/*name*/    "Դ",
+		/*explain*/ "ֵͬ롱ķֵ,Ϊ0ʱһתԶ",
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_INT,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_NONE,
+	},
+	{
+		/*name*/    "Ŀ",
+		/*explain*/ "ֵͬ롱ķֵ,Ϊ0",
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_INT,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_NONE,
+	},
+	{
+		/*name*/    "",
+		/*explain*/ "Աʡԡ0滻;1;2תʧܡĬΪ0",
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_INT,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_DEFAULT_VALUE_IS_EMPTY,
+	},
+	{
+		/*name*/    "дBOM",
+		/*explain*/ "ԱʡԡΪʱһǰдĿBOMĬΪ",
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_BOOL,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_DEFAULT_VALUE_IS_EMPTY,
+	}
+};
+EXTERN_C void fn_charconv_init(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto& self = elibstl::args_to_obj<converter>(pArgInf);
+	encoding from, to;
+	const auto policy = elibstl::args_to_data<INT>(pArgInf, 3).value_or(0);
+	if (!to_encoding(pArgInf[1].m_int, true, from) || !to_encoding(pArgInf[2].m_int, false, to) || policy < 0 || policy > 2)
+	{
+		pRetData->m_bool = FALSE;
+		return;
+	}
+	self->reset(from, to, static_cast<error_policy>(policy), elibstl::args_to_data<BOOL>(pArgInf, 4).value_or(FALSE) != FALSE);
+	pRetData->m_bool = TRUE;
+}
+FucInfo Fn_charconv_init = { {
+		/*ccname*/  "ʼ",
+		/*egname*/  "init",
+		/*explain*/ "ԴĿ,ϴתµ״̬Чʱؼ١",
+		/*category*/ -1,
+		/*state*/    _CMD_OS(__OS_WIN) ,
+		/*ret*/ SDT_BOOL,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		ESTLARG(Args_CharconvInit)
+	} ,ESTLFNAME(fn_charconv_init) };
+
+static ARG_INFO Args_CharconvFeed[] =
+{
+	{
+		/*name*/    "",
+		/*explain*/ "",
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_BIN,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_NONE,
+	}
+};
+EXTERN_C void fn_charconv_feed(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto& self = elibstl::args_to_obj<converter>(pArgInf);
+	const auto data = elibstl::args_to_ebin(pArgInf, 1);
+	std::string out;
+	if (self->feed(data ? data->m_data : nullptr, data ? data->m_size : 0, out))
+		pRetData->m_pBin = string_to_bin(out);
+}
+FucInfo Fn_charconv_feed = { {
+		/*ccname*/  "ת",
+		/*egname*/  "feed",
+		/*explain*/ "תһݲؽݿλ÷ֿ,ĩβַһת򡰽ʱΪ2ʱؿֽڼ,֮תʧ,ֱ³ʼ",
+		/*category*/ -1,
+		/*state*/    _CMD_OS(__OS_WIN) ,
+		/*ret*/ SDT_BIN,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		ESTLARG(Args_CharconvFeed)
+	} ,ESTLFNAME(fn_charconv_feed) };
+
+EXTERN_C void fn_charconv_finish(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto& self = elibstl::args_to_obj<converter>(pArgInf);
+	std::string out;
+	if (self->finish(out))
+		pRetData->m_pBin = string_to_bin(out);
+}
+FucInfo Fn_charconv_finish = { {
+		/*ccname*/  "",
+		/*egname*/  "finish",
+		/*explain*/ "ʱ,ʣһĩβµĲַ",
+		/*category*/ -1,
+		/*state*/    _CMD_OS(__OS_WIN) ,
+		/*ret*/ SDT_BIN,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*ArgCount*/0,
+		/*arg lp*/  0,
+	} ,ESTLFNAME(fn_charconv_finish) };
+
+EXTERN_C void fn_charconv_errors(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto& self = elibstl::args_to_obj<converter>(pArgInf);
+	pRetData->m_int = static_cast<INT>((std::min<size_t>)(self->errors(), INT_MAX));
+}
+FucInfo Fn_charconv_errors = { {
+		/*ccname*/  "ȡ",
+		/*egname*/  "errors",
+		/*explain*/ "سʼЧ޷ʾַ",
+		/*category*/ -1,
+		/*state*/    _CMD_OS(__OS_WIN) ,
+		/*ret*/ SDT_INT,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*ArgCount*/0,
+		/*arg lp*/  0,
+	} ,ESTLFNAME(fn_charconv_errors) };
+
+EXTERN_C void fn_charconv_source(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	auto& self = elibstl::args_to_obj<converter>(pArgInf);
+	pRetData->m_int = static_cast<INT>(self->source());
+}
+FucInfo Fn_charconv_source = { {
+		/*ccname*/  "ȡԴ",
+		/*egname*/  "source",
+		/*explain*/ "Դ롣ʼʱԴΪ0,ڵһת󷵻ؼ⵽ı롣",
+		/*category*/ -1,
+		/*state*/    _CMD_OS(__OS_WIN) ,
+		/*ret*/ SDT_INT,
+		/*reserved*/0,
+		/*level*/   LVL_SIMPLE,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*ArgCount*/0,
+		/*arg lp*/  0,
+	} ,ESTLFNAME(fn_charconv_source) };
+
+static INT s_dtCmdIndexcommobj_charconv[] = { 469,470,471,472,473,474,475,476 };
+namespace elibstl {
+
+
+	LIB_DATA_TYPE_INFO Obj_CharsetConverter =
+	{
+		"ת",
+		"CharsetConverter",
+		"ֿתı,ʺתļ߽ϱضϵַԶƴ",
+		sizeof(s_dtCmdIndexcommobj_charconv) / sizeof(s_dtCmdIndexcommobj_charconv[0]),
+		 s_dtCmdIndexcommobj_charconv,
+		_DT_OS(__OS_WIN),
+		0,
+		NULL,
+		NULL,
+		NULL,
+		NULL,
+		NULL,
+		0,
+		0
+	};
+}
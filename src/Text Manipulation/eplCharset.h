@@ -0,0 +1,93 @@
+#pragma once
+#include<cstddef>
+#include<cstdint>
+#include<string>
+
+/*
+* ת,ϵͳҳ(MultiByteToWideChar),ڸƽ̨Ͻһ.
+* GB18030(GBK/GB2312)Big5(cp950)ʹ,밴㷨ת.
+*/
+namespace elibstl {
+	namespace charset {
+		/*ֵEеıһ,ҪĶ*/
+		enum class encoding : int
+		{
+			unknown = 0,
+			ascii = 1,
+			utf8 = 2,
+			utf16le = 3,
+			utf16be = 4,
+			gb18030 = 5,
+			big5 = 6,
+		};
+		constexpr int kEncodingCount = 7;
+
+		enum class error_policy : int
+		{
+			replace = 0, /*Ч޷ʾַU+FFFD,Ŀ벻ܱʾU+FFFDʱ?*/
+			skip = 1,    /**/
+			stop = 2,    /*תʧ*/
+		};
+
+		struct detect_result
+		{
+			encoding enc = encoding::unknown;
+			size_t bom_size = 0;  /*ݿͷBOMֽ,ûʱΪ0*/
+			int confidence = 0;   /*0-100*/
+		};
+
+		/*
+		* ݵı.completeΪʱʾdataֻǿͷһ,ĩβضϵĶַֽ.
+		* ˳:BOM;0ֽʱUTF-16ж;ASCII;UTF-8У;GB18030Big5;0ֽڵUTF-16.
+		*/
+		detect_result detect(const void* data, size_t size, bool complete = true);
+		const char* encoding_name(encoding enc);
+
+		/*ʽת,ݿԷֳ,߽ϱضϵַᱣһ*/
+		class converter
+		{
+		public:
+			converter() = default;
+			/*fromΪunknownʱһݼ*/
+			converter(encoding from, encoding to, error_policy policy = error_policy::replace, bool write_bom = false);
+
+			void reset(encoding from, encoding to, error_policy policy = error_policy::replace, bool write_bom = false);
+			/*ת׷ӵout.policyΪstopʱ󷵻ؼ,֮ٽ*/
+			bool feed(const void* data, size_t size, std::string& out);
+			/*,ʣĲַ*/
+			bool finish(std::string& out);
+
+			encoding source() const { return m_from; }
+			encoding target() const { return m_to; }
+			/*Ч޷ʾַ*/
+			size_t errors() const { return m_errors; }
+			/*һеƫ,ûдʱΪ-1*/
+			std::int64_t error_offset() const { return m_error_offset; }
+			bool failed() const { return m_failed; }
+
+		private:
+			/*ĵֽ;0ʾݲ;ʾЧ,ֵΪӦֽ*/
+			int decode_one(const unsigned char* p, size_t n, bool last, char32_t& cp) const;
+			bool encode_one(char32_t cp, std::string& out) const;
+			bool emit(char32_t cp, std::string& out);
+			bool error(std::uint64_t offset, std::string& out);
+			size_t process(const unsigned char* p, size_t n, bool last, std::string& out);
+
+			encoding m_from = encoding::unknown;
+			encoding m_to = encoding::utf8;
+			error_policy m_policy = error_policy::replace;
+			bool m_write_bom = false;
+			bool m_started = false;   /*ѾBOMһַ*/
+			bool m_failed = false;
+			unsigned char m_pending[4] = {};
+			size_t m_pending_size = 0;
+			std::uint64_t m_consumed = 0;   /*Ѵֽ,m_pending*/
+			size_t m_errors = 0;
+			std::int64_t m_error_offset = -1;
+		};
+
+		/*һת,fromΪunknownʱȼ*/
+		bool convert(const void* data, size_t size, encoding from, encoding to, std::string& out,
+			error_policy policy = error_policy::replace, bool write_bom = false, size_t* errors = nullptr);
+	}
+}
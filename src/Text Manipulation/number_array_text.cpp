@@ -0,0 +1,154 @@
+#include"ElibHelp.h"
+
+namespace {
+	inline bool is_blank(wchar_t c)
+	{
+		return c == L' ' || (c >= L'\t' && c <= L'\r') || c == 0x3000 || c == 0xA0;
+	}
+
+	inline std::wstring_view trim_blank(std::wstring_view s)
+	{
+		while (!s.empty() && is_blank(s.front()))
+			s.remove_prefix(1);
+		while (!s.empty() && is_blank(s.back()))
+			s.remove_suffix(1);
+		return s;
+	}
+}
+
+static ARG_INFO Args_ToText[] =
+{
+	{
+		/*name*/    "ֵ",
+		/*explain*/ ("תΪı˫С"),
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_DOUBLE,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_RECEIVE_ARRAY_DATA,
+	},
+	{
+		/*name*/    "ָ",
+		/*explain*/ ("ֵ֮ķָı,ΪʱʹðǶ"),
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_BIN,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_DEFAULT_VALUE_IS_EMPTY,
+	}
+};
+
+EXTERN_C void efn_number_array_to_text(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	size_t count = 0;
+	const auto pData = elibstl::get_array_element_inf<const double*>(pArgInf[0].m_pAryData, &count);
+	std::wstring_view sep = elibstl::args_to_wsdata(pArgInf, 1);
+	if (sep.empty())
+		sep = L",";
+
+	std::wstring ret;
+	ret.reserve(count * (12 + sep.size()));
+	wchar_t buf[elibstl::numtext::kMaxChars];
+	for (size_t i = 0; i < count; ++i)
+	{
+		if (i != 0)
+			ret.append(sep);
+		ret.append(buf, elibstl::numtext::format(pData[i], buf));
+	}
+	pRetData->m_pBin = elibstl::clone_textw(ret);
+}
+
+FucInfo Fn_number_array_to_text = { {
+		/*ccname*/  ("ֵ鵽ıW"),
+		/*egname*/  ("number_array_to_text"),
+		/*explain*/ ("˫СеĸֵתΪı÷ָ,CSVлJSONݡÿֵתΪܹԭصı(0.10.10000000000000001),ϵͳӰ졣"),
+		/*category*/2,
+		/*state*/   NULL,
+		/*ret*/     SDT_BIN,
+		/*reserved*/NULL,
+		/*level*/   LVL_HIGH,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		ESTLARG(Args_ToText)
+	} ,ESTLFNAME(efn_number_array_to_text) };
+
+static ARG_INFO Args_FromText[] =
+{
+	{
+		/*name*/    "ı",
+		/*explain*/ ("תıı\"[\"ͷ\"]\"βʱ(JSON)ȥ˵ķ"),
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_BIN,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_NONE,
+	},
+	{
+		/*name*/    "ָ",
+		/*explain*/ ("ֵ֮ķָı,ΪʱʹðǶšֵǰĿհַᱻ"),
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_BIN,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_DEFAULT_VALUE_IS_EMPTY,
+	},
+	{
+		/*name*/    "ʧ",
+		/*explain*/ ("Աʡԡṩʱд޷ת,Щ()ڷصΪ0"),
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_INT,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_RECEIVE_VAR | ArgMark::AS_DEFAULT_VALUE_IS_EMPTY,
+	}
+};
+
+EXTERN_C void efn_text_to_number_array(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	std::wstring_view text = trim_blank(elibstl::args_to_wsdata(pArgInf, 0));
+	std::wstring_view sep = elibstl::args_to_wsdata(pArgInf, 1);
+	if (sep.empty())
+		sep = L",";
+	if (text.size() >= 2 && text.front() == L'[' && text.back() == L']')
+		text = trim_blank(text.substr(1, text.size() - 2));
+
+	std::vector<double> ret;
+	INT failed = 0;
+	if (!text.empty())
+	{
+		size_t pos = 0;
+		for (;;)
+		{
+			const size_t next = text.find(sep, pos);
+			const auto field = trim_blank(text.substr(pos, next == std::wstring_view::npos ? std::wstring_view::npos : next - pos));
+			double value = 0;
+			const wchar_t* last = field.data() + field.size();
+			if (field.empty() || elibstl::numtext::parse(field.data(), last, value) != last)
+			{
+				value = 0;
+				++failed;
+			}
+			ret.push_back(value);
+			if (next == std::wstring_view::npos)
+				break;
+			pos = next + sep.size();
+		}
+	}
+	if (pArgInf[2].m_pInt)
+		*pArgInf[2].m_pInt = failed;
+	pRetData->m_pAryData = elibstl::create_array<double>(ret);
+}
+
+FucInfo Fn_text_to_number_array = { {
+		/*ccname*/  ("ıֵW"),
+		/*egname*/  ("text_to_number_array"),
+		/*explain*/ ("÷ָһֵı(CSVлJSON)תΪ˫С顣֧ͨдѧ(1.5e-3)Լinfnan,Ϊӽԭı˫С,ϵͳӰ졣"),
+		/*category*/2,
+		/*state*/   CT_RETRUN_ARY_TYPE_DATA,
+		/*ret*/     SDT_DOUBLE,
+		/*reserved*/NULL,
+		/*level*/   LVL_HIGH,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		ESTLARG(Args_FromText)
+	} ,ESTLFNAME(efn_text_to_number_array) };
@@ -0,0 +1,280 @@
+#include"ElibHelp.h"
+
+namespace {
+	/*ʽΪʱʹõĸʽ*/
+	constexpr wchar_t kDefaultFormat[] = L"%Y-%m-%d %H:%M:%S";
+
+	std::wstring_view arg_to_format(PMDATA_INF pArgInf, int index)
+	{
+		auto fmt = elibstl::args_to_wsdata(pArgInf, index);
+		return fmt.empty() ? std::wstring_view(kDefaultFormat) : fmt;
+	}
+
+	/*ֽڼеһԱ,ȥĩβĽ*/
+	std::wstring_view bin_to_wsview(LPBYTE pBin)
+	{
+		if (!pBin)
+			return {};
+		std::wstring_view text(reinterpret_cast<const wchar_t*>(pBin + sizeof(INT) * 2), reinterpret_cast<const INT*>(pBin)[1] / sizeof(wchar_t));
+		while (!text.empty() && text.back() == L'\0')
+			text.remove_suffix(1);
+		return text;
+	}
+}
+
+#define ESTL_DATE_FORMAT_EXPLAIN "ʽCԵstrftimeͬ,ϵͳӰ:%Y %yλ %m %d %e(0) %Hʱ %IʮСʱƵʱ %M %S %L %p(AM/PM) " \
+	"%jһеĵڼ %a/%AڵӢд/ȫ %b/%B·ݵӢд/ȫ %u(1Ϊһ) %w(0Ϊ) %V ISO %G ISO %F൱%Y-%m-%d %T൱%H:%M:%S %%Ϊ%,ַԭ" \
+	"Ϊʱʹ\"%Y-%m-%d %H:%M:%S\""
+
+static ARG_INFO Args_Format[] =
+{
+	{
+		/*name*/    "",
+		/*explain*/ ("ʽʱ"),
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_DATE_TIME,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_NONE,
+	},
+	{
+		/*name*/    "ʽ",
+		/*explain*/ (ESTL_DATE_FORMAT_EXPLAIN),
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_BIN,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_DEFAULT_VALUE_IS_EMPTY,
+	}
+};
+
+EXTERN_C void efn_format_date(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	std::wstring ret;
+	elibstl::datetime::format(pArgInf[0].m_date, arg_to_format(pArgInf, 1), ret);
+	pRetData->m_pBin = elibstl::clone_textw(ret);
+}
+
+FucInfo Fn_format_date = { {
+		/*ccname*/  ("ʽW"),
+		/*egname*/  ("format_date"),
+		/*explain*/ ("ָʽʱתΪı,ȷ롣Чʱؿı"),
+		/*category*/18,
+		/*state*/   NULL,
+		/*ret*/     SDT_BIN,
+		/*reserved*/NULL,
+		/*level*/   LVL_HIGH,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		ESTLARG(Args_Format)
+	} ,ESTLFNAME(efn_format_date) };
+
+static ARG_INFO Args_Parse[] =
+{
+	{
+		/*name*/    "ı",
+		/*explain*/ ("ȡʱı"),
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_BIN,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_NONE,
+	},
+	{
+		/*name*/    "ʽ",
+		/*explain*/ ("õĸʽͬ\"ʽW\",ֿԲ0,ʽеĿհƥհ,%p\"\"/\"\""
+			"ʽֻʱʱڲΪ18991230աΪʱʹ\"%Y-%m-%d %H:%M:%S\""),
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_BIN,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_DEFAULT_VALUE_IS_EMPTY,
+	},
+	{
+		/*name*/    "",
+		/*explain*/ ("ڽնȡʱı"),
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_DATE_TIME,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_RECEIVE_VAR,
+	}
+};
+
+EXTERN_C void efn_parse_date(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	DATE date = 0;
+	pRetData->m_bool = elibstl::datetime::parse(elibstl::args_to_wsdata(pArgInf, 0), arg_to_format(pArgInf, 1), date);
+	if (pRetData->m_bool)
+		*pArgInf[2].m_pDate = date;
+}
+
+FucInfo Fn_parse_date = { {
+		/*ccname*/  ("W"),
+		/*egname*/  ("parse_date"),
+		/*explain*/ ("ָʽıȡʱ䡣ı(βհ)ϸʽЧʱ,򷵻ؼҲ޸Ľ"),
+		/*category*/18,
+		/*state*/   NULL,
+		/*ret*/     SDT_BOOL,
+		/*reserved*/NULL,
+		/*level*/   LVL_HIGH,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		ESTLARG(Args_Parse)
+	} ,ESTLFNAME(efn_parse_date) };
+
+static ARG_INFO Args_IsoWeek[] =
+{
+	{
+		/*name*/    "",
+		/*explain*/ ("ȡ"),
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_DATE_TIME,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_NONE,
+	},
+	{
+		/*name*/    "",
+		/*explain*/ ("Աʡԡṩʱд,ĩļڵ"),
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_INT,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_RECEIVE_VAR | ArgMark::AS_DEFAULT_VALUE_IS_EMPTY,
+	}
+};
+
+EXTERN_C void efn_iso_week(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	int year = 0;
+	pRetData->m_int = elibstl::datetime::iso_week(pArgInf[0].m_date, &year);
+	if (pArgInf[1].m_pInt)
+		*pArgInf[1].m_pInt = year;
+}
+
+FucInfo Fn_iso_week = { {
+		/*ccname*/  ("ȡISOW"),
+		/*egname*/  ("iso_week"),
+		/*explain*/ ("ڰISO 8601(153)ÿܴһʼ,һĵһΪ1ܡЧʱ0"),
+		/*category*/18,
+		/*state*/   NULL,
+		/*ret*/     SDT_INT,
+		/*reserved*/NULL,
+		/*level*/   LVL_HIGH,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		ESTLARG(Args_IsoWeek)
+	} ,ESTLFNAME(efn_iso_week) };
+
+static ARG_INFO Args_FormatArray[] =
+{
+	{
+		/*name*/    "",
+		/*explain*/ ("ʽʱ"),
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_DATE_TIME,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_RECEIVE_ARRAY_DATA,
+	},
+	{
+		/*name*/    "ʽ",
+		/*explain*/ ("ͬ\"ʽW\"ĸʽ"),
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_BIN,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_DEFAULT_VALUE_IS_EMPTY,
+	}
+};
+
+EXTERN_C void efn_format_date_array(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	size_t count = 0;
+	const auto pData = elibstl::get_array_element_inf<const DATE*>(pArgInf[0].m_pAryData, &count);
+	const auto fmt = arg_to_format(pArgInf, 1);
+	std::vector<std::wstring> ret(count);
+	for (size_t i = 0; i < count; ++i)
+		elibstl::datetime::format(pData[i], fmt, ret[i]);
+	pRetData->m_pAryData = elibstl::create_text_array(ret);
+}
+
+FucInfo Fn_format_date_array = { {
+		/*ccname*/  ("鵽ıW"),
+		/*egname*/  ("format_date_array"),
+		/*explain*/ ("ͬһʽʱеÿԱתΪı,ı顣ЧڶӦı"),
+		/*category*/18,
+		/*state*/   CT_RETRUN_ARY_TYPE_DATA,
+		/*ret*/     SDT_BIN,
+		/*reserved*/NULL,
+		/*level*/   LVL_HIGH,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		ESTLARG(Args_FormatArray)
+	} ,ESTLFNAME(efn_format_date_array) };
+
+static ARG_INFO Args_ParseArray[] =
+{
+	{
+		/*name*/    "ı",
+		/*explain*/ ("ȡʱı"),
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_BIN,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_RECEIVE_ARRAY_DATA,
+	},
+	{
+		/*name*/    "ʽ",
+		/*explain*/ ("ͬ\"W\"ĸʽ"),
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_BIN,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_DEFAULT_VALUE_IS_EMPTY,
+	},
+	{
+		/*name*/    "ʧ",
+		/*explain*/ ("Աʡԡṩʱд޷ȡĳԱ,ЩԱڷصΪ0(18991230)"),
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_INT,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_RECEIVE_VAR | ArgMark::AS_DEFAULT_VALUE_IS_EMPTY,
+	}
+};
+
+EXTERN_C void efn_parse_date_array(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
+{
+	size_t count = 0;
+	const auto pData = elibstl::get_array_element_inf<LPBYTE*>(pArgInf[0].m_pAryData, &count);
+	const auto fmt = arg_to_format(pArgInf, 1);
+	std::vector<DATE> ret(count);
+	INT failed = 0;
+	for (size_t i = 0; i < count; ++i)
+	{
+		if (!elibstl::datetime::parse(bin_to_wsview(pData[i]), fmt, ret[i]))
+		{
+			ret[i] = 0;
+			++failed;
+		}
+	}
+	if (pArgInf[2].m_pInt)
+		*pArgInf[2].m_pInt = failed;
+	pRetData->m_pAryData = elibstl::create_array<DATE>(ret);
+}
+
+FucInfo Fn_parse_date_array = { {
+		/*ccname*/  ("ı鵽W"),
+		/*egname*/  ("parse_date_array"),
+		/*explain*/ ("ͬһʽıÿԱȡʱ,ʱ顣"),
+		/*category*/18,
+		/*state*/   CT_RETRUN_ARY_TYPE_DATA,
+		/*ret*/     SDT_DATE_TIME,
+		/*reserved*/NULL,
+		/*level*/   LVL_HIGH,
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		ESTLARG(Args_ParseArray)
+	} ,ESTLFNAME(efn_parse_date_array) };
@@ -1,39 +1,12 @@
 #include <fstream>  
 #include"ElibHelp.h"
+#include"Disk Processing/eplDirWalk.h"
 
+/*߳öٺɾ,ļܶĿ¼(绺Ŀ¼)ݹɾö*/
 static bool ClearFolder(const std::wstring& folderPath)
 {
-	std::wstring searchPath = folderPath + L"\\*.*";
-	WIN32_FIND_DATAW findData;
-	HANDLE hFind = FindFirstFileW(searchPath.c_str(), &findData);
-
-	if (hFind == INVALID_HANDLE_VALUE)
-	{
-		return false;
-	}
-	do
-	{
-		std::wstring currentPath = folderPath + L"\\" + findData.cFileName;
-
-		// ignore "." and ".."
-		if (wcscmp(findData.cFileName, L".") && wcscmp(findData.cFileName, L".."))
-		{
-			if (findData.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY)
-			{
-				// recursively clear subfolder
-				ClearFolder(currentPath);
-				RemoveDirectoryW(currentPath.c_str());
-			}
-			else
-			{
-				// delete file
-				DeleteFileW(currentPath.c_str());
-			}
-		}
-	} while (FindNextFileW(hFind, &findData));
-
-	FindClose(hFind);
-	return true;
+	elibstl::dirwalk::bulk_result result;
+	return elibstl::dirwalk::remove_tree(folderPath, {}, {}, true, true, result) && result.failed == 0;
 }
 
 
@@ -60,7 +33,7 @@ EXTERN_C void Fn_clear_folder_W(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF p
 FucInfo clear_folder_W = { {
 		/*ccname*/  ("Ŀ¼W"),
 		/*egname*/  (""),
-		/*explain*/ ("ָĿ¼еļգļϵͳļļе,ʹ֮ǰȷ˽Լڲʲôļ"),
+		/*explain*/ ("ָĿ¼еļգļϵͳļֻļļе,Ŀ¼ȫɾɹ,ɾʱԻɾؼ١Ŀ¼Ӻͷ,ֻɾӱʹ֮ǰȷ˽Լڲʲôļ"),
 		/*category*/4,
 		/*state*/   NULL,
 		/*ret*/     SDT_BOOL,
@@ -520,8 +520,15 @@ namespace elibstl {
 			__get_nowtm_to_oletm() {
 			SYSTEMTIME time;
 			GetLocalTime(&time);
+			elibstl::datetime::fields f;
+			f.year = time.wYear;
+			f.month = time.wMonth;
+			f.day = time.wDay;
+			f.hour = time.wHour;
+			f.minute = time.wMinute;
+			f.second = time.wSecond;
 			double pvtime{ 0.0 };
-			SystemTimeToVariantTime(&time, &pvtime);
+			elibstl::datetime::join(f, pvtime);
 			return pvtime;
 			/*auto now = std::chrono::system_clock::now();
 			auto time_t_now = std::chrono::system_clock::to_time_t(now);
@@ -1,5 +1,6 @@
 //#include <fstream>  
 #include"ElibHelp.h"
+#include"Disk Processing/eplFileIO.h"
 
 static ARG_INFO Args[] =
 {
@@ -83,33 +84,29 @@ static ARG_INFO WArgs[] =
 EXTERN_C void Fn_readfileW(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
 {
 	const std::wstring_view& filename = elibstl::args_to_wsdata(pArgInf, 0);
-	HANDLE hFile = CreateFile(filename.data(),
-		GENERIC_READ,
-		FILE_SHARE_READ | FILE_SHARE_WRITE,
-		NULL,
-		OPEN_EXISTING,
-		FILE_ATTRIBUTE_ARCHIVE,
-		0);
 	LPBYTE pData = NULL;
-
-	if (hFile != INVALID_HANDLE_VALUE)
+	std::uint64_t nRead = 0;
+	/*ֽڼINT,ļ*/
+	const bool bOk = elibstl::fileio::read_file(std::wstring(filename), INT_MAX - 2 * sizeof(INT),
+		[&pData](std::uint64_t nSize) -> unsigned char* {
+			pData = (LPBYTE)elibstl::ealloc(static_cast<INT>(nSize) + 2 * sizeof(INT));
+			*(LPINT)pData = 1;
+			return pData + 2 * sizeof(INT);
+		}, nRead);
+	if (!bOk && pData)
 	{
-
-		DWORD dwNumOfByteRead;
-		INT nLen = GetFileSize(hFile, &dwNumOfByteRead);
-		pData = (LPBYTE)elibstl::ealloc(nLen + 2 * sizeof(INT));
-		*(LPINT)pData = 1;
-		*(LPINT)(pData + sizeof(INT)) = nLen;
-		INT nRet = ReadFile(hFile, pData + 2 * sizeof(INT), nLen, &dwNumOfByteRead, 0);
-		CloseHandle(hFile);
+		elibstl::efree(pData);
+		pData = NULL;
 	}
+	if (pData)
+		*(LPINT)(pData + sizeof(INT)) = static_cast<INT>(nRead);
 	pRetData->m_pBin = pData;
 }
 
 FucInfo read_file_w = { {
 		/*ccname*/  ("ļW"),
 		/*egname*/  (""),
-		/*explain*/ ("ļԶƷʽڴ"),
+		/*explain*/ ("ļԶƷʽڴ,ֿȡ.ļڡȡʧܻ򳬹2GBʱؿֽڼ"),
 		/*category*/4,
 		/*state*/   NULL,
 		/*ret*/     SDT_BIN,
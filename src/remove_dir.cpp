@@ -1,12 +1,16 @@
 #include"ElibHelp.h"
+#include"Disk Processing/eplDirWalk.h"
 
-static bool remove_dir(const std::wstring& path) {
+static bool remove_dir(const std::wstring& path, bool recursive) {
 	if (path.empty())
 		return FALSE;
-	size_t nLen = path.size();
-	if (nLen == 0)//ֹɾǰĿ¼ĸĿ¼"\*"
-		return FALSE;
-	if (nLen == 1 && path == L"\\")//ֹɾǰĿ¼ĸĿ¼"\*"
+	if (recursive)
+	{
+		/*remove_treeܾĿ¼*/
+		elibstl::dirwalk::bulk_result result;
+		return elibstl::dirwalk::remove_tree(path, {}, {}, true, false, result) && result.failed == 0;
+	}
+	if (elibstl::dirwalk::is_root_dir(path))
 		return FALSE;
 	return RemoveDirectoryW(path.c_str());//ɾĿ¼
 }
@@ -21,6 +25,15 @@ static ARG_INFO Args[] =
 		/*type*/    SDT_BIN,
 		/*default*/ 0,
 		/*state*/   ArgMark::AS_NONE,
+	},
+	{
+		/*name*/    "ɾĿ¼",
+		/*explain*/ ("ԱʡԡΪʱͬĿ¼еļĿ¼һɾ,ΪʱֻɾĿ¼ĬΪ"),
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_BOOL,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_DEFAULT_VALUE_IS_EMPTY,
 	}
 };
 
@@ -28,13 +41,13 @@ static ARG_INFO Args[] =
 EXTERN_C void Fn_remove_dir_W(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
 {
 	auto filename = elibstl::args_to_wsdata(pArgInf, 0);
-	pRetData->m_bool = remove_dir(std::wstring(filename));
+	pRetData->m_bool = remove_dir(std::wstring(filename), elibstl::args_to_data<BOOL>(pArgInf, 1).value_or(FALSE) != FALSE);
 }
 
 FucInfo remove_dir_W = { {
 		/*ccname*/  ("ɾĿ¼W"),
 		/*egname*/  ("remove_dirW"),
-		/*explain*/ ("ɾָĿ¼ɹ棬ʧܷؼ١"),
+		/*explain*/ ("ɾָĿ¼ɹ棬ʧܷؼ١ɾĿ¼ʱ߳ɾ,ɾʱԻɾؼ١"),
 		/*category*/4,
 		/*state*/   NULL,
 		/*ret*/     SDT_BOOL,
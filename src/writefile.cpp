@@ -1,6 +1,7 @@
 #pragma warning(disable:4996)
 #include <fstream>  
 #include"ElibHelp.h"
+#include"Disk Processing/eplFileIO.h"
 
 static ARG_INFO Args[] =
 {
@@ -90,6 +91,24 @@ static ARG_INFO WArgs[] =
 		/*type*/    SDT_BIN,
 		/*default*/ 0,
 		/*state*/   ArgMark::AS_NONE,
+	},
+	{
+		/*name*/    "дʽ",
+		/*explain*/ ("0ΪֱӸԭļ;1Ϊȫ滻,дͬĿ¼ʱļˢµٸ,;ʧܻϵʱԭļֲ;2Ϊ׷ӵļβ,ļʱ.ĬΪ0"),
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_INT,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_DEFAULT_VALUE_IS_EMPTY,
+	},
+	{
+		/*name*/    "Ԥߴ",
+		/*explain*/ ("ݳʱΪļôռд,д갴ʵʳȽض,ɼٴļƬ.׷ӷʽº"),
+		/*bmp inx*/ 0,
+		/*bmp num*/ 0,
+		/*type*/    SDT_INT64,
+		/*default*/ 0,
+		/*state*/   ArgMark::AS_DEFAULT_VALUE_IS_EMPTY,
 	}
 
 };
@@ -98,20 +117,24 @@ static ARG_INFO WArgs[] =
 EXTERN_C void Fn_writefileW(PMDATA_INF pRetData, INT nArgCount, PMDATA_INF pArgInf)
 {
 	const std::wstring_view& filename = elibstl::args_to_wsdata(pArgInf, 0);
-	//std::vector<unsigned char> data = ebin2v(pArgInf->m_pBin);
 	if (filename.empty() || pArgInf[1].m_pBin == nullptr || *reinterpret_cast<DWORD*>(pArgInf[1].m_pBin + sizeof(DWORD)) == 0) {
 		pRetData->m_bool = false;
 		return;
 	}
-
-	FILE* out = _wfopen(std::wstring(filename).c_str(), L"wb");
-	if (out == NULL) {
+	const INT nMode = elibstl::args_to_data<INT>(pArgInf, 2).value_or(0);
+	const INT64 nPrealloc = pArgInf[3].m_dtDataType == _SDT_NULL ? 0 : pArgInf[3].m_int64;
+	elibstl::fileio::write_mode mode;
+	switch (nMode)
+	{
+	case 0: mode = elibstl::fileio::write_mode::overwrite; break;
+	case 1: mode = elibstl::fileio::write_mode::atomic; break;
+	case 2: mode = elibstl::fileio::write_mode::append; break;
+	default:
 		pRetData->m_bool = false;
 		return;
 	}
-	const bool blpSucceeded = (fwrite(pArgInf[1].m_pBin + sizeof(DWORD) * 2, 1, *reinterpret_cast<DWORD*>(pArgInf[1].m_pBin + sizeof(DWORD)), out) == *reinterpret_cast<DWORD*>(pArgInf[1].m_pBin + sizeof(DWORD)));
-	fclose(out);
-	pRetData->m_bool = blpSucceeded;
+	pRetData->m_bool = elibstl::fileio::write_file(std::wstring(filename), pArgInf[1].m_pBin + sizeof(DWORD) * 2,
+		*reinterpret_cast<DWORD*>(pArgInf[1].m_pBin + sizeof(DWORD)), mode, nPrealloc > 0 ? static_cast<std::uint64_t>(nPrealloc) : 0);
 }
 
 FucInfo write_file_w = { {
@@ -125,6 +148,6 @@ FucInfo write_file_w = { {
 		/*level*/   LVL_HIGH,
 		/*bmp inx*/ 0,
 		/*bmp num*/ 0,
-		/*ArgCount*/2,
+		/*ArgCount*/4,
 		/*arg lp*/  &WArgs[0],
 	} ,Fn_writefileW ,"Fn_writefileW" };
@@ -1,5 +1,12 @@
 #pragma once
 #include "zlib.h"
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <algorithm>
+#include <string.h>
 class Czlib
 {
 private:
@@ -125,3 +132,691 @@ public:
     }
 };
 
+// ʽѹ/ѹݸʽ
+enum CZLIB_FORMAT
+{
+    CZLIB_FORMAT_AUTO = 0,  // ѹ, ͷԶʶzlibgzip
+    CZLIB_FORMAT_RAW  = 1,  // ͷУԭʼdeflate
+    CZLIB_FORMAT_ZLIB = 2,  // zlibͷ + adler32У
+    CZLIB_FORMAT_GZIP = 3,  // gzipͷ + crc32У, .gzļ
+};
+
+// ʽ, ȷ, ɵ pull() ȡ
+class CzlibOutput
+{
+protected:
+    enum { CHUNK = 64 * 1024 };
+    std::vector<Bytef> out;     // 
+    size_t outPos;              // out ѱȡߵλ
+
+    CzlibOutput() : outPos(0) {}
+
+    // ĩβԤ CHUNK ֽڸ z_stream д
+    void prepare(z_stream& strm)
+    {
+        if (outPos == out.size())
+        {
+            out.clear();
+            outPos = 0;
+        }
+        else if (outPos > out.size() / 2)   // ȡߵĲֹ, ÿζ
+        {
+            out.erase(out.begin(), out.begin() + outPos);
+            outPos = 0;
+        }
+        const size_t have = out.size();
+        out.resize(have + CHUNK);
+        strm.next_out = out.data() + have;
+        strm.avail_out = CHUNK;
+    }
+    // ȥԤûдĲ
+    void commit(const z_stream& strm)
+    {
+        out.resize(out.size() - strm.avail_out);
+    }
+public:
+    // δȡߵֽ
+    uLong pending() const
+    {
+        return (uLong)(out.size() - outPos);
+    }
+
+    // ȡ size ֽڵ, ʵȡֽ
+    uLong pull(void* buf, uLong size)
+    {
+        uLong n = pending();
+        if (n > size) n = size;
+        if (n)
+        {
+            memcpy(buf, out.data() + outPos, n);
+            outPos += n;
+        }
+        return n;
+    }
+
+    // δȡߵ
+    void discard()
+    {
+        out.clear();
+        outPos = 0;
+    }
+};
+
+// ʽѹ, ݿԷֶ push,  finish(), ڼʱ pull() ȡѲѹ
+// z_stream  reset() ɸ, Ҫ·ڲ
+class CzlibDeflate : public CzlibOutput
+{
+private:
+    z_stream strm;
+    int err;
+    bool inited;
+    bool finished;
+    int level, format, windowBits, memLevel;
+
+    bool run(const void* data, uLong size, int flush)
+    {
+        if (!inited || finished)
+        {
+            err = Z_STREAM_ERROR;
+            return false;
+        }
+        strm.next_in = (Bytef*)data;
+        strm.avail_in = data ? size : 0;
+        do
+        {
+            prepare(strm);
+            err = ::deflate(&strm, flush);
+            commit(strm);
+            if (err == Z_STREAM_ERROR)
+                return false;
+        } while (strm.avail_out == 0 || strm.avail_in != 0);
+        if (err == Z_BUF_ERROR)     // ûݿɴ, 
+            err = Z_OK;
+        if (flush == Z_FINISH)
+            finished = true;
+        return true;
+    }
+public:
+    CzlibDeflate() : err(0), inited(false), finished(false), level(Z_DEFAULT_COMPRESSION), format(CZLIB_FORMAT_ZLIB), windowBits(MAX_WBITS), memLevel(8)
+    {
+        memset(&strm, 0, sizeof(strm));
+    }
+    CzlibDeflate(const CzlibDeflate& other) : CzlibOutput(other), err(other.err), inited(false), finished(other.finished),
+        level(other.level), format(other.format), windowBits(other.windowBits), memLevel(other.memLevel)
+    {
+        memset(&strm, 0, sizeof(strm));
+        if (other.inited)
+            inited = ::deflateCopy(&strm, const_cast<z_streamp>(&other.strm)) == Z_OK;
+    }
+    CzlibDeflate& operator=(const CzlibDeflate&) = delete;
+    ~CzlibDeflate()
+    {
+        end();
+    }
+
+    // ʼѹ, ϴͬʱֻ״̬
+    // level = ѹ, 0-9, Z_DEFAULT_COMPRESSION Ϊ 6
+    // format = CZLIB_FORMAT_RAW/ZLIB/GZIP
+    // windowBits = ڴС, 9-15, ԽѹԽ, ѹʱʹòСڴֵĴ
+    // memLevel = ڲ״̬ʹõڴ, 1-9
+    bool init(int level = Z_DEFAULT_COMPRESSION, int format = CZLIB_FORMAT_ZLIB, int windowBits = MAX_WBITS, int memLevel = 8)
+    {
+        if (format < CZLIB_FORMAT_RAW || format > CZLIB_FORMAT_GZIP)
+        {
+            err = Z_STREAM_ERROR;
+            return false;
+        }
+        if (inited && level == this->level && format == this->format && windowBits == this->windowBits && memLevel == this->memLevel)
+            return reset();
+        // ѳʼʱȶδȡߵ, ͷžɵ z_stream ״̬
+        if (inited)
+            discard();
+        end();
+        int bits = windowBits;
+        if (format == CZLIB_FORMAT_RAW)
+            bits = -windowBits;
+        else if (format == CZLIB_FORMAT_GZIP)
+            bits = windowBits + 16;
+        err = ::deflateInit2(&strm, level, Z_DEFLATED, bits, memLevel, Z_DEFAULT_STRATEGY);
+        if (err != Z_OK)
+            return false;
+        inited = true;
+        finished = false;
+        this->level = level;
+        this->format = format;
+        this->windowBits = windowBits;
+        this->memLevel = memLevel;
+        return true;
+    }
+
+    // ѹ, ѹ pull() ȡ
+    bool push(const void* data, uLong size)
+    {
+        return run(data, size, Z_NO_FLUSH);
+    }
+
+    // Ѽȫ, Էѹ, ΢ѹ
+    bool flush()
+    {
+        return run(0, 0, Z_SYNC_FLUSH);
+    }
+
+    // һݲѹ, ֮Ҫ reset() ܿʼµѹ
+    bool finish(const void* data = 0, uLong size = 0)
+    {
+        return run(data, size, Z_FINISH);
+    }
+
+    // Ϊʼ״̬, ѷڴ, δȡߵ
+    bool reset()
+    {
+        discard();
+        if (!inited)
+            return init(level, format, windowBits, memLevel);
+        err = ::deflateReset(&strm);
+        finished = false;
+        return err == Z_OK;
+    }
+
+    void end()
+    {
+        if (inited)
+            ::deflateEnd(&strm);
+        inited = false;
+        finished = false;
+    }
+
+    bool isFinished() const { return finished; }
+    uLong totalIn() const { return strm.total_in; }
+    uLong totalOut() const { return strm.total_out; }
+    int GetError()const { return err; }
+};
+
+// ʽѹ, ѹݿԷֶ push, ѹ pull() ȡ
+// gzip ʽ(Զʶ gzip)ʱֶ֧Աβӵļ,  gzip -d Ϊһ
+class CzlibInflate : public CzlibOutput
+{
+private:
+    z_stream strm;
+    int err;
+    bool inited;
+    bool finished;
+    int format, windowBits;
+
+    // ѹʣǷΪһgzipԱ, ǵĵβ
+    bool nextMember() const
+    {
+        if (format == CZLIB_FORMAT_RAW || format == CZLIB_FORMAT_ZLIB)
+            return false;
+        return strm.avail_in >= 2 && strm.next_in[0] == 0x1f && strm.next_in[1] == 0x8b;
+    }
+public:
+    CzlibInflate() : err(0), inited(false), finished(false), format(CZLIB_FORMAT_AUTO), windowBits(MAX_WBITS)
+    {
+        memset(&strm, 0, sizeof(strm));
+    }
+    CzlibInflate(const CzlibInflate& other) : CzlibOutput(other), err(other.err), inited(false), finished(other.finished),
+        format(other.format), windowBits(other.windowBits)
+    {
+        memset(&strm, 0, sizeof(strm));
+        if (other.inited)
+            inited = ::inflateCopy(&strm, const_cast<z_streamp>(&other.strm)) == Z_OK;
+    }
+    CzlibInflate& operator=(const CzlibInflate&) = delete;
+    ~CzlibInflate()
+    {
+        end();
+    }
+
+    // ʼѹ, ϴͬʱֻ״̬
+    // format = CZLIB_FORMAT_AUTO/RAW/ZLIB/GZIP
+    // windowBits = ڴС, 8-15, 費Сѹʱʹõֵ
+    bool init(int format = CZLIB_FORMAT_AUTO, int windowBits = MAX_WBITS)
+    {
+        if (format < CZLIB_FORMAT_AUTO || format > CZLIB_FORMAT_GZIP)
+        {
+            err = Z_STREAM_ERROR;
+            return false;
+        }
+        if (inited && format == this->format && windowBits == this->windowBits)
+            return reset();
+        // ѳʼʱȶδȡߵ, ͷžɵ z_stream ״̬
+        if (inited)
+            discard();
+        end();
+        int bits = windowBits;
+        if (format == CZLIB_FORMAT_AUTO)
+            bits = windowBits + 32;
+        else if (format == CZLIB_FORMAT_RAW)
+            bits = -windowBits;
+        else if (format == CZLIB_FORMAT_GZIP)
+            bits = windowBits + 16;
+        err = ::inflateInit2(&strm, bits);
+        if (err != Z_OK)
+            return false;
+        inited = true;
+        finished = false;
+        this->format = format;
+        this->windowBits = windowBits;
+        return true;
+    }
+
+    // ѹ, ʱfalse
+    bool push(const void* data, uLong size)
+    {
+        if (!inited)
+        {
+            err = Z_STREAM_ERROR;
+            return false;
+        }
+        if (!data || !size)
+            return true;
+        strm.next_in = (Bytef*)data;
+        strm.avail_in = size;
+        if (finished)
+        {
+            if (!nextMember())
+                return true;
+            ::inflateReset(&strm);
+            finished = false;
+        }
+        for (;;)
+        {
+            prepare(strm);
+            err = ::inflate(&strm, Z_NO_FLUSH);
+            commit(strm);
+            if (err == Z_STREAM_END)
+            {
+                finished = true;
+                err = Z_OK;
+                if (!nextMember())
+                    break;
+                ::inflateReset(&strm);
+                finished = false;
+                continue;
+            }
+            if (err == Z_BUF_ERROR && strm.avail_out != 0)  // , ȴ
+            {
+                err = Z_OK;
+                break;
+            }
+            if (err != Z_OK && err != Z_BUF_ERROR)
+            {
+                if (err == Z_NEED_DICT)
+                    err = Z_DATA_ERROR;
+                return false;
+            }
+            if (strm.avail_in == 0 && strm.avail_out != 0)
+                break;
+        }
+        return true;
+    }
+
+    // Ϊʼ״̬, ѷڴ, δȡߵ
+    bool reset()
+    {
+        discard();
+        if (!inited)
+            return init(format, windowBits);
+        err = ::inflateReset(&strm);
+        finished = false;
+        return err == Z_OK;
+    }
+
+    void end()
+    {
+        if (inited)
+            ::inflateEnd(&strm);
+        inited = false;
+        finished = false;
+    }
+
+    // ѹǷ, ȫΪfalse˵ݲ
+    bool isFinished() const { return finished; }
+    uLong totalIn() const { return strm.total_in; }
+    uLong totalOut() const { return strm.total_out; }
+    int GetError()const { return err; }
+};
+
+// ߳ѹ(pigzͬ), Ϊ׼ raw/zlib/gzip , ͨzlibɽѹ
+// г blockSize СĿ, ÿǰһĩβ32KΪԤֵѹ, ֮ Z_SYNC_FLUSH 뵽ֽںֱƴ
+// Уֵɸ crc32/adler32  crc32_combine/adler32_combine ϲ, ֻСй, ߳޹
+// ڴռԼΪ ߳ * С * 2, ܳ޹
+class CzlibParallelDeflate : public CzlibOutput
+{
+private:
+    enum { DICT_SIZE = 32 * 1024 };
+
+    struct Job
+    {
+        const Bytef* data;
+        uLong size;
+        const Bytef* dict;
+        uInt dictSize;
+        bool last;
+        std::vector<Bytef> out;
+        uLong check;
+        bool ok;
+    };
+
+    std::vector<z_stream> streams;  // ÿ߳һ, ڸ֮临
+    std::vector<Bytef> in;          // [һĩβֵ | δѹ]
+    size_t dictLen;                 // in ͷֵֽ
+    std::vector<Job> jobs;
+    uLong check;                    // ѹݵ crc32  adler32
+    unsigned long long total;       // ѹݵܳ
+    int err;
+    bool inited;
+    bool started;                   // Ƿͷ
+    bool finished;
+    int level, format;
+    unsigned threads;
+    uLong blockSize;
+
+    // פĹ߳, ߳һÿһĿ; ߳ i ʹ streams[i], ߳ʹ streams[0]
+    std::vector<std::thread> pool;
+    std::mutex poolMutex;
+    std::condition_variable poolWake, poolDone;
+    unsigned long long poolRound;   // ÿʼһһ, ߳̾ݴ֪µһ
+    unsigned poolBusy;              // δĹ߳
+    bool poolStop;
+    size_t jobCount;
+    std::atomic<size_t> nextJob;
+
+    void runJobs(unsigned slot)
+    {
+        for (size_t i = nextJob++; i < jobCount; i = nextJob++)
+            deflateJob(streams[slot], jobs[i]);
+    }
+
+    void poolMain(unsigned slot)
+    {
+        unsigned long long seen = 0;
+        std::unique_lock<std::mutex> lock(poolMutex);
+        for (;;)
+        {
+            poolWake.wait(lock, [&] { return poolStop || poolRound != seen; });
+            if (poolStop)
+                return;
+            seen = poolRound;
+            lock.unlock();
+            runJobs(slot);
+            lock.lock();
+            if (--poolBusy == 0)
+                poolDone.notify_one();
+        }
+    }
+
+    void startPool()
+    {
+        poolStop = false;
+        poolRound = 0;
+        for (unsigned t = 1; t < threads; t++)
+            pool.emplace_back(&CzlibParallelDeflate::poolMain, this, t);
+    }
+
+    void stopPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(poolMutex);
+            poolStop = true;
+        }
+        poolWake.notify_all();
+        for (auto& t : pool)
+            t.join();
+        pool.clear();
+    }
+
+    // ѹ jobs ǰ count , ʱȫ
+    void runBatch(size_t count)
+    {
+        jobCount = count;
+        nextJob = 0;
+        if (count > 1 && !pool.empty())
+        {
+            {
+                std::lock_guard<std::mutex> lock(poolMutex);
+                poolBusy = (unsigned)pool.size();
+                poolRound++;
+            }
+            poolWake.notify_all();
+            runJobs(0);
+            std::unique_lock<std::mutex> lock(poolMutex);
+            poolDone.wait(lock, [&] { return poolBusy == 0; });
+        }
+        else
+        {
+            runJobs(0);
+        }
+    }
+
+    void deflateJob(z_stream& strm, Job& job)
+    {
+        job.ok = false;
+        if (::deflateReset(&strm) != Z_OK)
+            return;
+        if (job.dictSize && ::deflateSetDictionary(&strm, job.dict, job.dictSize) != Z_OK)
+            return;
+        job.check = format == CZLIB_FORMAT_GZIP ? ::crc32(0, job.data, job.size) : ::adler32(1, job.data, job.size);
+        // Z_SYNC_FLUSH  5 ֽڵĿմ洢, һЩ
+        job.out.resize(::deflateBound(&strm, job.size) + 16);
+        strm.next_in = (Bytef*)job.data;
+        strm.avail_in = job.size;
+        strm.next_out = job.out.data();
+        strm.avail_out = (uInt)job.out.size();
+        const int flush = job.last ? Z_FINISH : Z_SYNC_FLUSH;
+        for (;;)
+        {
+            const int ret = ::deflate(&strm, flush);
+            if (ret == Z_STREAM_ERROR)
+                return;
+            if (strm.avail_out != 0)
+                break;
+            // ϲᷢ, Էһ󻺳
+            const size_t have = job.out.size();
+            job.out.resize(have * 2);
+            strm.next_out = job.out.data() + have;
+            strm.avail_out = (uInt)(job.out.size() - have);
+        }
+        job.out.resize(job.out.size() - strm.avail_out);
+        job.ok = true;
+    }
+
+    void writeHeader()
+    {
+        if (format == CZLIB_FORMAT_GZIP)
+        {
+            // ļʱ, XFL ע, OS 뱾 zlib  OS_CODE һ
+            const Bytef header[10] = { 0x1f, 0x8b, 8, 0, 0, 0, 0, 0, (Bytef)(level == 9 ? 2 : level == 1 ? 4 : 0), 10 };
+            out.insert(out.end(), header, header + sizeof(header));
+        }
+        else if (format == CZLIB_FORMAT_ZLIB)
+        {
+            const int flevel = (level >= 0 && level < 2) ? 0 : (level >= 2 && level < 6) ? 1 : (level == 6 || level == Z_DEFAULT_COMPRESSION) ? 2 : 3;
+            const int head = (0x78 << 8) | (flevel << 6);
+            out.push_back(0x78);
+            out.push_back((Bytef)((head + 31 - head % 31) & 0xff));
+        }
+        started = true;
+    }
+
+    void writeTrailer()
+    {
+        if (format == CZLIB_FORMAT_GZIP)
+        {
+            const uLong isize = (uLong)(total & 0xffffffff);
+            for (int i = 0; i < 4; i++)
+                out.push_back((Bytef)(check >> (i * 8)));
+            for (int i = 0; i < 4; i++)
+                out.push_back((Bytef)(isize >> (i * 8)));
+        }
+        else if (format == CZLIB_FORMAT_ZLIB)
+        {
+            for (int i = 3; i >= 0; i--)
+                out.push_back((Bytef)(check >> (i * 8)));
+        }
+    }
+
+    // ѹ in ֵ֮, last Ϊʱȫѹ, ֻѹĿ
+    bool compressBatch(bool last)
+    {
+        const Bytef* base = in.data() + dictLen;
+        const size_t avail = in.size() - dictLen;
+        size_t count = last ? (avail + blockSize - 1) / blockSize : avail / blockSize;
+        if (last && count == 0)
+            count = 1;  // ҲҪһ
+        if (count == 0)
+            return true;
+        jobs.resize(count);
+        for (size_t i = 0; i < count; i++)
+        {
+            Job& job = jobs[i];
+            job.data = base + i * blockSize;
+            job.size = (uLong)((std::min)((size_t)blockSize, avail - i * blockSize));
+            const Bytef* dictEnd = job.data;
+            const size_t dictAvail = (size_t)(dictEnd - in.data());
+            job.dictSize = (uInt)((std::min)(dictAvail, (size_t)DICT_SIZE));
+            job.dict = dictEnd - job.dictSize;
+            job.last = last && i + 1 == count;
+        }
+        runBatch(count);
+
+        if (!started)
+            writeHeader();
+        for (size_t i = 0; i < count; i++)
+        {
+            Job& job = jobs[i];
+            if (!job.ok)
+            {
+                err = Z_STREAM_ERROR;
+                return false;
+            }
+            out.insert(out.end(), job.out.begin(), job.out.end());
+            check = format == CZLIB_FORMAT_GZIP ? ::crc32_combine(check, job.check, (z_off_t)job.size) : ::adler32_combine(check, job.check, (z_off_t)job.size);
+            total += job.size;
+            std::vector<Bytef>().swap(job.out);
+        }
+        // 32KΪһֵ, ඪ
+        const size_t used = dictLen + (size_t)(jobs[count - 1].data - base) + jobs[count - 1].size;
+        const size_t keep = (std::min)(used, (size_t)DICT_SIZE);
+        in.erase(in.begin(), in.begin() + (used - keep));
+        dictLen = keep;
+        if (last)
+        {
+            writeTrailer();
+            finished = true;
+        }
+        return true;
+    }
+
+    void freeStreams()
+    {
+        for (auto& strm : streams)
+            ::deflateEnd(&strm);
+        streams.clear();
+    }
+public:
+    CzlibParallelDeflate() : dictLen(0), check(0), total(0), err(0), inited(false), started(false), finished(false),
+        level(Z_DEFAULT_COMPRESSION), format(CZLIB_FORMAT_GZIP), threads(1), blockSize(128 * 1024),
+        poolRound(0), poolBusy(0), poolStop(false), jobCount(0), nextJob(0)
+    {
+    }
+    CzlibParallelDeflate(const CzlibParallelDeflate&) = delete;
+    CzlibParallelDeflate& operator=(const CzlibParallelDeflate&) = delete;
+    ~CzlibParallelDeflate()
+    {
+        stopPool();
+        freeStreams();
+    }
+
+    // level = ѹ, 0-9, Z_DEFAULT_COMPRESSION Ϊ 6
+    // format = CZLIB_FORMAT_RAW/ZLIB/GZIP
+    // threads = ߳, 0 ΪCPU
+    // blockSize = С, С32K, ԽСжԽߵѹԽ
+    bool init(int level = Z_DEFAULT_COMPRESSION, int format = CZLIB_FORMAT_GZIP, unsigned threads = 0, uLong blockSize = 128 * 1024)
+    {
+        if (format < CZLIB_FORMAT_RAW || format > CZLIB_FORMAT_GZIP || blockSize < DICT_SIZE)
+        {
+            err = Z_STREAM_ERROR;
+            return false;
+        }
+        if (threads == 0)
+            threads = (std::max)(1u, std::thread::hardware_concurrency());
+        stopPool();
+        freeStreams();
+        streams.resize(threads);
+        for (auto& strm : streams)
+        {
+            memset(&strm, 0, sizeof(strm));
+            err = ::deflateInit2(&strm, level, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY);
+            if (err != Z_OK)
+            {
+                streams.pop_back();     // һʼʧ, Ҫ deflateEnd
+                freeStreams();
+                inited = false;
+                return false;
+            }
+        }
+        this->level = level;
+        this->format = format;
+        this->threads = threads;
+        this->blockSize = blockSize;
+        startPool();
+        inited = true;
+        return reset();
+    }
+
+    // , ܹ ߳ һкʱѹһ, ѹ pull() ȡ
+    // һҪȵкݻ finish() ʱѹ, һǴ, ߳޹
+    bool push(const void* data, uLong size)
+    {
+        if (!inited || finished)
+        {
+            err = Z_STREAM_ERROR;
+            return false;
+        }
+        const Bytef* p = (const Bytef*)data;
+        const size_t batch = (size_t)threads * blockSize;
+        while (data && size)
+        {
+            if (in.size() - dictLen == batch && !compressBatch(false))
+                return false;
+            const size_t room = dictLen + batch - in.size();
+            const size_t n = (std::min)((size_t)size, room);
+            in.insert(in.end(), p, p + n);
+            p += n;
+            size -= (uLong)n;
+        }
+        return true;
+    }
+
+    // ѹʣݲдУβ, ֮Ҫ reset() ܿʼµѹ
+    bool finish(const void* data = 0, uLong size = 0)
+    {
+        if (!push(data, size))
+            return false;
+        return compressBatch(true);
+    }
+
+    // Ϊʼ״̬, ͸̵߳ z_stream, δȡߵ
+    bool reset()
+    {
+        if (!inited)
+        {
+            err = Z_STREAM_ERROR;
+            return false;
+        }
+        discard();
+        in.clear();
+        dictLen = 0;
+        check = format == CZLIB_FORMAT_GZIP ? ::crc32(0, Z_NULL, 0) : ::adler32(0, Z_NULL, 0);
+        total = 0;
+        started = false;
+        finished = false;
+        err = Z_OK;
+        return true;
+    }
+
+    bool isFinished() const { return finished; }
+    int GetError()const { return err; }
+};